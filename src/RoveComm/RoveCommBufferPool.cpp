@@ -0,0 +1,172 @@
+/******************************************************************************
+ * @brief RoveComm Buffer Pool Implementation.
+ *
+ * @file RoveCommBufferPool.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommBufferPool.h"
+
+/// \cond
+#include <utility>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Construct an empty buffer handle that does not belong to a pool.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommBufferPool::Buffer::Buffer() : m_pPool(nullptr) {}
+
+    /******************************************************************************
+     * @brief Construct a new buffer handle.
+     *
+     * @param pPool - The pool the buffer is returned to, or nullptr to free it.
+     * @param vBytes - The buffer's storage.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommBufferPool::Buffer::Buffer(RoveCommBufferPool* pPool, std::vector<uint8_t>&& vBytes) : m_pPool(pPool), m_vBytes(std::move(vBytes)) {}
+
+    /******************************************************************************
+     * @brief Move a buffer handle. The moved-from handle no longer owns a buffer.
+     *
+     * @param stOther - The handle to move from.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommBufferPool::Buffer::Buffer(Buffer&& stOther) noexcept : m_pPool(stOther.m_pPool), m_vBytes(std::move(stOther.m_vBytes))
+    {
+        stOther.m_pPool = nullptr;
+    }
+
+    /******************************************************************************
+     * @brief Move-assign a buffer handle, returning the currently owned buffer to
+     *        its pool first.
+     *
+     * @param stOther - The handle to move from.
+     * @return Buffer& - This handle.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommBufferPool::Buffer& RoveCommBufferPool::Buffer::operator=(Buffer&& stOther) noexcept
+    {
+        if (this != &stOther)
+        {
+            if (m_pPool != nullptr)
+            {
+                m_pPool->Release(std::move(m_vBytes));
+            }
+            m_pPool         = stOther.m_pPool;
+            m_vBytes        = std::move(stOther.m_vBytes);
+            stOther.m_pPool = nullptr;
+        }
+        return *this;
+    }
+
+    /******************************************************************************
+     * @brief Destroy the buffer handle, returning the buffer to its pool.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommBufferPool::Buffer::~Buffer()
+    {
+        if (m_pPool != nullptr)
+        {
+            m_pPool->Release(std::move(m_vBytes));
+        }
+    }
+
+    /******************************************************************************
+     * @brief Construct a new buffer pool.
+     *
+     * @param siMaxFreeBuffers - The maximum number of idle buffers to keep. Extra
+     *                           buffers are freed when they are returned.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommBufferPool::RoveCommBufferPool(size_t siMaxFreeBuffers) : m_siMaxFreeBuffers(siMaxFreeBuffers)
+    {
+        m_vFreeBuffers.reserve(siMaxFreeBuffers);
+    }
+
+    /******************************************************************************
+     * @brief Acquire a buffer of exactly siSize bytes. The contents are not
+     *        cleared.
+     *
+     * @param siSize - The number of bytes needed.
+     * @return Buffer - A handle to the buffer.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommBufferPool::Buffer RoveCommBufferPool::Acquire(size_t siSize)
+    {
+        std::vector<uint8_t> vBytes;
+        {
+            // Acquire a lock to protect the free list.
+            std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+            if (!m_vFreeBuffers.empty())
+            {
+                vBytes = std::move(m_vFreeBuffers.back());
+                m_vFreeBuffers.pop_back();
+            }
+        }
+
+        vBytes.resize(siSize);
+        return Buffer(this, std::move(vBytes));
+    }
+
+    /******************************************************************************
+     * @brief Get the number of idle buffers in the pool.
+     *
+     * @return size_t - The number of idle buffers.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommBufferPool::GetFreeBufferCount()
+    {
+        // Acquire a lock to protect the free list.
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        return m_vFreeBuffers.size();
+    }
+
+    /******************************************************************************
+     * @brief Return a buffer to the free list, or free it if the pool is full.
+     *
+     * @param vBytes - The buffer to return.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommBufferPool::Release(std::vector<uint8_t>&& vBytes)
+    {
+        // Acquire a lock to protect the free list.
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        if (m_vFreeBuffers.size() < m_siMaxFreeBuffers)
+        {
+            m_vFreeBuffers.push_back(std::move(vBytes));
+        }
+    }
+}    // namespace rovecomm
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * @brief The RoveCommBufferPool class hands out reusable byte buffers so that
+ *        packets can be packed and received without allocating memory for
+ *        every packet.
+ *
+ * @file RoveCommBufferPool.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_BUFFER_POOL_H
+#define ROVECOMM_BUFFER_POOL_H
+
+/// \cond
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief The RoveCommBufferPool class keeps a free list of byte buffers. A
+     *        buffer is acquired with the size that is actually needed, and is
+     *        returned to the pool when its handle goes out of scope. Buffers keep
+     *        their capacity, so once the pool is warm, acquiring a buffer does not
+     *        allocate.
+     *
+     * @note The pool must outlive every buffer acquired from it.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommBufferPool
+    {
+        public:
+            /******************************************************************************
+             * @brief A move-only handle to a pooled buffer. The buffer is returned to
+             *        its pool when the handle is destroyed.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            class Buffer
+            {
+                private:
+                    // Private member variables
+                    RoveCommBufferPool* m_pPool;
+                    std::vector<uint8_t> m_vBytes;
+
+                public:
+                    Buffer();
+                    Buffer(RoveCommBufferPool* pPool, std::vector<uint8_t>&& vBytes);
+                    Buffer(Buffer&& stOther) noexcept;
+                    Buffer& operator=(Buffer&& stOther) noexcept;
+                    Buffer(const Buffer&)            = delete;
+                    Buffer& operator=(const Buffer&) = delete;
+                    ~Buffer();
+
+                    uint8_t* data() { return m_vBytes.data(); }
+
+                    const uint8_t* data() const { return m_vBytes.data(); }
+
+                    size_t size() const { return m_vBytes.size(); }
+
+                    void Resize(size_t siSize) { m_vBytes.resize(siSize); }
+            };
+
+        private:
+            // Private member variables
+            std::mutex m_muPoolMutex;
+            std::vector<std::vector<uint8_t>> m_vFreeBuffers;
+            size_t m_siMaxFreeBuffers;
+
+            // Buffer management functions
+            void Release(std::vector<uint8_t>&& vBytes);
+
+        public:
+            // Constructor
+            explicit RoveCommBufferPool(size_t siMaxFreeBuffers = 16);
+
+            // Buffer management functions
+            Buffer Acquire(size_t siSize);
+            size_t GetFreeBufferCount();
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_BUFFER_POOL_H
@@ -0,0 +1,396 @@
+/******************************************************************************
+ * @brief RoveComm Byte Swap Implementation.
+ *
+ * @file RoveCommByteSwap.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommByteSwap.h"
+#include "RoveCommPacket.h"
+
+/// \cond
+#include <atomic>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define ROVECOMM_BYTE_SWAP_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) || defined(__ARM_NEON)
+#define ROVECOMM_BYTE_SWAP_NEON 1
+#include <arm_neon.h>
+#endif
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    // The selected kernel, or -1 before the first conversion picks one.
+    static std::atomic<int> g_nByteSwapKernel(-1);
+
+    /******************************************************************************
+     * @brief Convert an array element by element with htons/htonl/htonll. This
+     *        is the reference implementation and handles the tail of every vector
+     *        kernel.
+     *
+     * @tparam N - The element size in bytes: 2, 4 or 8.
+     * @param pSource - The bytes to convert.
+     * @param pDestination - Where to write the converted bytes.
+     * @param siCount - The number of elements to convert.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<size_t N>
+    static void ConvertScalar(const uint8_t* pSource, uint8_t* pDestination, size_t siCount)
+    {
+        for (size_t siIter = 0; siIter < siCount; ++siIter)
+        {
+            // INT16_T, UINT16_T
+            if constexpr (N == sizeof(uint16_t))
+            {
+                uint16_t unResult;
+                memcpy(&unResult, pSource, sizeof(uint16_t));
+                unResult = htons(unResult);
+                memcpy(pDestination, &unResult, sizeof(uint16_t));
+            }
+            // INT32_T, UINT32_T, FLOAT_T
+            else if constexpr (N == sizeof(uint32_t))
+            {
+                uint32_t unResult;
+                memcpy(&unResult, pSource, sizeof(uint32_t));
+                unResult = htonl(unResult);
+                memcpy(pDestination, &unResult, sizeof(uint32_t));
+            }
+            // DOUBLE_T
+            else if constexpr (N == sizeof(uint64_t))
+            {
+                uint64_t unResult;
+                memcpy(&unResult, pSource, sizeof(uint64_t));
+                unResult = htonll(unResult);
+                memcpy(pDestination, &unResult, sizeof(uint64_t));
+            }
+            pSource += N;
+            pDestination += N;
+        }
+    }
+
+#if defined(ROVECOMM_BYTE_SWAP_X86)
+    /******************************************************************************
+     * @brief Build the PSHUFB mask that reverses every N-byte element of a
+     *        16-byte lane.
+     *
+     * @tparam N - The element size in bytes: 2, 4 or 8.
+     * @param aMask - Receives 32 mask bytes, the same pattern for both AVX2 lanes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<size_t N>
+    static void BuildShuffleMask(uint8_t (&aMask)[32])
+    {
+        for (size_t siIter = 0; siIter < sizeof(aMask); ++siIter)
+        {
+            size_t siLaneByte = siIter % 16;
+            aMask[siIter]     = static_cast<uint8_t>((siLaneByte / N) * N + (N - 1 - siLaneByte % N));
+        }
+    }
+
+    /******************************************************************************
+     * @brief Convert an array 16 bytes at a time with SSSE3 PSHUFB.
+     *
+     * @tparam N - The element size in bytes: 2, 4 or 8.
+     * @param pSource - The bytes to convert.
+     * @param pDestination - Where to write the converted bytes.
+     * @param siCount - The number of elements to convert.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<size_t N>
+    __attribute__((target("ssse3"))) static void ConvertSSSE3(const uint8_t* pSource, uint8_t* pDestination, size_t siCount)
+    {
+        alignas(32) uint8_t aMask[32];
+        BuildShuffleMask<N>(aMask);
+        const __m128i mMask = _mm_load_si128(reinterpret_cast<const __m128i*>(aMask));
+
+        size_t siBytes = siCount * N;
+        size_t siIter  = 0;
+        for (; siIter + 16 <= siBytes; siIter += 16)
+        {
+            __m128i mData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + siIter));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDestination + siIter), _mm_shuffle_epi8(mData, mMask));
+        }
+
+        // Convert the remaining elements.
+        ConvertScalar<N>(pSource + siIter, pDestination + siIter, (siBytes - siIter) / N);
+    }
+
+    /******************************************************************************
+     * @brief Convert an array 32 bytes at a time with AVX2 VPSHUFB.
+     *
+     * @tparam N - The element size in bytes: 2, 4 or 8.
+     * @param pSource - The bytes to convert.
+     * @param pDestination - Where to write the converted bytes.
+     * @param siCount - The number of elements to convert.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<size_t N>
+    __attribute__((target("avx2"))) static void ConvertAVX2(const uint8_t* pSource, uint8_t* pDestination, size_t siCount)
+    {
+        alignas(32) uint8_t aMask[32];
+        BuildShuffleMask<N>(aMask);
+        const __m256i mMask = _mm256_load_si256(reinterpret_cast<const __m256i*>(aMask));
+
+        size_t siBytes = siCount * N;
+        size_t siIter  = 0;
+        for (; siIter + 32 <= siBytes; siIter += 32)
+        {
+            __m256i mData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSource + siIter));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDestination + siIter), _mm256_shuffle_epi8(mData, mMask));
+        }
+
+        // Convert the remaining elements.
+        ConvertScalar<N>(pSource + siIter, pDestination + siIter, (siBytes - siIter) / N);
+    }
+#endif
+
+#if defined(ROVECOMM_BYTE_SWAP_NEON)
+    /******************************************************************************
+     * @brief Convert an array 16 bytes at a time with NEON VREV.
+     *
+     * @tparam N - The element size in bytes: 2, 4 or 8.
+     * @param pSource - The bytes to convert.
+     * @param pDestination - Where to write the converted bytes.
+     * @param siCount - The number of elements to convert.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<size_t N>
+    static void ConvertNEON(const uint8_t* pSource, uint8_t* pDestination, size_t siCount)
+    {
+        size_t siBytes = siCount * N;
+        size_t siIter  = 0;
+        for (; siIter + 16 <= siBytes; siIter += 16)
+        {
+            uint8x16_t mData = vld1q_u8(pSource + siIter);
+            if constexpr (N == sizeof(uint16_t))
+            {
+                mData = vrev16q_u8(mData);
+            }
+            else if constexpr (N == sizeof(uint32_t))
+            {
+                mData = vrev32q_u8(mData);
+            }
+            else if constexpr (N == sizeof(uint64_t))
+            {
+                mData = vrev64q_u8(mData);
+            }
+            vst1q_u8(pDestination + siIter, mData);
+        }
+
+        // Convert the remaining elements.
+        ConvertScalar<N>(pSource + siIter, pDestination + siIter, (siBytes - siIter) / N);
+    }
+#endif
+
+    /******************************************************************************
+     * @brief Check whether a kernel can run on this CPU.
+     *
+     * @param eKernel - The kernel to check.
+     * @return true - The kernel is compiled in and the CPU supports it.
+     * @return false - The kernel cannot be used.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool IsByteSwapKernelSupported(ByteSwapKernel eKernel)
+    {
+        switch (eKernel)
+        {
+            case ByteSwapKernel::eScalar: return true;
+#if defined(ROVECOMM_BYTE_SWAP_X86)
+            case ByteSwapKernel::eSSSE3: return __builtin_cpu_supports("ssse3");
+            case ByteSwapKernel::eAVX2: return __builtin_cpu_supports("avx2");
+#endif
+#if defined(ROVECOMM_BYTE_SWAP_NEON)
+            case ByteSwapKernel::eNEON: return true;
+#endif
+            default: return false;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Force a specific kernel. Mainly useful for testing and benchmarking
+     *        every kernel on one machine.
+     *
+     * @param eKernel - The kernel to use from now on.
+     * @return true - The kernel was selected.
+     * @return false - The kernel is not supported, the selection is unchanged.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool SetByteSwapKernel(ByteSwapKernel eKernel)
+    {
+        if (!IsByteSwapKernelSupported(eKernel))
+        {
+            return false;
+        }
+
+        g_nByteSwapKernel.store(static_cast<int>(eKernel), std::memory_order_relaxed);
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Get the kernel used for conversions, selecting the fastest supported
+     *        one if none has been chosen yet.
+     *
+     * @return ByteSwapKernel - The active kernel.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    ByteSwapKernel GetByteSwapKernel()
+    {
+        int nKernel = g_nByteSwapKernel.load(std::memory_order_relaxed);
+        if (nKernel < 0)
+        {
+            // Pick the widest kernel the CPU supports.
+            ByteSwapKernel eBest = ByteSwapKernel::eScalar;
+            for (ByteSwapKernel eKernel : {ByteSwapKernel::eNEON, ByteSwapKernel::eSSSE3, ByteSwapKernel::eAVX2})
+            {
+                if (IsByteSwapKernelSupported(eKernel))
+                {
+                    eBest = eKernel;
+                }
+            }
+
+            nKernel = static_cast<int>(eBest);
+            g_nByteSwapKernel.store(nKernel, std::memory_order_relaxed);
+        }
+
+        return static_cast<ByteSwapKernel>(nKernel);
+    }
+
+    /******************************************************************************
+     * @brief Get a printable name for a kernel.
+     *
+     * @param eKernel - The kernel to name.
+     * @return const char* - The kernel's name.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    const char* GetByteSwapKernelName(ByteSwapKernel eKernel)
+    {
+        switch (eKernel)
+        {
+            case ByteSwapKernel::eScalar: return "scalar";
+            case ByteSwapKernel::eSSSE3: return "ssse3";
+            case ByteSwapKernel::eAVX2: return "avx2";
+            case ByteSwapKernel::eNEON: return "neon";
+        }
+        return "unknown";
+    }
+
+    /******************************************************************************
+     * @brief Convert an array between host and network byte order with the active
+     *        kernel. On big-endian hosts the byte orders match, so this is a copy.
+     *
+     * @tparam N - The element size in bytes: 2, 4 or 8.
+     * @param pSource - The bytes to convert.
+     * @param pDestination - Where to write the converted bytes.
+     * @param siCount - The number of elements to convert.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<size_t N>
+    static void ConvertByteOrder(const void* pSource, void* pDestination, size_t siCount)
+    {
+        const uint8_t* pSourceBytes = static_cast<const uint8_t*>(pSource);
+        uint8_t* pDestinationBytes  = static_cast<uint8_t*>(pDestination);
+
+        if (htons(1) == 1)
+        {
+            memcpy(pDestinationBytes, pSourceBytes, siCount * N);
+            return;
+        }
+
+        switch (GetByteSwapKernel())
+        {
+#if defined(ROVECOMM_BYTE_SWAP_X86)
+            case ByteSwapKernel::eSSSE3: ConvertSSSE3<N>(pSourceBytes, pDestinationBytes, siCount); break;
+            case ByteSwapKernel::eAVX2: ConvertAVX2<N>(pSourceBytes, pDestinationBytes, siCount); break;
+#endif
+#if defined(ROVECOMM_BYTE_SWAP_NEON)
+            case ByteSwapKernel::eNEON: ConvertNEON<N>(pSourceBytes, pDestinationBytes, siCount); break;
+#endif
+            default: ConvertScalar<N>(pSourceBytes, pDestinationBytes, siCount); break;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Convert an array of 16-bit elements between host and network byte
+     *        order.
+     *
+     * @param pSource - The elements to convert.
+     * @param pDestination - Where to write the converted elements.
+     * @param siCount - The number of elements to convert.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void ConvertByteOrder16(const void* pSource, void* pDestination, size_t siCount)
+    {
+        ConvertByteOrder<sizeof(uint16_t)>(pSource, pDestination, siCount);
+    }
+
+    /******************************************************************************
+     * @brief Convert an array of 32-bit elements between host and network byte
+     *        order.
+     *
+     * @param pSource - The elements to convert.
+     * @param pDestination - Where to write the converted elements.
+     * @param siCount - The number of elements to convert.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void ConvertByteOrder32(const void* pSource, void* pDestination, size_t siCount)
+    {
+        ConvertByteOrder<sizeof(uint32_t)>(pSource, pDestination, siCount);
+    }
+
+    /******************************************************************************
+     * @brief Convert an array of 64-bit elements between host and network byte
+     *        order.
+     *
+     * @param pSource - The elements to convert.
+     * @param pDestination - Where to write the converted elements.
+     * @param siCount - The number of elements to convert.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void ConvertByteOrder64(const void* pSource, void* pDestination, size_t siCount)
+    {
+        ConvertByteOrder<sizeof(uint64_t)>(pSource, pDestination, siCount);
+    }
+}    // namespace rovecomm
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * @brief Vectorized conversion between host and network byte order for arrays
+ *        of 16, 32 and 64-bit elements.
+ *
+ * @file RoveCommByteSwap.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_BYTE_SWAP_H
+#define ROVECOMM_BYTE_SWAP_H
+
+/// \cond
+#include <cstddef>
+#include <cstdint>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief The implementations available for converting arrays between host and
+     *        network byte order. The fastest kernel the CPU supports is selected
+     *        the first time a conversion runs.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    enum class ByteSwapKernel
+    {
+        eScalar,    // Portable element-by-element htons/htonl/htonll.
+        eSSSE3,     // 16 bytes per iteration with PSHUFB (x86).
+        eAVX2,      // 32 bytes per iteration with VPSHUFB (x86).
+        eNEON       // 16 bytes per iteration with VREV (ARM, e.g. the Jetson).
+    };
+
+    // Kernel selection functions
+    bool IsByteSwapKernelSupported(ByteSwapKernel eKernel);
+    bool SetByteSwapKernel(ByteSwapKernel eKernel);
+    ByteSwapKernel GetByteSwapKernel();
+    const char* GetByteSwapKernelName(ByteSwapKernel eKernel);
+
+    // Conversion functions. Converting is its own inverse, so these work in both
+    // directions. The source and destination may be unaligned but must not overlap.
+    void ConvertByteOrder16(const void* pSource, void* pDestination, size_t siCount);
+    void ConvertByteOrder32(const void* pSource, void* pDestination, size_t siCount);
+    void ConvertByteOrder64(const void* pSource, void* pDestination, size_t siCount);
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_BYTE_SWAP_H
@@ -0,0 +1,196 @@
+/******************************************************************************
+ * @brief RoveComm Callback Handle Implementation.
+ *
+ * @file RoveCommCallbackHandle.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommCallbackHandle.h"
+
+/// \cond
+#include <utility>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Construct an empty handle that does not refer to a registration.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommCallbackHandle::RoveCommCallbackHandle() : m_unDataId(0), m_unRegistrationId(0) {}
+
+    /******************************************************************************
+     * @brief Construct a handle to a registration.
+     *
+     * @param pRemover - The registry that holds the callback.
+     * @param unDataId - The data id the callback was registered for.
+     * @param unRegistrationId - The registry's id for this registration.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommCallbackHandle::RoveCommCallbackHandle(std::weak_ptr<RoveCommCallbackRemover> pRemover, uint16_t unDataId, uint64_t unRegistrationId) :
+        m_pRemover(std::move(pRemover)), m_unDataId(unDataId), m_unRegistrationId(unRegistrationId)
+    {}
+
+    /******************************************************************************
+     * @brief Remove the registration this handle refers to. Only the callbacks
+     *        registered for the same data id are searched, so the cost does not
+     *        depend on how many other callbacks the node has. The handle is empty
+     *        afterwards.
+     *
+     * @return true - The callback was removed.
+     * @return false - The handle was empty, the callback was already removed, or
+     *                 its node no longer exists.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommCallbackHandle::Unsubscribe()
+    {
+        std::shared_ptr<RoveCommCallbackRemover> pRemover = m_pRemover.lock();
+        m_pRemover.reset();
+        if (pRemover == nullptr)
+        {
+            return false;
+        }
+        return pRemover->Remove(m_unDataId, m_unRegistrationId);
+    }
+
+    /******************************************************************************
+     * @brief Check if the handle still refers to a registration that it has not
+     *        unsubscribed, on a node that still exists.
+     *
+     * @return true - The handle can be unsubscribed.
+     * @return false - The handle is empty or its node no longer exists.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommCallbackHandle::IsValid() const
+    {
+        return !m_pRemover.expired();
+    }
+
+    /******************************************************************************
+     * @brief Get the data id the callback was registered for.
+     *
+     * @return uint16_t - The data id.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint16_t RoveCommCallbackHandle::GetDataId() const
+    {
+        return m_unDataId;
+    }
+
+    /******************************************************************************
+     * @brief Take ownership of a registration.
+     *
+     * @param stHandle - The handle returned when the callback was added.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommScopedCallback::RoveCommScopedCallback(RoveCommCallbackHandle stHandle) : m_stHandle(std::move(stHandle)) {}
+
+    /******************************************************************************
+     * @brief Move ownership of a registration. The moved-from object no longer
+     *        owns it.
+     *
+     * @param stOther - The object to move from.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommScopedCallback::RoveCommScopedCallback(RoveCommScopedCallback&& stOther) noexcept : m_stHandle(stOther.Release()) {}
+
+    /******************************************************************************
+     * @brief Move-assign ownership of a registration, unsubscribing the currently
+     *        owned one first.
+     *
+     * @param stOther - The object to move from.
+     * @return RoveCommScopedCallback& - This object.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommScopedCallback& RoveCommScopedCallback::operator=(RoveCommScopedCallback&& stOther) noexcept
+    {
+        if (this != &stOther)
+        {
+            m_stHandle.Unsubscribe();
+            m_stHandle = stOther.Release();
+        }
+        return *this;
+    }
+
+    /******************************************************************************
+     * @brief Unsubscribe the owned registration.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommScopedCallback::~RoveCommScopedCallback()
+    {
+        m_stHandle.Unsubscribe();
+    }
+
+    /******************************************************************************
+     * @brief Unsubscribe the owned registration now instead of at destruction.
+     *
+     * @return true - The callback was removed.
+     * @return false - Nothing was owned, or the node no longer exists.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommScopedCallback::Unsubscribe()
+    {
+        return m_stHandle.Unsubscribe();
+    }
+
+    /******************************************************************************
+     * @brief Give up ownership without unsubscribing.
+     *
+     * @return RoveCommCallbackHandle - The handle to the registration.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommCallbackHandle RoveCommScopedCallback::Release()
+    {
+        RoveCommCallbackHandle stHandle = std::move(m_stHandle);
+        m_stHandle                      = RoveCommCallbackHandle();
+        return stHandle;
+    }
+
+    /******************************************************************************
+     * @brief Check if a registration is owned.
+     *
+     * @return true - A registration is owned and its node still exists.
+     * @return false - Nothing is owned.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommScopedCallback::IsValid() const
+    {
+        return m_stHandle.IsValid();
+    }
+}    // namespace rovecomm
@@ -0,0 +1,109 @@
+/******************************************************************************
+ * @brief The RoveCommCallbackHandle class identifies a single callback
+ *        registration so that it can be removed without affecting any other
+ *        callback, and RoveCommScopedCallback removes it automatically.
+ *
+ * @file RoveCommCallbackHandle.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_CALLBACK_HANDLE_H
+#define ROVECOMM_CALLBACK_HANDLE_H
+
+/// \cond
+#include <cstdint>
+#include <memory>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief The interface a callback handle uses to remove its registration,
+     *        implemented by every RoveCommCallbackRegistry.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommCallbackRemover
+    {
+        public:
+            virtual ~RoveCommCallbackRemover() = default;
+            virtual bool Remove(uint16_t unDataId, uint64_t unRegistrationId) = 0;
+    };
+
+    /******************************************************************************
+     * @brief A handle to one callback registration, returned by the Add*Callback
+     *        functions. Unsubscribe() removes exactly that registration, even if
+     *        other callbacks have the same type. Destroying the handle does not
+     *        remove the callback; wrap it in a RoveCommScopedCallback for that.
+     *
+     * @note The handle only refers to its registry weakly. Unsubscribing after
+     *       the node that owns the callback has been destroyed does nothing.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommCallbackHandle
+    {
+        private:
+            // Private member variables
+            std::weak_ptr<RoveCommCallbackRemover> m_pRemover;
+            uint16_t m_unDataId;
+            uint64_t m_unRegistrationId;
+
+        public:
+            // Constructors
+            RoveCommCallbackHandle();
+            RoveCommCallbackHandle(std::weak_ptr<RoveCommCallbackRemover> pRemover, uint16_t unDataId, uint64_t unRegistrationId);
+
+            // Registration management functions
+            bool Unsubscribe();
+            bool IsValid() const;
+            uint16_t GetDataId() const;
+    };
+
+    /******************************************************************************
+     * @brief A move-only owner of a callback registration that unsubscribes it
+     *        when it is destroyed, for callbacks that should only live as long as
+     *        the module that registered them.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommScopedCallback
+    {
+        private:
+            // Private member variables
+            RoveCommCallbackHandle m_stHandle;
+
+        public:
+            // Constructors
+            RoveCommScopedCallback() = default;
+            explicit RoveCommScopedCallback(RoveCommCallbackHandle stHandle);
+            RoveCommScopedCallback(RoveCommScopedCallback&& stOther) noexcept;
+            RoveCommScopedCallback& operator=(RoveCommScopedCallback&& stOther) noexcept;
+            RoveCommScopedCallback(const RoveCommScopedCallback&)            = delete;
+            RoveCommScopedCallback& operator=(const RoveCommScopedCallback&) = delete;
+            // Destructor
+            ~RoveCommScopedCallback();
+
+            // Registration management functions
+            bool Unsubscribe();
+            RoveCommCallbackHandle Release();
+            bool IsValid() const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_CALLBACK_HANDLE_H
@@ -0,0 +1,252 @@
+/******************************************************************************
+ * @brief The RoveCommCallbackIndex class stores callbacks keyed by the data id
+ *        they are registered for, so that dispatching a packet only touches
+ *        the callbacks for that packet's data id.
+ *
+ * @file RoveCommCallbackIndex.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_CALLBACK_INDEX_H
+#define ROVECOMM_CALLBACK_INDEX_H
+
+/// \cond
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief A table of callbacks indexed by data id. The 16-bit data id is split
+     *        into a page number (high byte) and a slot within the page (low byte).
+     *        Pages are only allocated once a callback is registered for one of
+     *        their data ids, so the table stays small even though every data id
+     *        has a slot, and a lookup is two array loads no matter how many
+     *        callbacks are registered.
+     *
+     * @tparam Callback - The callback type, normally a std::function.
+     *
+     *        Copies share their pages, and a page is only cloned when a copy
+     *        modifies it, so copying the index to publish a new snapshot costs 256
+     *        pointer copies plus the pages that change.
+     *
+     * @note The index is not thread safe. RoveCommCallbackRegistry publishes it
+     *       to the receive threads as immutable snapshots.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename Callback>
+    class RoveCommCallbackIndex
+    {
+        private:
+            // Define a struct for the callbacks of one data id. The registration ids are kept in a
+            // parallel vector so that dispatch only walks the callbacks.
+            struct Slot
+            {
+                public:
+                    std::vector<Callback> vCallbacks;
+                    std::vector<uint64_t> vRegistrationIds;
+            };
+
+            // Define a struct for the callbacks of 256 consecutive data ids.
+            struct Page
+            {
+                public:
+                    std::array<Slot, 256> aSlots;
+            };
+
+            // Private member variables
+            std::array<std::shared_ptr<Page>, 256> m_aPages;
+            size_t m_siCallbackCount;
+
+            /******************************************************************************
+             * @brief Get a page that only this index refers to, allocating it if it does
+             *        not exist and cloning it if it is shared with another copy.
+             *
+             * @param siPage - The page number, the high byte of the data id.
+             * @return Page& - The page, safe to modify.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            Page& GetWritablePage(size_t siPage)
+            {
+                std::shared_ptr<Page>& pPage = m_aPages[siPage];
+                if (pPage == nullptr)
+                {
+                    pPage = std::make_shared<Page>();
+                }
+                else if (pPage.use_count() > 1)
+                {
+                    pPage = std::make_shared<Page>(*pPage);
+                }
+                return *pPage;
+            }
+
+        public:
+            // Constructor
+            RoveCommCallbackIndex() : m_siCallbackCount(0) {}
+
+            /******************************************************************************
+             * @brief Register a callback for a data id. Callbacks for the same data id
+             *        are invoked in the order they were added.
+             *
+             * @param fnCallback - The callback to add.
+             * @param unDataId - The data id the callback is invoked for.
+             * @param unRegistrationId - An id the caller can later pass to Remove.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            void Add(const Callback& fnCallback, uint16_t unDataId, uint64_t unRegistrationId = 0)
+            {
+                Slot& stSlot = GetWritablePage(unDataId >> 8).aSlots[unDataId & 0xFF];
+                stSlot.vCallbacks.push_back(fnCallback);
+                stSlot.vRegistrationIds.push_back(unRegistrationId);
+                ++m_siCallbackCount;
+            }
+
+            /******************************************************************************
+             * @brief Remove the callback added with a registration id. Only the slot for
+             *        unDataId is searched, so this does not depend on how many callbacks
+             *        are registered for other data ids.
+             *
+             * @param unDataId - The data id the callback was added for.
+             * @param unRegistrationId - The id it was added with.
+             * @return true - The callback was removed.
+             * @return false - No callback with that id is registered for unDataId.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            bool Remove(uint16_t unDataId, uint64_t unRegistrationId)
+            {
+                const Page* pPage = m_aPages[unDataId >> 8].get();
+                if (pPage == nullptr)
+                {
+                    return false;
+                }
+                const std::vector<uint64_t>& vIds = pPage->aSlots[unDataId & 0xFF].vRegistrationIds;
+                std::vector<uint64_t>::const_iterator itId = std::find(vIds.begin(), vIds.end(), unRegistrationId);
+                if (itId == vIds.end())
+                {
+                    return false;
+                }
+
+                ptrdiff_t nPosition = itId - vIds.begin();
+                Slot& stSlot        = GetWritablePage(unDataId >> 8).aSlots[unDataId & 0xFF];
+                stSlot.vCallbacks.erase(stSlot.vCallbacks.begin() + nPosition);
+                stSlot.vRegistrationIds.erase(stSlot.vRegistrationIds.begin() + nPosition);
+                --m_siCallbackCount;
+                return true;
+            }
+
+            /******************************************************************************
+             * @brief Remove every callback, for any data id, that matches a predicate.
+             *        This visits every allocated page, so it is slower than a lookup.
+             *
+             * @tparam Predicate - A callable taking a const Callback& and returning bool.
+             * @param fnPredicate - Returns true for callbacks that should be removed.
+             * @return size_t - The number of callbacks removed.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            template<typename Predicate>
+            size_t RemoveIf(Predicate fnPredicate)
+            {
+                size_t siRemoved = 0;
+                for (size_t siPage = 0; siPage < m_aPages.size(); ++siPage)
+                {
+                    // Only clone the pages that actually hold a matching callback.
+                    const Page* pPage = m_aPages[siPage].get();
+                    if (pPage == nullptr ||
+                        std::none_of(pPage->aSlots.begin(),
+                                     pPage->aSlots.end(),
+                                     [&](const Slot& stSlot) { return std::any_of(stSlot.vCallbacks.begin(), stSlot.vCallbacks.end(), fnPredicate); }))
+                    {
+                        continue;
+                    }
+
+                    for (Slot& stSlot : GetWritablePage(siPage).aSlots)
+                    {
+                        // Compact both vectors together so the registration ids stay paired with their callbacks.
+                        size_t siKept = 0;
+                        for (size_t siIndex = 0; siIndex < stSlot.vCallbacks.size(); ++siIndex)
+                        {
+                            if (!fnPredicate(stSlot.vCallbacks[siIndex]))
+                            {
+                                if (siKept != siIndex)
+                                {
+                                    stSlot.vCallbacks[siKept]       = std::move(stSlot.vCallbacks[siIndex]);
+                                    stSlot.vRegistrationIds[siKept] = stSlot.vRegistrationIds[siIndex];
+                                }
+                                ++siKept;
+                            }
+                        }
+                        siRemoved += stSlot.vCallbacks.size() - siKept;
+                        stSlot.vCallbacks.erase(stSlot.vCallbacks.begin() + siKept, stSlot.vCallbacks.end());
+                        stSlot.vRegistrationIds.erase(stSlot.vRegistrationIds.begin() + siKept, stSlot.vRegistrationIds.end());
+                    }
+                }
+                m_siCallbackCount -= siRemoved;
+                return siRemoved;
+            }
+
+            /******************************************************************************
+             * @brief Look up the callbacks registered for a data id.
+             *
+             * @param unDataId - The data id of the received packet.
+             * @return const std::vector<Callback>* - The callbacks for unDataId, or
+             *                                        nullptr if none were ever added.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            const std::vector<Callback>* Find(uint16_t unDataId) const
+            {
+                const Page* pPage = m_aPages[unDataId >> 8].get();
+                return pPage == nullptr ? nullptr : &pPage->aSlots[unDataId & 0xFF].vCallbacks;
+            }
+
+            /******************************************************************************
+             * @brief Remove every callback and free every page.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            void Clear()
+            {
+                for (std::shared_ptr<Page>& pPage : m_aPages)
+                {
+                    pPage.reset();
+                }
+                m_siCallbackCount = 0;
+            }
+
+            size_t size() const { return m_siCallbackCount; }
+
+            bool empty() const { return m_siCallbackCount == 0; }
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_CALLBACK_INDEX_H
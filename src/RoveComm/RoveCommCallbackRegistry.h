@@ -0,0 +1,318 @@
+/******************************************************************************
+ * @brief The RoveCommCallbackRegistry class publishes a RoveCommCallbackIndex
+ *        to the receive threads as immutable snapshots, so that dispatching a
+ *        packet never waits on a lock while callbacks are added or removed. The
+ *        RoveCommCallbackTable class holds one registry per manifest data type
+ *        for a single node.
+ *
+ * @file RoveCommCallbackRegistry.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_CALLBACK_REGISTRY_H
+#define ROVECOMM_CALLBACK_REGISTRY_H
+
+#include "./RoveCommCallbackHandle.h"
+#include "./RoveCommCallbackIndex.h"
+
+/// \cond
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief A callback index that readers access without locks. Writers copy the
+     *        current index, modify the copy and atomically swap it in. Readers pin
+     *        whichever snapshot is current when they start, which takes a fixed
+     *        number of atomic operations and never waits.
+     *
+     *        Old snapshots are freed once no reader can still be using them. Every
+     *        reader counts itself in one of two counters, chosen by the parity of a
+     *        reader epoch. After swapping in a new snapshot, the writer flips the
+     *        epoch and waits for the old parity's counter to drain, twice, so that
+     *        both counters have drained once since the swap. New readers always
+     *        land in the counter that is not being waited on, so a steady stream
+     *        of packets cannot starve the writer.
+     *
+     * @tparam Callback - The callback type, normally a std::function.
+     *
+     *        Every callback gets a registration id when it is added, and the
+     *        returned RoveCommCallbackHandle removes exactly that callback.
+     *
+     * @note Adding or removing a callback from inside a callback of the same
+     *       registry deadlocks, because the writer waits for the calling reader.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename Callback>
+    class RoveCommCallbackRegistry : public RoveCommCallbackRemover
+    {
+        private:
+            // Keep each reader counter on its own cache line.
+            struct alignas(64) ReaderCount
+            {
+                public:
+                    std::atomic<uint32_t> unCount{0};
+            };
+
+            // Private member variables
+            std::atomic<const RoveCommCallbackIndex<Callback>*> m_pCurrent;
+            mutable std::atomic<uint32_t> m_unReaderEpoch;
+            mutable std::array<ReaderCount, 2> m_aReaderCounts;
+            std::mutex m_muWriterMutex;
+            uint64_t m_unNextRegistrationId;
+            // Handles refer to the registry through this non-owning pointer, which expires when the registry is destroyed.
+            std::shared_ptr<RoveCommCallbackRemover> m_pSelf;
+
+            /******************************************************************************
+             * @brief Copy the current snapshot, modify the copy, publish it, and free the
+             *        previous snapshot once no reader can still be using it.
+             *
+             * @tparam Modifier - A callable taking a RoveCommCallbackIndex<Callback>&.
+             * @param fnModify - Applies the change to the copy.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            template<typename Modifier>
+            void Update(Modifier fnModify)
+            {
+                // Acquire a lock so that only one writer copies the snapshot at a time.
+                std::lock_guard<std::mutex> lkWriterLock(m_muWriterMutex);
+
+                RoveCommCallbackIndex<Callback>* pNext = new RoveCommCallbackIndex<Callback>(*m_pCurrent.load());
+                fnModify(*pNext);
+                const RoveCommCallbackIndex<Callback>* pPrevious = m_pCurrent.exchange(pNext);
+
+                // Wait out both reader counters, flipping the epoch first so new readers go to the other counter.
+                for (int nPhase = 0; nPhase < 2; ++nPhase)
+                {
+                    uint32_t unDrainingSlot = m_unReaderEpoch.fetch_add(1) & 1;
+                    while (m_aReaderCounts[unDrainingSlot].unCount.load() != 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                delete pPrevious;
+            }
+
+        public:
+            /******************************************************************************
+             * @brief A pinned snapshot of the registry. The snapshot cannot be freed while
+             *        this handle exists, so keep it only as long as the dispatch takes.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            class Snapshot
+            {
+                private:
+                    // Private member variables
+                    const RoveCommCallbackRegistry* m_pRegistry;
+                    uint32_t m_unReaderSlot;
+                    const RoveCommCallbackIndex<Callback>* m_pIndex;
+
+                public:
+                    explicit Snapshot(const RoveCommCallbackRegistry* pRegistry) : m_pRegistry(pRegistry)
+                    {
+                        // Count this reader before loading the snapshot so a writer that swaps after this point waits for it.
+                        m_unReaderSlot = m_pRegistry->m_unReaderEpoch.load() & 1;
+                        m_pRegistry->m_aReaderCounts[m_unReaderSlot].unCount.fetch_add(1);
+                        m_pIndex = m_pRegistry->m_pCurrent.load();
+                    }
+
+                    ~Snapshot() { m_pRegistry->m_aReaderCounts[m_unReaderSlot].unCount.fetch_sub(1, std::memory_order_release); }
+
+                    Snapshot(const Snapshot&)            = delete;
+                    Snapshot& operator=(const Snapshot&) = delete;
+
+                    const RoveCommCallbackIndex<Callback>* operator->() const { return m_pIndex; }
+
+                    const RoveCommCallbackIndex<Callback>& operator*() const { return *m_pIndex; }
+            };
+
+            // Constructor
+            RoveCommCallbackRegistry() :
+                m_pCurrent(new RoveCommCallbackIndex<Callback>()), m_unReaderEpoch(0), m_unNextRegistrationId(1), m_pSelf(this, [](RoveCommCallbackRemover*) {})
+            {}
+
+            // Destructor
+            ~RoveCommCallbackRegistry() override { delete m_pCurrent.load(); }
+
+            RoveCommCallbackRegistry(const RoveCommCallbackRegistry&)            = delete;
+            RoveCommCallbackRegistry& operator=(const RoveCommCallbackRegistry&) = delete;
+
+            /******************************************************************************
+             * @brief Pin the current snapshot for reading. This never blocks.
+             *
+             * @return Snapshot - The pinned snapshot.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            Snapshot Read() const { return Snapshot(this); }
+
+            /******************************************************************************
+             * @brief Register a callback for a data id. Dispatches that start after this
+             *        returns will invoke it.
+             *
+             * @param fnCallback - The callback to add.
+             * @param unDataId - The data id the callback is invoked for.
+             * @return RoveCommCallbackHandle - A handle that removes this callback.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            RoveCommCallbackHandle Add(const Callback& fnCallback, uint16_t unDataId)
+            {
+                uint64_t unRegistrationId = 0;
+                Update(
+                    [&](RoveCommCallbackIndex<Callback>& stIndex)
+                    {
+                        // The writer mutex is held here, so the counter needs no synchronization of its own.
+                        unRegistrationId = m_unNextRegistrationId++;
+                        stIndex.Add(fnCallback, unDataId, unRegistrationId);
+                    });
+                return RoveCommCallbackHandle(m_pSelf, unDataId, unRegistrationId);
+            }
+
+            /******************************************************************************
+             * @brief Remove the callback with a registration id. When this returns, no
+             *        dispatch is still running it.
+             *
+             * @param unDataId - The data id the callback was added for.
+             * @param unRegistrationId - The id assigned when it was added.
+             * @return true - The callback was removed.
+             * @return false - The callback was already removed.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            bool Remove(uint16_t unDataId, uint64_t unRegistrationId) override
+            {
+                // Skip the copy and the reader wait when there is nothing to remove.
+                {
+                    Snapshot stSnapshot                     = Read();
+                    const std::vector<Callback>* pCallbacks = stSnapshot->Find(unDataId);
+                    if (pCallbacks == nullptr || pCallbacks->empty())
+                    {
+                        return false;
+                    }
+                }
+
+                bool bRemoved = false;
+                Update([&](RoveCommCallbackIndex<Callback>& stIndex) { bRemoved = stIndex.Remove(unDataId, unRegistrationId); });
+                return bRemoved;
+            }
+
+            /******************************************************************************
+             * @brief Remove every callback that matches a predicate. When this returns, no
+             *        dispatch is still running a removed callback.
+             *
+             * @tparam Predicate - A callable taking a const Callback& and returning bool.
+             * @param fnPredicate - Returns true for callbacks that should be removed.
+             * @return size_t - The number of callbacks removed.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            template<typename Predicate>
+            size_t RemoveIf(Predicate fnPredicate)
+            {
+                size_t siRemoved = 0;
+                Update([&](RoveCommCallbackIndex<Callback>& stIndex) { siRemoved = stIndex.RemoveIf(fnPredicate); });
+                return siRemoved;
+            }
+
+            /******************************************************************************
+             * @brief Remove every callback.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            void Clear()
+            {
+                Update([](RoveCommCallbackIndex<Callback>& stIndex) { stIndex.Clear(); });
+            }
+
+            size_t size() const { return Read()->size(); }
+
+            bool empty() const { return Read()->empty(); }
+    };
+
+    /******************************************************************************
+     * @brief The callback registries of one node, one for each manifest data type.
+     *        Registries are looked up by type at compile time, so a node reaches
+     *        its callbacks for T without a switch or any shared state.
+     *
+     * @tparam Callback - An alias template mapping a data type to the callback
+     *                    type for that data type, e.g. a std::function taking a
+     *                    RoveCommPacket<T>.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<template<typename> class Callback>
+    class RoveCommCallbackTable
+    {
+        private:
+            // Private member variables
+            std::tuple<RoveCommCallbackRegistry<Callback<uint8_t>>,
+                       RoveCommCallbackRegistry<Callback<int8_t>>,
+                       RoveCommCallbackRegistry<Callback<uint16_t>>,
+                       RoveCommCallbackRegistry<Callback<int16_t>>,
+                       RoveCommCallbackRegistry<Callback<uint32_t>>,
+                       RoveCommCallbackRegistry<Callback<int32_t>>,
+                       RoveCommCallbackRegistry<Callback<float>>,
+                       RoveCommCallbackRegistry<Callback<double>>,
+                       RoveCommCallbackRegistry<Callback<char>>>
+                m_tpRegistries;
+
+        public:
+            /******************************************************************************
+             * @brief Get the registry for a data type.
+             *
+             * @tparam T - The data type. This can be any of the types defined in the
+             *             manifest.
+             * @return RoveCommCallbackRegistry<Callback<T>>& - The registry for T.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            template<typename T>
+            RoveCommCallbackRegistry<Callback<T>>& Get()
+            {
+                return std::get<RoveCommCallbackRegistry<Callback<T>>>(m_tpRegistries);
+            }
+
+            template<typename T>
+            const RoveCommCallbackRegistry<Callback<T>>& Get() const
+            {
+                return std::get<RoveCommCallbackRegistry<Callback<T>>>(m_tpRegistries);
+            }
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_CALLBACK_REGISTRY_H
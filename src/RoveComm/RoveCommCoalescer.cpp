@@ -0,0 +1,288 @@
+/******************************************************************************
+ * @brief RoveComm Coalescer Implementation.
+ *
+ * @file RoveCommCoalescer.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommCoalescer.h"
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Construct a new, inactive coalescer.
+     *
+     * @param fnSend - The function datagrams are sent with.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommCoalescer::RoveCommCoalescer(SendFunction fnSend) : m_fnSend(std::move(fnSend))
+    {
+        m_siMaxDatagramSize = ROVECOMM_COALESCE_MAX_DATAGRAM_SIZE;
+        m_tmMaxDelay        = std::chrono::microseconds(ROVECOMM_COALESCE_MAX_DELAY_US);
+        m_bActive           = false;
+        m_bEnabled          = false;
+        m_bStopping         = false;
+        m_bThreadStarted    = false;
+        m_vFrame.reserve(m_siMaxDatagramSize);
+
+        // Initialize the statistics.
+        m_unPacketsCoalesced = 0;
+        m_unDatagramsSent    = 0;
+        m_unSizeFlushes      = 0;
+        m_unTimeFlushes      = 0;
+    }
+
+    /******************************************************************************
+     * @brief Destroy the coalescer, stopping its thread.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommCoalescer::~RoveCommCoalescer()
+    {
+        Disable();
+    }
+
+    /******************************************************************************
+     * @brief Send the pending datagram, if it holds any packets, and start a new
+     *        one. Must be called with the frame mutex held.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommCoalescer::SendFrame()
+    {
+        if (m_vFrame.size() > 1)
+        {
+            m_fnSend(m_vFrame.data(), m_vFrame.size());
+            m_unDatagramsSent.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_vFrame.clear();
+    }
+
+    /******************************************************************************
+     * @brief Turn coalescing on or off and set when datagrams are sent. Turning it
+     *        off sends the pending datagram.
+     *
+     * @param bActive - Whether packets are coalesced.
+     * @param siMaxDatagramSize - The largest datagram that is built, in bytes.
+     * @param tmMaxDelay - The longest a packet waits for more packets to join it.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommCoalescer::Configure(bool bActive, size_t siMaxDatagramSize, std::chrono::microseconds tmMaxDelay)
+    {
+        {
+            std::lock_guard<std::mutex> lkFrameLock(m_muFrameMutex);
+            SendFrame();
+            m_siMaxDatagramSize = siMaxDatagramSize;
+            m_tmMaxDelay        = tmMaxDelay;
+            m_vFrame.reserve(m_siMaxDatagramSize);
+            m_bActive = bActive;
+
+            // The thread is only needed once there is something to wait for.
+            if (m_bActive && m_bEnabled && !m_bThreadStarted)
+            {
+                m_bThreadStarted = true;
+                Start();
+            }
+        }
+        m_cvFrame.notify_one();
+    }
+
+    /******************************************************************************
+     * @brief Check if packets are being coalesced.
+     *
+     * @return true - Coalescing is turned on.
+     * @return false - Coalescing is turned off.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommCoalescer::IsActive() const
+    {
+        return m_bActive.load(std::memory_order_relaxed);
+    }
+
+    /******************************************************************************
+     * @brief Add a packed packet to the pending datagram. If it does not fit, the
+     *        pending datagram is sent first.
+     *
+     * @param pData - The packed packet.
+     * @param siDataSize - The packed size of the packet.
+     * @return true - The packet will be sent in a coalesced datagram.
+     * @return false - Coalescing is off, the node is closed, or the packet alone
+     *                 is larger than a datagram. The caller sends it on its own.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommCoalescer::Append(const uint8_t* pData, size_t siDataSize)
+    {
+        bool bStarted;
+        {
+            std::lock_guard<std::mutex> lkFrameLock(m_muFrameMutex);
+            if (!m_bActive || !m_bEnabled || siDataSize + 1 > m_siMaxDatagramSize)
+            {
+                return false;
+            }
+
+            if (m_vFrame.size() + siDataSize > m_siMaxDatagramSize)
+            {
+                SendFrame();
+                m_unSizeFlushes.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // A new datagram starts its delay with its first packet.
+            bStarted = m_vFrame.empty();
+            if (bStarted)
+            {
+                m_vFrame.push_back(ROVECOMM_COALESCED_VERSION);
+                m_tmDeadline = std::chrono::steady_clock::now() + m_tmMaxDelay;
+            }
+            m_vFrame.insert(m_vFrame.end(), pData, pData + siDataSize);
+        }
+
+        m_unPacketsCoalesced.fetch_add(1, std::memory_order_relaxed);
+        if (bStarted)
+        {
+            m_cvFrame.notify_one();
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Send the pending datagram now, without waiting for it to fill up or
+     *        for its delay to pass.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommCoalescer::Flush()
+    {
+        std::lock_guard<std::mutex> lkFrameLock(m_muFrameMutex);
+        SendFrame();
+    }
+
+    /******************************************************************************
+     * @brief Allow the coalescer to send, starting its thread if coalescing is
+     *        turned on. Called once the node's socket is open.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommCoalescer::Enable()
+    {
+        std::lock_guard<std::mutex> lkFrameLock(m_muFrameMutex);
+        m_bEnabled = true;
+        if (m_bActive && !m_bThreadStarted)
+        {
+            m_bThreadStarted = true;
+            Start();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Send the pending datagram, then stop the coalescer's thread and wait
+     *        for it to exit. Called before the node's socket is closed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommCoalescer::Disable()
+    {
+        bool bThreadStarted;
+        {
+            std::lock_guard<std::mutex> lkFrameLock(m_muFrameMutex);
+            SendFrame();
+            m_bEnabled       = false;
+            bThreadStarted   = m_bThreadStarted;
+            m_bThreadStarted = false;
+        }
+
+        if (bThreadStarted)
+        {
+            // Stop the thread, waking it if it is waiting for a datagram or a deadline.
+            RequestStop();
+            {
+                std::lock_guard<std::mutex> lkFrameLock(m_muFrameMutex);
+                m_bStopping = true;
+            }
+            m_cvFrame.notify_all();
+            Join();
+
+            std::lock_guard<std::mutex> lkFrameLock(m_muFrameMutex);
+            m_bStopping = false;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the coalescer's counters.
+     *
+     * @return RoveCommCoalescerStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommCoalescerStatistics RoveCommCoalescer::GetStatistics() const
+    {
+        RoveCommCoalescerStatistics stStatistics;
+        stStatistics.unPacketsCoalesced = m_unPacketsCoalesced.load(std::memory_order_relaxed);
+        stStatistics.unDatagramsSent    = m_unDatagramsSent.load(std::memory_order_relaxed);
+        stStatistics.unSizeFlushes      = m_unSizeFlushes.load(std::memory_order_relaxed);
+        stStatistics.unTimeFlushes      = m_unTimeFlushes.load(std::memory_order_relaxed);
+
+        return stStatistics;
+    }
+
+    /******************************************************************************
+     * @brief Sleep until a datagram is pending, then until its delay has passed,
+     *        and send it unless it was already sent because it filled up.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommCoalescer::ThreadedContinuousCode()
+    {
+        std::unique_lock<std::mutex> lkFrameLock(m_muFrameMutex);
+        m_cvFrame.wait(lkFrameLock, [this]() { return m_bStopping || !m_vFrame.empty(); });
+        if (m_bStopping)
+        {
+            return;
+        }
+
+        // A datagram sent early for its size is replaced by a new one with a later deadline, so recheck after each wakeup.
+        while (!m_bStopping && !m_vFrame.empty() && std::chrono::steady_clock::now() < m_tmDeadline)
+        {
+            m_cvFrame.wait_until(lkFrameLock, m_tmDeadline);
+        }
+        if (!m_bStopping && !m_vFrame.empty())
+        {
+            SendFrame();
+            m_unTimeFlushes.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /******************************************************************************
+     * @brief The coalescer does not use the thread pool.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommCoalescer::PooledLinearCode() {}
+}    // namespace rovecomm
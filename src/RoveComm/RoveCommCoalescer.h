@@ -0,0 +1,122 @@
+/******************************************************************************
+ * @brief The RoveCommCoalescer class packs several small RoveComm packets into
+ *        one UDP datagram, so that the per datagram IP/UDP overhead and the send
+ *        syscall are paid once for all of them.
+ *
+ * @file RoveCommCoalescer.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_COALESCER_H
+#define ROVECOMM_COALESCER_H
+
+#include "ExternalIncludes.h"
+#include "RoveCommConsts.h"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    // Define a struct for reporting a snapshot of a coalescer's counters.
+    struct RoveCommCoalescerStatistics
+    {
+        public:
+            uint64_t unPacketsCoalesced;    // Packets appended to a coalesced datagram.
+            uint64_t unDatagramsSent;       // Coalesced datagrams handed to the node.
+            uint64_t unSizeFlushes;         // Datagrams sent because the next packet did not fit.
+            uint64_t unTimeFlushes;         // Datagrams sent because their oldest packet reached the maximum delay.
+    };
+
+    /******************************************************************************
+     * @brief Collects packets bound for the subscribers that asked for coalesced
+     *        datagrams. A datagram starts with ROVECOMM_COALESCED_VERSION and is
+     *        followed by whole version 3 packets, back to back. It is sent when the
+     *        next packet would make it larger than the maximum datagram size, when
+     *        its oldest packet has waited for the maximum delay, or on Flush().
+     *
+     *        The coalescer's thread only wakes for the delay deadline of a pending
+     *        datagram. A full datagram is sent by the thread that appended to it.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommCoalescer : AutonomyThread<void>
+    {
+        public:
+            // Define the function the coalescer sends a datagram with.
+            using SendFunction = std::function<void(const uint8_t*, size_t)>;
+
+        private:
+            // Private member variables
+            SendFunction m_fnSend;
+            std::mutex m_muFrameMutex;
+            std::condition_variable m_cvFrame;
+            std::vector<uint8_t> m_vFrame;
+            size_t m_siMaxDatagramSize;
+            std::chrono::steady_clock::duration m_tmMaxDelay;
+            std::chrono::steady_clock::time_point m_tmDeadline;
+            std::atomic<bool> m_bActive;
+            bool m_bEnabled;
+            bool m_bStopping;
+            bool m_bThreadStarted;
+
+            // Statistics counters.
+            std::atomic<uint64_t> m_unPacketsCoalesced;
+            std::atomic<uint64_t> m_unDatagramsSent;
+            std::atomic<uint64_t> m_unSizeFlushes;
+            std::atomic<uint64_t> m_unTimeFlushes;
+
+            // Frame functions
+            void SendFrame();
+
+            // AutonomyThread member functions
+            void ThreadedContinuousCode() override;
+            void PooledLinearCode() override;
+
+        public:
+            // Constructor
+            explicit RoveCommCoalescer(SendFunction fnSend);
+            RoveCommCoalescer(const RoveCommCoalescer&)            = delete;
+            RoveCommCoalescer& operator=(const RoveCommCoalescer&) = delete;
+            // Destructor
+            ~RoveCommCoalescer();
+
+            // Configuration functions
+            void Configure(bool bActive, size_t siMaxDatagramSize, std::chrono::microseconds tmMaxDelay);
+            bool IsActive() const;
+
+            // Coalescing functions
+            bool Append(const uint8_t* pData, size_t siDataSize);
+            void Flush();
+
+            // Lifetime functions
+            void Enable();
+            void Disable();
+
+            // Accessors
+            RoveCommCoalescerStatistics GetStatistics() const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_COALESCER_H
@@ -25,8 +25,81 @@ namespace rovecomm
 #define ROVECOMM_PACKET_MAX_DATA_COUNT        65535
 #define ROVECOMM_PACKET_HEADER_SIZE           6
 #define ROVECOMM_VERSION                      3
+#define ROVECOMM_COALESCED_VERSION            0xC3    // First byte of a datagram that carries several version 3 packets.
+#define ROVECOMM_FRAGMENT_VERSION             0xF3    // First byte of a datagram that carries one fragment of a large version 3 packet.
+#define ROVECOMM_FRAGMENT_HEADER_SIZE         11
+#define ROVECOMM_STREAM_VERSION               0xB3    // First byte of a TCP connection that carries bulk stream transfers.
+#define ROVECOMM_STREAM_HEADER_SIZE           19
+#define ROVECOMM_STREAM_ACK_SIZE              8
+#define ROVECOMM_STREAM_REJECTED              0xFFFFFFFFFFFFFFFFULL    // Acknowledgement sent instead of 0 when a transfer is refused.
+
+// Capability flags a node sets in the payload of its SUBSCRIBE packet. Legacy nodes send 0.
+#define ROVECOMM_SUBSCRIBE_COALESCED 0x01
+#define ROVECOMM_SUBSCRIBE_FRAGMENTS 0x02
 
     // Server constants.
-    const int ROVECOMM_THREAD_MAX_IPS = 120;
+    const int ROVECOMM_THREAD_MAX_IPS         = 120;
+    const int ROVECOMM_EVENT_WAIT_TIMEOUT_MS  = 250;
+    const int ROVECOMM_UDP_RECEIVE_BATCH_SIZE = 16;
+    const int ROVECOMM_UDP_SEND_BATCH_MAX     = 1024;    // Kernel limit on messages per sendmmsg call (UIO_MAXIOV).
+    const int ROVECOMM_UDP_SOCKET_BUFFER_SIZE = 4 * 1024 * 1024;    // Requested size of each UDP socket buffer, capped by net.core.rmem_max/wmem_max.
+    const int ROVECOMM_UDP_SEND_WAIT_MS       = 100;    // How long a send waits for room in a full socket send buffer.
+    const int ROVECOMM_TCP_LISTEN_BACKLOG     = 1024;    // Capped by the kernel at net.core.somaxconn.
+    const int ROVECOMM_TCP_MAX_CLIENTS        = 1024;
+    const int ROVECOMM_TCP_EVENT_BATCH_SIZE   = 64;
+
+    // Default number of packets a node's callback dispatch queue can hold, and the largest buffer a queue slot keeps between packets.
+    const int ROVECOMM_DISPATCH_QUEUE_CAPACITY    = 1024;
+    const int ROVECOMM_DISPATCH_SLOT_MAX_RETAINED = 4096;
+
+    // Default number of samples kept per data id when history is enabled without a capacity.
+    const int ROVECOMM_HISTORY_DEFAULT_CAPACITY = 256;
+
+    // Default size and age at which a coalesced datagram is sent. 1472 bytes fill a 1500 byte Ethernet MTU.
+    const int ROVECOMM_COALESCE_MAX_DATAGRAM_SIZE = 1472;
+    const int ROVECOMM_COALESCE_MAX_DELAY_US      = 2000;
+
+    // Packets larger than a receive buffer are split into fragments of at most one Ethernet MTU.
+    const int ROVECOMM_FRAGMENT_THRESHOLD         = ROVECOMM_PACKET_HEADER_SIZE + ROVECOMM_PACKET_MAX_DATA_COUNT / 2;
+    const int ROVECOMM_FRAGMENT_MAX_DATAGRAM_SIZE = 1472;
+
+    // Fragments sent to each destination back to back, and the pause between bursts, so a receiver with a small socket buffer keeps up.
+    const int ROVECOMM_FRAGMENT_BURST_SIZE   = 32;
+    const int ROVECOMM_FRAGMENT_BURST_GAP_US = 500;
+
+    // Default limits on packets being reassembled: how long one may take, and how many and how large they may be in total.
+    const int ROVECOMM_REASSEMBLY_TIMEOUT_MS   = 500;
+    const int ROVECOMM_REASSEMBLY_MAX_MESSAGES = 8;
+    const int ROVECOMM_REASSEMBLY_MAX_BYTES    = 4 * 1024 * 1024;
+
+    // Default chunk size of a stream transfer, how many unacknowledged chunks a sender keeps in flight, and how long a stalled transfer waits.
+    const int ROVECOMM_STREAM_CHUNK_SIZE      = 256 * 1024;
+    const int ROVECOMM_STREAM_WINDOW_CHUNKS   = 8;
+    const int ROVECOMM_STREAM_TIMEOUT_MS      = 5000;
+    const int ROVECOMM_STREAM_MAX_CHUNK_SIZE  = 16 * 1024 * 1024;
+    const int ROVECOMM_STREAM_IDLE_TIMEOUT_MS = 60000;    // How long a stream connection may sit between transfers.
+
+    // Initial receive buffer of each TCP client connection, and the largest packet a connection may announce by default.
+    const int ROVECOMM_TCP_FRAMER_BUFFER_SIZE = 64 * 1024;
+    const int ROVECOMM_TCP_MAX_FRAME_SIZE     = ROVECOMM_PACKET_HEADER_SIZE + 8 * ROVECOMM_PACKET_MAX_DATA_COUNT;
+
+    // Default limits of the asynchronous TCP send queue: bytes buffered per destination before backpressure, and how long a packet may wait.
+    const int ROVECOMM_TCP_SEND_HIGH_WATER_MARK = 1024 * 1024;
+    const int ROVECOMM_TCP_SEND_TIMEOUT_MS      = 2000;
+    const int ROVECOMM_TCP_SEND_GATHER_MAX      = 64;    // Packets per gathered write.
+
+    // Default delay before reconnecting to a TCP destination that could not be reached, doubled after each failure up to the maximum.
+    const int ROVECOMM_TCP_RECONNECT_MIN_MS = 10;
+    const int ROVECOMM_TCP_RECONNECT_MAX_MS = 2000;
+
+    // Default time after which a send filter lets an unchanged packet through.
+    const int ROVECOMM_SEND_FILTER_KEEPALIVE_MS = 1000;
+
+    // Resolution of the periodic send scheduler, and the number of ticks its timer wheel spans.
+    const int ROVECOMM_SCHEDULER_TICK_US    = 1000;
+    const int ROVECOMM_SCHEDULER_WHEEL_SIZE = 1024;
+
+    // Packets up to this size are packed on the stack, larger ones use a pooled buffer.
+    const int ROVECOMM_PACKET_STACK_BUFFER_SIZE = 256;
 }    // namespace rovecomm
 #endif    // ROVECOMM_CONSTS_H
@@ -0,0 +1,422 @@
+/******************************************************************************
+ * @brief RoveComm Dispatch Queue Implementation.
+ *
+ * @file RoveCommDispatchQueue.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommDispatchQueue.h"
+
+/// \cond
+#include <algorithm>
+#include <bit>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Construct a new, open dispatch queue.
+     *
+     * @param siCapacity - The number of packets the queue can hold. Rounded up to a
+     *                     power of two, and at least 2.
+     * @param ePolicy - What Push() does when the queue is full.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommDispatchQueue::RoveCommDispatchQueue(size_t siCapacity, RoveCommOverflowPolicy ePolicy) :
+        m_siCapacity(std::bit_ceil(std::max<size_t>(siCapacity, 2))), m_ePolicy(ePolicy)
+    {
+        // Slot i is free for the producer that claims position i.
+        m_pSlots = std::make_unique<Slot[]>(m_siCapacity);
+        for (size_t siIter = 0; siIter < m_siCapacity; ++siIter)
+        {
+            m_pSlots[siIter].siSequence = siIter;
+        }
+
+        // Initialize member variables.
+        m_siEnqueuePosition  = 0;
+        m_siDequeuePosition  = 0;
+        m_bClosed            = false;
+        m_unPushSignal       = 0;
+        m_unPopSignal        = 0;
+        m_unWaitingConsumers = 0;
+        m_unWaitingProducers = 0;
+        m_unEnqueued         = 0;
+        m_unDispatched       = 0;
+        m_unDroppedOldest    = 0;
+        m_unDroppedNewest    = 0;
+        m_unBlockedWaits     = 0;
+        m_siMaxDepth         = 0;
+    }
+
+    /******************************************************************************
+     * @brief Claim the next free slot for writing.
+     *
+     * @param siPosition - Set to the claimed position.
+     * @return Slot* - The claimed slot, or nullptr if the queue is full.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommDispatchQueue::Slot* RoveCommDispatchQueue::ClaimPushSlot(size_t& siPosition)
+    {
+        size_t siCurrent = m_siEnqueuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot* pSlot     = &m_pSlots[siCurrent & (m_siCapacity - 1)];
+            intptr_t nDelta = static_cast<intptr_t>(pSlot->siSequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(siCurrent);
+            if (nDelta == 0)
+            {
+                // The slot is free, try to take this position.
+                if (m_siEnqueuePosition.compare_exchange_weak(siCurrent, siCurrent + 1, std::memory_order_relaxed))
+                {
+                    siPosition = siCurrent;
+                    return pSlot;
+                }
+            }
+            else if (nDelta < 0)
+            {
+                // The slot still holds a packet from the previous lap.
+                return nullptr;
+            }
+            else
+            {
+                // Another producer took this position first.
+                siCurrent = m_siEnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Claim the oldest queued packet for reading. The slot stays claimed
+     *        until ReleasePopSlot() is called.
+     *
+     * @param siPosition - Set to the claimed position.
+     * @return Slot* - The claimed slot, or nullptr if the queue is empty.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommDispatchQueue::Slot* RoveCommDispatchQueue::ClaimPopSlot(size_t& siPosition)
+    {
+        size_t siCurrent = m_siDequeuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot* pSlot     = &m_pSlots[siCurrent & (m_siCapacity - 1)];
+            intptr_t nDelta = static_cast<intptr_t>(pSlot->siSequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(siCurrent + 1);
+            if (nDelta == 0)
+            {
+                // The slot holds a packet, try to take this position.
+                if (m_siDequeuePosition.compare_exchange_weak(siCurrent, siCurrent + 1, std::memory_order_relaxed))
+                {
+                    siPosition = siCurrent;
+                    return pSlot;
+                }
+            }
+            else if (nDelta < 0)
+            {
+                // Nothing has been written to this position yet.
+                return nullptr;
+            }
+            else
+            {
+                // Another consumer took this position first.
+                siCurrent = m_siDequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Hand a claimed slot back to the producers and wake a producer that is
+     *        waiting for space. A slot buffer larger than
+     *        ROVECOMM_DISPATCH_SLOT_MAX_RETAINED is freed first.
+     *
+     * @param pSlot - The slot returned by ClaimPopSlot().
+     * @param siPosition - The position returned by ClaimPopSlot().
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommDispatchQueue::ReleasePopSlot(Slot* pSlot, size_t siPosition)
+    {
+        // Give back a buffer that grew for an unusually large packet.
+        if (pSlot->vBytes.capacity() > static_cast<size_t>(ROVECOMM_DISPATCH_SLOT_MAX_RETAINED))
+        {
+            std::vector<uint8_t>().swap(pSlot->vBytes);
+        }
+
+        pSlot->siSequence.store(siPosition + m_siCapacity, std::memory_order_release);
+
+        m_unPopSignal.fetch_add(1);
+        if (m_unWaitingProducers.load() > 0)
+        {
+            m_unPopSignal.notify_all();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Copy a received packet into the queue. If the queue is full, the
+     *        overflow policy decides whether to wait, to discard the oldest queued
+     *        packet, or to discard this one.
+     *
+     * @param pData - The received bytes.
+     * @param siDataSize - The number of bytes received.
+     * @param saAddress - The address the packet was received from.
+     * @return true - The packet was queued.
+     * @return false - The packet was dropped, or the queue is closed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommDispatchQueue::Push(const uint8_t* pData, size_t siDataSize, const sockaddr_in& saAddress)
+    {
+        bool bWaited = false;
+        while (!m_bClosed)
+        {
+            // Read the signal before trying, so a slot freed after the attempt still ends the wait below.
+            uint32_t unPopSignal = m_unPopSignal.load();
+
+            size_t siPosition;
+            Slot* pSlot = ClaimPushSlot(siPosition);
+            if (pSlot != nullptr)
+            {
+                // Copy the packet into the slot's buffer, which keeps a capacity of up to ROVECOMM_DISPATCH_SLOT_MAX_RETAINED between laps.
+                pSlot->vBytes.assign(pData, pData + siDataSize);
+                pSlot->saAddress = saAddress;
+                pSlot->siSequence.store(siPosition + 1, std::memory_order_release);
+                m_unEnqueued++;
+
+                // Track the high-water mark.
+                size_t siDepth    = GetDepth();
+                size_t siMaxDepth = m_siMaxDepth.load(std::memory_order_relaxed);
+                while (siDepth > siMaxDepth && !m_siMaxDepth.compare_exchange_weak(siMaxDepth, siDepth, std::memory_order_relaxed))
+                {
+                }
+
+                // Wake a worker if one is sleeping.
+                m_unPushSignal.fetch_add(1);
+                if (m_unWaitingConsumers.load() > 0)
+                {
+                    m_unPushSignal.notify_one();
+                }
+                return true;
+            }
+
+            // The queue is full.
+            if (m_ePolicy == eOverflowDropOldest)
+            {
+                size_t siOldestPosition;
+                Slot* pOldest = ClaimPopSlot(siOldestPosition);
+                if (pOldest != nullptr)
+                {
+                    ReleasePopSlot(pOldest, siOldestPosition);
+                    m_unDroppedOldest++;
+                    continue;
+                }
+
+                // Every slot is held by a worker that is still running its callbacks, so nothing can be discarded.
+                m_unDroppedNewest++;
+                return false;
+            }
+            else if (m_ePolicy == eOverflowDropNewest)
+            {
+                m_unDroppedNewest++;
+                return false;
+            }
+
+            // Sleep until a worker releases a slot or the queue is closed.
+            if (!bWaited)
+            {
+                m_unBlockedWaits++;
+                bWaited = true;
+            }
+            m_unWaitingProducers++;
+            m_unPopSignal.wait(unPopSignal);
+            m_unWaitingProducers--;
+        }
+
+        return false;
+    }
+
+    /******************************************************************************
+     * @brief Run a consumer on the oldest queued packet, if there is one. The bytes
+     *        are only valid until the consumer returns.
+     *
+     * @param fnConsumer - Called with the packet bytes, size and source address.
+     * @return true - A packet was consumed.
+     * @return false - The queue was empty.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommDispatchQueue::TryPop(const Consumer& fnConsumer)
+    {
+        size_t siPosition;
+        Slot* pSlot = ClaimPopSlot(siPosition);
+        if (pSlot == nullptr)
+        {
+            return false;
+        }
+
+        // Run the consumer on the bytes in place, then free the slot.
+        fnConsumer(pSlot->vBytes.data(), pSlot->vBytes.size(), pSlot->saAddress);
+        ReleasePopSlot(pSlot, siPosition);
+        m_unDispatched++;
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Run a consumer on the oldest queued packet, sleeping until one arrives
+     *        if the queue is empty. After Close(), the packets that are already
+     *        queued are still consumed before this returns false.
+     *
+     * @param fnConsumer - Called with the packet bytes, size and source address.
+     * @return true - A packet was consumed.
+     * @return false - The queue is closed and empty.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommDispatchQueue::Pop(const Consumer& fnConsumer)
+    {
+        while (true)
+        {
+            // Read the signal before trying, so a packet pushed after the attempt still ends the wait below.
+            uint32_t unPushSignal = m_unPushSignal.load();
+            if (TryPop(fnConsumer))
+            {
+                return true;
+            }
+            else if (m_bClosed)
+            {
+                return false;
+            }
+
+            m_unWaitingConsumers++;
+            m_unPushSignal.wait(unPushSignal);
+            m_unWaitingConsumers--;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Reopen a closed queue so that Push() accepts packets again.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommDispatchQueue::Open()
+    {
+        m_bClosed = false;
+    }
+
+    /******************************************************************************
+     * @brief Close the queue. Push() rejects new packets, a producer waiting for
+     *        space gives up, and Pop() returns false once the queue is drained.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommDispatchQueue::Close()
+    {
+        m_bClosed = true;
+
+        // Wake every sleeping thread so it sees the queue is closed.
+        m_unPushSignal.fetch_add(1);
+        m_unPushSignal.notify_all();
+        m_unPopSignal.fetch_add(1);
+        m_unPopSignal.notify_all();
+    }
+
+    /******************************************************************************
+     * @brief Check whether the queue is closed.
+     *
+     * @return true - The queue is closed.
+     * @return false - The queue accepts packets.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommDispatchQueue::IsClosed() const
+    {
+        return m_bClosed;
+    }
+
+    /******************************************************************************
+     * @brief Get the policy applied when the queue is full.
+     *
+     * @return RoveCommOverflowPolicy - The overflow policy.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommOverflowPolicy RoveCommDispatchQueue::GetOverflowPolicy() const
+    {
+        return m_ePolicy;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of slots in the queue.
+     *
+     * @return size_t - The capacity, after rounding up to a power of two.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommDispatchQueue::GetCapacity() const
+    {
+        return m_siCapacity;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of packets waiting for a worker. The value is exact
+     *        when no thread is pushing or popping, and approximate otherwise.
+     *
+     * @return size_t - The queue depth.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommDispatchQueue::GetDepth() const
+    {
+        size_t siDequeue = m_siDequeuePosition.load(std::memory_order_relaxed);
+        size_t siEnqueue = m_siEnqueuePosition.load(std::memory_order_relaxed);
+        return siEnqueue > siDequeue ? std::min(siEnqueue - siDequeue, m_siCapacity) : 0;
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the queue's counters.
+     *
+     * @return RoveCommDispatchStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommDispatchStatistics RoveCommDispatchQueue::GetStatistics() const
+    {
+        RoveCommDispatchStatistics stStatistics;
+        stStatistics.unEnqueued      = m_unEnqueued;
+        stStatistics.unDispatched    = m_unDispatched;
+        stStatistics.unDroppedOldest = m_unDroppedOldest;
+        stStatistics.unDroppedNewest = m_unDroppedNewest;
+        stStatistics.unBlockedWaits  = m_unBlockedWaits;
+        stStatistics.siDepth         = GetDepth();
+        stStatistics.siMaxDepth      = m_siMaxDepth;
+        stStatistics.siCapacity      = m_siCapacity;
+
+        return stStatistics;
+    }
+}    // namespace rovecomm
@@ -0,0 +1,145 @@
+/******************************************************************************
+ * @brief The RoveCommDispatchQueue class hands received packets from a node's
+ *        receive thread to a pool of worker threads that run the callbacks, so
+ *        a slow callback does not stop the socket from being drained.
+ *
+ * @file RoveCommDispatchQueue.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_DISPATCH_QUEUE_H
+#define ROVECOMM_DISPATCH_QUEUE_H
+
+#include "./RoveCommPacket.h"
+
+/// \cond
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    // Define an enum for selecting what the receive thread does when the dispatch queue is full.
+    enum RoveCommOverflowPolicy
+    {
+        eOverflowBlock,         // Wait for a worker to free a slot. Nothing is dropped, but the socket is not drained meanwhile.
+        eOverflowDropOldest,    // Discard the oldest queued packet to make room for the new one.
+        eOverflowDropNewest     // Discard the new packet and keep the queued ones.
+    };
+
+    // Define a struct for reporting a snapshot of a dispatch queue's counters.
+    struct RoveCommDispatchStatistics
+    {
+        public:
+            uint64_t unEnqueued;         // Packets handed to the queue by the receive thread.
+            uint64_t unDispatched;       // Packets whose callbacks were run by a worker.
+            uint64_t unDroppedOldest;    // Queued packets discarded by eOverflowDropOldest.
+            uint64_t unDroppedNewest;    // New packets discarded by eOverflowDropNewest, or because no slot could be freed.
+            uint64_t unBlockedWaits;     // Times eOverflowBlock made the receive thread wait for a free slot.
+            size_t siDepth;              // Packets currently queued.
+            size_t siMaxDepth;           // The highest depth seen since the queue was created.
+            size_t siCapacity;           // The number of slots in the queue.
+    };
+
+    /******************************************************************************
+     * @brief A bounded, lock-free multi-producer multi-consumer ring of received
+     *        packets. Every slot owns a byte buffer that keeps its capacity, so once
+     *        each slot has held a packet of the usual size, queueing a packet is a
+     *        copy into the slot and never allocates. A slot whose buffer grew past
+     *        ROVECOMM_DISPATCH_SLOT_MAX_RETAINED bytes for an unusually large
+     *        packet frees it again once the packet is consumed, so a burst of
+     *        large packets does not pin their memory in every slot.
+     *
+     *        Producers and consumers claim slots with a per-slot sequence number, so
+     *        neither side ever takes a lock. A consumer keeps its slot until the
+     *        callbacks return, and its bytes are handed to them in place. Threads
+     *        that find the queue empty, or full with eOverflowBlock, sleep on an
+     *        atomic wait and are only woken when another thread is known to wait.
+     *
+     * @note The capacity is rounded up to a power of two.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommDispatchQueue
+    {
+        public:
+            // Define the function type that consumes a queued packet.
+            using Consumer = std::function<void(const uint8_t*, size_t, const sockaddr_in&)>;
+
+        private:
+            // Keep each slot on its own cache line so neighbouring slots do not contend.
+            struct alignas(64) Slot
+            {
+                public:
+                    std::atomic<size_t> siSequence;
+                    std::vector<uint8_t> vBytes;
+                    sockaddr_in saAddress;
+            };
+
+            // Private member variables
+            std::unique_ptr<Slot[]> m_pSlots;
+            size_t m_siCapacity;
+            RoveCommOverflowPolicy m_ePolicy;
+            alignas(64) std::atomic<size_t> m_siEnqueuePosition;
+            alignas(64) std::atomic<size_t> m_siDequeuePosition;
+            alignas(64) std::atomic<bool> m_bClosed;
+            std::atomic<uint32_t> m_unPushSignal;
+            std::atomic<uint32_t> m_unPopSignal;
+            std::atomic<uint32_t> m_unWaitingConsumers;
+            std::atomic<uint32_t> m_unWaitingProducers;
+
+            // Statistics counters.
+            std::atomic<uint64_t> m_unEnqueued;
+            std::atomic<uint64_t> m_unDispatched;
+            std::atomic<uint64_t> m_unDroppedOldest;
+            std::atomic<uint64_t> m_unDroppedNewest;
+            std::atomic<uint64_t> m_unBlockedWaits;
+            std::atomic<size_t> m_siMaxDepth;
+
+            // Slot management functions
+            Slot* ClaimPushSlot(size_t& siPosition);
+            Slot* ClaimPopSlot(size_t& siPosition);
+            void ReleasePopSlot(Slot* pSlot, size_t siPosition);
+
+        public:
+            // Constructor
+            explicit RoveCommDispatchQueue(size_t siCapacity, RoveCommOverflowPolicy ePolicy = eOverflowDropOldest);
+            RoveCommDispatchQueue(const RoveCommDispatchQueue&)            = delete;
+            RoveCommDispatchQueue& operator=(const RoveCommDispatchQueue&) = delete;
+
+            // Queue functions
+            bool Push(const uint8_t* pData, size_t siDataSize, const sockaddr_in& saAddress);
+            bool TryPop(const Consumer& fnConsumer);
+            bool Pop(const Consumer& fnConsumer);
+
+            // Lifetime functions
+            void Open();
+            void Close();
+            bool IsClosed() const;
+
+            // Accessors
+            RoveCommOverflowPolicy GetOverflowPolicy() const;
+            size_t GetCapacity() const;
+            size_t GetDepth() const;
+            RoveCommDispatchStatistics GetStatistics() const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_DISPATCH_QUEUE_H
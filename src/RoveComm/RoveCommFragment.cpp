@@ -0,0 +1,469 @@
+/******************************************************************************
+ * @brief RoveComm Fragment Implementation.
+ *
+ * @file RoveCommFragment.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommFragment.h"
+
+/// \cond
+#include <algorithm>
+#include <cstring>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Get the number of fragments a packed packet is split into.
+     *
+     * @param siDataSize - The packed size of the packet.
+     * @param siMaxDatagramSize - The largest datagram a fragment may use,
+     *                            including its header.
+     * @return uint16_t - The number of fragments.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint16_t GetFragmentCount(size_t siDataSize, size_t siMaxDatagramSize)
+    {
+        size_t siMaxPayload = siMaxDatagramSize - ROVECOMM_FRAGMENT_HEADER_SIZE;
+        return static_cast<uint16_t>((siDataSize + siMaxPayload - 1) / siMaxPayload);
+    }
+
+    /******************************************************************************
+     * @brief Get the offset in the whole packet of the bytes a fragment carries.
+     *        The packet is spread evenly, so every fragment but the last carries
+     *        the total size divided by the count, rounded up.
+     *
+     * @param stHeader - The header of the fragment.
+     * @return size_t - The offset in bytes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t GetFragmentOffset(const RoveCommFragmentHeader& stHeader)
+    {
+        size_t siStride = (static_cast<size_t>(stHeader.unTotalSize) + stHeader.unCount - 1) / stHeader.unCount;
+        return siStride * stHeader.unIndex;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of bytes of the whole packet a fragment carries.
+     *
+     * @param stHeader - The header of the fragment.
+     * @return size_t - The payload size in bytes. Returns 0 if the header does not
+     *                  describe a valid fragment.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t GetFragmentPayloadSize(const RoveCommFragmentHeader& stHeader)
+    {
+        if (stHeader.unCount == 0 || stHeader.unIndex >= stHeader.unCount)
+        {
+            return 0;
+        }
+
+        size_t siStride = (static_cast<size_t>(stHeader.unTotalSize) + stHeader.unCount - 1) / stHeader.unCount;
+        size_t siOffset = siStride * stHeader.unIndex;
+        if (siOffset >= stHeader.unTotalSize)
+        {
+            return 0;
+        }
+
+        return std::min<size_t>(siStride, stHeader.unTotalSize - siOffset);
+    }
+
+    /******************************************************************************
+     * @brief Write a fragment header into the first ROVECOMM_FRAGMENT_HEADER_SIZE
+     *        bytes of a buffer.
+     *
+     * @param stHeader - The header to write.
+     * @param pBuffer - The buffer to write into.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void PackFragmentHeader(const RoveCommFragmentHeader& stHeader, uint8_t* pBuffer)
+    {
+        pBuffer[0]  = ROVECOMM_FRAGMENT_VERSION;
+        pBuffer[1]  = stHeader.unMessageId >> 8;
+        pBuffer[2]  = stHeader.unMessageId & 0xFF;
+        pBuffer[3]  = stHeader.unIndex >> 8;
+        pBuffer[4]  = stHeader.unIndex & 0xFF;
+        pBuffer[5]  = stHeader.unCount >> 8;
+        pBuffer[6]  = stHeader.unCount & 0xFF;
+        pBuffer[7]  = (stHeader.unTotalSize >> 24) & 0xFF;
+        pBuffer[8]  = (stHeader.unTotalSize >> 16) & 0xFF;
+        pBuffer[9]  = (stHeader.unTotalSize >> 8) & 0xFF;
+        pBuffer[10] = stHeader.unTotalSize & 0xFF;
+    }
+
+    /******************************************************************************
+     * @brief Read and check the header of a received fragment.
+     *
+     * @param pData - The received datagram.
+     * @param siDataSize - The size of the datagram.
+     * @param stHeader - Set to the header of the fragment.
+     * @return true - The datagram is a fragment, and carries exactly the bytes its
+     *                header says it does.
+     * @return false - The datagram is not a valid fragment.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool UnpackFragmentHeader(const uint8_t* pData, size_t siDataSize, RoveCommFragmentHeader& stHeader)
+    {
+        if (siDataSize <= ROVECOMM_FRAGMENT_HEADER_SIZE || pData[0] != ROVECOMM_FRAGMENT_VERSION)
+        {
+            return false;
+        }
+
+        stHeader.unMessageId = (pData[1] << 8) | pData[2];
+        stHeader.unIndex     = (pData[3] << 8) | pData[4];
+        stHeader.unCount     = (pData[5] << 8) | pData[6];
+        stHeader.unTotalSize = (static_cast<uint32_t>(pData[7]) << 24) | (static_cast<uint32_t>(pData[8]) << 16) | (pData[9] << 8) | pData[10];
+
+        // The whole packet must be a plausible RoveComm packet, and this fragment must carry its share of it.
+        if (stHeader.unTotalSize <= ROVECOMM_PACKET_HEADER_SIZE || stHeader.unTotalSize > ROVECOMM_PACKET_HEADER_SIZE + ROVECOMM_PACKET_MAX_DATA_COUNT * sizeof(double))
+        {
+            return false;
+        }
+
+        return GetFragmentPayloadSize(stHeader) == siDataSize - ROVECOMM_FRAGMENT_HEADER_SIZE;
+    }
+
+    /******************************************************************************
+     * @brief Construct a new reassembler with the default limits.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommReassembler::RoveCommReassembler() : m_stBufferPool(ROVECOMM_REASSEMBLY_MAX_MESSAGES)
+    {
+        m_aRetired.fill(MessageKey{0, 0, 0, 0});
+        m_siNextRetired = 0;
+        m_siBytesInUse  = 0;
+        m_tmTimeout     = std::chrono::milliseconds(ROVECOMM_REASSEMBLY_TIMEOUT_MS);
+        m_siMaxMessages = ROVECOMM_REASSEMBLY_MAX_MESSAGES;
+        m_siMaxBytes    = ROVECOMM_REASSEMBLY_MAX_BYTES;
+        m_vMessages.resize(m_siMaxMessages);
+
+        // Initialize the statistics.
+        m_unFragmentsReceived  = 0;
+        m_unPacketsCompleted   = 0;
+        m_unPacketsTimedOut    = 0;
+        m_unPacketsDropped     = 0;
+        m_unLateFragments      = 0;
+        m_unDuplicateFragments = 0;
+        m_unMalformedFragments = 0;
+    }
+
+    /******************************************************************************
+     * @brief Change the limits on packets being reassembled. Packets that are
+     *        being reassembled are discarded and counted as dropped.
+     *
+     * @param tmTimeout - How long after its first fragment a packet must be
+     *                    complete.
+     * @param siMaxMessages - The number of packets that can be reassembled at once.
+     * @param siMaxBytes - The total size of the packets being reassembled. A packet
+     *                     larger than this is never reassembled.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommReassembler::SetLimits(std::chrono::milliseconds tmTimeout, size_t siMaxMessages, size_t siMaxBytes)
+    {
+        std::lock_guard<std::mutex> lkReassemblyLock(m_muReassemblyMutex);
+        for (Message& stMessage : m_vMessages)
+        {
+            if (stMessage.bInUse)
+            {
+                Retire(stMessage);
+                m_unPacketsDropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        m_tmTimeout     = tmTimeout;
+        m_siMaxMessages = std::max<size_t>(siMaxMessages, 1);
+        m_siMaxBytes    = siMaxBytes;
+        m_vMessages.clear();
+        m_vMessages.resize(m_siMaxMessages);
+    }
+
+    /******************************************************************************
+     * @brief Free a packet's slot and buffer, and remember it so that its
+     *        remaining fragments are recognized as late.
+     *
+     * @param stMessage - The packet to retire. Its buffer is returned to the pool
+     *                    unless it was moved out first.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommReassembler::Retire(Message& stMessage)
+    {
+        m_aRetired[m_siNextRetired] = MessageKey{stMessage.unAddress, stMessage.unPort, stMessage.stHeader.unMessageId, stMessage.stHeader.unTotalSize};
+        m_siNextRetired             = (m_siNextRetired + 1) % m_aRetired.size();
+
+        m_siBytesInUse -= stMessage.stHeader.unTotalSize;
+        stMessage.stBuffer = RoveCommBufferPool::Buffer();
+        stMessage.bInUse   = false;
+    }
+
+    /******************************************************************************
+     * @brief Check if a packet was recently completed or discarded.
+     *
+     * @param stKey - The source, message id and size of the packet.
+     * @return true - The packet was retired.
+     * @return false - The packet is new.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommReassembler::IsRetired(const MessageKey& stKey) const
+    {
+        for (const MessageKey& stRetired : m_aRetired)
+        {
+            if (stRetired.unAddress == stKey.unAddress && stRetired.unPort == stKey.unPort && stRetired.unMessageId == stKey.unMessageId &&
+                stRetired.unTotalSize == stKey.unTotalSize)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /******************************************************************************
+     * @brief Discard the packets whose first fragment is older than the timeout.
+     *        Must be called with the reassembly mutex held.
+     *
+     * @param tmNow - The current time.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommReassembler::ExpireMessages(std::chrono::steady_clock::time_point tmNow)
+    {
+        for (Message& stMessage : m_vMessages)
+        {
+            if (stMessage.bInUse && tmNow - stMessage.tmStarted >= m_tmTimeout)
+            {
+                Retire(stMessage);
+                m_unPacketsTimedOut.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Claim a slot and a buffer for a new packet, discarding the oldest
+     *        packets if that is needed to stay within the limits. Must be called
+     *        with the reassembly mutex held.
+     *
+     * @param stKey - The source, message id and size of the packet.
+     * @param stHeader - The header of the packet's first received fragment.
+     * @param tmNow - The current time.
+     * @return Message* - The new packet, or nullptr if it is larger than the
+     *                    memory cap.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommReassembler::Message* RoveCommReassembler::StartMessage(const MessageKey& stKey, const RoveCommFragmentHeader& stHeader, std::chrono::steady_clock::time_point tmNow)
+    {
+        if (stHeader.unTotalSize > m_siMaxBytes)
+        {
+            return nullptr;
+        }
+
+        // Make room by discarding the oldest packets, first for the memory cap, then for a free slot.
+        Message* pFree = nullptr;
+        while (pFree == nullptr || m_siBytesInUse + stHeader.unTotalSize > m_siMaxBytes)
+        {
+            Message* pOldest = nullptr;
+            pFree            = nullptr;
+            for (Message& stMessage : m_vMessages)
+            {
+                if (!stMessage.bInUse)
+                {
+                    pFree = pFree == nullptr ? &stMessage : pFree;
+                }
+                else if (pOldest == nullptr || stMessage.tmStarted < pOldest->tmStarted)
+                {
+                    pOldest = &stMessage;
+                }
+            }
+
+            if (pFree != nullptr && m_siBytesInUse + stHeader.unTotalSize <= m_siMaxBytes)
+            {
+                break;
+            }
+            Retire(*pOldest);
+            m_unPacketsDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        pFree->bInUse              = true;
+        pFree->unAddress           = stKey.unAddress;
+        pFree->unPort              = stKey.unPort;
+        pFree->stHeader            = stHeader;
+        pFree->unFragmentsReceived = 0;
+        pFree->vReceived.assign(stHeader.unCount, false);
+        pFree->stBuffer  = m_stBufferPool.Acquire(stHeader.unTotalSize);
+        pFree->tmStarted = tmNow;
+        m_siBytesInUse += stHeader.unTotalSize;
+
+        return pFree;
+    }
+
+    /******************************************************************************
+     * @brief Add a received fragment. If it was the last missing fragment of its
+     *        packet, the whole packet is handed back.
+     *
+     * @param pData - The received datagram, starting with ROVECOMM_FRAGMENT_VERSION.
+     * @param siDataSize - The size of the datagram.
+     * @param saAddress - The address the datagram was received from.
+     * @param tmNow - The time the datagram was read.
+     * @param stPacket - Set to the reassembled packet when true is returned. The
+     *                   buffer returns to the pool when it is destroyed.
+     * @return true - The packet is complete and was moved into stPacket.
+     * @return false - More fragments are needed, or the fragment was ignored.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommReassembler::Add(const uint8_t* pData,
+                                  size_t siDataSize,
+                                  const sockaddr_in& saAddress,
+                                  std::chrono::steady_clock::time_point tmNow,
+                                  RoveCommBufferPool::Buffer& stPacket)
+    {
+        m_unFragmentsReceived.fetch_add(1, std::memory_order_relaxed);
+
+        RoveCommFragmentHeader stHeader;
+        if (!UnpackFragmentHeader(pData, siDataSize, stHeader))
+        {
+            m_unMalformedFragments.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lkReassemblyLock(m_muReassemblyMutex);
+        ExpireMessages(tmNow);
+
+        // Find the packet this fragment belongs to.
+        MessageKey stKey{saAddress.sin_addr.s_addr, saAddress.sin_port, stHeader.unMessageId, stHeader.unTotalSize};
+        Message* pMessage = nullptr;
+        for (Message& stMessage : m_vMessages)
+        {
+            if (stMessage.bInUse && stMessage.unAddress == stKey.unAddress && stMessage.unPort == stKey.unPort && stMessage.stHeader.unMessageId == stKey.unMessageId)
+            {
+                pMessage = &stMessage;
+                break;
+            }
+        }
+
+        if (pMessage != nullptr && (pMessage->stHeader.unTotalSize != stHeader.unTotalSize || pMessage->stHeader.unCount != stHeader.unCount))
+        {
+            m_unMalformedFragments.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (pMessage == nullptr)
+        {
+            if (IsRetired(stKey))
+            {
+                m_unLateFragments.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            pMessage = StartMessage(stKey, stHeader, tmNow);
+            if (pMessage == nullptr)
+            {
+                // Remember the packet, so its other fragments are not counted as drops again.
+                m_aRetired[m_siNextRetired] = stKey;
+                m_siNextRetired             = (m_siNextRetired + 1) % m_aRetired.size();
+                m_unPacketsDropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        if (pMessage->vReceived[stHeader.unIndex])
+        {
+            m_unDuplicateFragments.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        // Copy the fragment into its place in the packet.
+        std::memcpy(pMessage->stBuffer.data() + GetFragmentOffset(stHeader), pData + ROVECOMM_FRAGMENT_HEADER_SIZE, siDataSize - ROVECOMM_FRAGMENT_HEADER_SIZE);
+        pMessage->vReceived[stHeader.unIndex] = true;
+        if (++pMessage->unFragmentsReceived < pMessage->stHeader.unCount)
+        {
+            return false;
+        }
+
+        // Hand the buffer over before the slot is freed.
+        stPacket = std::move(pMessage->stBuffer);
+        Retire(*pMessage);
+        if (GetPackedSize(stPacket.data(), stPacket.size()) != stPacket.size())
+        {
+            m_unPacketsDropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        m_unPacketsCompleted.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Discard the packets that have not completed within the timeout. This
+     *        also happens whenever a fragment is added, calling it only frees their
+     *        buffers sooner when no more fragments arrive.
+     *
+     * @param tmNow - The current time.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommReassembler::Expire(std::chrono::steady_clock::time_point tmNow)
+    {
+        std::lock_guard<std::mutex> lkReassemblyLock(m_muReassemblyMutex);
+        ExpireMessages(tmNow);
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the reassembler's counters.
+     *
+     * @return RoveCommReassemblyStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommReassemblyStatistics RoveCommReassembler::GetStatistics() const
+    {
+        RoveCommReassemblyStatistics stStatistics;
+        stStatistics.unFragmentsReceived  = m_unFragmentsReceived.load(std::memory_order_relaxed);
+        stStatistics.unPacketsCompleted   = m_unPacketsCompleted.load(std::memory_order_relaxed);
+        stStatistics.unPacketsTimedOut    = m_unPacketsTimedOut.load(std::memory_order_relaxed);
+        stStatistics.unPacketsDropped     = m_unPacketsDropped.load(std::memory_order_relaxed);
+        stStatistics.unLateFragments      = m_unLateFragments.load(std::memory_order_relaxed);
+        stStatistics.unDuplicateFragments = m_unDuplicateFragments.load(std::memory_order_relaxed);
+        stStatistics.unMalformedFragments = m_unMalformedFragments.load(std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lkReassemblyLock(m_muReassemblyMutex);
+        stStatistics.siBytesInUse = m_siBytesInUse;
+
+        return stStatistics;
+    }
+}    // namespace rovecomm
@@ -0,0 +1,167 @@
+/******************************************************************************
+ * @brief Splitting of RoveComm packets that are too large for one datagram into
+ *        fragments, and the RoveCommReassembler class that puts them back
+ *        together on receive.
+ *
+ * @file RoveCommFragment.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_FRAGMENT_H
+#define ROVECOMM_FRAGMENT_H
+
+#include "./RoveCommBufferPool.h"
+#include "./RoveCommConsts.h"
+#include "./RoveCommPacket.h"
+
+/// \cond
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief The header in front of every fragment. On the wire it is
+     *        [ROVECOMM_FRAGMENT_VERSION][message id 2][index 2][count 2][size 4],
+     *        big endian. All fragments of a packet carry the same number of bytes,
+     *        except the last one, which carries the rest.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    struct RoveCommFragmentHeader
+    {
+        public:
+            uint16_t unMessageId;     // Chosen by the sender, the same for every fragment of a packet.
+            uint16_t unIndex;         // The position of this fragment in the packet.
+            uint16_t unCount;         // The number of fragments the packet was split into.
+            uint32_t unTotalSize;     // The packed size of the whole packet.
+    };
+
+    // Fragment functions
+    uint16_t GetFragmentCount(size_t siDataSize, size_t siMaxDatagramSize = ROVECOMM_FRAGMENT_MAX_DATAGRAM_SIZE);
+    size_t GetFragmentOffset(const RoveCommFragmentHeader& stHeader);
+    size_t GetFragmentPayloadSize(const RoveCommFragmentHeader& stHeader);
+    void PackFragmentHeader(const RoveCommFragmentHeader& stHeader, uint8_t* pBuffer);
+    bool UnpackFragmentHeader(const uint8_t* pData, size_t siDataSize, RoveCommFragmentHeader& stHeader);
+
+    // Define a struct for reporting a snapshot of a reassembler's counters.
+    struct RoveCommReassemblyStatistics
+    {
+        public:
+            uint64_t unFragmentsReceived;     // Fragments handed to the reassembler.
+            uint64_t unPacketsCompleted;      // Packets put back together and handed on.
+            uint64_t unPacketsTimedOut;       // Packets discarded because a fragment did not arrive in time.
+            uint64_t unPacketsDropped;        // Packets discarded to stay within the memory cap, or that were malformed.
+            uint64_t unLateFragments;         // Fragments of packets that were already completed or discarded.
+            uint64_t unDuplicateFragments;    // Fragments that had already been received.
+            uint64_t unMalformedFragments;    // Fragments with an invalid header, or that disagree with the other fragments.
+            size_t siBytesInUse;              // Bytes held by packets being reassembled.
+    };
+
+    /******************************************************************************
+     * @brief Puts fragmented packets back together. Each packet being reassembled
+     *        gets a pooled buffer of its full size, and fragments are copied
+     *        straight into their place in it, so they may arrive in any order.
+     *
+     *        A packet is discarded if it is not complete within the timeout. The
+     *        number of packets and the bytes they hold are capped, and a new packet
+     *        that would exceed either cap discards the oldest ones, since a newer
+     *        sample is worth more than an older one. Fragments of a packet that was
+     *        already completed or discarded are counted as late and ignored.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommReassembler
+    {
+        private:
+            struct Message
+            {
+                public:
+                    bool bInUse;
+                    uint32_t unAddress;
+                    uint16_t unPort;
+                    RoveCommFragmentHeader stHeader;
+                    uint16_t unFragmentsReceived;
+                    std::vector<bool> vReceived;
+                    RoveCommBufferPool::Buffer stBuffer;
+                    std::chrono::steady_clock::time_point tmStarted;
+            };
+
+            struct MessageKey
+            {
+                public:
+                    uint32_t unAddress;
+                    uint16_t unPort;
+                    uint16_t unMessageId;
+                    uint32_t unTotalSize;
+            };
+
+            // Private member variables
+            mutable std::mutex m_muReassemblyMutex;
+            RoveCommBufferPool m_stBufferPool;
+            std::vector<Message> m_vMessages;
+            std::array<MessageKey, 4 * ROVECOMM_REASSEMBLY_MAX_MESSAGES> m_aRetired;
+            size_t m_siNextRetired;
+            size_t m_siBytesInUse;
+            std::chrono::steady_clock::duration m_tmTimeout;
+            size_t m_siMaxMessages;
+            size_t m_siMaxBytes;
+
+            // Statistics counters.
+            std::atomic<uint64_t> m_unFragmentsReceived;
+            std::atomic<uint64_t> m_unPacketsCompleted;
+            std::atomic<uint64_t> m_unPacketsTimedOut;
+            std::atomic<uint64_t> m_unPacketsDropped;
+            std::atomic<uint64_t> m_unLateFragments;
+            std::atomic<uint64_t> m_unDuplicateFragments;
+            std::atomic<uint64_t> m_unMalformedFragments;
+
+            // Message management functions
+            void Retire(Message& stMessage);
+            bool IsRetired(const MessageKey& stKey) const;
+            void ExpireMessages(std::chrono::steady_clock::time_point tmNow);
+            Message* StartMessage(const MessageKey& stKey, const RoveCommFragmentHeader& stHeader, std::chrono::steady_clock::time_point tmNow);
+
+        public:
+            // Constructor
+            RoveCommReassembler();
+            RoveCommReassembler(const RoveCommReassembler&)            = delete;
+            RoveCommReassembler& operator=(const RoveCommReassembler&) = delete;
+
+            // Configuration functions
+            void SetLimits(std::chrono::milliseconds tmTimeout, size_t siMaxMessages, size_t siMaxBytes);
+
+            // Reassembly functions
+            bool Add(const uint8_t* pData,
+                     size_t siDataSize,
+                     const sockaddr_in& saAddress,
+                     std::chrono::steady_clock::time_point tmNow,
+                     RoveCommBufferPool::Buffer& stPacket);
+            void Expire(std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now());
+
+            // Accessors
+            RoveCommReassemblyStatistics GetStatistics() const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_FRAGMENT_H
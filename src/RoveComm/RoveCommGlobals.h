@@ -1,7 +1,7 @@
 /******************************************************************************
  * @brief The RoveCommGlobals.h file is used to define functions and objects used
  *        at the global scope for the RoveComm library. This includes the
- *        SubscriberInfo struct and the vectors of callbacks for each data type.
+ *        SubscriberInfo struct.
  *
  * @file RoveCommGlobals.h
  * @author Eli Byrd (edbgkk@mst.edu)
@@ -37,7 +37,8 @@ namespace rovecomm
 {
     /******************************************************************************
      * @brief The SubscriberInfo struct is used to store the IP address and port of
-     *        a subscriber.
+     *        a subscriber. The socket address is resolved once when the subscriber
+     *        is added so sends do not have to parse the IP address string again.
      *
      *
      * @author Eli Byrd (edbgkk@mst.edu)
@@ -48,52 +49,10 @@ namespace rovecomm
         public:
             std::string szIPAddress;
             int nPort;
+            sockaddr_in saAddress;
+            bool bCoalesced;    // The subscriber asked for several packets per datagram.
+            bool bFragments;    // The subscriber can reassemble packets sent as fragments.
     };
-
-    /******************************************************************************
-     * @brief The RoveComm::UDP namespace contains all of the functionality for the
-     *        RoveComm library's UDP functionality. This includes the vectors of
-     *        callbacks for each data type.
-     *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
-     ******************************************************************************/
-    namespace udp
-    {
-        // The vectors of UDP callbacks for each data type.
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<uint8_t>&, const sockaddr_in&)>, unsigned int>> vUInt8Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<int8_t>&, const sockaddr_in&)>, unsigned int>> vInt8Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<uint16_t>&, const sockaddr_in&)>, unsigned int>> vUInt16Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<int16_t>&, const sockaddr_in&)>, unsigned int>> vInt16Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<uint32_t>&, const sockaddr_in&)>, unsigned int>> vUInt32Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<int32_t>&, const sockaddr_in&)>, unsigned int>> vInt32Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)>, unsigned int>> vFloatCallbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<double>&, const sockaddr_in&)>, unsigned int>> vDoubleCallbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<char>&, const sockaddr_in&)>, unsigned int>> vCharCallbacks;
-    }    // namespace udp
-
-    /******************************************************************************
-     * @brief The RoveComm::TCP namespace contains all of the functionality for the
-     *        RoveComm library's TCP functionality. This includes the vectors of
-     *        callbacks for each data type.
-     *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
-     ******************************************************************************/
-    namespace tcp
-    {
-        // The vectors of TCP callbacks for each data type.
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<uint8_t>&)>, uint16_t>> vUInt8Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<int8_t>&)>, uint16_t>> vInt8Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<uint16_t>&)>, uint16_t>> vUInt16Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<int16_t>&)>, uint16_t>> vInt16Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<uint32_t>&)>, uint16_t>> vUInt32Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<int32_t>&)>, uint16_t>> vInt32Callbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<float>&)>, uint16_t>> vFloatCallbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<double>&)>, uint16_t>> vDoubleCallbacks;
-        extern std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<char>&)>, uint16_t>> vCharCallbacks;
-    }    // namespace tcp
-
 }    // namespace rovecomm
 
 #endif    // ROVECOMM_GLOBALS_H
@@ -0,0 +1,291 @@
+/******************************************************************************
+ * @brief RoveComm History Implementation.
+ *
+ * @file RoveCommHistory.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommHistory.h"
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Construct the type independent part of a ring and allocate its
+     *        mirrored timestamps.
+     *
+     * @param eDataType - The data type of the packets kept.
+     * @param unDataCount - The number of values kept per sample.
+     * @param siCapacity - The number of samples kept.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommHistoryRingBase::RoveCommHistoryRingBase(manifest::DataTypes eDataType, uint16_t unDataCount, size_t siCapacity) :
+        m_eDataType(eDataType), m_unDataCount(unDataCount), m_siCapacity(siCapacity), m_siSlots(siCapacity + 1)
+    {
+        m_unWritten   = 0;
+        m_pTimestamps = std::make_unique<std::atomic<std::chrono::steady_clock::rep>[]>(2 * m_siSlots);
+    }
+
+    /******************************************************************************
+     * @brief Get the data type of the packets kept.
+     *
+     * @return manifest::DataTypes - The data type.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    manifest::DataTypes RoveCommHistoryRingBase::GetDataType() const
+    {
+        return m_eDataType;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of values kept per sample.
+     *
+     * @return uint16_t - The data count.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint16_t RoveCommHistoryRingBase::GetDataCount() const
+    {
+        return m_unDataCount;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of samples kept.
+     *
+     * @return size_t - The capacity.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommHistoryRingBase::GetCapacity() const
+    {
+        return m_siCapacity;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of samples appended since the ring was created.
+     *
+     * @return uint64_t - The number of samples, including overwritten ones.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint64_t RoveCommHistoryRingBase::GetWritten() const
+    {
+        return m_unWritten.load(std::memory_order_acquire);
+    }
+
+    /******************************************************************************
+     * @brief Construct a new store with history disabled for every data id.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommHistoryStore::RoveCommHistoryStore()
+    {
+        for (std::atomic<Page*>& pPage : m_aPages)
+        {
+            pPage = nullptr;
+        }
+        m_bAnyEnabled = false;
+    }
+
+    /******************************************************************************
+     * @brief Find the ring of a data id.
+     *
+     * @param unDataId - The data id to look up.
+     * @return RoveCommHistoryRingBase* - The ring, or nullptr if history is not
+     *                                    enabled for the data id.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommHistoryRingBase* RoveCommHistoryStore::FindRing(uint16_t unDataId) const
+    {
+        Page* pPage = m_aPages[unDataId >> 8].load(std::memory_order_acquire);
+        if (pPage == nullptr)
+        {
+            return nullptr;
+        }
+
+        return pPage->aRings[unDataId & 0xFF].load(std::memory_order_acquire);
+    }
+
+    /******************************************************************************
+     * @brief Start keeping the history of a data id. All of the ring's memory is
+     *        allocated here, none is allocated on receive.
+     *
+     * @param unDataId - The data id to keep.
+     * @param eDataType - The data type of its packets. Packets of another type are
+     *                    not kept.
+     * @param unDataCount - The number of values kept per sample.
+     * @param siCapacity - The number of samples kept.
+     * @return true - The history was enabled.
+     * @return false - The data count or capacity was zero.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommHistoryStore::EnableHistory(uint16_t unDataId, manifest::DataTypes eDataType, uint16_t unDataCount, size_t siCapacity)
+    {
+        if (unDataCount == 0 || siCapacity == 0)
+        {
+            return false;
+        }
+
+        // Create a ring of the packet's element type.
+        std::unique_ptr<RoveCommHistoryRingBase> pRing;
+        switch (eDataType)
+        {
+            case manifest::DataTypes::UINT8_T: pRing = std::make_unique<RoveCommHistoryRing<uint8_t>>(unDataCount, siCapacity); break;
+            case manifest::DataTypes::INT8_T: pRing = std::make_unique<RoveCommHistoryRing<int8_t>>(unDataCount, siCapacity); break;
+            case manifest::DataTypes::UINT16_T: pRing = std::make_unique<RoveCommHistoryRing<uint16_t>>(unDataCount, siCapacity); break;
+            case manifest::DataTypes::INT16_T: pRing = std::make_unique<RoveCommHistoryRing<int16_t>>(unDataCount, siCapacity); break;
+            case manifest::DataTypes::UINT32_T: pRing = std::make_unique<RoveCommHistoryRing<uint32_t>>(unDataCount, siCapacity); break;
+            case manifest::DataTypes::INT32_T: pRing = std::make_unique<RoveCommHistoryRing<int32_t>>(unDataCount, siCapacity); break;
+            case manifest::DataTypes::FLOAT_T: pRing = std::make_unique<RoveCommHistoryRing<float>>(unDataCount, siCapacity); break;
+            case manifest::DataTypes::DOUBLE_T: pRing = std::make_unique<RoveCommHistoryRing<double>>(unDataCount, siCapacity); break;
+            case manifest::DataTypes::CHAR: pRing = std::make_unique<RoveCommHistoryRing<char>>(unDataCount, siCapacity); break;
+        }
+
+        std::lock_guard<std::mutex> lkAllocationLock(m_muAllocationMutex);
+
+        // Allocate the page on first use.
+        Page* pPage = m_aPages[unDataId >> 8].load(std::memory_order_acquire);
+        if (pPage == nullptr)
+        {
+            m_vPages.push_back(std::make_unique<Page>());
+            pPage = m_vPages.back().get();
+            for (std::atomic<RoveCommHistoryRingBase*>& pPageRing : pPage->aRings)
+            {
+                pPageRing = nullptr;
+            }
+            m_aPages[unDataId >> 8].store(pPage, std::memory_order_release);
+        }
+
+        // Publish the ring. The receive thread starts filling it with the next packet.
+        pPage->aRings[unDataId & 0xFF].store(pRing.get(), std::memory_order_release);
+        m_vRings.push_back(std::move(pRing));
+        m_bAnyEnabled = true;
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Start keeping the history of a manifest entry, using its data id,
+     *        data type and data count.
+     *
+     * @param stEntry - The manifest entry, such as
+     *                  manifest::Core::TELEMETRY.at("DRIVESPEEDS").
+     * @param siCapacity - The number of samples kept.
+     * @return true - The history was enabled.
+     * @return false - The data count or capacity was zero.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommHistoryStore::EnableHistory(const manifest::ManifestEntry& stEntry, size_t siCapacity)
+    {
+        return EnableHistory(static_cast<uint16_t>(stEntry.DATA_ID), stEntry.DATA_TYPE, static_cast<uint16_t>(stEntry.DATA_COUNT), siCapacity);
+    }
+
+    /******************************************************************************
+     * @brief Start keeping the history of every entry in a manifest map, such as
+     *        manifest::Core::TELEMETRY, with the same capacity for each.
+     *
+     * @param mpEntries - The manifest entries to keep.
+     * @param siCapacity - The number of samples kept per data id.
+     * @return true - The history of every entry was enabled.
+     * @return false - At least one entry could not be enabled.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommHistoryStore::EnableHistory(const std::map<std::string, manifest::ManifestEntry>& mpEntries, size_t siCapacity)
+    {
+        bool bSuccess = true;
+        for (const auto& stEntry : mpEntries)
+        {
+            bSuccess &= EnableHistory(stEntry.second, siCapacity);
+        }
+
+        return bSuccess;
+    }
+
+    /******************************************************************************
+     * @brief Append a received packet to the history of its data id, if history
+     *        is enabled for it.
+     *
+     * @param pData - The received bytes, at least a packet header long.
+     * @param siDataSize - The number of bytes received.
+     * @param tmReceived - When the packet was received.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommHistoryStore::Update(const uint8_t* pData, size_t siDataSize, std::chrono::steady_clock::time_point tmReceived)
+    {
+        // Nodes that never enable history only pay for this check.
+        if (!m_bAnyEnabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        RoveCommHistoryRingBase* pRing = FindRing((pData[1] << 8) | pData[2]);
+        if (pRing != nullptr)
+        {
+            pRing->Append(pData, siDataSize, tmReceived);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Get the number of samples kept for a data id.
+     *
+     * @param unDataId - The data id to look up.
+     * @return size_t - The capacity, 0 if history is not enabled for it.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommHistoryStore::GetCapacity(uint16_t unDataId) const
+    {
+        RoveCommHistoryRingBase* pRing = FindRing(unDataId);
+        return pRing != nullptr ? pRing->GetCapacity() : 0;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of bytes allocated for every ring in the store,
+     *        including rings that were replaced.
+     *
+     * @return size_t - The memory used by samples.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommHistoryStore::GetMemoryUsage() const
+    {
+        std::lock_guard<std::mutex> lkAllocationLock(m_muAllocationMutex);
+        size_t siBytes = 0;
+        for (const std::unique_ptr<RoveCommHistoryRingBase>& pRing : m_vRings)
+        {
+            siBytes += pRing->GetMemoryUsage();
+        }
+
+        return siBytes;
+    }
+}    // namespace rovecomm
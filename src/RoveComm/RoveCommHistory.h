@@ -0,0 +1,442 @@
+/******************************************************************************
+ * @brief The RoveCommHistory classes keep a bounded, preallocated history of
+ *        the packets a node receives for selected data ids, so that consumers
+ *        that need the last few seconds of a stream can query it instead of
+ *        keeping their own copy from a callback.
+ *
+ * @file RoveCommHistory.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_HISTORY_H
+#define ROVECOMM_HISTORY_H
+
+#include "./RoveCommConsts.h"
+#include "./RoveCommLatestValueCache.h"
+#include "./RoveCommManifest.h"
+#include "./RoveCommPacket.h"
+
+/// \cond
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief A contiguous window of samples from a history ring. The window points
+     *        straight into the ring, nothing is copied when it is created. Sample i
+     *        was received at GetTimestamp(i) and holds the unDataCount values
+     *        GetValue(i, 0) to GetValue(i, unDataCount - 1), oldest first.
+     *
+     *        The ring keeps writing while the window is in use. A window of N
+     *        samples stays untouched until another capacity + 1 - N samples have
+     *        been received, and IsIntact() tells whether that has happened. Like a
+     *        seqlock, a reader on another thread should check IsIntact() after it
+     *        is done with the samples and query again if it returns false. The
+     *        samples are stored as atomics, so reading a sample that is being
+     *        overwritten returns a stale or torn sample, never undefined behavior.
+     *
+     * @tparam T - The data type of the elements in the packets.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    class RoveCommHistoryWindow
+    {
+        private:
+            // Private member variables
+            const std::atomic<uint64_t>* m_pWritten;
+            size_t m_siSlots;
+            const std::atomic<std::chrono::steady_clock::rep>* m_pTimestamps;
+            const std::atomic<T>* m_pValues;
+            size_t m_siSize;
+
+        public:
+            uint16_t unDataCount;
+            uint64_t unFirstSequence;    // The sequence number of the first sample, counting from 1.
+
+            RoveCommHistoryWindow() :
+                m_pWritten(nullptr), m_siSlots(0), m_pTimestamps(nullptr), m_pValues(nullptr), m_siSize(0), unDataCount(0), unFirstSequence(0)
+            {}
+
+            RoveCommHistoryWindow(const std::atomic<uint64_t>* pWritten,
+                                  size_t siSlots,
+                                  const std::atomic<std::chrono::steady_clock::rep>* pWindowTimestamps,
+                                  const std::atomic<T>* pWindowValues,
+                                  size_t siWindowSize,
+                                  uint16_t unWindowDataCount,
+                                  uint64_t unWindowFirstSequence) :
+                m_pWritten(pWritten),
+                m_siSlots(siSlots), m_pTimestamps(pWindowTimestamps), m_pValues(pWindowValues), m_siSize(siWindowSize), unDataCount(unWindowDataCount),
+                unFirstSequence(unWindowFirstSequence)
+            {}
+
+            size_t size() const { return m_siSize; }
+
+            bool empty() const { return m_siSize == 0; }
+
+            // Indices are not bounds checked, use size() and unDataCount first.
+            std::chrono::steady_clock::time_point GetTimestamp(size_t siIndex) const
+            {
+                return std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(m_pTimestamps[siIndex].load(std::memory_order_relaxed)));
+            }
+
+            T GetValue(size_t siIndex, size_t siElement) const { return m_pValues[siIndex * unDataCount + siElement].load(std::memory_order_relaxed); }
+
+            /******************************************************************************
+             * @brief Get the samples from an index to the end of the window.
+             *
+             * @param siFirst - The index of the first sample kept. Clamped to size().
+             * @return RoveCommHistoryWindow<T> - The later part of this window.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            RoveCommHistoryWindow<T> From(size_t siFirst) const
+            {
+                siFirst = std::min(siFirst, m_siSize);
+                return RoveCommHistoryWindow<T>(m_pWritten,
+                                                m_siSlots,
+                                                m_pTimestamps + siFirst,
+                                                m_pValues + siFirst * unDataCount,
+                                                m_siSize - siFirst,
+                                                unDataCount,
+                                                unFirstSequence + siFirst);
+            }
+
+            /******************************************************************************
+             * @brief Check that the ring has not started overwriting this window.
+             *
+             * @return true - Every sample in the window is still the one it was queried as.
+             * @return false - Some samples may have been overwritten, query again.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            bool IsIntact() const
+            {
+                if (m_pWritten == nullptr || empty())
+                {
+                    return true;
+                }
+
+                // The writer overwrites the first sample of the window when it starts on sample unFirstSequence + slots. The
+                // ring has one slot more than its capacity, so even a window of the whole capacity is intact until then.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return m_pWritten->load(std::memory_order_acquire) < unFirstSequence - 1 + m_siSlots;
+            }
+    };
+
+    /******************************************************************************
+     * @brief The type independent part of a history ring, so that rings of every
+     *        data type can be held and filled through one table.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommHistoryRingBase
+    {
+        protected:
+            // Protected member variables
+            manifest::DataTypes m_eDataType;
+            uint16_t m_unDataCount;
+            size_t m_siCapacity;
+            size_t m_siSlots;    // One more than the capacity, so a window of the whole capacity is not overwritten by the next sample.
+            std::atomic<uint64_t> m_unWritten;
+            std::unique_ptr<std::atomic<std::chrono::steady_clock::rep>[]> m_pTimestamps;
+
+        public:
+            RoveCommHistoryRingBase(manifest::DataTypes eDataType, uint16_t unDataCount, size_t siCapacity);
+            virtual ~RoveCommHistoryRingBase() = default;
+
+            // Append a received packet. Only the receive thread calls this.
+            virtual void Append(const uint8_t* pData, size_t siDataSize, std::chrono::steady_clock::time_point tmReceived) = 0;
+
+            // Accessors
+            manifest::DataTypes GetDataType() const;
+            uint16_t GetDataCount() const;
+            size_t GetCapacity() const;
+            uint64_t GetWritten() const;
+            virtual size_t GetMemoryUsage() const = 0;
+    };
+
+    /******************************************************************************
+     * @brief A fixed-capacity history of the packets of one data id, decoded to
+     *        host byte order. All storage is allocated when the ring is created.
+     *
+     *        The ring has capacity + 1 slots and is mirrored: sample k is written
+     *        both at slot k % slots and at slot k % slots + slots. That way the last
+     *        N samples, for any N up to the capacity, are always one contiguous run
+     *        of slots, and can be handed out as a window without copying or
+     *        wrapping. Values and timestamps are atomic words, so readers racing
+     *        the writer do not race on the memory itself.
+     *
+     * @tparam T - The data type of the elements in the packets.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    class RoveCommHistoryRing : public RoveCommHistoryRingBase
+    {
+        private:
+            // Private member variables
+            std::unique_ptr<std::atomic<T>[]> m_pValues;
+
+        public:
+            /******************************************************************************
+             * @brief Construct a new ring and allocate all of its storage.
+             *
+             * @param unDataCount - The number of values kept per sample.
+             * @param siCapacity - The number of samples kept.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            RoveCommHistoryRing(uint16_t unDataCount, size_t siCapacity) : RoveCommHistoryRingBase(GetDataTypeOf<T>(), unDataCount, siCapacity)
+            {
+                m_pValues = std::make_unique<std::atomic<T>[]>(2 * m_siSlots * m_unDataCount);
+            }
+
+            /******************************************************************************
+             * @brief Decode a received packet into the next sample. Packets of another
+             *        data type are ignored, and packets with a different count are
+             *        truncated or padded with zeros.
+             *
+             * @param pData - The received bytes, at least a packet header long.
+             * @param siDataSize - The number of bytes received.
+             * @param tmReceived - When the packet was received.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            void Append(const uint8_t* pData, size_t siDataSize, std::chrono::steady_clock::time_point tmReceived) override
+            {
+                RoveCommPacketView<T> stView = ViewData<T>(pData, siDataSize);
+                if (stView.eDataType != m_eDataType)
+                {
+                    return;
+                }
+
+                // Readers that see any of the new values also see that this sample was started, see IsIntact().
+                uint64_t unWritten = m_unWritten.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+
+                // Write the sample into both of its mirrored slots before publishing it.
+                size_t siSlot   = unWritten % m_siSlots;
+                size_t siCopied = std::min<size_t>(stView.size(), m_unDataCount);
+                for (size_t siMirror : {siSlot, siSlot + m_siSlots})
+                {
+                    std::atomic<T>* pSample = &m_pValues[siMirror * m_unDataCount];
+                    for (size_t siIter = 0; siIter < m_unDataCount; ++siIter)
+                    {
+                        pSample[siIter].store(siIter < siCopied ? static_cast<T>(stView[siIter]) : T{}, std::memory_order_relaxed);
+                    }
+                    m_pTimestamps[siMirror].store(tmReceived.time_since_epoch().count(), std::memory_order_relaxed);
+                }
+                m_unWritten.store(unWritten + 1, std::memory_order_release);
+            }
+
+            /******************************************************************************
+             * @brief Get the last samples received, oldest first.
+             *
+             * @param siCount - The number of samples wanted. Clamped to the number of
+             *                  samples received and to the capacity.
+             * @return RoveCommHistoryWindow<T> - The samples, without copying them.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            RoveCommHistoryWindow<T> GetLast(size_t siCount) const
+            {
+                uint64_t unWritten = m_unWritten.load(std::memory_order_acquire);
+                siCount            = static_cast<size_t>(std::min<uint64_t>({siCount, unWritten, m_siCapacity}));
+                uint64_t unFirst   = unWritten - siCount;
+                size_t siSlot      = unFirst % m_siSlots;
+
+                return RoveCommHistoryWindow<T>(&m_unWritten, m_siSlots, &m_pTimestamps[siSlot], &m_pValues[siSlot * m_unDataCount], siCount, m_unDataCount, unFirst + 1);
+            }
+
+            /******************************************************************************
+             * @brief Get every sample received at or after a point in time that is still
+             *        in the ring, oldest first.
+             *
+             * @param tmSince - The earliest receive time wanted.
+             * @return RoveCommHistoryWindow<T> - The samples, without copying them.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            RoveCommHistoryWindow<T> GetSince(std::chrono::steady_clock::time_point tmSince) const
+            {
+                // Samples are stored in receive order, so the timestamps can be binary searched.
+                RoveCommHistoryWindow<T> stAll = GetLast(m_siCapacity);
+                size_t siLow                   = 0;
+                size_t siHigh                  = stAll.size();
+                while (siLow < siHigh)
+                {
+                    size_t siMiddle = siLow + (siHigh - siLow) / 2;
+                    if (stAll.GetTimestamp(siMiddle) < tmSince)
+                    {
+                        siLow = siMiddle + 1;
+                    }
+                    else
+                    {
+                        siHigh = siMiddle;
+                    }
+                }
+
+                return stAll.From(siLow);
+            }
+
+            /******************************************************************************
+             * @brief Get the number of bytes allocated for the samples.
+             *
+             * @return size_t - The size of the mirrored value and timestamp arrays.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            size_t GetMemoryUsage() const override
+            {
+                return 2 * m_siSlots * (m_unDataCount * sizeof(std::atomic<T>) + sizeof(std::atomic<std::chrono::steady_clock::rep>));
+            }
+    };
+
+    /******************************************************************************
+     * @brief The history rings of one node, looked up by data id without a lock.
+     *        History is opt-in: only data ids passed to EnableHistory() are kept,
+     *        and each keeps exactly the number of samples it was configured with.
+     *
+     * @note Rings are only freed with the store. Enabling a data id again replaces
+     *       its ring with a new, empty one, and the old one stays allocated so that
+     *       windows still pointing into it remain valid memory.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommHistoryStore
+    {
+        private:
+            struct Page
+            {
+                public:
+                    std::array<std::atomic<RoveCommHistoryRingBase*>, 256> aRings;
+            };
+
+            // Private member variables
+            std::array<std::atomic<Page*>, 256> m_aPages;
+            std::atomic<bool> m_bAnyEnabled;
+            mutable std::mutex m_muAllocationMutex;
+            std::vector<std::unique_ptr<Page>> m_vPages;
+            std::vector<std::unique_ptr<RoveCommHistoryRingBase>> m_vRings;
+
+            // Ring management functions
+            RoveCommHistoryRingBase* FindRing(uint16_t unDataId) const;
+
+            /******************************************************************************
+             * @brief Find the ring of a data id and check that it holds the requested type.
+             *
+             * @tparam T - The data type the caller expects.
+             * @param unDataId - The data id to look up.
+             * @return const RoveCommHistoryRing<T>* - The ring, or nullptr if there is none
+             *                                         of this type.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            template<typename T>
+            const RoveCommHistoryRing<T>* FindTypedRing(uint16_t unDataId) const
+            {
+                RoveCommHistoryRingBase* pRing = FindRing(unDataId);
+                if (pRing == nullptr || pRing->GetDataType() != GetDataTypeOf<T>())
+                {
+                    return nullptr;
+                }
+
+                return static_cast<const RoveCommHistoryRing<T>*>(pRing);
+            }
+
+        public:
+            // Constructor
+            RoveCommHistoryStore();
+            RoveCommHistoryStore(const RoveCommHistoryStore&)            = delete;
+            RoveCommHistoryStore& operator=(const RoveCommHistoryStore&) = delete;
+
+            // Configuration functions
+            bool EnableHistory(uint16_t unDataId, manifest::DataTypes eDataType, uint16_t unDataCount, size_t siCapacity);
+            bool EnableHistory(const manifest::ManifestEntry& stEntry, size_t siCapacity);
+            bool EnableHistory(const std::map<std::string, manifest::ManifestEntry>& mpEntries, size_t siCapacity);
+
+            // Store functions
+            void Update(const uint8_t* pData, size_t siDataSize, std::chrono::steady_clock::time_point tmReceived);
+
+            // Accessors
+            size_t GetCapacity(uint16_t unDataId) const;
+            size_t GetMemoryUsage() const;
+
+            /******************************************************************************
+             * @brief Get the last samples of a data id, oldest first.
+             *
+             * @tparam T - The data type of the elements in the packets.
+             * @param unDataId - The data id to query.
+             * @param siCount - The number of samples wanted.
+             * @return RoveCommHistoryWindow<T> - The samples, empty if the data id has
+             *                                    no history of this type.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            template<typename T>
+            RoveCommHistoryWindow<T> GetLast(uint16_t unDataId, size_t siCount) const
+            {
+                const RoveCommHistoryRing<T>* pRing = FindTypedRing<T>(unDataId);
+                return pRing != nullptr ? pRing->GetLast(siCount) : RoveCommHistoryWindow<T>();
+            }
+
+            /******************************************************************************
+             * @brief Get the samples of a data id received at or after a point in time,
+             *        oldest first.
+             *
+             * @tparam T - The data type of the elements in the packets.
+             * @param unDataId - The data id to query.
+             * @param tmSince - The earliest receive time wanted.
+             * @return RoveCommHistoryWindow<T> - The samples, empty if the data id has
+             *                                    no history of this type.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            template<typename T>
+            RoveCommHistoryWindow<T> GetSince(uint16_t unDataId, std::chrono::steady_clock::time_point tmSince) const
+            {
+                const RoveCommHistoryRing<T>* pRing = FindTypedRing<T>(unDataId);
+                return pRing != nullptr ? pRing->GetSince(tmSince) : RoveCommHistoryWindow<T>();
+            }
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_HISTORY_H
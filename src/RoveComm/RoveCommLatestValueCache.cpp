@@ -0,0 +1,245 @@
+/******************************************************************************
+ * @brief RoveComm Latest Value Cache Implementation.
+ *
+ * @file RoveCommLatestValueCache.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommLatestValueCache.h"
+
+/// \cond
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Construct a new, empty cache. No entries are allocated until a packet
+     *        is received.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommLatestValueCache::RoveCommLatestValueCache()
+    {
+        for (std::atomic<Page*>& pPage : m_aPages)
+        {
+            pPage = nullptr;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Find the entry of a data id.
+     *
+     * @param unDataId - The data id to look up.
+     * @return Entry* - The entry, or nullptr if the data id was never received.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommLatestValueCache::Entry* RoveCommLatestValueCache::FindEntry(uint16_t unDataId) const
+    {
+        Page* pPage = m_aPages[unDataId >> 8].load(std::memory_order_acquire);
+        if (pPage == nullptr)
+        {
+            return nullptr;
+        }
+
+        return pPage->aEntries[unDataId & 0xFF].load(std::memory_order_acquire);
+    }
+
+    /******************************************************************************
+     * @brief Allocate an entry large enough for a packet and publish it in place of
+     *        the data id's current entry, if any. The new entry continues the old
+     *        one's sequence number and holds the same packet until it is written.
+     *
+     * @param unDataId - The data id the entry is for.
+     * @param siDataSize - The size of the packet it must hold.
+     * @return Entry* - The published entry.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommLatestValueCache::Entry* RoveCommLatestValueCache::AllocateEntry(uint16_t unDataId, size_t siDataSize)
+    {
+        std::lock_guard<std::mutex> lkAllocationLock(m_muAllocationMutex);
+
+        // Allocate the page on first use.
+        Page* pPage = m_aPages[unDataId >> 8].load(std::memory_order_acquire);
+        if (pPage == nullptr)
+        {
+            m_vPages.push_back(std::make_unique<Page>());
+            pPage = m_vPages.back().get();
+            for (std::atomic<Entry*>& pEntry : pPage->aEntries)
+            {
+                pEntry = nullptr;
+            }
+            m_aPages[unDataId >> 8].store(pPage, std::memory_order_release);
+        }
+
+        // Round up to a power of two so that a data id with a varying size only grows a few times.
+        std::unique_ptr<Entry> pNewEntry = std::make_unique<Entry>();
+        pNewEntry->siWords               = std::bit_ceil((siDataSize + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+        pNewEntry->pWords                = std::make_unique<std::atomic<uint64_t>[]>(pNewEntry->siWords);
+        pNewEntry->unSequence            = 0;
+        pNewEntry->unTimestampNs         = 0;
+        pNewEntry->unSize                = 0;
+
+        // Carry the current packet over, so readers never see the data id go back to empty.
+        Entry* pOldEntry = pPage->aEntries[unDataId & 0xFF].load(std::memory_order_acquire);
+        if (pOldEntry != nullptr)
+        {
+            pNewEntry->unSequence    = pOldEntry->unSequence.load(std::memory_order_relaxed);
+            pNewEntry->unTimestampNs = pOldEntry->unTimestampNs.load(std::memory_order_relaxed);
+            pNewEntry->unSize        = pOldEntry->unSize.load(std::memory_order_relaxed);
+            for (size_t siIter = 0; siIter < pOldEntry->siWords; ++siIter)
+            {
+                pNewEntry->pWords[siIter] = pOldEntry->pWords[siIter].load(std::memory_order_relaxed);
+            }
+        }
+
+        Entry* pEntry = pNewEntry.get();
+        m_vEntries.push_back(std::move(pNewEntry));
+        pPage->aEntries[unDataId & 0xFF].store(pEntry, std::memory_order_release);
+
+        return pEntry;
+    }
+
+    /******************************************************************************
+     * @brief Store a received packet as the latest value of its data id.
+     *
+     * @param pData - The received bytes, at least a packet header long.
+     * @param siDataSize - The number of bytes received.
+     * @param tmReceived - When the packet was received.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommLatestValueCache::Update(const uint8_t* pData, size_t siDataSize, std::chrono::steady_clock::time_point tmReceived)
+    {
+        uint16_t unDataId = (pData[1] << 8) | pData[2];
+        Entry* pEntry     = FindEntry(unDataId);
+        if (pEntry == nullptr || pEntry->siWords * sizeof(uint64_t) < siDataSize)
+        {
+            pEntry = AllocateEntry(unDataId, siDataSize);
+        }
+        uint64_t unTimestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(tmReceived.time_since_epoch()).count();
+
+        // Mark the entry as being written before touching the payload.
+        uint64_t unSequence = pEntry->unSequence.load(std::memory_order_relaxed);
+        pEntry->unSequence.store(unSequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        // Copy the packet in a word at a time. The last word is padded with zeros.
+        size_t siFullWords = siDataSize / sizeof(uint64_t);
+        for (size_t siIter = 0; siIter < siFullWords; ++siIter)
+        {
+            uint64_t unWord;
+            memcpy(&unWord, pData + siIter * sizeof(uint64_t), sizeof(uint64_t));
+            pEntry->pWords[siIter].store(unWord, std::memory_order_relaxed);
+        }
+        if (siDataSize % sizeof(uint64_t) != 0)
+        {
+            uint64_t unWord = 0;
+            memcpy(&unWord, pData + siFullWords * sizeof(uint64_t), siDataSize % sizeof(uint64_t));
+            pEntry->pWords[siFullWords].store(unWord, std::memory_order_relaxed);
+        }
+        pEntry->unSize.store(static_cast<uint32_t>(siDataSize), std::memory_order_relaxed);
+        pEntry->unTimestampNs.store(unTimestampNs, std::memory_order_relaxed);
+
+        // Publish the new packet.
+        pEntry->unSequence.store(unSequence + 2, std::memory_order_release);
+    }
+
+    /******************************************************************************
+     * @brief Copy the latest packet of a data id out of its entry, retrying until
+     *        the copy was not overlapped by a write.
+     *
+     * @param unDataId - The data id to read.
+     * @param vBytes - Resized to hold the packet, and filled with its bytes.
+     * @param siDataSize - Set to the size of the packet.
+     * @param unSequence - Set to the number of packets of this data id received.
+     * @param unTimestampNs - Set to the steady clock time the packet was received.
+     * @return true - A packet was copied.
+     * @return false - The data id was never received.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommLatestValueCache::ReadBytes(uint16_t unDataId, std::vector<uint8_t>& vBytes, size_t& siDataSize, uint64_t& unSequence, uint64_t& unTimestampNs) const
+    {
+        Entry* pEntry = FindEntry(unDataId);
+        if (pEntry == nullptr)
+        {
+            unSequence = 0;
+            return false;
+        }
+
+        while (true)
+        {
+            uint64_t unBefore = pEntry->unSequence.load(std::memory_order_acquire);
+            if (unBefore == 0)
+            {
+                unSequence = 0;
+                return false;
+            }
+            else if (unBefore % 2 == 1)
+            {
+                // The writer is in the middle of an update.
+                continue;
+            }
+
+            siDataSize    = std::min<size_t>(pEntry->unSize.load(std::memory_order_relaxed), pEntry->siWords * sizeof(uint64_t));
+            unTimestampNs = pEntry->unTimestampNs.load(std::memory_order_relaxed);
+            size_t siWords = (siDataSize + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+            vBytes.resize(siWords * sizeof(uint64_t));
+            for (size_t siIter = 0; siIter < siWords; ++siIter)
+            {
+                uint64_t unWord = pEntry->pWords[siIter].load(std::memory_order_relaxed);
+                memcpy(vBytes.data() + siIter * sizeof(uint64_t), &unWord, sizeof(uint64_t));
+            }
+
+            // The copy is only consistent if no write started while it was made.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (pEntry->unSequence.load(std::memory_order_relaxed) == unBefore)
+            {
+                unSequence = unBefore / 2;
+                return true;
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Get how many packets of a data id have been received.
+     *
+     * @param unDataId - The data id to look up.
+     * @return uint64_t - The number of packets, 0 if none were received.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint64_t RoveCommLatestValueCache::GetSequence(uint16_t unDataId) const
+    {
+        Entry* pEntry = FindEntry(unDataId);
+        if (pEntry == nullptr)
+        {
+            return 0;
+        }
+
+        return pEntry->unSequence.load(std::memory_order_acquire) / 2;
+    }
+}    // namespace rovecomm
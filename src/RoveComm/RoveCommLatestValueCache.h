@@ -0,0 +1,223 @@
+/******************************************************************************
+ * @brief The RoveCommLatestValueCache class keeps the most recent packet of
+ *        every data id a node receives, so that modules which only poll for the
+ *        current state do not need a callback and a mutex of their own.
+ *
+ * @file RoveCommLatestValueCache.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_LATEST_VALUE_CACHE_H
+#define ROVECOMM_LATEST_VALUE_CACHE_H
+
+#include "./RoveCommPacket.h"
+
+/// \cond
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Get the manifest data type that matches a C++ element type.
+     *
+     * @tparam T - The element type. This can be any of the data types defined in
+     *             the manifest.
+     * @return manifest::DataTypes - The matching manifest data type.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    constexpr manifest::DataTypes GetDataTypeOf()
+    {
+        if constexpr (std::is_same_v<T, int8_t>)
+        {
+            return manifest::DataTypes::INT8_T;
+        }
+        else if constexpr (std::is_same_v<T, uint8_t>)
+        {
+            return manifest::DataTypes::UINT8_T;
+        }
+        else if constexpr (std::is_same_v<T, int16_t>)
+        {
+            return manifest::DataTypes::INT16_T;
+        }
+        else if constexpr (std::is_same_v<T, uint16_t>)
+        {
+            return manifest::DataTypes::UINT16_T;
+        }
+        else if constexpr (std::is_same_v<T, int32_t>)
+        {
+            return manifest::DataTypes::INT32_T;
+        }
+        else if constexpr (std::is_same_v<T, uint32_t>)
+        {
+            return manifest::DataTypes::UINT32_T;
+        }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            return manifest::DataTypes::FLOAT_T;
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            return manifest::DataTypes::DOUBLE_T;
+        }
+        else
+        {
+            static_assert(std::is_same_v<T, char>, "Unsupported RoveComm data type.");
+            return manifest::DataTypes::CHAR;
+        }
+    }
+
+    /******************************************************************************
+     * @brief The most recent packet of one data id, as returned by
+     *        RoveCommLatestValueCache::Read().
+     *
+     * @tparam T - The data type of the elements in the packet.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    struct RoveCommLatestValue
+    {
+        public:
+            bool bValid;                                        // False if nothing of this data id and type was received yet.
+            RoveCommPacket<T> stPacket;                         // The decoded packet.
+            std::chrono::steady_clock::time_point tmReceived;   // When the receive thread read the packet.
+            uint64_t unSequence;                                // How many packets of this data id were received, counting this one.
+    };
+
+    /******************************************************************************
+     * @brief A per data id store of the last packet received, written by the
+     *        node's receive thread and read by any number of polling threads.
+     *
+     *        Each data id gets an entry the first time it is received. An entry is
+     *        a seqlock over the raw packet bytes: the writer makes the sequence
+     *        number odd, copies the packet in, and makes it even again. Readers copy
+     *        the bytes out and retry if the sequence number was odd or changed
+     *        while they were copying. The writer never waits for a reader, and
+     *        readers never take a lock.
+     *
+     *        Entries are found through a two level table of 256 pages, so a node
+     *        only allocates pages for the ranges of data ids it actually receives.
+     *        Entries and pages are only freed with the cache, which is what lets
+     *        readers use them without pinning. If a data id arrives with a larger
+     *        payload than its entry holds, a larger entry replaces it, and the old
+     *        one is kept until then.
+     *
+     * @note Update() expects a single writer, which is the node's receive thread.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommLatestValueCache
+    {
+        private:
+            // The payload is stored as atomic words, so that a reader racing the writer is not a data race.
+            struct alignas(64) Entry
+            {
+                public:
+                    std::atomic<uint64_t> unSequence;
+                    std::atomic<uint64_t> unTimestampNs;
+                    std::atomic<uint32_t> unSize;
+                    size_t siWords;
+                    std::unique_ptr<std::atomic<uint64_t>[]> pWords;
+            };
+
+            struct Page
+            {
+                public:
+                    std::array<std::atomic<Entry*>, 256> aEntries;
+            };
+
+            // Private member variables
+            std::array<std::atomic<Page*>, 256> m_aPages;
+            std::mutex m_muAllocationMutex;
+            std::vector<std::unique_ptr<Page>> m_vPages;
+            std::vector<std::unique_ptr<Entry>> m_vEntries;
+
+            // Entry management functions
+            Entry* FindEntry(uint16_t unDataId) const;
+            Entry* AllocateEntry(uint16_t unDataId, size_t siDataSize);
+            bool ReadBytes(uint16_t unDataId, std::vector<uint8_t>& vBytes, size_t& siDataSize, uint64_t& unSequence, uint64_t& unTimestampNs) const;
+
+        public:
+            // Constructor
+            RoveCommLatestValueCache();
+            RoveCommLatestValueCache(const RoveCommLatestValueCache&)            = delete;
+            RoveCommLatestValueCache& operator=(const RoveCommLatestValueCache&) = delete;
+
+            // Cache functions
+            void Update(const uint8_t* pData, size_t siDataSize, std::chrono::steady_clock::time_point tmReceived = std::chrono::steady_clock::now());
+            uint64_t GetSequence(uint16_t unDataId) const;
+
+            /******************************************************************************
+             * @brief Read the most recent packet of a data id. The packet's vector keeps
+             *        its capacity, so polling into the same value does not allocate once
+             *        it has held the largest packet of that data id.
+             *
+             * @tparam T - The data type of the elements in the packet.
+             * @param unDataId - The data id to read.
+             * @param stValue - Filled with the packet, its receive time and its sequence
+             *                  number. bValid is false if nothing was read.
+             * @return true - A packet of this data id and data type was read.
+             * @return false - No packet of this data id was received yet, or the last
+             *                 one had a different data type.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            template<typename T>
+            bool Read(uint16_t unDataId, RoveCommLatestValue<T>& stValue) const
+            {
+                // Copy the bytes out into a per thread buffer, then decode them outside of the seqlock.
+                thread_local std::vector<uint8_t> vBytes;
+                size_t siDataSize;
+                uint64_t unTimestampNs;
+                stValue.bValid = false;
+                if (!ReadBytes(unDataId, vBytes, siDataSize, stValue.unSequence, unTimestampNs))
+                {
+                    return false;
+                }
+
+                RoveCommPacketView<T> stView = ViewData<T>(vBytes.data(), siDataSize);
+                if (stView.eDataType != GetDataTypeOf<T>())
+                {
+                    return false;
+                }
+
+                stValue.stPacket.unDataId    = stView.unDataId;
+                stValue.stPacket.unDataCount = stView.unDataCount;
+                stValue.stPacket.eDataType   = stView.eDataType;
+                stValue.stPacket.vData.assign(stView.begin(), stView.end());
+                stValue.tmReceived = std::chrono::steady_clock::time_point(std::chrono::nanoseconds(unTimestampNs));
+                stValue.bValid     = true;
+
+                return true;
+            }
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_LATEST_VALUE_CACHE_H
@@ -9,6 +9,7 @@
  ******************************************************************************/
 
 #include "RoveCommPacket.h"
+#include "RoveCommByteSwap.h"
 
 /// \cond
 #include <iostream>
@@ -26,87 +27,176 @@
 namespace rovecomm
 {
     /******************************************************************************
-     * @brief Create a RoveCommData structure from a RoveCommPacket structure.
+     * @brief Get the number of bytes a RoveCommPacket occupies once packed. This is
+     *        the header plus the payload, not the size of a RoveCommData structure.
      *
      * @tparam T - The type of data that is to be sent or received. This can be
      *             any of the types defined in the manifest.
-     * @param stPacket - The packet to be packed into a RoveCommData structure.
-     * @return RoveCommData - The packed data.
+     * @param stPacket - The packet to measure.
+     * @return size_t - The packed size in bytes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    size_t GetPackedSize(const RoveCommPacket<T>& stPacket)
+    {
+        return ROVECOMM_PACKET_HEADER_SIZE + (sizeof(T) * stPacket.unDataCount);
+    }
+
+    /******************************************************************************
+     * @brief Get the size of one element of a manifest data type.
+     *
+     * @param eDataType - The data type.
+     * @return size_t - The element size in bytes, or 0 if the data type is not one
+     *                  defined in the manifest.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t GetDataTypeSize(manifest::DataTypes eDataType)
+    {
+        switch (eDataType)
+        {
+            case manifest::DataTypes::UINT8_T: return sizeof(uint8_t);
+            case manifest::DataTypes::INT8_T: return sizeof(int8_t);
+            case manifest::DataTypes::UINT16_T: return sizeof(uint16_t);
+            case manifest::DataTypes::INT16_T: return sizeof(int16_t);
+            case manifest::DataTypes::UINT32_T: return sizeof(uint32_t);
+            case manifest::DataTypes::INT32_T: return sizeof(int32_t);
+            case manifest::DataTypes::FLOAT_T: return sizeof(float);
+            case manifest::DataTypes::DOUBLE_T: return sizeof(double);
+            case manifest::DataTypes::CHAR: return sizeof(char);
+        }
+
+        return 0;
+    }
+
+    /******************************************************************************
+     * @brief Get the packed size of the packet that starts at pData, as declared by
+     *        its header. Used to walk packets that are stored back to back.
+     *
+     * @param pData - The start of a packed packet.
+     * @param siDataSize - The number of bytes available from pData on.
+     * @return size_t - The packed size in bytes. Returns 0 if the header is
+     *                  incomplete, is not a version 3 header, has an unknown data
+     *                  type, or declares more bytes than are available.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t GetPackedSize(const uint8_t* pData, size_t siDataSize)
+    {
+        if (siDataSize < ROVECOMM_PACKET_HEADER_SIZE || pData[0] != ROVECOMM_VERSION)
+        {
+            return 0;
+        }
+
+        size_t siElementSize = GetDataTypeSize(static_cast<manifest::DataTypes>(pData[5]));
+        size_t siPackedSize  = ROVECOMM_PACKET_HEADER_SIZE + siElementSize * ((pData[3] << 8) | pData[4]);
+        if (siElementSize == 0 || siPackedSize > siDataSize)
+        {
+            return 0;
+        }
+
+        return siPackedSize;
+    }
+
+    /******************************************************************************
+     * @brief Pack a RoveCommPacket into a caller-supplied buffer. Only the bytes
+     *        that make up the packet are written.
+     *
+     * @tparam T - The type of data that is to be sent or received. This can be
+     *             any of the types defined in the manifest.
+     * @param stPacket - The packet to be packed.
+     * @param pBuffer - The buffer to pack the packet into.
+     * @param siBufferSize - The size of pBuffer in bytes.
+     * @return size_t - The number of bytes written. Returns 0 if the buffer is too
+     *                  small or the packet has fewer elements than its data count.
      *
      * @note The accepted versions of the Pack Packet function are templated and
      *       are explicitly instantiated at the end of this file.
      *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
     template<typename T>
-    RoveCommData PackPacket(const RoveCommPacket<T>& stPacket)
+    size_t PackPacket(const RoveCommPacket<T>& stPacket, uint8_t* pBuffer, size_t siBufferSize)
     {
-        RoveCommData stData;
+        // Make sure the packet fits and has as much data as it claims.
+        size_t siPackedSize = GetPackedSize(stPacket);
+        if (siPackedSize > siBufferSize || stPacket.vData.size() < stPacket.unDataCount)
+        {
+            return 0;
+        }
 
         // The first byte of the data is the version number
-        stData.unBytes[0] = ROVECOMM_VERSION;
+        pBuffer[0] = ROVECOMM_VERSION;
 
         // The next two bytes are the data ID
-        stData.unBytes[1] = stPacket.unDataId >> 8;
-        stData.unBytes[2] = stPacket.unDataId;
+        pBuffer[1] = stPacket.unDataId >> 8;
+        pBuffer[2] = stPacket.unDataId;
 
         // The next two bytes are the data count
-        stData.unBytes[3] = stPacket.unDataCount >> 8;
-        stData.unBytes[4] = stPacket.unDataCount;
+        pBuffer[3] = stPacket.unDataCount >> 8;
+        pBuffer[4] = stPacket.unDataCount;
 
         // The next byte is the data type
-        stData.unBytes[5] = static_cast<uint8_t>(stPacket.eDataType);
+        pBuffer[5] = static_cast<uint8_t>(stPacket.eDataType);
 
-        // The rest of the data is the data payload
-        size_t siDataSize = sizeof(T) * stPacket.unDataCount;
-        // Initialize pointers for looping through data.
-        uint8_t* pDataPtr    = &stData.unBytes[ROVECOMM_PACKET_HEADER_SIZE];
+        // Copy the payload, converting it to network order with the fastest available kernel.
+        uint8_t* pDataPtr    = &pBuffer[ROVECOMM_PACKET_HEADER_SIZE];
         const T* pPacketData = stPacket.vData.data();
-        // Loop through data.
         static_assert(std::is_arithmetic<T>::value);
-        for (uint16_t unInter = 0; unInter < stPacket.unDataCount; ++unInter)
-        {
-            // INT8_T, UINT8_T, CHAR
-            if constexpr (sizeof(T) == sizeof(uint8_t))
-            {
-                // No need to convert to network order.
-                memcpy(pDataPtr, &pPacketData[unInter], sizeof(uint8_t));
-                pDataPtr += sizeof(uint8_t);
-            }
-            // INT16_T, UINT16_T
-            else if constexpr (sizeof(T) == sizeof(uint16_t))
-            {
-                // Convert to network order and add to RoveCommData.
-                uint16_t unResult;
-                memcpy(&unResult, &pPacketData[unInter], sizeof(uint16_t));
-                unResult = htons(unResult);
-                // Add converted data to RoveCommData.
-                memcpy(pDataPtr, &unResult, sizeof(uint16_t));
-                pDataPtr += sizeof(uint16_t);
-            }
-            // INT32_T, UINT32_T, FLOAT_T
-            else if constexpr (sizeof(T) == sizeof(uint32_t))
-            {
-                // Convert to network order and add to RoveCommData.
-                uint32_t unResult;
-                memcpy(&unResult, &pPacketData[unInter], sizeof(uint32_t));
-                unResult = htonl(unResult);
-                // Add converted data to RoveCommData.
-                memcpy(pDataPtr, &unResult, sizeof(uint32_t));
-                pDataPtr += sizeof(uint32_t);
-            }
-            // DOUBLE_T
-            else if constexpr (sizeof(T) == sizeof(uint64_t))
-            {
-                // Convert to network order and add to RoveCommData.
-                uint64_t unResult;
-                memcpy(&unResult, &pPacketData[unInter], sizeof(uint64_t));
-                unResult = htonll(unResult);
-                // Add converted data to RoveCommData.
-                memcpy(pDataPtr, &unResult, sizeof(uint64_t));
-                pDataPtr += sizeof(uint64_t);
-            }
+        // INT8_T, UINT8_T, CHAR
+        if constexpr (sizeof(T) == sizeof(uint8_t))
+        {
+            // No need to convert to network order.
+            memcpy(pDataPtr, pPacketData, stPacket.unDataCount);
+        }
+        // INT16_T, UINT16_T
+        else if constexpr (sizeof(T) == sizeof(uint16_t))
+        {
+            ConvertByteOrder16(pPacketData, pDataPtr, stPacket.unDataCount);
+        }
+        // INT32_T, UINT32_T, FLOAT_T
+        else if constexpr (sizeof(T) == sizeof(uint32_t))
+        {
+            ConvertByteOrder32(pPacketData, pDataPtr, stPacket.unDataCount);
+        }
+        // DOUBLE_T
+        else if constexpr (sizeof(T) == sizeof(uint64_t))
+        {
+            ConvertByteOrder64(pPacketData, pDataPtr, stPacket.unDataCount);
+        }
+
+        return siPackedSize;
+    }
+
+    /******************************************************************************
+     * @brief Create a RoveCommData structure from a RoveCommPacket structure.
+     *
+     * @tparam T - The type of data that is to be sent or received. This can be
+     *             any of the types defined in the manifest.
+     * @param stPacket - The packet to be packed into a RoveCommData structure.
+     * @return RoveCommData - The packed data. If the packet does not fit or has
+     *                        fewer elements than its data count, every byte is
+     *                        zero, so the result has no version 3 header and
+     *                        GetPackedSize() of it returns 0.
+     *
+     * @note Prefer packing into a buffer sized with GetPackedSize() on hot paths.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommData PackPacket(const RoveCommPacket<T>& stPacket)
+    {
+        RoveCommData stData;
+        if (PackPacket(stPacket, stData.unBytes, sizeof(stData.unBytes)) == 0)
+        {
+            std::cerr << "Failed to pack packet with data id " << stPacket.unDataId << " into a RoveCommData." << std::endl;
+            memset(stData.unBytes, 0, sizeof(stData.unBytes));
         }
 
         return stData;
@@ -114,107 +204,274 @@ namespace rovecomm
 
     // Explicit instantiation of the template for supported types
     template RoveCommData PackPacket<uint8_t>(const RoveCommPacket<uint8_t>& stPacket);
+    template size_t PackPacket<uint8_t>(const RoveCommPacket<uint8_t>& stPacket, uint8_t* pBuffer, size_t siBufferSize);
+    template size_t GetPackedSize<uint8_t>(const RoveCommPacket<uint8_t>& stPacket);
     template RoveCommData PackPacket<uint16_t>(const RoveCommPacket<uint16_t>& stPacket);
+    template size_t PackPacket<uint16_t>(const RoveCommPacket<uint16_t>& stPacket, uint8_t* pBuffer, size_t siBufferSize);
+    template size_t GetPackedSize<uint16_t>(const RoveCommPacket<uint16_t>& stPacket);
     template RoveCommData PackPacket<uint32_t>(const RoveCommPacket<uint32_t>& stPacket);
+    template size_t PackPacket<uint32_t>(const RoveCommPacket<uint32_t>& stPacket, uint8_t* pBuffer, size_t siBufferSize);
+    template size_t GetPackedSize<uint32_t>(const RoveCommPacket<uint32_t>& stPacket);
     template RoveCommData PackPacket<int8_t>(const RoveCommPacket<int8_t>& stPacket);
+    template size_t PackPacket<int8_t>(const RoveCommPacket<int8_t>& stPacket, uint8_t* pBuffer, size_t siBufferSize);
+    template size_t GetPackedSize<int8_t>(const RoveCommPacket<int8_t>& stPacket);
     template RoveCommData PackPacket<int16_t>(const RoveCommPacket<int16_t>& stPacket);
+    template size_t PackPacket<int16_t>(const RoveCommPacket<int16_t>& stPacket, uint8_t* pBuffer, size_t siBufferSize);
+    template size_t GetPackedSize<int16_t>(const RoveCommPacket<int16_t>& stPacket);
     template RoveCommData PackPacket<int32_t>(const RoveCommPacket<int32_t>& stPacket);
+    template size_t PackPacket<int32_t>(const RoveCommPacket<int32_t>& stPacket, uint8_t* pBuffer, size_t siBufferSize);
+    template size_t GetPackedSize<int32_t>(const RoveCommPacket<int32_t>& stPacket);
     template RoveCommData PackPacket<float>(const RoveCommPacket<float>& stPacket);
+    template size_t PackPacket<float>(const RoveCommPacket<float>& stPacket, uint8_t* pBuffer, size_t siBufferSize);
+    template size_t GetPackedSize<float>(const RoveCommPacket<float>& stPacket);
     template RoveCommData PackPacket<double>(const RoveCommPacket<double>& stPacket);
+    template size_t PackPacket<double>(const RoveCommPacket<double>& stPacket, uint8_t* pBuffer, size_t siBufferSize);
+    template size_t GetPackedSize<double>(const RoveCommPacket<double>& stPacket);
     template RoveCommData PackPacket<char>(const RoveCommPacket<char>& stPacket);
+    template size_t PackPacket<char>(const RoveCommPacket<char>& stPacket, uint8_t* pBuffer, size_t siBufferSize);
+    template size_t GetPackedSize<char>(const RoveCommPacket<char>& stPacket);
 
     /******************************************************************************
-     * @brief Create a RoveCommPacket structure from a RoveCommData structure.
+     * @brief Create a RoveCommPacket structure from a buffer of received bytes.
+     *        The data count is clamped to the number of elements in the buffer.
      *
      * @tparam T - The type of data that is to be sent or received. This can be
      *             any of the types defined in the manifest.
-     * @param stData - The data to be unpacked into a RoveCommPacket structure.
+     * @param pData - The received bytes, starting with the packet header.
+     * @param siDataSize - The number of valid bytes in pData.
      * @return RoveCommPacket<T> - The unpacked packet.
      *
      * @note The accepted versions of the Unpack Data function are templated and
      *       are explicitly instantiated at the end of this file.
      *
      * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
     template<typename T>
-    RoveCommPacket<T> UnpackData(const RoveCommData& stData)
+    RoveCommPacket<T> UnpackData(const uint8_t* pData, size_t siDataSize)
     {
         RoveCommPacket<T> stPacket;
 
-        // Extract data from stData and fill stPacket
-        stPacket.unDataId    = (stData.unBytes[1] << 8) | stData.unBytes[2];
-        stPacket.unDataCount = (stData.unBytes[3] << 8) | stData.unBytes[4];
-        stPacket.eDataType   = static_cast<manifest::DataTypes>(stData.unBytes[5]);
+        // A buffer without a full header holds no packet.
+        if (siDataSize < ROVECOMM_PACKET_HEADER_SIZE)
+        {
+            stPacket.unDataId    = 0;
+            stPacket.unDataCount = 0;
+            stPacket.eDataType   = static_cast<manifest::DataTypes>(0);
+            return stPacket;
+        }
+
+        // Extract data from pData and fill stPacket
+        stPacket.unDataId    = (pData[1] << 8) | pData[2];
+        stPacket.unDataCount = (pData[3] << 8) | pData[4];
+        stPacket.eDataType   = static_cast<manifest::DataTypes>(pData[5]);
+
+        // Never read past the end of the buffer.
+        if (stPacket.unDataCount > (siDataSize - ROVECOMM_PACKET_HEADER_SIZE) / sizeof(T))
+        {
+            stPacket.unDataCount = (siDataSize - ROVECOMM_PACKET_HEADER_SIZE) / sizeof(T);
+        }
 
-        // Copy the data payload from stData to stPacket's vData vector
+        // Copy the data payload from pData to stPacket's vData vector
         stPacket.vData.resize(stPacket.unDataCount);
 
-        // Initialize pointers for looping through data.
-        const uint8_t* pDataPtr = &stData.unBytes[ROVECOMM_PACKET_HEADER_SIZE];
+        // Copy the payload, converting it to host order with the fastest available kernel.
+        const uint8_t* pDataPtr = &pData[ROVECOMM_PACKET_HEADER_SIZE];
         T* pPacketData          = stPacket.vData.data();
-        // Loop through data.
         static_assert(std::is_arithmetic<T>::value);
-        for (uint16_t unInter = 0; unInter < stPacket.unDataCount; ++unInter)
-        {
-            // INT8_T, UINT8_T, CHAR
-            if constexpr (sizeof(T) == sizeof(uint8_t))
-            {
-                // No need to convert to host order.
-                memcpy(&pPacketData[unInter], pDataPtr, sizeof(uint8_t));
-                pDataPtr += sizeof(uint8_t);
-            }
-            // INT16_T, UINT16_T
-            else if constexpr (sizeof(T) == sizeof(uint16_t))
-            {
-                // Convert to host order and add to RoveCommData.
-                uint16_t unResult;
-                memcpy(&unResult, pDataPtr, sizeof(uint16_t));
-                unResult = ntohs(unResult);
-                // Add converted data to RoveCommData.
-                T tValue;
-                memcpy(&tValue, &unResult, sizeof(uint16_t));
-                pPacketData[unInter] = tValue;
-                pDataPtr += sizeof(uint16_t);
-            }
-            // INT32_T, UINT32_T, FLOAT_T
-            else if constexpr (sizeof(T) == sizeof(uint32_t))
-            {
-                // Convert to host order and add to RoveCommData.
-                uint32_t unResult;
-                memcpy(&unResult, pDataPtr, sizeof(uint32_t));
-                unResult = ntohl(unResult);
-                // Add converted data to RoveCommData.
-                T tValue;
-                memcpy(&tValue, &unResult, sizeof(uint32_t));
-                pPacketData[unInter] = tValue;
-                pDataPtr += sizeof(uint32_t);
-            }
-            // DOUBLE_T
-            else if constexpr (sizeof(T) == sizeof(uint64_t))
-            {
-                // Convert to host order and add to RoveCommData.
-                uint64_t unResult;
-                memcpy(&unResult, pDataPtr, sizeof(uint64_t));
-                unResult = ntohll(unResult);
-                // Add converted data to RoveCommData.
-                T tValue;
-                memcpy(&tValue, &unResult, sizeof(uint64_t));
-                pPacketData[unInter] = tValue;
-                pDataPtr += sizeof(uint64_t);
-            }
+        // INT8_T, UINT8_T, CHAR
+        if constexpr (sizeof(T) == sizeof(uint8_t))
+        {
+            // No need to convert to host order.
+            memcpy(pPacketData, pDataPtr, stPacket.unDataCount);
+        }
+        // INT16_T, UINT16_T
+        else if constexpr (sizeof(T) == sizeof(uint16_t))
+        {
+            ConvertByteOrder16(pDataPtr, pPacketData, stPacket.unDataCount);
+        }
+        // INT32_T, UINT32_T, FLOAT_T
+        else if constexpr (sizeof(T) == sizeof(uint32_t))
+        {
+            ConvertByteOrder32(pDataPtr, pPacketData, stPacket.unDataCount);
+        }
+        // DOUBLE_T
+        else if constexpr (sizeof(T) == sizeof(uint64_t))
+        {
+            ConvertByteOrder64(pDataPtr, pPacketData, stPacket.unDataCount);
         }
         return stPacket;
     }
 
+    /******************************************************************************
+     * @brief Create a RoveCommPacket structure from a RoveCommData structure.
+     *
+     * @tparam T - The type of data that is to be sent or received. This can be
+     *             any of the types defined in the manifest.
+     * @param stData - The data to be unpacked into a RoveCommPacket structure.
+     * @return RoveCommPacket<T> - The unpacked packet.
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommPacket<T> UnpackData(const RoveCommData& stData)
+    {
+        return UnpackData<T>(stData.unBytes, sizeof(stData.unBytes));
+    }
+
     // Explicit instantiation of the template for supported types
     template RoveCommPacket<uint8_t> UnpackData<uint8_t>(const RoveCommData& stData);
+    template RoveCommPacket<uint8_t> UnpackData<uint8_t>(const uint8_t* pData, size_t siDataSize);
     template RoveCommPacket<uint16_t> UnpackData<uint16_t>(const RoveCommData& stData);
+    template RoveCommPacket<uint16_t> UnpackData<uint16_t>(const uint8_t* pData, size_t siDataSize);
     template RoveCommPacket<uint32_t> UnpackData<uint32_t>(const RoveCommData& stData);
+    template RoveCommPacket<uint32_t> UnpackData<uint32_t>(const uint8_t* pData, size_t siDataSize);
     template RoveCommPacket<int8_t> UnpackData<int8_t>(const RoveCommData& stData);
+    template RoveCommPacket<int8_t> UnpackData<int8_t>(const uint8_t* pData, size_t siDataSize);
     template RoveCommPacket<int16_t> UnpackData<int16_t>(const RoveCommData& stData);
+    template RoveCommPacket<int16_t> UnpackData<int16_t>(const uint8_t* pData, size_t siDataSize);
     template RoveCommPacket<int32_t> UnpackData<int32_t>(const RoveCommData& stData);
+    template RoveCommPacket<int32_t> UnpackData<int32_t>(const uint8_t* pData, size_t siDataSize);
     template RoveCommPacket<float> UnpackData<float>(const RoveCommData& stData);
+    template RoveCommPacket<float> UnpackData<float>(const uint8_t* pData, size_t siDataSize);
     template RoveCommPacket<double> UnpackData<double>(const RoveCommData& stData);
+    template RoveCommPacket<double> UnpackData<double>(const uint8_t* pData, size_t siDataSize);
     template RoveCommPacket<char> UnpackData<char>(const RoveCommData& stData);
+    template RoveCommPacket<char> UnpackData<char>(const uint8_t* pData, size_t siDataSize);
+
+    /******************************************************************************
+     * @brief Create a RoveCommPacketView over a buffer of received bytes without
+     *        copying the payload. The data count is clamped to the number of
+     *        elements in the buffer.
+     *
+     * @tparam T - The type of data that was received. This can be any of the types
+     *             defined in the manifest.
+     * @param pData - The received bytes, starting with the packet header. Must
+     *                outlive the returned view.
+     * @param siDataSize - The number of valid bytes in pData.
+     * @return RoveCommPacketView<T> - The view over pData.
+     *
+     * @note The accepted versions of the View Data function are templated and
+     *       are explicitly instantiated at the end of this file.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommPacketView<T> ViewData(const uint8_t* pData, size_t siDataSize)
+    {
+        // A buffer without a full header holds no packet.
+        if (siDataSize < ROVECOMM_PACKET_HEADER_SIZE)
+        {
+            return RoveCommPacketView<T>(pData, 0, 0, static_cast<manifest::DataTypes>(0));
+        }
+
+        // Extract the header from pData.
+        uint16_t unDataId    = (pData[1] << 8) | pData[2];
+        uint16_t unDataCount = (pData[3] << 8) | pData[4];
+
+        // Never let the view read past the end of the buffer.
+        const size_t siMaxDataCount = (siDataSize - ROVECOMM_PACKET_HEADER_SIZE) / sizeof(T);
+        if (unDataCount > siMaxDataCount)
+        {
+            unDataCount = siMaxDataCount;
+        }
+
+        return RoveCommPacketView<T>(&pData[ROVECOMM_PACKET_HEADER_SIZE], unDataId, unDataCount, static_cast<manifest::DataTypes>(pData[5]));
+    }
+
+    /******************************************************************************
+     * @brief Create a RoveCommPacketView over a RoveCommData structure without
+     *        copying the payload.
+     *
+     * @tparam T - The type of data that was received. This can be any of the types
+     *             defined in the manifest.
+     * @param stData - The data to view. Must outlive the returned view.
+     * @return RoveCommPacketView<T> - The view over stData.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommPacketView<T> ViewData(const RoveCommData& stData)
+    {
+        return ViewData<T>(stData.unBytes, sizeof(stData.unBytes));
+    }
+
+    /******************************************************************************
+     * @brief Copy the viewed data into an owning RoveCommPacket, converting every
+     *        element to host byte order.
+     *
+     * @tparam T - The type of data in the packet.
+     * @return RoveCommPacket<T> - A packet that no longer depends on the buffer.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommPacket<T> RoveCommPacketView<T>::ToPacket() const
+    {
+        RoveCommPacket<T> stPacket;
+        stPacket.unDataId    = unDataId;
+        stPacket.unDataCount = unDataCount;
+        stPacket.eDataType   = eDataType;
+        stPacket.vData.resize(unDataCount);
+
+        // Copy the payload, converting it to host order with the fastest available kernel.
+        // INT8_T, UINT8_T, CHAR
+        if constexpr (sizeof(T) == sizeof(uint8_t))
+        {
+            memcpy(stPacket.vData.data(), m_pPayload, unDataCount);
+        }
+        // INT16_T, UINT16_T
+        else if constexpr (sizeof(T) == sizeof(uint16_t))
+        {
+            ConvertByteOrder16(m_pPayload, stPacket.vData.data(), unDataCount);
+        }
+        // INT32_T, UINT32_T, FLOAT_T
+        else if constexpr (sizeof(T) == sizeof(uint32_t))
+        {
+            ConvertByteOrder32(m_pPayload, stPacket.vData.data(), unDataCount);
+        }
+        // DOUBLE_T
+        else if constexpr (sizeof(T) == sizeof(uint64_t))
+        {
+            ConvertByteOrder64(m_pPayload, stPacket.vData.data(), unDataCount);
+        }
+
+        return stPacket;
+    }
+
+    // Explicit instantiation of the template for supported types
+    template RoveCommPacketView<uint8_t> ViewData<uint8_t>(const RoveCommData& stData);
+    template RoveCommPacketView<uint8_t> ViewData<uint8_t>(const uint8_t* pData, size_t siDataSize);
+    template RoveCommPacketView<uint16_t> ViewData<uint16_t>(const RoveCommData& stData);
+    template RoveCommPacketView<uint16_t> ViewData<uint16_t>(const uint8_t* pData, size_t siDataSize);
+    template RoveCommPacketView<uint32_t> ViewData<uint32_t>(const RoveCommData& stData);
+    template RoveCommPacketView<uint32_t> ViewData<uint32_t>(const uint8_t* pData, size_t siDataSize);
+    template RoveCommPacketView<int8_t> ViewData<int8_t>(const RoveCommData& stData);
+    template RoveCommPacketView<int8_t> ViewData<int8_t>(const uint8_t* pData, size_t siDataSize);
+    template RoveCommPacketView<int16_t> ViewData<int16_t>(const RoveCommData& stData);
+    template RoveCommPacketView<int16_t> ViewData<int16_t>(const uint8_t* pData, size_t siDataSize);
+    template RoveCommPacketView<int32_t> ViewData<int32_t>(const RoveCommData& stData);
+    template RoveCommPacketView<int32_t> ViewData<int32_t>(const uint8_t* pData, size_t siDataSize);
+    template RoveCommPacketView<float> ViewData<float>(const RoveCommData& stData);
+    template RoveCommPacketView<float> ViewData<float>(const uint8_t* pData, size_t siDataSize);
+    template RoveCommPacketView<double> ViewData<double>(const RoveCommData& stData);
+    template RoveCommPacketView<double> ViewData<double>(const uint8_t* pData, size_t siDataSize);
+    template RoveCommPacketView<char> ViewData<char>(const RoveCommData& stData);
+    template RoveCommPacketView<char> ViewData<char>(const uint8_t* pData, size_t siDataSize);
+
+    template class RoveCommPacketView<uint8_t>;
+    template class RoveCommPacketView<uint16_t>;
+    template class RoveCommPacketView<uint32_t>;
+    template class RoveCommPacketView<int8_t>;
+    template class RoveCommPacketView<int16_t>;
+    template class RoveCommPacketView<int32_t>;
+    template class RoveCommPacketView<float>;
+    template class RoveCommPacketView<double>;
+    template class RoveCommPacketView<char>;
 }    // namespace rovecomm
@@ -15,8 +15,10 @@
 #include "./RoveCommManifest.h"
 
 /// \cond
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <iterator>
 #include <vector>
 
 #if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
@@ -88,12 +90,165 @@ namespace rovecomm
             uint8_t unBytes[ROVECOMM_PACKET_HEADER_SIZE + sizeof(uint8_t) * ROVECOMM_PACKET_MAX_DATA_COUNT / 2];
     };
 
+    /******************************************************************************
+     * @brief The RoveCommPacketView class is a non-owning, typed view over the
+     *        payload of a received RoveCommData buffer. Elements are converted from
+     *        network byte order only when they are accessed, so creating a view
+     *        never copies the payload or allocates memory. The view can be indexed
+     *        and iterated like a span.
+     *
+     * @tparam T - The data type of the elements in the packet. This can be any of
+     *             the data types defined in the manifest.
+     *
+     * @note A view is only valid for as long as the buffer it was created from.
+     *       Views handed to receive callbacks point into the node's receive
+     *       buffer, so call ToPacket() to keep the data after the callback returns.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    class RoveCommPacketView
+    {
+        private:
+            // Private member variables
+            const uint8_t* m_pPayload;
+
+        public:
+            uint16_t unDataId;
+            uint16_t unDataCount;
+            manifest::DataTypes eDataType;
+
+            /******************************************************************************
+             * @brief Read one element from network byte order.
+             *
+             * @param pBytes - Pointer to the first byte of the element.
+             * @return T - The element in host byte order.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            static T ReadElement(const uint8_t* pBytes)
+            {
+                static_assert(std::is_arithmetic<T>::value);
+                T tValue;
+                // INT8_T, UINT8_T, CHAR
+                if constexpr (sizeof(T) == sizeof(uint8_t))
+                {
+                    memcpy(&tValue, pBytes, sizeof(uint8_t));
+                }
+                // INT16_T, UINT16_T
+                else if constexpr (sizeof(T) == sizeof(uint16_t))
+                {
+                    uint16_t unResult;
+                    memcpy(&unResult, pBytes, sizeof(uint16_t));
+                    unResult = ntohs(unResult);
+                    memcpy(&tValue, &unResult, sizeof(uint16_t));
+                }
+                // INT32_T, UINT32_T, FLOAT_T
+                else if constexpr (sizeof(T) == sizeof(uint32_t))
+                {
+                    uint32_t unResult;
+                    memcpy(&unResult, pBytes, sizeof(uint32_t));
+                    unResult = ntohl(unResult);
+                    memcpy(&tValue, &unResult, sizeof(uint32_t));
+                }
+                // DOUBLE_T
+                else if constexpr (sizeof(T) == sizeof(uint64_t))
+                {
+                    uint64_t unResult;
+                    memcpy(&unResult, pBytes, sizeof(uint64_t));
+                    unResult = ntohll(unResult);
+                    memcpy(&tValue, &unResult, sizeof(uint64_t));
+                }
+                return tValue;
+            }
+
+            /******************************************************************************
+             * @brief Forward iterator over the elements of a RoveCommPacketView. The
+             *        iterator yields converted values, not references into the buffer.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-17
+             ******************************************************************************/
+            class Iterator
+            {
+                private:
+                    // Private member variables
+                    const uint8_t* m_pElement;
+
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type        = T;
+                    using difference_type   = std::ptrdiff_t;
+                    using pointer           = void;
+                    using reference         = T;
+
+                    explicit Iterator(const uint8_t* pElement) : m_pElement(pElement) {}
+
+                    T operator*() const { return ReadElement(m_pElement); }
+
+                    Iterator& operator++()
+                    {
+                        m_pElement += sizeof(T);
+                        return *this;
+                    }
+
+                    Iterator operator++(int)
+                    {
+                        Iterator itPrevious = *this;
+                        m_pElement += sizeof(T);
+                        return itPrevious;
+                    }
+
+                    bool operator==(const Iterator& itOther) const { return m_pElement == itOther.m_pElement; }
+
+                    bool operator!=(const Iterator& itOther) const { return m_pElement != itOther.m_pElement; }
+            };
+
+            RoveCommPacketView(const uint8_t* pPayload, uint16_t unPacketDataId, uint16_t unPacketDataCount, manifest::DataTypes ePacketDataType) :
+                m_pPayload(pPayload), unDataId(unPacketDataId), unDataCount(unPacketDataCount), eDataType(ePacketDataType)
+            {}
+
+            // Element access. Indices are not bounds checked, use size() first.
+            T operator[](size_t siIndex) const { return ReadElement(m_pPayload + siIndex * sizeof(T)); }
+
+            size_t size() const { return unDataCount; }
+
+            bool empty() const { return unDataCount == 0; }
+
+            Iterator begin() const { return Iterator(m_pPayload); }
+
+            Iterator end() const { return Iterator(m_pPayload + unDataCount * sizeof(T)); }
+
+            // Copy the data into an owning packet.
+            RoveCommPacket<T> ToPacket() const;
+    };
+
     // RoveCommPacket and RoveCommData packing and unpacking functions
+    template<typename T>
+    size_t GetPackedSize(const RoveCommPacket<T>& stPacket);
+
+    size_t GetDataTypeSize(manifest::DataTypes eDataType);
+    size_t GetPackedSize(const uint8_t* pData, size_t siDataSize);
+
+    template<typename T>
+    size_t PackPacket(const RoveCommPacket<T>& stPacket, uint8_t* pBuffer, size_t siBufferSize);
+
     template<typename T>
     RoveCommData PackPacket(const RoveCommPacket<T>& stPacket);
 
+    template<typename T>
+    RoveCommPacket<T> UnpackData(const uint8_t* pData, size_t siDataSize);
+
     template<typename T>
     RoveCommPacket<T> UnpackData(const RoveCommData& stData);
+
+    template<typename T>
+    RoveCommPacketView<T> ViewData(const uint8_t* pData, size_t siDataSize);
+
+    template<typename T>
+    RoveCommPacketView<T> ViewData(const RoveCommData& stData);
 }    // namespace rovecomm
 
 #endif    // ROVECOMM_PACKET_H
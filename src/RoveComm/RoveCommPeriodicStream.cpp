@@ -0,0 +1,190 @@
+/******************************************************************************
+ * @brief RoveComm Periodic Stream Implementation.
+ *
+ * @file RoveCommPeriodicStream.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommPeriodicStream.h"
+#include "RoveCommLatestValueCache.h"
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Construct the type independent part of a periodic stream.
+     *
+     * @param unDataId - The data id of the packets sent.
+     * @param unPeriodTicks - The number of scheduler ticks between samples. Must
+     *                        be at least 1.
+     * @param pTargetAddr - An address to send to in addition to the node's
+     *                      subscribers, or nullptr to only send to subscribers.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommPeriodicStream::RoveCommPeriodicStream(uint16_t unDataId, uint64_t unPeriodTicks, const sockaddr_in* pTargetAddr) :
+        m_unDataId(unDataId), m_unPeriodTicks(unPeriodTicks)
+    {
+        m_bHasTarget = pTargetAddr != nullptr;
+        if (m_bHasTarget)
+        {
+            m_saTargetAddr = *pTargetAddr;
+        }
+        m_unDueTick = 0;
+
+        // Initialize the statistics.
+        m_unSampled = 0;
+        m_unSent    = 0;
+        m_unSkipped = 0;
+        m_unMissed  = 0;
+    }
+
+    /******************************************************************************
+     * @brief Call the producer and append its packet to the scheduler's batch.
+     *        Only called by the scheduler thread.
+     *
+     * @param stBatch - The batch sent at the end of the current tick.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPeriodicStream::Sample(RoveCommUDPBatch& stBatch)
+    {
+        m_unSampled.fetch_add(1, std::memory_order_relaxed);
+        if (Produce(stBatch, m_bHasTarget ? &m_saTargetAddr : nullptr))
+        {
+            m_unSent.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            m_unSkipped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Get the data id of the packets sent.
+     *
+     * @return uint16_t - The data id.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint16_t RoveCommPeriodicStream::GetDataId() const
+    {
+        return m_unDataId;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of scheduler ticks between samples.
+     *
+     * @return uint64_t - The period, after rounding the rate to whole ticks.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint64_t RoveCommPeriodicStream::GetPeriodTicks() const
+    {
+        return m_unPeriodTicks;
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of this stream's counters.
+     *
+     * @return RoveCommPeriodicStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommPeriodicStatistics RoveCommPeriodicStream::GetStatistics() const
+    {
+        RoveCommPeriodicStatistics stStatistics;
+        stStatistics.unSampled = m_unSampled.load(std::memory_order_relaxed);
+        stStatistics.unSent    = m_unSent.load(std::memory_order_relaxed);
+        stStatistics.unSkipped = m_unSkipped.load(std::memory_order_relaxed);
+        stStatistics.unMissed  = m_unMissed.load(std::memory_order_relaxed);
+
+        return stStatistics;
+    }
+
+    /******************************************************************************
+     * @brief Construct a new periodic stream of one data type.
+     *
+     * @tparam T - The data type of the elements in the packet.
+     * @param unDataId - The data id of the packets sent.
+     * @param unPeriodTicks - The number of scheduler ticks between samples.
+     * @param pTargetAddr - An address to send to in addition to the node's
+     *                      subscribers, or nullptr to only send to subscribers.
+     * @param fnProducer - Called every period on the scheduler thread to fill in
+     *                     the packet's data.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommPeriodicStreamOf<T>::RoveCommPeriodicStreamOf(uint16_t unDataId, uint64_t unPeriodTicks, const sockaddr_in* pTargetAddr, Producer fnProducer) :
+        RoveCommPeriodicStream(unDataId, unPeriodTicks, pTargetAddr), m_fnProducer(std::move(fnProducer))
+    {
+        m_stPacket.unDataId    = unDataId;
+        m_stPacket.unDataCount = 0;
+        m_stPacket.eDataType   = GetDataTypeOf<T>();
+    }
+
+    /******************************************************************************
+     * @brief Let the producer fill in the packet, then pack it onto the batch. The
+     *        data id and data type are the stream's, and the data count is the
+     *        number of elements the producer left in vData.
+     *
+     * @tparam T - The data type of the elements in the packet.
+     * @param stBatch - The batch to append to.
+     * @param pTargetAddr - The stream's extra destination, or nullptr.
+     * @return true - The packet was appended.
+     * @return false - The producer skipped this period, left more elements than a
+     *                 packet can carry, or the packet could not be packed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    bool RoveCommPeriodicStreamOf<T>::Produce(RoveCommUDPBatch& stBatch, const sockaddr_in* pTargetAddr)
+    {
+        if (!m_fnProducer(m_stPacket))
+        {
+            return false;
+        }
+
+        // The data count is 16 bits, a larger packet would be sent truncated.
+        if (m_stPacket.vData.size() > ROVECOMM_PACKET_MAX_DATA_COUNT)
+        {
+            std::cerr << "Periodic stream for data id " << GetDataId() << " produced " << m_stPacket.vData.size() << " elements, more than a packet can carry."
+                      << std::endl;
+            return false;
+        }
+
+        m_stPacket.unDataId    = GetDataId();
+        m_stPacket.unDataCount = static_cast<uint16_t>(m_stPacket.vData.size());
+        m_stPacket.eDataType   = GetDataTypeOf<T>();
+        return stBatch.AddPacketTo(m_stPacket, pTargetAddr);
+    }
+
+    // Explicitly define template class types
+    template class RoveCommPeriodicStreamOf<uint8_t>;
+    template class RoveCommPeriodicStreamOf<int8_t>;
+    template class RoveCommPeriodicStreamOf<uint16_t>;
+    template class RoveCommPeriodicStreamOf<int16_t>;
+    template class RoveCommPeriodicStreamOf<uint32_t>;
+    template class RoveCommPeriodicStreamOf<int32_t>;
+    template class RoveCommPeriodicStreamOf<float>;
+    template class RoveCommPeriodicStreamOf<double>;
+    template class RoveCommPeriodicStreamOf<char>;
+}    // namespace rovecomm
@@ -0,0 +1,125 @@
+/******************************************************************************
+ * @brief The RoveCommPeriodicStream class describes a packet that a node samples
+ *        from a producer callback and sends at a fixed rate, so that modules do
+ *        not need a timer thread of their own for their telemetry.
+ *
+ * @file RoveCommPeriodicStream.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_PERIODIC_STREAM_H
+#define ROVECOMM_PERIODIC_STREAM_H
+
+#include "./RoveCommPacket.h"
+#include "./RoveCommUDPBatch.h"
+
+/// \cond
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    // Define a struct for reporting a snapshot of a periodic stream's counters.
+    struct RoveCommPeriodicStatistics
+    {
+        public:
+            uint64_t unSampled;    // Times the producer was called.
+            uint64_t unSent;       // Packets the producer filled in, handed to the node for sending.
+            uint64_t unSkipped;    // Times the producer returned false, or its packet could not be packed.
+            uint64_t unMissed;     // Periods that passed without a sample because the scheduler woke up late.
+    };
+
+    /******************************************************************************
+     * @brief The type independent part of a periodic stream. The scheduler samples
+     *        it every period, on ticks that are a multiple of the period, so that
+     *        streams with related rates are due on the same ticks and share a
+     *        send syscall.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommPeriodicStream
+    {
+        private:
+            // Private member variables
+            uint16_t m_unDataId;
+            uint64_t m_unPeriodTicks;
+            bool m_bHasTarget;
+            sockaddr_in m_saTargetAddr;
+            uint64_t m_unDueTick;
+
+            // Statistics counters.
+            std::atomic<uint64_t> m_unSampled;
+            std::atomic<uint64_t> m_unSent;
+            std::atomic<uint64_t> m_unSkipped;
+            std::atomic<uint64_t> m_unMissed;
+
+            friend class RoveCommPublisherScheduler;
+
+            // Scheduler functions
+            void Sample(RoveCommUDPBatch& stBatch);
+
+        protected:
+            virtual bool Produce(RoveCommUDPBatch& stBatch, const sockaddr_in* pTargetAddr) = 0;
+
+        public:
+            // Constructor
+            RoveCommPeriodicStream(uint16_t unDataId, uint64_t unPeriodTicks, const sockaddr_in* pTargetAddr);
+            RoveCommPeriodicStream(const RoveCommPeriodicStream&)            = delete;
+            RoveCommPeriodicStream& operator=(const RoveCommPeriodicStream&) = delete;
+            // Destructor
+            virtual ~RoveCommPeriodicStream() = default;
+
+            // Accessors
+            uint16_t GetDataId() const;
+            uint64_t GetPeriodTicks() const;
+            RoveCommPeriodicStatistics GetStatistics() const;
+    };
+
+    /******************************************************************************
+     * @brief A periodic stream of packets of one data type. The stream keeps its
+     *        packet between samples, so a producer that fills the same number of
+     *        elements every time does not allocate.
+     *
+     * @tparam T - The data type of the elements in the packet.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    class RoveCommPeriodicStreamOf : public RoveCommPeriodicStream
+    {
+        public:
+            // Define the producer type. It fills vData and returns false to skip this period.
+            using Producer = std::function<bool(RoveCommPacket<T>&)>;
+
+        private:
+            // Private member variables
+            Producer m_fnProducer;
+            RoveCommPacket<T> m_stPacket;
+
+            bool Produce(RoveCommUDPBatch& stBatch, const sockaddr_in* pTargetAddr) override;
+
+        public:
+            // Constructor
+            RoveCommPeriodicStreamOf(uint16_t unDataId, uint64_t unPeriodTicks, const sockaddr_in* pTargetAddr, Producer fnProducer);
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_PERIODIC_STREAM_H
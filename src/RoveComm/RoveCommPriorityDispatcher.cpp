@@ -0,0 +1,384 @@
+/******************************************************************************
+ * @brief RoveComm Priority Dispatcher Implementation.
+ *
+ * @file RoveCommPriorityDispatcher.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommPriorityDispatcher.h"
+
+/// \cond
+#include <limits>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    // One entry for every value a 16 bit data id can take.
+    static const size_t PRIORITY_TABLE_SIZE = std::numeric_limits<uint16_t>::max() + 1;
+
+    /******************************************************************************
+     * @brief Construct a new priority table with every data id at ePriorityNormal.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommPriorityTable::RoveCommPriorityTable()
+    {
+        m_pPriorities = std::make_unique<std::atomic<uint8_t>[]>(PRIORITY_TABLE_SIZE);
+        Reset();
+    }
+
+    /******************************************************************************
+     * @brief Set the priority class of a single data id.
+     *
+     * @param unDataId - The data id to classify.
+     * @param ePriority - The priority its packets are dispatched with.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPriorityTable::SetPriority(uint16_t unDataId, RoveCommPriority ePriority)
+    {
+        m_pPriorities[unDataId].store(static_cast<uint8_t>(ePriority), std::memory_order_relaxed);
+    }
+
+    /******************************************************************************
+     * @brief Set the priority class of every data id in a manifest map, such as
+     *        manifest::Core::COMMANDS.
+     *
+     * @param mpEntries - The manifest entries to classify.
+     * @param ePriority - The priority their packets are dispatched with.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPriorityTable::SetPriority(const std::map<std::string, manifest::ManifestEntry>& mpEntries, RoveCommPriority ePriority)
+    {
+        for (const auto& stEntry : mpEntries)
+        {
+            SetPriority(static_cast<uint16_t>(stEntry.second.DATA_ID), ePriority);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Classify a board from its manifest split: commands are dispatched at
+     *        ePriorityHigh, errors at ePriorityNormal and telemetry at ePriorityLow.
+     *
+     * @param mpCommands - The board's COMMANDS map.
+     * @param mpTelemetry - The board's TELEMETRY map.
+     * @param mpErrors - The board's ERROR map.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPriorityTable::SetManifestPriorities(const std::map<std::string, manifest::ManifestEntry>& mpCommands,
+                                                      const std::map<std::string, manifest::ManifestEntry>& mpTelemetry,
+                                                      const std::map<std::string, manifest::ManifestEntry>& mpErrors)
+    {
+        SetPriority(mpCommands, ePriorityHigh);
+        SetPriority(mpTelemetry, ePriorityLow);
+        SetPriority(mpErrors, ePriorityNormal);
+    }
+
+    /******************************************************************************
+     * @brief Put every data id back at ePriorityNormal.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPriorityTable::Reset()
+    {
+        for (size_t siIter = 0; siIter < PRIORITY_TABLE_SIZE; ++siIter)
+        {
+            m_pPriorities[siIter].store(static_cast<uint8_t>(ePriorityNormal), std::memory_order_relaxed);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Get the priority class of a data id.
+     *
+     * @param unDataId - The data id to look up.
+     * @return RoveCommPriority - Its priority, ePriorityNormal if none was set.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommPriority RoveCommPriorityTable::GetPriority(uint16_t unDataId) const
+    {
+        return static_cast<RoveCommPriority>(m_pPriorities[unDataId].load(std::memory_order_relaxed));
+    }
+
+    /******************************************************************************
+     * @brief Construct a new, open dispatcher with one lane per priority class.
+     *
+     * @param stPriorities - The table used to classify packets. It must outlive the
+     *                       dispatcher, and can still be changed while it runs.
+     * @param siLaneCapacity - The number of packets each lane can hold.
+     * @param ePolicy - What Push() does when a lane is full.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommPriorityDispatcher::RoveCommPriorityDispatcher(const RoveCommPriorityTable& stPriorities, size_t siLaneCapacity, RoveCommOverflowPolicy ePolicy) :
+        m_stPriorities(stPriorities)
+    {
+        for (int nIter = 0; nIter < ePriorityCount; ++nIter)
+        {
+            m_aLanes[nIter]            = std::make_unique<RoveCommDispatchQueue>(siLaneCapacity, ePolicy);
+            m_aDedicatedWorkers[nIter] = false;
+        }
+
+        // Initialize member variables.
+        m_unNextWorker       = 0;
+        m_bClosed            = false;
+        m_unPushSignal       = 0;
+        m_unWaitingConsumers = 0;
+    }
+
+    /******************************************************************************
+     * @brief Give a lane a worker of its own, in addition to the shared workers.
+     *
+     * @param ePriority - The lane to serve.
+     * @param bDedicated - Whether the lane gets a dedicated worker.
+     *
+     * @note This must be called before the workers are started. The caller starts
+     *       GetDedicatedWorkers() extra workers to serve the dedicated lanes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPriorityDispatcher::SetDedicatedWorker(RoveCommPriority ePriority, bool bDedicated)
+    {
+        m_aDedicatedWorkers[ePriority] = bDedicated;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of lanes that have a dedicated worker.
+     *
+     * @return unsigned int - The number of dedicated workers.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    unsigned int RoveCommPriorityDispatcher::GetDedicatedWorkers() const
+    {
+        unsigned int unDedicated = 0;
+        for (bool bDedicated : m_aDedicatedWorkers)
+        {
+            unDedicated += bDedicated ? 1 : 0;
+        }
+
+        return unDedicated;
+    }
+
+    /******************************************************************************
+     * @brief Copy a received packet onto the lane of its data id, and wake a shared
+     *        worker if one is sleeping.
+     *
+     * @param pData - The received bytes, at least a packet header long.
+     * @param siDataSize - The number of bytes received.
+     * @param saAddress - The address the packet was received from.
+     * @return true - The packet was queued.
+     * @return false - The packet was dropped, or the dispatcher is closed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommPriorityDispatcher::Push(const uint8_t* pData, size_t siDataSize, const sockaddr_in& saAddress)
+    {
+        uint16_t unDataId          = (pData[1] << 8) | pData[2];
+        RoveCommPriority ePriority = m_stPriorities.GetPriority(unDataId);
+        if (!m_aLanes[ePriority]->Push(pData, siDataSize, saAddress))
+        {
+            return false;
+        }
+
+        m_unPushSignal.fetch_add(1);
+        if (m_unWaitingConsumers.load() > 0)
+        {
+            m_unPushSignal.notify_one();
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Run a consumer on the oldest packet of the highest priority lane that
+     *        is not empty, if there is one.
+     *
+     * @param fnConsumer - Called with the packet bytes, size and source address.
+     * @return true - A packet was consumed.
+     * @return false - Every lane was empty.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommPriorityDispatcher::TryPop(const RoveCommDispatchQueue::Consumer& fnConsumer)
+    {
+        for (const std::unique_ptr<RoveCommDispatchQueue>& pLane : m_aLanes)
+        {
+            if (pLane->TryPop(fnConsumer))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /******************************************************************************
+     * @brief Run a consumer on the next packet by priority, sleeping until one
+     *        arrives if every lane is empty. After Close(), the packets that are
+     *        already queued are still consumed before this returns false.
+     *
+     * @param fnConsumer - Called with the packet bytes, size and source address.
+     * @return true - A packet was consumed.
+     * @return false - The dispatcher is closed and every lane is empty.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommPriorityDispatcher::Pop(const RoveCommDispatchQueue::Consumer& fnConsumer)
+    {
+        while (true)
+        {
+            // Read the signal before trying, so a packet pushed after the attempt still ends the wait below.
+            uint32_t unPushSignal = m_unPushSignal.load();
+            if (TryPop(fnConsumer))
+            {
+                return true;
+            }
+            else if (m_bClosed)
+            {
+                return false;
+            }
+
+            m_unWaitingConsumers++;
+            m_unPushSignal.wait(unPushSignal);
+            m_unWaitingConsumers--;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Run one worker until the dispatcher is closed and drained. The first
+     *        GetDedicatedWorkers() calls after Open() each serve one dedicated
+     *        lane only, every later call is a shared worker that serves all lanes
+     *        by priority.
+     *
+     * @param fnConsumer - Called with the bytes, size and source address of every
+     *                     packet this worker takes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPriorityDispatcher::RunWorker(const RoveCommDispatchQueue::Consumer& fnConsumer)
+    {
+        // Find the dedicated lane this worker was assigned, if any.
+        unsigned int unWorker = m_unNextWorker++;
+        for (int nIter = 0; nIter < ePriorityCount; ++nIter)
+        {
+            if (m_aDedicatedWorkers[nIter] && unWorker-- == 0)
+            {
+                while (m_aLanes[nIter]->Pop(fnConsumer))
+                {
+                }
+                return;
+            }
+        }
+
+        while (Pop(fnConsumer))
+        {
+        }
+    }
+
+    /******************************************************************************
+     * @brief Reopen a closed dispatcher so that Push() accepts packets again, and
+     *        restart the assignment of dedicated workers.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPriorityDispatcher::Open()
+    {
+        for (const std::unique_ptr<RoveCommDispatchQueue>& pLane : m_aLanes)
+        {
+            pLane->Open();
+        }
+        m_unNextWorker = 0;
+        m_bClosed      = false;
+    }
+
+    /******************************************************************************
+     * @brief Close every lane. Push() rejects new packets and the workers exit once
+     *        the lanes are drained.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPriorityDispatcher::Close()
+    {
+        m_bClosed = true;
+        for (const std::unique_ptr<RoveCommDispatchQueue>& pLane : m_aLanes)
+        {
+            pLane->Close();
+        }
+
+        // Wake every sleeping shared worker so it sees the dispatcher is closed.
+        m_unPushSignal.fetch_add(1);
+        m_unPushSignal.notify_all();
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the counters of every lane added together. The max
+     *        depth is the sum of each lane's high-water mark.
+     *
+     * @return RoveCommDispatchStatistics - The combined counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommDispatchStatistics RoveCommPriorityDispatcher::GetStatistics() const
+    {
+        RoveCommDispatchStatistics stStatistics{};
+        for (const std::unique_ptr<RoveCommDispatchQueue>& pLane : m_aLanes)
+        {
+            RoveCommDispatchStatistics stLane = pLane->GetStatistics();
+            stStatistics.unEnqueued += stLane.unEnqueued;
+            stStatistics.unDispatched += stLane.unDispatched;
+            stStatistics.unDroppedOldest += stLane.unDroppedOldest;
+            stStatistics.unDroppedNewest += stLane.unDroppedNewest;
+            stStatistics.unBlockedWaits += stLane.unBlockedWaits;
+            stStatistics.siDepth += stLane.siDepth;
+            stStatistics.siMaxDepth += stLane.siMaxDepth;
+            stStatistics.siCapacity += stLane.siCapacity;
+        }
+
+        return stStatistics;
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the counters of a single lane.
+     *
+     * @param ePriority - The lane to report.
+     * @return RoveCommDispatchStatistics - The lane's counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommDispatchStatistics RoveCommPriorityDispatcher::GetStatistics(RoveCommPriority ePriority) const
+    {
+        return m_aLanes[ePriority]->GetStatistics();
+    }
+}    // namespace rovecomm
@@ -0,0 +1,135 @@
+/******************************************************************************
+ * @brief The RoveCommPriorityDispatcher class splits a node's callback dispatch
+ *        queue into one lane per priority class, so that a command does not wait
+ *        behind the telemetry that was received before it.
+ *
+ * @file RoveCommPriorityDispatcher.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_PRIORITY_DISPATCHER_H
+#define ROVECOMM_PRIORITY_DISPATCHER_H
+
+#include "./RoveCommDispatchQueue.h"
+#include "./RoveCommManifest.h"
+
+/// \cond
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    // Define an enum for the priority classes a data id can be dispatched with, highest first.
+    enum RoveCommPriority
+    {
+        ePriorityHigh,      // Dispatched before anything else. Intended for commands.
+        ePriorityNormal,    // The default for data ids without an assigned priority. Intended for errors.
+        ePriorityLow,       // Dispatched only when nothing else is queued. Intended for telemetry.
+        ePriorityCount      // The number of priority classes, not a priority.
+    };
+
+    /******************************************************************************
+     * @brief A table mapping every possible data id to a priority class. Lookups
+     *        are a single array index, so the receive thread can classify every
+     *        packet without taking a lock.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommPriorityTable
+    {
+        private:
+            // Private member variables
+            std::unique_ptr<std::atomic<uint8_t>[]> m_pPriorities;
+
+        public:
+            // Constructor
+            RoveCommPriorityTable();
+            RoveCommPriorityTable(const RoveCommPriorityTable&)            = delete;
+            RoveCommPriorityTable& operator=(const RoveCommPriorityTable&) = delete;
+
+            // Priority assignment functions
+            void SetPriority(uint16_t unDataId, RoveCommPriority ePriority);
+            void SetPriority(const std::map<std::string, manifest::ManifestEntry>& mpEntries, RoveCommPriority ePriority);
+            void SetManifestPriorities(const std::map<std::string, manifest::ManifestEntry>& mpCommands,
+                                       const std::map<std::string, manifest::ManifestEntry>& mpTelemetry,
+                                       const std::map<std::string, manifest::ManifestEntry>& mpErrors);
+            void Reset();
+
+            // Accessors
+            RoveCommPriority GetPriority(uint16_t unDataId) const;
+    };
+
+    /******************************************************************************
+     * @brief Holds one RoveCommDispatchQueue per priority class. The receive thread
+     *        pushes each packet onto the lane of its data id, and the workers always
+     *        take the oldest packet of the highest priority lane that is not empty.
+     *
+     *        A lane can also be given a dedicated worker that only serves that lane,
+     *        so its packets are dispatched even while every shared worker is busy
+     *        in a slow callback.
+     *
+     * @note Priorities only reorder packets that are already queued. A lane with
+     *       eOverflowBlock that fills up still stops the receive thread, and with it
+     *       every other lane, so the lower priority lanes should normally drop.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommPriorityDispatcher
+    {
+        private:
+            // Private member variables
+            const RoveCommPriorityTable& m_stPriorities;
+            std::array<std::unique_ptr<RoveCommDispatchQueue>, ePriorityCount> m_aLanes;
+            std::array<bool, ePriorityCount> m_aDedicatedWorkers;
+            std::atomic<unsigned int> m_unNextWorker;
+            std::atomic<bool> m_bClosed;
+            std::atomic<uint32_t> m_unPushSignal;
+            std::atomic<uint32_t> m_unWaitingConsumers;
+
+        public:
+            // Constructor
+            RoveCommPriorityDispatcher(const RoveCommPriorityTable& stPriorities, size_t siLaneCapacity, RoveCommOverflowPolicy ePolicy = eOverflowDropOldest);
+            RoveCommPriorityDispatcher(const RoveCommPriorityDispatcher&)            = delete;
+            RoveCommPriorityDispatcher& operator=(const RoveCommPriorityDispatcher&) = delete;
+
+            // Configuration functions
+            void SetDedicatedWorker(RoveCommPriority ePriority, bool bDedicated);
+            unsigned int GetDedicatedWorkers() const;
+
+            // Queue functions
+            bool Push(const uint8_t* pData, size_t siDataSize, const sockaddr_in& saAddress);
+            bool TryPop(const RoveCommDispatchQueue::Consumer& fnConsumer);
+            bool Pop(const RoveCommDispatchQueue::Consumer& fnConsumer);
+            void RunWorker(const RoveCommDispatchQueue::Consumer& fnConsumer);
+
+            // Lifetime functions
+            void Open();
+            void Close();
+
+            // Accessors
+            RoveCommDispatchStatistics GetStatistics() const;
+            RoveCommDispatchStatistics GetStatistics(RoveCommPriority ePriority) const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_PRIORITY_DISPATCHER_H
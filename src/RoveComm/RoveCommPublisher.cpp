@@ -0,0 +1,761 @@
+/******************************************************************************
+ * @brief RoveComm Publisher Implementation.
+ *
+ * @file RoveCommPublisher.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommPublisher.h"
+
+/// \cond
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Wake the scheduler waiting on this signal.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPublisherSignal::Notify()
+    {
+        {
+            std::lock_guard<std::mutex> lkSignalLock(muSignalMutex);
+            bPending = true;
+        }
+        cvSignal.notify_one();
+    }
+
+    /******************************************************************************
+     * @brief Construct a new publisher with nothing to send.
+     *
+     * @param unDataId - The data id of the packets published.
+     * @param dMaxRateHz - The most packets per second that are sent. Must be
+     *                     positive.
+     * @param pTargetAddr - An address to send to in addition to the node's
+     *                      subscribers, or nullptr to only send to subscribers.
+     * @param pSignal - The signal of the scheduler that sends this publisher.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommPublisher::RoveCommPublisher(uint16_t unDataId, double dMaxRateHz, const sockaddr_in* pTargetAddr, std::shared_ptr<RoveCommPublisherSignal> pSignal) :
+        m_unDataId(unDataId), m_pSignal(std::move(pSignal))
+    {
+        m_tmInterval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / dMaxRateHz));
+        m_bHasTarget = pTargetAddr != nullptr;
+        if (m_bHasTarget)
+        {
+            m_saTargetAddr = *pTargetAddr;
+        }
+
+        // Buffer 0 is written first, 1 starts in the middle and 2 with the scheduler.
+        m_aSizes.fill(0);
+        m_unBackBuffer   = 0;
+        m_unMiddleBuffer = 1;
+        m_unFrontBuffer  = 2;
+        m_tmNextSend     = std::chrono::steady_clock::time_point::min();
+
+        // Initialize the statistics.
+        m_unPublished    = 0;
+        m_unSent         = 0;
+        m_unCoalesced    = 0;
+        m_unSendFailures = 0;
+    }
+
+    /******************************************************************************
+     * @brief Replace the packet waiting to be sent with a new one. The packet is
+     *        packed on the caller's thread and sent later by the scheduler, at the
+     *        start of the next send window.
+     *
+     * @tparam T - The data type of the elements in the packet.
+     * @param stPacket - The packet to publish. Its data id must be the
+     *                   publisher's.
+     * @return true - The packet will be sent, unless a newer one replaces it first.
+     * @return false - The packet has another data id or could not be packed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    bool RoveCommPublisher::Publish(const RoveCommPacket<T>& stPacket)
+    {
+        if (stPacket.unDataId != m_unDataId)
+        {
+            std::cerr << "Publisher for data id " << m_unDataId << " cannot publish data id " << stPacket.unDataId << std::endl;
+            return false;
+        }
+
+        uint8_t unPrevious;
+        {
+            std::lock_guard<std::mutex> lkPublishLock(m_muPublishMutex);
+
+            // Pack into the back buffer, which only grows until it fits the largest packet.
+            std::vector<uint8_t>& vBuffer = m_aBuffers[m_unBackBuffer];
+            size_t siPackedSize           = GetPackedSize(stPacket);
+            if (vBuffer.size() < siPackedSize)
+            {
+                vBuffer.resize(siPackedSize);
+            }
+            size_t siDataSize = PackPacket(stPacket, vBuffer.data(), vBuffer.size());
+            if (siDataSize == 0)
+            {
+                std::cerr << "Failed to pack published packet with data id " << stPacket.unDataId << std::endl;
+                return false;
+            }
+            m_aSizes[m_unBackBuffer] = siDataSize;
+
+            // Swap it into the middle. Whatever was there becomes the next back buffer.
+            unPrevious     = m_unMiddleBuffer.exchange(m_unBackBuffer | PENDING_FLAG, std::memory_order_acq_rel);
+            m_unBackBuffer = unPrevious & ~PENDING_FLAG;
+        }
+
+        m_unPublished.fetch_add(1, std::memory_order_relaxed);
+        if (unPrevious & PENDING_FLAG)
+        {
+            // The scheduler already knows about this publisher, the older packet is simply never sent.
+            m_unCoalesced.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            m_pSignal->Notify();
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Check if a published packet is waiting to be sent.
+     *
+     * @return true - A packet is waiting.
+     * @return false - Every published packet was sent or replaced.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommPublisher::IsPending() const
+    {
+        return m_unMiddleBuffer.load(std::memory_order_acquire) & PENDING_FLAG;
+    }
+
+    /******************************************************************************
+     * @brief Get the data id of the packets published.
+     *
+     * @return uint16_t - The data id.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint16_t RoveCommPublisher::GetDataId() const
+    {
+        return m_unDataId;
+    }
+
+    /******************************************************************************
+     * @brief Get the shortest time between two sends.
+     *
+     * @return std::chrono::steady_clock::duration - One over the maximum rate.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    std::chrono::steady_clock::duration RoveCommPublisher::GetInterval() const
+    {
+        return m_tmInterval;
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of this publisher's counters.
+     *
+     * @return RoveCommPublisherStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommPublisherStatistics RoveCommPublisher::GetStatistics() const
+    {
+        RoveCommPublisherStatistics stStatistics;
+        stStatistics.unPublished    = m_unPublished.load(std::memory_order_relaxed);
+        stStatistics.unSent         = m_unSent.load(std::memory_order_relaxed);
+        stStatistics.unCoalesced    = m_unCoalesced.load(std::memory_order_relaxed);
+        stStatistics.unSendFailures = m_unSendFailures.load(std::memory_order_relaxed);
+
+        return stStatistics;
+    }
+
+    /******************************************************************************
+     * @brief Take the newest published packet and append it to the scheduler's
+     *        batch. Only called by the scheduler thread.
+     *
+     * @param stBatch - The batch sent at the end of the current tick.
+     * @return true - A packet was appended.
+     * @return false - Nothing was waiting to be sent.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommPublisher::Flush(RoveCommUDPBatch& stBatch)
+    {
+        if (!IsPending())
+        {
+            return false;
+        }
+
+        // Swap the front buffer, which was already sent, for the pending middle one.
+        uint8_t unMiddle = m_unMiddleBuffer.exchange(m_unFrontBuffer, std::memory_order_acq_rel);
+        m_unFrontBuffer  = unMiddle & ~PENDING_FLAG;
+
+        stBatch.AddBytes(m_aBuffers[m_unFrontBuffer].data(), m_aSizes[m_unFrontBuffer], m_bHasTarget ? &m_saTargetAddr : nullptr);
+        m_unSent.fetch_add(1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Construct a new scheduler. Its thread is not started until it is
+     *        enabled and has something to send.
+     *
+     * @param fnSend - The function batches are sent with.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommPublisherScheduler::RoveCommPublisherScheduler(SendFunction fnSend) : m_fnSend(std::move(fnSend))
+    {
+        m_pSignal        = std::make_shared<RoveCommPublisherSignal>();
+        m_bEnabled       = false;
+        m_bThreadStarted = false;
+
+        // Tick 0 is when the scheduler was created.
+        m_tmEpoch = std::chrono::steady_clock::now();
+        m_tmTick  = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::microseconds(ROVECOMM_SCHEDULER_TICK_US));
+        m_vWheel.resize(ROVECOMM_SCHEDULER_WHEEL_SIZE);
+        m_unProcessedTick   = 0;
+        m_tmScheduledWakeup = std::chrono::steady_clock::time_point::max();
+
+        // Initialize the statistics.
+        m_unWakeups     = 0;
+        m_unBatches     = 0;
+        m_unPacketsSent = 0;
+        m_unLateWakeups = 0;
+    }
+
+    /******************************************************************************
+     * @brief Destroy the scheduler, stopping its thread. Publishers still held by
+     *        their callers keep working, but are no longer sent.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommPublisherScheduler::~RoveCommPublisherScheduler()
+    {
+        Disable();
+    }
+
+    /******************************************************************************
+     * @brief Get the tick a point in time falls in.
+     *
+     * @param tmTime - A time after the scheduler was created.
+     * @return uint64_t - The number of whole ticks since the scheduler was created.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint64_t RoveCommPublisherScheduler::GetTick(std::chrono::steady_clock::time_point tmTime) const
+    {
+        return static_cast<uint64_t>((tmTime - m_tmEpoch) / m_tmTick);
+    }
+
+    /******************************************************************************
+     * @brief Put a stream on the wheel slot of its next sample, which is the first
+     *        multiple of its period after the given tick. Aligning every stream to
+     *        its period is what makes related rates share ticks.
+     *
+     * @param pStream - The stream to schedule.
+     * @param unAfterTick - The sample goes on a tick after this one.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPublisherScheduler::ScheduleStream(const std::shared_ptr<RoveCommPeriodicStream>& pStream, uint64_t unAfterTick)
+    {
+        pStream->m_unDueTick = (unAfterTick / pStream->m_unPeriodTicks + 1) * pStream->m_unPeriodTicks;
+        m_vWheel[pStream->m_unDueTick % m_vWheel.size()].push_back(pStream);
+    }
+
+    /******************************************************************************
+     * @brief Take a stream off the wheel.
+     *
+     * @param pStream - The stream to remove.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPublisherScheduler::UnscheduleStream(const std::shared_ptr<RoveCommPeriodicStream>& pStream)
+    {
+        std::vector<std::shared_ptr<RoveCommPeriodicStream>>& vSlot = m_vWheel[pStream->m_unDueTick % m_vWheel.size()];
+        auto itStream                                               = std::find(vSlot.begin(), vSlot.end(), pStream);
+        if (itStream != vSlot.end())
+        {
+            *itStream = std::move(vSlot.back());
+            vSlot.pop_back();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Move every stream due at or before a tick from the wheel to the due
+     *        list, and reschedule each for its next sample. Samples that were
+     *        missed because the thread woke up late are counted, not made up.
+     *
+     * @param unTick - The current tick.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPublisherScheduler::CollectDueStreams(uint64_t unTick)
+    {
+        // Visit each slot passed since the last call, or every slot once if the thread fell a full turn behind.
+        uint64_t unSlots = std::min<uint64_t>(unTick - m_unProcessedTick, m_vWheel.size());
+        for (uint64_t unIter = 0; unIter < unSlots; ++unIter)
+        {
+            std::vector<std::shared_ptr<RoveCommPeriodicStream>>& vSlot = m_vWheel[(unTick - unIter) % m_vWheel.size()];
+            size_t siIter                                               = 0;
+            while (siIter < vSlot.size())
+            {
+                // Streams more than a turn ahead share the slot but are not due yet.
+                if (vSlot[siIter]->m_unDueTick > unTick)
+                {
+                    ++siIter;
+                    continue;
+                }
+
+                std::shared_ptr<RoveCommPeriodicStream> pStream = std::move(vSlot[siIter]);
+                vSlot[siIter]                                   = std::move(vSlot.back());
+                vSlot.pop_back();
+
+                pStream->m_unMissed.fetch_add((unTick - pStream->m_unDueTick) / pStream->m_unPeriodTicks, std::memory_order_relaxed);
+                ScheduleStream(pStream, unTick);
+                m_vDueStreams.push_back(std::move(pStream));
+            }
+        }
+        m_unProcessedTick = unTick;
+    }
+
+    /******************************************************************************
+     * @brief Find the next tick on which a stream is due.
+     *
+     * @param unTick - The current tick.
+     * @return uint64_t - The next due tick, or the largest uint64_t if there are no
+     *                    streams.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint64_t RoveCommPublisherScheduler::GetNextDueTick(uint64_t unTick) const
+    {
+        // Walk forward one turn of the wheel, which normally stops within the shortest period.
+        for (uint64_t unNextTick = unTick + 1; unNextTick <= unTick + m_vWheel.size(); ++unNextTick)
+        {
+            for (const std::shared_ptr<RoveCommPeriodicStream>& pStream : m_vWheel[unNextTick % m_vWheel.size()])
+            {
+                if (pStream->m_unDueTick == unNextTick)
+                {
+                    return unNextTick;
+                }
+            }
+        }
+
+        // Every stream is more than a turn away.
+        uint64_t unNextTick = std::numeric_limits<uint64_t>::max();
+        for (const std::shared_ptr<RoveCommPeriodicStream>& pStream : m_vStreams)
+        {
+            unNextTick = std::min(unNextTick, pStream->m_unDueTick);
+        }
+
+        return unNextTick;
+    }
+
+    /******************************************************************************
+     * @brief Start the thread if the scheduler is enabled and has something to
+     *        send. Must be called with the schedule mutex held.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPublisherScheduler::StartThreadIfNeeded()
+    {
+        if (m_bEnabled && !m_bThreadStarted && (!m_vPublishers.empty() || !m_vStreams.empty()))
+        {
+            m_bThreadStarted = true;
+            Start();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Create a publisher and start sending it.
+     *
+     * @param unDataId - The data id of the packets published.
+     * @param dMaxRateHz - The most packets per second that are sent.
+     * @param pTargetAddr - An address to send to in addition to the node's
+     *                      subscribers, or nullptr to only send to subscribers.
+     * @return std::shared_ptr<RoveCommPublisher> - The publisher, or nullptr if the
+     *                                              rate was not positive.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    std::shared_ptr<RoveCommPublisher> RoveCommPublisherScheduler::AddPublisher(uint16_t unDataId, double dMaxRateHz, const sockaddr_in* pTargetAddr)
+    {
+        if (!(dMaxRateHz > 0.0))
+        {
+            std::cerr << "Publisher for data id " << unDataId << " needs a positive maximum rate." << std::endl;
+            return nullptr;
+        }
+
+        std::shared_ptr<RoveCommPublisher> pPublisher = std::make_shared<RoveCommPublisher>(unDataId, dMaxRateHz, pTargetAddr, m_pSignal);
+
+        std::lock_guard<std::mutex> lkScheduleLock(m_muScheduleMutex);
+        m_vPublishers.push_back(pPublisher);
+        StartThreadIfNeeded();
+
+        return pPublisher;
+    }
+
+    /******************************************************************************
+     * @brief Stop sending a publisher. A packet it still has waiting is dropped.
+     *
+     * @param pPublisher - The publisher returned by AddPublisher().
+     * @return true - The publisher was removed.
+     * @return false - The publisher does not belong to this scheduler.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommPublisherScheduler::RemovePublisher(const std::shared_ptr<RoveCommPublisher>& pPublisher)
+    {
+        std::lock_guard<std::mutex> lkScheduleLock(m_muScheduleMutex);
+        auto itPublisher = std::find(m_vPublishers.begin(), m_vPublishers.end(), pPublisher);
+        if (itPublisher == m_vPublishers.end())
+        {
+            return false;
+        }
+
+        m_vPublishers.erase(itPublisher);
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of publishers being sent.
+     *
+     * @return size_t - The number of publishers.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommPublisherScheduler::GetPublisherCount()
+    {
+        std::lock_guard<std::mutex> lkScheduleLock(m_muScheduleMutex);
+        return m_vPublishers.size();
+    }
+
+    /******************************************************************************
+     * @brief Start sampling a producer at a fixed rate and sending its packets.
+     *        The rate is rounded to a whole number of ticks, and the first sample
+     *        is taken on the first multiple of that period.
+     *
+     * @tparam T - The data type of the elements in the packet.
+     * @param unDataId - The data id of the packets sent.
+     * @param dRateHz - The number of samples per second.
+     * @param fnProducer - Called on the scheduler thread every period. It fills in
+     *                     the packet's vData and returns false to skip the period.
+     * @param pTargetAddr - An address to send to in addition to the node's
+     *                      subscribers, or nullptr to only send to subscribers.
+     * @return std::shared_ptr<RoveCommPeriodicStream> - The stream, or nullptr if
+     *                                                   the rate was not positive.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    std::shared_ptr<RoveCommPeriodicStream> RoveCommPublisherScheduler::AddPeriodicStream(uint16_t unDataId,
+                                                                                          double dRateHz,
+                                                                                          typename RoveCommPeriodicStreamOf<T>::Producer fnProducer,
+                                                                                          const sockaddr_in* pTargetAddr)
+    {
+        if (!(dRateHz > 0.0) || !fnProducer)
+        {
+            std::cerr << "Periodic stream for data id " << unDataId << " needs a positive rate and a producer." << std::endl;
+            return nullptr;
+        }
+
+        // Round the period to whole ticks, but never faster than one sample per tick.
+        double dPeriodTicks    = 1000000.0 / (dRateHz * ROVECOMM_SCHEDULER_TICK_US);
+        uint64_t unPeriodTicks = std::max<uint64_t>(1, static_cast<uint64_t>(std::llround(dPeriodTicks)));
+        std::shared_ptr<RoveCommPeriodicStream> pStream = std::make_shared<RoveCommPeriodicStreamOf<T>>(unDataId, unPeriodTicks, pTargetAddr, std::move(fnProducer));
+
+        {
+            std::lock_guard<std::mutex> lkScheduleLock(m_muScheduleMutex);
+            m_vStreams.push_back(pStream);
+            ScheduleStream(pStream, GetTick(std::chrono::steady_clock::now()));
+            StartThreadIfNeeded();
+        }
+
+        // The new stream may be due before the thread's current wakeup.
+        m_pSignal->Notify();
+
+        return pStream;
+    }
+
+    /******************************************************************************
+     * @brief Stop sampling a periodic stream.
+     *
+     * @param pStream - The stream returned by AddPeriodicStream().
+     * @return true - The stream was removed.
+     * @return false - The stream does not belong to this scheduler.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommPublisherScheduler::RemovePeriodicStream(const std::shared_ptr<RoveCommPeriodicStream>& pStream)
+    {
+        std::lock_guard<std::mutex> lkScheduleLock(m_muScheduleMutex);
+        auto itStream = std::find(m_vStreams.begin(), m_vStreams.end(), pStream);
+        if (itStream == m_vStreams.end())
+        {
+            return false;
+        }
+
+        UnscheduleStream(pStream);
+        m_vStreams.erase(itStream);
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of periodic streams being sampled.
+     *
+     * @return size_t - The number of streams.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommPublisherScheduler::GetPeriodicStreamCount()
+    {
+        std::lock_guard<std::mutex> lkScheduleLock(m_muScheduleMutex);
+        return m_vStreams.size();
+    }
+
+    /******************************************************************************
+     * @brief Allow the scheduler to send, starting its thread if it already has
+     *        something to send. Called once the node's socket is open.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPublisherScheduler::Enable()
+    {
+        std::lock_guard<std::mutex> lkScheduleLock(m_muScheduleMutex);
+        m_bEnabled = true;
+        StartThreadIfNeeded();
+    }
+
+    /******************************************************************************
+     * @brief Stop the scheduler's thread and wait for it to exit. Packets that are
+     *        still waiting stay in their publishers until the scheduler is enabled
+     *        again.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPublisherScheduler::Disable()
+    {
+        bool bThreadStarted;
+        {
+            std::lock_guard<std::mutex> lkScheduleLock(m_muScheduleMutex);
+            m_bEnabled       = false;
+            bThreadStarted   = m_bThreadStarted;
+            m_bThreadStarted = false;
+        }
+
+        if (bThreadStarted)
+        {
+            // Stop the thread, waking it if it is waiting for a send window.
+            RequestStop();
+            {
+                std::lock_guard<std::mutex> lkSignalLock(m_pSignal->muSignalMutex);
+                m_pSignal->bStopping = true;
+            }
+            m_pSignal->cvSignal.notify_all();
+            Join();
+
+            std::lock_guard<std::mutex> lkSignalLock(m_pSignal->muSignalMutex);
+            m_pSignal->bStopping = false;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Get the length of one scheduler tick.
+     *
+     * @return std::chrono::steady_clock::duration - The tick length.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    std::chrono::steady_clock::duration RoveCommPublisherScheduler::GetTickDuration() const
+    {
+        return m_tmTick;
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the scheduler's counters.
+     *
+     * @return RoveCommSchedulerStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommSchedulerStatistics RoveCommPublisherScheduler::GetStatistics() const
+    {
+        RoveCommSchedulerStatistics stStatistics;
+        stStatistics.unWakeups     = m_unWakeups.load(std::memory_order_relaxed);
+        stStatistics.unBatches     = m_unBatches.load(std::memory_order_relaxed);
+        stStatistics.unPacketsSent = m_unPacketsSent.load(std::memory_order_relaxed);
+        stStatistics.unLateWakeups = m_unLateWakeups.load(std::memory_order_relaxed);
+
+        return stStatistics;
+    }
+
+    /******************************************************************************
+     * @brief Batch every periodic stream due on this tick and every pending
+     *        publisher whose send window is open, send the batch, then sleep until
+     *        the next due tick or publisher window, or until a publisher becomes
+     *        pending.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPublisherScheduler::ThreadedContinuousCode()
+    {
+        std::chrono::steady_clock::time_point tmNow    = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point tmWakeup = std::chrono::steady_clock::time_point::max();
+        uint64_t unTick                                = GetTick(tmNow);
+        m_unWakeups.fetch_add(1, std::memory_order_relaxed);
+        if (m_tmScheduledWakeup != std::chrono::steady_clock::time_point::max() && tmNow - m_tmScheduledWakeup > m_tmTick)
+        {
+            m_unLateWakeups.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        {
+            std::lock_guard<std::mutex> lkScheduleLock(m_muScheduleMutex);
+            CollectDueStreams(unTick);
+
+            for (const std::shared_ptr<RoveCommPublisher>& pPublisher : m_vPublishers)
+            {
+                if (!pPublisher->IsPending())
+                {
+                    continue;
+                }
+
+                if (pPublisher->m_tmNextSend <= tmNow)
+                {
+                    pPublisher->Flush(m_stBatch);
+                    pPublisher->m_tmNextSend = tmNow + pPublisher->m_tmInterval;
+                    m_vBatchPublishers.push_back(pPublisher);
+                }
+                else
+                {
+                    tmWakeup = std::min(tmWakeup, pPublisher->m_tmNextSend);
+                }
+            }
+
+            uint64_t unNextTick = GetNextDueTick(unTick);
+            if (unNextTick != std::numeric_limits<uint64_t>::max())
+            {
+                tmWakeup = std::min(tmWakeup, m_tmEpoch + static_cast<int64_t>(unNextTick) * m_tmTick);
+            }
+        }
+
+        // Producers run without the lock, so they cannot hold up Publish() or stream registration.
+        for (const std::shared_ptr<RoveCommPeriodicStream>& pStream : m_vDueStreams)
+        {
+            pStream->Sample(m_stBatch);
+        }
+
+        // Everything due on this tick goes out together.
+        if (m_stBatch.GetPacketCount() > 0)
+        {
+            bool bSent = m_fnSend(m_stBatch);
+            m_unBatches.fetch_add(1, std::memory_order_relaxed);
+            m_unPacketsSent.fetch_add(m_stBatch.GetPacketCount(), std::memory_order_relaxed);
+            if (!bSent)
+            {
+                for (const std::shared_ptr<RoveCommPublisher>& pPublisher : m_vBatchPublishers)
+                {
+                    pPublisher->m_unSendFailures.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+        m_stBatch.Clear();
+        m_vDueStreams.clear();
+        m_vBatchPublishers.clear();
+        m_tmScheduledWakeup = tmWakeup;
+
+        // Publishers that become pending after they were checked above set bPending, so the wait returns at once.
+        std::unique_lock<std::mutex> lkSignalLock(m_pSignal->muSignalMutex);
+        auto fnWoken = [this]() { return m_pSignal->bPending || m_pSignal->bStopping; };
+        if (tmWakeup == std::chrono::steady_clock::time_point::max())
+        {
+            m_pSignal->cvSignal.wait(lkSignalLock, fnWoken);
+        }
+        else
+        {
+            m_pSignal->cvSignal.wait_until(lkSignalLock, tmWakeup, fnWoken);
+        }
+        m_pSignal->bPending = false;
+    }
+
+    /******************************************************************************
+     * @brief The scheduler does not use the thread pool.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommPublisherScheduler::PooledLinearCode() {}
+
+    // Explicitly define template function types
+    template bool RoveCommPublisher::Publish<uint8_t>(const RoveCommPacket<uint8_t>&);
+    template bool RoveCommPublisher::Publish<int8_t>(const RoveCommPacket<int8_t>&);
+    template bool RoveCommPublisher::Publish<uint16_t>(const RoveCommPacket<uint16_t>&);
+    template bool RoveCommPublisher::Publish<int16_t>(const RoveCommPacket<int16_t>&);
+    template bool RoveCommPublisher::Publish<uint32_t>(const RoveCommPacket<uint32_t>&);
+    template bool RoveCommPublisher::Publish<int32_t>(const RoveCommPacket<int32_t>&);
+    template bool RoveCommPublisher::Publish<float>(const RoveCommPacket<float>&);
+    template bool RoveCommPublisher::Publish<double>(const RoveCommPacket<double>&);
+    template bool RoveCommPublisher::Publish<char>(const RoveCommPacket<char>&);
+
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommPublisherScheduler::AddPeriodicStream<uint8_t>(uint16_t, double, RoveCommPeriodicStreamOf<uint8_t>::Producer, const sockaddr_in*);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommPublisherScheduler::AddPeriodicStream<int8_t>(uint16_t, double, RoveCommPeriodicStreamOf<int8_t>::Producer, const sockaddr_in*);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommPublisherScheduler::AddPeriodicStream<uint16_t>(uint16_t, double, RoveCommPeriodicStreamOf<uint16_t>::Producer, const sockaddr_in*);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommPublisherScheduler::AddPeriodicStream<int16_t>(uint16_t, double, RoveCommPeriodicStreamOf<int16_t>::Producer, const sockaddr_in*);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommPublisherScheduler::AddPeriodicStream<uint32_t>(uint16_t, double, RoveCommPeriodicStreamOf<uint32_t>::Producer, const sockaddr_in*);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommPublisherScheduler::AddPeriodicStream<int32_t>(uint16_t, double, RoveCommPeriodicStreamOf<int32_t>::Producer, const sockaddr_in*);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommPublisherScheduler::AddPeriodicStream<float>(uint16_t, double, RoveCommPeriodicStreamOf<float>::Producer, const sockaddr_in*);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommPublisherScheduler::AddPeriodicStream<double>(uint16_t, double, RoveCommPeriodicStreamOf<double>::Producer, const sockaddr_in*);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommPublisherScheduler::AddPeriodicStream<char>(uint16_t, double, RoveCommPeriodicStreamOf<char>::Producer, const sockaddr_in*);
+}    // namespace rovecomm
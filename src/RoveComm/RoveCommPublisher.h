@@ -0,0 +1,243 @@
+/******************************************************************************
+ * @brief The RoveCommPublisher class rate limits the packets of one data id, so
+ *        that control code can publish from a tight loop while only the latest
+ *        value in each send window goes out on the link.
+ *
+ * @file RoveCommPublisher.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_PUBLISHER_H
+#define ROVECOMM_PUBLISHER_H
+
+#include "ExternalIncludes.h"
+#include "RoveCommPacket.h"
+#include "RoveCommPeriodicStream.h"
+#include "RoveCommUDPBatch.h"
+
+/// \cond
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    // Define a struct for reporting a snapshot of a publisher's counters.
+    struct RoveCommPublisherStatistics
+    {
+        public:
+            uint64_t unPublished;       // Calls to Publish() that stored a packet.
+            uint64_t unSent;            // Packets handed to the node for sending.
+            uint64_t unCoalesced;       // Packets replaced by a newer one before they were sent.
+            uint64_t unSendFailures;    // Sent packets whose batch was not fully sent by the node.
+    };
+
+    // Define a struct for reporting a snapshot of a scheduler's counters.
+    struct RoveCommSchedulerStatistics
+    {
+        public:
+            uint64_t unWakeups;        // Times the scheduler thread woke up.
+            uint64_t unBatches;        // Batches handed to the node, each sent with a single syscall.
+            uint64_t unPacketsSent;    // Packets in those batches, from publishers and periodic streams.
+            uint64_t unLateWakeups;    // Wakeups more than one tick after the time they were scheduled for.
+    };
+
+    // The wakeup shared by a scheduler and its publishers. It outlives whichever of them is destroyed first.
+    struct RoveCommPublisherSignal
+    {
+        public:
+            std::mutex muSignalMutex;
+            std::condition_variable cvSignal;
+            bool bPending = false;
+            bool bStopping = false;
+
+            void Notify();
+    };
+
+    /******************************************************************************
+     * @brief A latest-wins slot for the packets of one data id, sent by the node's
+     *        RoveCommPublisherScheduler at no more than a maximum rate.
+     *
+     *        Publish() packs the packet into a triple buffer and returns. The
+     *        scheduler takes the newest buffer when the publisher's send window
+     *        opens, so a packet published while an older one is still waiting
+     *        simply replaces it. The first packet after an idle window is sent
+     *        right away, and later ones at most once per window.
+     *
+     * @note Publish() only takes a lock shared with other callers of Publish() on
+     *       the same publisher. The scheduler never holds it.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommPublisher
+    {
+        private:
+            // Set in the middle buffer index when it holds a packet that was not sent yet.
+            static const uint8_t PENDING_FLAG = 0x4;
+
+            // Private member variables
+            uint16_t m_unDataId;
+            std::chrono::steady_clock::duration m_tmInterval;
+            bool m_bHasTarget;
+            sockaddr_in m_saTargetAddr;
+            std::shared_ptr<RoveCommPublisherSignal> m_pSignal;
+
+            // Triple buffer. The back buffer belongs to Publish(), the front one to the scheduler.
+            std::array<std::vector<uint8_t>, 3> m_aBuffers;
+            std::array<size_t, 3> m_aSizes;
+            std::mutex m_muPublishMutex;
+            uint8_t m_unBackBuffer;
+            std::atomic<uint8_t> m_unMiddleBuffer;
+            uint8_t m_unFrontBuffer;
+            std::chrono::steady_clock::time_point m_tmNextSend;
+
+            // Statistics counters.
+            std::atomic<uint64_t> m_unPublished;
+            std::atomic<uint64_t> m_unSent;
+            std::atomic<uint64_t> m_unCoalesced;
+            std::atomic<uint64_t> m_unSendFailures;
+
+            friend class RoveCommPublisherScheduler;
+
+        public:
+            // Constructor
+            RoveCommPublisher(uint16_t unDataId, double dMaxRateHz, const sockaddr_in* pTargetAddr, std::shared_ptr<RoveCommPublisherSignal> pSignal);
+            RoveCommPublisher(const RoveCommPublisher&)            = delete;
+            RoveCommPublisher& operator=(const RoveCommPublisher&) = delete;
+
+            // Publishing functions
+            template<typename T>
+            bool Publish(const RoveCommPacket<T>& stPacket);
+            bool IsPending() const;
+
+            // Accessors
+            uint16_t GetDataId() const;
+            std::chrono::steady_clock::duration GetInterval() const;
+            RoveCommPublisherStatistics GetStatistics() const;
+
+        private:
+            // Scheduler functions
+            bool Flush(RoveCommUDPBatch& stBatch);
+    };
+
+    /******************************************************************************
+     * @brief Owns the publishers and periodic streams of a node, and the thread
+     *        that sends them.
+     *
+     *        Periodic streams sit on a hashed timer wheel with one slot per tick.
+     *        A stream's samples fall on ticks that are a multiple of its period,
+     *        so streams with related rates come due on the same ticks. Everything
+     *        due on a tick, together with every publisher whose send window is
+     *        open, goes into one RoveCommUDPBatch and is sent with one syscall.
+     *
+     *        Between ticks the thread sleeps until the next due tick or the next
+     *        publisher window, whichever is first. It also wakes when a publisher
+     *        becomes pending. An idle node costs no wakeups. The thread is only
+     *        started once the node has something to send.
+     *
+     * @note Producers run on the scheduler thread, so a slow producer delays every
+     *       packet due on the same tick.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommPublisherScheduler : AutonomyThread<void>
+    {
+        public:
+            // Define the function type the scheduler sends each batch with. It returns false if not everything was sent.
+            using SendFunction = std::function<bool(const RoveCommUDPBatch&)>;
+
+        private:
+            // Private member variables
+            SendFunction m_fnSend;
+            std::shared_ptr<RoveCommPublisherSignal> m_pSignal;
+            std::mutex m_muScheduleMutex;
+            std::vector<std::shared_ptr<RoveCommPublisher>> m_vPublishers;
+            std::vector<std::shared_ptr<RoveCommPeriodicStream>> m_vStreams;
+            bool m_bEnabled;
+            bool m_bThreadStarted;
+
+            // Timer wheel. Each slot holds the streams due on the ticks that map to it.
+            std::chrono::steady_clock::time_point m_tmEpoch;
+            std::chrono::steady_clock::duration m_tmTick;
+            std::vector<std::vector<std::shared_ptr<RoveCommPeriodicStream>>> m_vWheel;
+            uint64_t m_unProcessedTick;
+            std::chrono::steady_clock::time_point m_tmScheduledWakeup;
+
+            // Work buffers of the scheduler thread, kept so that a tick does not allocate.
+            RoveCommUDPBatch m_stBatch;
+            std::vector<std::shared_ptr<RoveCommPeriodicStream>> m_vDueStreams;
+            std::vector<std::shared_ptr<RoveCommPublisher>> m_vBatchPublishers;
+
+            // Statistics counters.
+            std::atomic<uint64_t> m_unWakeups;
+            std::atomic<uint64_t> m_unBatches;
+            std::atomic<uint64_t> m_unPacketsSent;
+            std::atomic<uint64_t> m_unLateWakeups;
+
+            // Timer wheel functions
+            uint64_t GetTick(std::chrono::steady_clock::time_point tmTime) const;
+            void ScheduleStream(const std::shared_ptr<RoveCommPeriodicStream>& pStream, uint64_t unAfterTick);
+            void UnscheduleStream(const std::shared_ptr<RoveCommPeriodicStream>& pStream);
+            void CollectDueStreams(uint64_t unTick);
+            uint64_t GetNextDueTick(uint64_t unTick) const;
+            void StartThreadIfNeeded();
+
+            // AutonomyThread member functions
+            void ThreadedContinuousCode() override;
+            void PooledLinearCode() override;
+
+        public:
+            // Constructor
+            explicit RoveCommPublisherScheduler(SendFunction fnSend);
+            RoveCommPublisherScheduler(const RoveCommPublisherScheduler&)            = delete;
+            RoveCommPublisherScheduler& operator=(const RoveCommPublisherScheduler&) = delete;
+            // Destructor
+            ~RoveCommPublisherScheduler();
+
+            // Publisher management functions
+            std::shared_ptr<RoveCommPublisher> AddPublisher(uint16_t unDataId, double dMaxRateHz, const sockaddr_in* pTargetAddr = nullptr);
+            bool RemovePublisher(const std::shared_ptr<RoveCommPublisher>& pPublisher);
+            size_t GetPublisherCount();
+
+            // Periodic stream management functions
+            template<typename T>
+            std::shared_ptr<RoveCommPeriodicStream> AddPeriodicStream(uint16_t unDataId,
+                                                                      double dRateHz,
+                                                                      typename RoveCommPeriodicStreamOf<T>::Producer fnProducer,
+                                                                      const sockaddr_in* pTargetAddr = nullptr);
+            bool RemovePeriodicStream(const std::shared_ptr<RoveCommPeriodicStream>& pStream);
+            size_t GetPeriodicStreamCount();
+
+            // Lifetime functions
+            void Enable();
+            void Disable();
+
+            // Accessors
+            std::chrono::steady_clock::duration GetTickDuration() const;
+            RoveCommSchedulerStatistics GetStatistics() const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_PUBLISHER_H
@@ -0,0 +1,452 @@
+/******************************************************************************
+ * @brief RoveComm Send Filter Implementation.
+ *
+ * @file RoveCommSendFilter.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommSendFilter.h"
+
+/// \cond
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Check if any element of a packed payload moved out of the deadband
+     *        around the same element of the last sent payload.
+     *
+     * @tparam T - The element type, float or double.
+     * @param pNew - The payload of the new packet.
+     * @param pLast - The payload of the last sent packet.
+     * @param unDataCount - The number of elements in both.
+     * @param stDeadband - The deadband of the data id.
+     * @return true - At least one element changed.
+     * @return false - Every element is within the deadband.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    static bool IsOutsideDeadband(const uint8_t* pNew, const uint8_t* pLast, uint16_t unDataCount, const RoveCommDeadband& stDeadband)
+    {
+        for (uint16_t unIter = 0; unIter < unDataCount; ++unIter)
+        {
+            double dNew  = RoveCommPacketView<T>::ReadElement(pNew + unIter * sizeof(T));
+            double dLast = RoveCommPacketView<T>::ReadElement(pLast + unIter * sizeof(T));
+
+            // Written so that a NaN on either side counts as a change.
+            double dBand = std::max(stDeadband.dAbsolute, stDeadband.dRelative * std::fabs(dLast));
+            if (!(std::fabs(dNew - dLast) <= dBand))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /******************************************************************************
+     * @brief Construct a new send filter with no data ids filtered.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommSendFilter::RoveCommSendFilter()
+    {
+        for (std::atomic<Page*>& pPage : m_aPages)
+        {
+            pPage = nullptr;
+        }
+        m_bAnyEnabled = false;
+    }
+
+    /******************************************************************************
+     * @brief Find the filter of a data id.
+     *
+     * @param unDataId - The data id to look up.
+     * @return Entry* - The filter, or nullptr if the data id was never filtered.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommSendFilter::Entry* RoveCommSendFilter::FindEntry(uint16_t unDataId) const
+    {
+        Page* pPage = m_aPages[unDataId >> 8].load(std::memory_order_acquire);
+        if (pPage == nullptr)
+        {
+            return nullptr;
+        }
+
+        return pPage->aEntries[unDataId & 0xFF].load(std::memory_order_acquire);
+    }
+
+    /******************************************************************************
+     * @brief Get the key a destination's last sent packet is kept under.
+     *
+     * @param pDestination - An explicit address, or nullptr for the subscribers.
+     * @return uint64_t - The address and port, or 0 for the subscribers.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint64_t RoveCommSendFilter::GetDestinationKey(const sockaddr_in* pDestination)
+    {
+        if (pDestination == nullptr)
+        {
+            return 0;
+        }
+
+        return (static_cast<uint64_t>(ntohl(pDestination->sin_addr.s_addr)) << 16) | ntohs(pDestination->sin_port);
+    }
+
+    /******************************************************************************
+     * @brief Compare a packed packet with the last one sent to a destination. Must
+     *        be called with the entry's lock held.
+     *
+     * @param stDeadband - The deadband of the packet's data id.
+     * @param vLastSent - The last packet sent to the destination, empty if none.
+     * @param pData - The packed packet.
+     * @param siDataSize - The packed size of the packet.
+     * @return true - The packet tells the receiver something new.
+     * @return false - The packet is the same as the last one, within the deadband.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommSendFilter::IsChanged(const RoveCommDeadband& stDeadband, const std::vector<uint8_t>& vLastSent, const uint8_t* pData, size_t siDataSize)
+    {
+        // Nothing sent yet, or a different data count or data type, is always a change.
+        if (vLastSent.size() != siDataSize || std::memcmp(vLastSent.data(), pData, ROVECOMM_PACKET_HEADER_SIZE) != 0)
+        {
+            return true;
+        }
+
+        // Integer and char payloads, and float payloads without a deadband, must match exactly.
+        const uint8_t* pNew           = pData + ROVECOMM_PACKET_HEADER_SIZE;
+        const uint8_t* pLast          = vLastSent.data() + ROVECOMM_PACKET_HEADER_SIZE;
+        size_t siPayloadSize          = siDataSize - ROVECOMM_PACKET_HEADER_SIZE;
+        manifest::DataTypes eDataType = static_cast<manifest::DataTypes>(pData[5]);
+        uint16_t unDataCount          = static_cast<uint16_t>((pData[3] << 8) | pData[4]);
+        bool bHasDeadband             = stDeadband.dAbsolute > 0.0 || stDeadband.dRelative > 0.0;
+        if (bHasDeadband && eDataType == manifest::DataTypes::FLOAT_T && siPayloadSize >= unDataCount * sizeof(float))
+        {
+            return IsOutsideDeadband<float>(pNew, pLast, unDataCount, stDeadband);
+        }
+        if (bHasDeadband && eDataType == manifest::DataTypes::DOUBLE_T && siPayloadSize >= unDataCount * sizeof(double))
+        {
+            return IsOutsideDeadband<double>(pNew, pLast, unDataCount, stDeadband);
+        }
+
+        return std::memcmp(pNew, pLast, siPayloadSize) != 0;
+    }
+
+    /******************************************************************************
+     * @brief Read the counters of one filter.
+     *
+     * @param stEntry - The filter.
+     * @return RoveCommSendFilterStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommSendFilterStatistics RoveCommSendFilter::ReadStatistics(const Entry& stEntry)
+    {
+        RoveCommSendFilterStatistics stStatistics;
+        stStatistics.unChecked    = stEntry.unChecked.load(std::memory_order_relaxed);
+        stStatistics.unSent       = stEntry.unSent.load(std::memory_order_relaxed);
+        stStatistics.unKeepalives = stEntry.unKeepalives.load(std::memory_order_relaxed);
+        stStatistics.unSuppressed = stEntry.unSuppressed.load(std::memory_order_relaxed);
+        stStatistics.unBytesSent  = stEntry.unBytesSent.load(std::memory_order_relaxed);
+        stStatistics.unBytesSaved = stEntry.unBytesSaved.load(std::memory_order_relaxed);
+
+        return stStatistics;
+    }
+
+    /******************************************************************************
+     * @brief Start filtering a data id, or change the deadband of one that is
+     *        already filtered. The next packet of the data id is always sent.
+     *
+     * @param unDataId - The data id to filter.
+     * @param stDeadband - When a packet counts as changed, and how often an
+     *                     unchanged one is sent anyway.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommSendFilter::SetFilter(uint16_t unDataId, const RoveCommDeadband& stDeadband)
+    {
+        std::lock_guard<std::mutex> lkAllocationLock(m_muAllocationMutex);
+
+        // Allocate the page on first use.
+        Page* pPage = m_aPages[unDataId >> 8].load(std::memory_order_acquire);
+        if (pPage == nullptr)
+        {
+            m_vPages.push_back(std::make_unique<Page>());
+            pPage = m_vPages.back().get();
+            for (std::atomic<Entry*>& pPageEntry : pPage->aEntries)
+            {
+                pPageEntry = nullptr;
+            }
+            m_aPages[unDataId >> 8].store(pPage, std::memory_order_release);
+        }
+
+        // Reuse the entry of a data id that was filtered before, so its counters carry on.
+        Entry* pEntry = pPage->aEntries[unDataId & 0xFF].load(std::memory_order_acquire);
+        if (pEntry == nullptr)
+        {
+            m_vEntries.push_back(std::make_unique<Entry>());
+            pEntry               = m_vEntries.back().get();
+            pEntry->bEnabled     = false;
+            pEntry->unChecked    = 0;
+            pEntry->unSent       = 0;
+            pEntry->unKeepalives = 0;
+            pEntry->unSuppressed = 0;
+            pEntry->unBytesSent  = 0;
+            pEntry->unBytesSaved = 0;
+            pPage->aEntries[unDataId & 0xFF].store(pEntry, std::memory_order_release);
+        }
+
+        {
+            std::lock_guard<std::mutex> lkEntryLock(pEntry->muEntryMutex);
+            pEntry->stDeadband = stDeadband;
+            pEntry->mpLastSent.clear();
+        }
+        pEntry->bEnabled.store(true, std::memory_order_release);
+        m_bAnyEnabled = true;
+    }
+
+    /******************************************************************************
+     * @brief Filter every entry in a manifest map, such as
+     *        manifest::Core::TELEMETRY, with the same deadband.
+     *
+     * @param mpEntries - The manifest entries to filter.
+     * @param stDeadband - The deadband used for each of them.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommSendFilter::SetFilter(const std::map<std::string, manifest::ManifestEntry>& mpEntries, const RoveCommDeadband& stDeadband)
+    {
+        for (const std::pair<const std::string, manifest::ManifestEntry>& stEntry : mpEntries)
+        {
+            SetFilter(static_cast<uint16_t>(stEntry.second.DATA_ID), stDeadband);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Stop filtering a data id. Its counters are kept.
+     *
+     * @param unDataId - The data id to stop filtering.
+     * @return true - The data id was filtered.
+     * @return false - The data id was not filtered.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommSendFilter::ClearFilter(uint16_t unDataId)
+    {
+        Entry* pEntry = FindEntry(unDataId);
+        return pEntry != nullptr && pEntry->bEnabled.exchange(false, std::memory_order_acq_rel);
+    }
+
+    /******************************************************************************
+     * @brief Decide whether a packed packet is sent to a destination. A packet of
+     *        a filtered data id is sent if it changed since the last one sent to
+     *        the destination, or if the keepalive is due. Packets of other data ids
+     *        are always sent. Nothing is recorded until Commit().
+     *
+     * @param pData - The packed packet.
+     * @param siDataSize - The packed size of the packet.
+     * @param pDestination - The explicit address the packet is for, or nullptr
+     *                       for the node's subscribers.
+     * @param tmNow - The time of the send.
+     * @return true - The packet is to be sent.
+     * @return false - The packet is suppressed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommSendFilter::Check(const uint8_t* pData, size_t siDataSize, const sockaddr_in* pDestination, std::chrono::steady_clock::time_point tmNow)
+    {
+        // Most nodes filter nothing, skip the lookup entirely.
+        if (!m_bAnyEnabled.load(std::memory_order_relaxed) || siDataSize < ROVECOMM_PACKET_HEADER_SIZE)
+        {
+            return true;
+        }
+
+        Entry* pEntry = FindEntry(static_cast<uint16_t>((pData[1] << 8) | pData[2]));
+        if (pEntry == nullptr || !pEntry->bEnabled.load(std::memory_order_acquire))
+        {
+            return true;
+        }
+
+        bool bSend = true;
+        {
+            std::lock_guard<std::mutex> lkEntryLock(pEntry->muEntryMutex);
+            std::map<uint64_t, LastSent>::const_iterator itLastSent = pEntry->mpLastSent.find(GetDestinationKey(pDestination));
+            if (itLastSent != pEntry->mpLastSent.end() && !IsChanged(pEntry->stDeadband, itLastSent->second.vBytes, pData, siDataSize))
+            {
+                std::chrono::milliseconds tmKeepalive = pEntry->stDeadband.tmKeepalive;
+                bSend                                 = tmKeepalive.count() > 0 && tmNow - itLastSent->second.tmSent >= tmKeepalive;
+            }
+        }
+
+        pEntry->unChecked.fetch_add(1, std::memory_order_relaxed);
+        if (!bSend)
+        {
+            pEntry->unSuppressed.fetch_add(1, std::memory_order_relaxed);
+            pEntry->unBytesSaved.fetch_add(siDataSize, std::memory_order_relaxed);
+        }
+
+        return bSend;
+    }
+
+    /******************************************************************************
+     * @brief Record that a packet Check() let through was sent to a destination,
+     *        making it the packet later ones to the destination are compared with.
+     *        Call it only once the send succeeded.
+     *
+     * @param pData - The packed packet.
+     * @param siDataSize - The packed size of the packet.
+     * @param pDestination - The explicit address the packet was sent to, or
+     *                       nullptr for the node's subscribers.
+     * @param tmNow - The time of the send.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommSendFilter::Commit(const uint8_t* pData, size_t siDataSize, const sockaddr_in* pDestination, std::chrono::steady_clock::time_point tmNow)
+    {
+        if (!m_bAnyEnabled.load(std::memory_order_relaxed) || siDataSize < ROVECOMM_PACKET_HEADER_SIZE)
+        {
+            return;
+        }
+
+        Entry* pEntry = FindEntry(static_cast<uint16_t>((pData[1] << 8) | pData[2]));
+        if (pEntry == nullptr || !pEntry->bEnabled.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        // A packet that did not change since the last one sent there went out as a keepalive.
+        bool bKeepalive;
+        {
+            std::lock_guard<std::mutex> lkEntryLock(pEntry->muEntryMutex);
+            LastSent& stLastSent = pEntry->mpLastSent[GetDestinationKey(pDestination)];
+            bKeepalive           = !IsChanged(pEntry->stDeadband, stLastSent.vBytes, pData, siDataSize);
+            if (!bKeepalive)
+            {
+                stLastSent.vBytes.assign(pData, pData + siDataSize);
+            }
+            stLastSent.tmSent = tmNow;
+        }
+
+        pEntry->unSent.fetch_add(1, std::memory_order_relaxed);
+        pEntry->unKeepalives.fetch_add(bKeepalive ? 1 : 0, std::memory_order_relaxed);
+        pEntry->unBytesSent.fetch_add(siDataSize, std::memory_order_relaxed);
+    }
+
+    /******************************************************************************
+     * @brief Forget what was last sent to a destination, so the next packet of
+     *        every filtered data id is sent there whether it changed or not. Used
+     *        when a subscriber joins, since all subscribers share one last sent
+     *        packet and the new one has not received it.
+     *
+     * @param pDestination - The explicit address to forget, or nullptr for the
+     *                       node's subscribers.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommSendFilter::ResetDestination(const sockaddr_in* pDestination)
+    {
+        uint64_t unKey = GetDestinationKey(pDestination);
+
+        std::lock_guard<std::mutex> lkAllocationLock(m_muAllocationMutex);
+        for (const std::unique_ptr<Entry>& pEntry : m_vEntries)
+        {
+            std::lock_guard<std::mutex> lkEntryLock(pEntry->muEntryMutex);
+            pEntry->mpLastSent.erase(unKey);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Check if a data id is filtered.
+     *
+     * @param unDataId - The data id to check.
+     * @return true - Packets of the data id go through the filter.
+     * @return false - Packets of the data id are always sent.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommSendFilter::IsFiltered(uint16_t unDataId) const
+    {
+        Entry* pEntry = FindEntry(unDataId);
+        return pEntry != nullptr && pEntry->bEnabled.load(std::memory_order_acquire);
+    }
+
+    /******************************************************************************
+     * @brief Get the counters of every data id that was ever filtered, added up.
+     *
+     * @return RoveCommSendFilterStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommSendFilterStatistics RoveCommSendFilter::GetStatistics() const
+    {
+        RoveCommSendFilterStatistics stTotal = {0, 0, 0, 0, 0, 0};
+
+        std::lock_guard<std::mutex> lkAllocationLock(m_muAllocationMutex);
+        for (const std::unique_ptr<Entry>& pEntry : m_vEntries)
+        {
+            RoveCommSendFilterStatistics stStatistics = ReadStatistics(*pEntry);
+            stTotal.unChecked += stStatistics.unChecked;
+            stTotal.unSent += stStatistics.unSent;
+            stTotal.unKeepalives += stStatistics.unKeepalives;
+            stTotal.unSuppressed += stStatistics.unSuppressed;
+            stTotal.unBytesSent += stStatistics.unBytesSent;
+            stTotal.unBytesSaved += stStatistics.unBytesSaved;
+        }
+
+        return stTotal;
+    }
+
+    /******************************************************************************
+     * @brief Get the counters of one data id.
+     *
+     * @param unDataId - The data id.
+     * @return RoveCommSendFilterStatistics - The current counter values, all zero
+     *                                        if the data id was never filtered.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommSendFilterStatistics RoveCommSendFilter::GetStatistics(uint16_t unDataId) const
+    {
+        Entry* pEntry = FindEntry(unDataId);
+        if (pEntry == nullptr)
+        {
+            return RoveCommSendFilterStatistics{0, 0, 0, 0, 0, 0};
+        }
+
+        return ReadStatistics(*pEntry);
+    }
+}    // namespace rovecomm
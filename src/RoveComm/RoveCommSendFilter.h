@@ -0,0 +1,166 @@
+/******************************************************************************
+ * @brief The RoveCommSendFilter class suppresses outbound packets that would
+ *        not tell the receiver anything new, so that slowly changing telemetry
+ *        does not use the link at its full send rate.
+ *
+ * @file RoveCommSendFilter.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_SEND_FILTER_H
+#define ROVECOMM_SEND_FILTER_H
+
+#include "./RoveCommConsts.h"
+#include "./RoveCommManifest.h"
+#include "./RoveCommPacket.h"
+
+/// \cond
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    // Define a struct for configuring when a packet of a filtered data id counts as changed.
+    struct RoveCommDeadband
+    {
+        public:
+            double dAbsolute = 0.0;    // A float or double element changed if it moved more than this...
+            double dRelative = 0.0;    // ...and more than this fraction of its last sent value. Both zero compares the bytes.
+            std::chrono::milliseconds tmKeepalive = std::chrono::milliseconds(ROVECOMM_SEND_FILTER_KEEPALIVE_MS);    // Send anyway this long after the last send. Zero never forces one.
+    };
+
+    // Define a struct for reporting a snapshot of a send filter's counters.
+    struct RoveCommSendFilterStatistics
+    {
+        public:
+            uint64_t unChecked;       // Packets of filtered data ids that were about to be sent, per destination.
+            uint64_t unSent;          // Packets let through and sent, including keepalives.
+            uint64_t unKeepalives;    // Unchanged packets let through because the keepalive was due.
+            uint64_t unSuppressed;    // Packets that were not sent because nothing changed.
+            uint64_t unBytesSent;     // Packed bytes of the packets let through, per destination.
+            uint64_t unBytesSaved;    // Packed bytes of the packets suppressed, per destination.
+    };
+
+    /******************************************************************************
+     * @brief A per data id filter in front of a node's UDP send path. Each filtered
+     *        data id keeps a copy of the last packet sent to each destination, and
+     *        a new packet is only sent there if its header differs or one of its
+     *        elements moved out of the deadband around the last sent value.
+     *        Comparing against the last sent packet, rather than the last one
+     *        offered, means a slow drift is still sent once it adds up to more
+     *        than the deadband.
+     *
+     *        The subscribers of a node share one destination, and every explicit
+     *        address is a destination of its own, so a peer asking for the
+     *        current value is not refused because the subscribers already have it.
+     *        Check() only decides. The packet becomes the last sent one when the
+     *        caller reports with Commit() that the send succeeded, so a failed
+     *        send does not suppress the same value on the next try.
+     *
+     *        Data ids without a filter are not looked at. Filters are found through
+     *        the same two level table of 256 pages as the history store, and only
+     *        freed with the filter, so Check() does not take the allocation lock.
+     *
+     * @note Check() and Commit() may be called from any number of sending threads.
+     *       Packets of the same data id are compared under that data id's own lock.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommSendFilter
+    {
+        private:
+            struct LastSent
+            {
+                public:
+                    std::vector<uint8_t> vBytes;
+                    std::chrono::steady_clock::time_point tmSent;
+            };
+
+            struct Entry
+            {
+                public:
+                    std::mutex muEntryMutex;
+                    std::atomic<bool> bEnabled;
+                    RoveCommDeadband stDeadband;
+                    std::map<uint64_t, LastSent> mpLastSent;
+
+                    // Statistics counters.
+                    std::atomic<uint64_t> unChecked;
+                    std::atomic<uint64_t> unSent;
+                    std::atomic<uint64_t> unKeepalives;
+                    std::atomic<uint64_t> unSuppressed;
+                    std::atomic<uint64_t> unBytesSent;
+                    std::atomic<uint64_t> unBytesSaved;
+            };
+
+            struct Page
+            {
+                public:
+                    std::array<std::atomic<Entry*>, 256> aEntries;
+            };
+
+            // Private member variables
+            std::array<std::atomic<Page*>, 256> m_aPages;
+            std::atomic<bool> m_bAnyEnabled;
+            mutable std::mutex m_muAllocationMutex;
+            std::vector<std::unique_ptr<Page>> m_vPages;
+            std::vector<std::unique_ptr<Entry>> m_vEntries;
+
+            // Entry management functions
+            Entry* FindEntry(uint16_t unDataId) const;
+            static uint64_t GetDestinationKey(const sockaddr_in* pDestination);
+            static bool IsChanged(const RoveCommDeadband& stDeadband, const std::vector<uint8_t>& vLastSent, const uint8_t* pData, size_t siDataSize);
+            static RoveCommSendFilterStatistics ReadStatistics(const Entry& stEntry);
+
+        public:
+            // Constructor
+            RoveCommSendFilter();
+            RoveCommSendFilter(const RoveCommSendFilter&)            = delete;
+            RoveCommSendFilter& operator=(const RoveCommSendFilter&) = delete;
+
+            // Configuration functions
+            void SetFilter(uint16_t unDataId, const RoveCommDeadband& stDeadband);
+            void SetFilter(const std::map<std::string, manifest::ManifestEntry>& mpEntries, const RoveCommDeadband& stDeadband);
+            bool ClearFilter(uint16_t unDataId);
+
+            // Filter functions
+            bool Check(const uint8_t* pData,
+                       size_t siDataSize,
+                       const sockaddr_in* pDestination,
+                       std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now());
+            void Commit(const uint8_t* pData,
+                        size_t siDataSize,
+                        const sockaddr_in* pDestination,
+                        std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now());
+            void ResetDestination(const sockaddr_in* pDestination);
+
+            // Accessors
+            bool IsFiltered(uint16_t unDataId) const;
+            RoveCommSendFilterStatistics GetStatistics() const;
+            RoveCommSendFilterStatistics GetStatistics(uint16_t unDataId) const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_SEND_FILTER_H
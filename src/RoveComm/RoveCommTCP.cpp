@@ -16,6 +16,8 @@ typedef SOCKET socket_t;
 #define CLOSE_SOCKET   closesocket
 #define GET_LAST_ERROR WSAGetLastError()
 #else
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 typedef int socket_t;
 #define CLOSE_SOCKET   close
 #define GET_LAST_ERROR errno
@@ -36,16 +38,32 @@ namespace rovecomm
      *
      *
      * @author clayjay3 (claytonraycowen@gmail.com)
-     * @date 2024-03-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
     RoveCommTCP::RoveCommTCP()
     {
         // Initialize member variables.
-        m_nTCPSocket              = -1;
-        m_nCurrentTCPClientSocket = -1;
+        m_nTCPSocket            = -1;
+        m_nEpollFD              = -1;
+        m_nWakeupFD             = -1;
+        m_bConnectionPooling    = true;
+        m_pNoDelayDataIds       = std::make_unique<std::atomic<bool>[]>(std::numeric_limits<uint16_t>::max() + 1);
+        m_unConnectionsAccepted = 0;
+        m_unConnectionsRejected = 0;
+        m_unConnectionsClosed   = 0;
+        m_unPacketsReceived     = 0;
+        m_unBytesReceived       = 0;
+        m_siOpenConnections     = 0;
+        m_unOversizedFrames     = 0;
+        m_unMalformedFrames     = 0;
+        m_siMaxFrameSize        = ROVECOMM_TCP_MAX_FRAME_SIZE;
 
-        // Set an IPS cap in the backend RoveComm thread.
-        this->SetMainThreadIPSLimit(rovecomm::ROVECOMM_THREAD_MAX_IPS);
+        // Callbacks run on the receive thread until SetCallbackDispatch() is called.
+        m_unDispatchThreads = 0;
+        m_aDedicatedDispatchLanes.fill(false);
+
+        // The receive thread sleeps in epoll_wait() until a connection has data, so it needs no IPS cap.
     }
 
     /******************************************************************************
@@ -59,6 +77,247 @@ namespace rovecomm
         CloseTCPSocket();
     }
 
+    /******************************************************************************
+     * @brief Choose where callbacks run. By default they run on the receive thread,
+     *        so a slow callback delays accepting the next connection. With one or
+     *        more worker threads, the receive thread copies each packet into a
+     *        bounded dispatch queue and the workers run the callbacks. There is
+     *        one queue per priority class, and the workers always take the
+     *        highest priority packet first, see SetDataIdPriority().
+     *
+     * @param unWorkerThreads - The number of threads that run callbacks. Pass 0 to
+     *                          run callbacks on the receive thread.
+     * @param siQueueCapacity - The number of packets each priority's queue can hold.
+     * @param ePolicy - What the receive thread does when a queue is full.
+     * @return true - The dispatch was set.
+     * @return false - The socket is open. The receive thread and the workers use
+     *                 the dispatcher until CloseTCPSocket(), so it cannot be
+     *                 replaced until then.
+     *
+     * @note This must be called before InitTCPSocket(). With more than one
+     *       worker, callbacks can run concurrently and packets can be handled
+     *       out of order, so callbacks must be thread safe.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCP::SetCallbackDispatch(unsigned int unWorkerThreads, size_t siQueueCapacity, RoveCommOverflowPolicy ePolicy)
+    {
+        if (m_nTCPSocket != -1)
+        {
+            std::cerr << "Cannot change the callback dispatch while the TCP socket is open." << std::endl;
+            return false;
+        }
+
+        m_unDispatchThreads = unWorkerThreads;
+        m_pDispatcher.reset();
+        if (unWorkerThreads > 0)
+        {
+            m_pDispatcher = std::make_unique<RoveCommPriorityDispatcher>(m_stPriorities, siQueueCapacity, ePolicy);
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of worker threads that run callbacks.
+     *
+     * @return unsigned int - The number of workers, 0 if callbacks run on the
+     *                        receive thread.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    unsigned int RoveCommTCP::GetCallbackDispatchThreads() const
+    {
+        return m_unDispatchThreads;
+    }
+
+    /******************************************************************************
+     * @brief Give a priority class a dispatch thread of its own, in addition to the
+     *        workers set with SetCallbackDispatch(). Its packets are then handled
+     *        even while every shared worker is stuck in a slow callback.
+     *
+     * @param ePriority - The priority class to serve.
+     * @param bDedicated - Whether the priority class gets a dedicated thread.
+     *
+     * @note This must be called before InitTCPSocket() to take effect, and only has
+     *       an effect once SetCallbackDispatch() enabled the worker threads.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::SetDedicatedDispatchThread(RoveCommPriority ePriority, bool bDedicated)
+    {
+        m_aDedicatedDispatchLanes[ePriority] = bDedicated;
+    }
+
+    /******************************************************************************
+     * @brief Set the priority class that packets with a data id are dispatched
+     *        with. Data ids default to ePriorityNormal. Priorities only apply when
+     *        callbacks run on worker threads, and can be changed at any time.
+     *
+     * @param unDataId - The data id to classify.
+     * @param ePriority - The priority its packets are dispatched with.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::SetDataIdPriority(uint16_t unDataId, RoveCommPriority ePriority)
+    {
+        m_stPriorities.SetPriority(unDataId, ePriority);
+    }
+
+    /******************************************************************************
+     * @brief Set the priority class of every data id in a manifest map, such as
+     *        manifest::Core::TELEMETRY.
+     *
+     * @param mpEntries - The manifest entries to classify.
+     * @param ePriority - The priority their packets are dispatched with.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::SetDataIdPriority(const std::map<std::string, manifest::ManifestEntry>& mpEntries, RoveCommPriority ePriority)
+    {
+        m_stPriorities.SetPriority(mpEntries, ePriority);
+    }
+
+    /******************************************************************************
+     * @brief Classify a board from its manifest split, so that its commands are
+     *        dispatched ahead of its errors, and its errors ahead of its telemetry.
+     *
+     * @param mpCommands - The board's COMMANDS map, dispatched at ePriorityHigh.
+     * @param mpTelemetry - The board's TELEMETRY map, dispatched at ePriorityLow.
+     * @param mpErrors - The board's ERROR map, dispatched at ePriorityNormal.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::SetManifestPriorities(const std::map<std::string, manifest::ManifestEntry>& mpCommands,
+                                            const std::map<std::string, manifest::ManifestEntry>& mpTelemetry,
+                                            const std::map<std::string, manifest::ManifestEntry>& mpErrors)
+    {
+        m_stPriorities.SetManifestPriorities(mpCommands, mpTelemetry, mpErrors);
+    }
+
+    /******************************************************************************
+     * @brief Get the priority class that packets with a data id are dispatched with.
+     *
+     * @param unDataId - The data id to look up.
+     * @return RoveCommPriority - Its priority.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommPriority RoveCommTCP::GetDataIdPriority(uint16_t unDataId) const
+    {
+        return m_stPriorities.GetPriority(unDataId);
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the callback dispatch queue's counters.
+     *
+     * @return RoveCommDispatchStatistics - The current counter values, all zero if
+     *                                      callbacks run on the receive thread.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommDispatchStatistics RoveCommTCP::GetDispatchStatistics() const
+    {
+        if (m_pDispatcher == nullptr)
+        {
+            return RoveCommDispatchStatistics{};
+        }
+
+        return m_pDispatcher->GetStatistics();
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the counters of one priority class's dispatch queue.
+     *
+     * @param ePriority - The priority class to report.
+     * @return RoveCommDispatchStatistics - The current counter values, all zero if
+     *                                      callbacks run on the receive thread.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommDispatchStatistics RoveCommTCP::GetDispatchStatistics(RoveCommPriority ePriority) const
+    {
+        if (m_pDispatcher == nullptr)
+        {
+            return RoveCommDispatchStatistics{};
+        }
+
+        return m_pDispatcher->GetStatistics(ePriority);
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the stream receiver's counters.
+     *
+     * @return RoveCommStreamStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommStreamStatistics RoveCommTCP::GetTCPStreamStatistics() const
+    {
+        return m_stStreamReceiver.GetStatistics();
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the counters of the connections SendTCPPacket()
+     *        keeps open.
+     *
+     * @return RoveCommConnectionPoolStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommConnectionPoolStatistics RoveCommTCP::GetTCPConnectionPoolStatistics() const
+    {
+        return m_stConnectionPool.GetStatistics();
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the counters of the write buffers
+     *        SendTCPPacketAsync() queues into.
+     *
+     * @return RoveCommSendQueueStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommSendQueueStatistics RoveCommTCP::GetTCPSendQueueStatistics() const
+    {
+        return m_stSendQueue.GetStatistics();
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the counters of the client connections this node
+     *        has accepted.
+     *
+     * @return RoveCommTCPServerStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommTCPServerStatistics RoveCommTCP::GetTCPServerStatistics() const
+    {
+        RoveCommTCPServerStatistics stStatistics;
+        stStatistics.unConnectionsAccepted = m_unConnectionsAccepted;
+        stStatistics.unConnectionsRejected = m_unConnectionsRejected;
+        stStatistics.unConnectionsClosed   = m_unConnectionsClosed;
+        stStatistics.unPacketsReceived     = m_unPacketsReceived;
+        stStatistics.unBytesReceived       = m_unBytesReceived;
+        stStatistics.unOversizedFrames     = m_unOversizedFrames;
+        stStatistics.unMalformedFrames     = m_unMalformedFrames;
+        stStatistics.siOpenConnections     = m_siOpenConnections;
+        return stStatistics;
+    }
+
     /******************************************************************************
      * @brief Initializes a TCP socket and binds it to the specified IP address and
      *        port. And then starts the threaded continuous code in AutonomyThread.
@@ -118,6 +377,10 @@ namespace rovecomm
         m_saTCPServerAddr.sin_addr.s_addr = inet_addr(cIPAddress);
         m_saTCPServerAddr.sin_port        = htons(nPort);
 
+        // Persistent stream connections closed by this node leave the port in TIME_WAIT, which must not stop it from being bound again.
+        int nReuseAddress = 1;
+        setsockopt(m_nTCPSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&nReuseAddress), sizeof(nReuseAddress));
+
         // Bind the socket to the server address
         if (bind(m_nTCPSocket.load(), (struct sockaddr*) &m_saTCPServerAddr, sizeof(m_saTCPServerAddr)) == -1)
         {
@@ -127,23 +390,58 @@ namespace rovecomm
         }
 
         // Listen for incoming connections
-        if (listen(m_nTCPSocket, 5) == -1)
+        if (listen(m_nTCPSocket, ROVECOMM_TCP_LISTEN_BACKLOG) == -1)
         {
             perror("Failed to listen on TCP socket");
             close(m_nTCPSocket);
             return false;
         }
 
+        // Create the epoll instance the receive thread waits on.
+        if (!InitReceiveEvents())
+        {
+            close(m_nTCPSocket);
+            return false;
+        }
+
+        // Size the worker pool before the receive thread starts, since resizing briefly signals every thread to stop.
+        unsigned int unWorkers = 0;
+        if (m_pDispatcher != nullptr)
+        {
+            for (int nIter = 0; nIter < ePriorityCount; ++nIter)
+            {
+                m_pDispatcher->SetDedicatedWorker(static_cast<RoveCommPriority>(nIter), m_aDedicatedDispatchLanes[nIter]);
+            }
+            m_pDispatcher->Open();
+            unWorkers = m_unDispatchThreads + m_pDispatcher->GetDedicatedWorkers();
+            RunDetachedPool(0, unWorkers);
+        }
+
+        // Stream transfers still work over TCP packets if their receiver cannot start, they are only refused.
+        if (!m_stStreamReceiver.Enable())
+        {
+            std::cerr << "Failed to start the TCP stream receiver, stream transfers will be refused." << std::endl;
+        }
+
         // Start the threaded continuous code
         Start();
 
+        // Start one long-running dispatch worker per pool thread.
+        if (m_pDispatcher != nullptr)
+        {
+            RunDetachedPool(unWorkers, unWorkers);
+        }
+
         return true;
     }
 
     /******************************************************************************
      * @brief Sends a TCP packet to the specified client IP address and port.
-     *        The data is packed into a RoveCommData struct and sent over the
-     *        TCP socket.
+     *        The data is packed into a buffer sized to the packet and sent over
+     *        the destination's pooled connection, which is opened by the first
+     *        send and kept for later ones. With pooling turned off, a connection
+     *        is opened and closed for every packet, and the send mode is ignored
+     *        since closing the connection pushes the packet.
      *
      * @tparam T - The data type of the RoveCommPacket. Must be one of the
      *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
@@ -151,15 +449,47 @@ namespace rovecomm
      * @param stData - The RoveCommPacket to send over the TCP socket.
      * @param cClientIPAddress - The IP address of the client to send the packet to.
      * @param nClientPort - The port of the client to send the packet to.
+     * @param eMode - When the packet is pushed onto the wire. eSendDefault is
+     *                eSendNoDelay for data ids passed to SetTCPNoDelay(). Use
+     *                eSendBatched for a burst, then FlushTCP().
      * @return ssize_t - The number of bytes sent over the TCP socket. Returns -1
      *                   if an error occurred.
      *
      * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
     template<typename T>
-    ssize_t RoveCommTCP::SendTCPPacket(const RoveCommPacket<T>& stPacket, const char* cClientIPAddress, int nClientPort)
+    ssize_t RoveCommTCP::SendTCPPacket(const RoveCommPacket<T>& stPacket, const char* cClientIPAddress, int nClientPort, RoveCommTCPSendMode eMode)
     {
+        // Pack the data into a small stack buffer, or a pooled buffer if it does not fit.
+        uint8_t aStackBuffer[ROVECOMM_PACKET_STACK_BUFFER_SIZE];
+        uint8_t* pBuffer    = aStackBuffer;
+        size_t siBufferSize = sizeof(aStackBuffer);
+        RoveCommBufferPool::Buffer stPooledBuffer;
+        if (GetPackedSize(stPacket) > siBufferSize)
+        {
+            stPooledBuffer = m_stSendBufferPool.Acquire(GetPackedSize(stPacket));
+            pBuffer        = stPooledBuffer.data();
+            siBufferSize   = stPooledBuffer.size();
+        }
+        size_t siDataSize = PackPacket(stPacket, pBuffer, siBufferSize);
+        if (siDataSize == 0)
+        {
+            std::cerr << "Failed to pack TCP packet with data id " << stPacket.unDataId << std::endl;
+            return -1;
+        }
+
+        // Reuse the destination's open connection.
+        if (m_bConnectionPooling)
+        {
+            if (eMode == eSendDefault && m_pNoDelayDataIds[stPacket.unDataId].load(std::memory_order_relaxed))
+            {
+                eMode = eSendNoDelay;
+            }
+            return m_stConnectionPool.Send(cClientIPAddress, nClientPort, pBuffer, siDataSize, eMode);
+        }
+
         // Create a TCP socket
         int nClientSocket = socket(AF_INET, SOCK_STREAM, 0);
         if (nClientSocket == -1)
@@ -190,16 +520,11 @@ namespace rovecomm
             return -1;
         }
 
-        // Pack the data
-        RoveCommData stData = PackPacket(stPacket);
-
-        // Get size of data not including the data not filled. (the null/zero data in RoveCommData)
-        size_t siDataSize = ROVECOMM_PACKET_HEADER_SIZE + (sizeof(T) * stPacket.unDataCount);
         // Send the data
 #if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
-        ssize_t siBytesSent = send(nClientSocket, reinterpret_cast<char*>(&stData), siDataSize, 0);
+        ssize_t siBytesSent = send(nClientSocket, reinterpret_cast<const char*>(pBuffer), siDataSize, 0);
 #else
-        ssize_t siBytesSent = send(nClientSocket, &stData, siDataSize, 0);
+        ssize_t siBytesSent = send(nClientSocket, pBuffer, siDataSize, 0);
 #endif
         // Check if any bytes were sent.
         if (siBytesSent == -1)
@@ -215,283 +540,1087 @@ namespace rovecomm
     }
 
     /******************************************************************************
-     * @brief Adds a callback function to the vector of TCP callbacks for the
-     *        specified data type. The callback function will be invoked when a
-     *        packet with the specified data id is received.
+     * @brief Queues a TCP packet for the specified client IP address and port,
+     *        and returns without waiting on the connection. The packet is packed
+     *        into the destination's write buffer, and the send queue's thread
+     *        connects and writes it.
      *
      * @tparam T - The data type of the RoveCommPacket. Must be one of the
      *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
      *             int32_t, float, double, or char.
-     * @param fnCallback - The callback function to add to the vector of TCP
-     *                     callbacks.
-     * @param unCondition - The data id of the packet that will invoke the
-     *                      callback function.
+     * @param stPacket - The RoveCommPacket to send.
+     * @param cClientIPAddress - The IP address of the client to send the packet to.
+     * @param nClientPort - The port of the client to send the packet to.
+     * @param fnCallback - Called once with the bytes written, or -1 if the packet
+     *                     was refused, timed out, or the socket was closed first.
+     *                     Runs on the send queue's thread, so it must not block.
+     * @return true - The packet was queued.
+     * @return false - The packet could not be packed, the address is invalid, or
+     *                 the destination's write buffer is over its high-water mark.
      *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
     template<typename T>
-    void RoveCommTCP::AddTCPCallback(std::function<void(const RoveCommPacket<T>&)> fnCallback, const uint16_t& unCondition)
+    bool RoveCommTCP::SendTCPPacketAsync(const RoveCommPacket<T>& stPacket, const char* cClientIPAddress, int nClientPort, RoveCommSendCallback fnCallback)
     {
-        // Acquire a write lock to protect the callback vectors.
-        std::unique_lock<std::shared_mutex> lkCallbackLock(m_muCallbackMutex);
-
-        // Add the callback function to the vector of TCP callbacks for the specified data type
-        if constexpr (std::is_same_v<T, uint8_t>)
-        {
-            // Add the callback function to the vector of uint8_t callbacks
-            tcp::vUInt8Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, int8_t>)
-        {
-            // Add the callback function to the vector of int8_t callbacks
-            tcp::vInt8Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, uint16_t>)
-        {
-            // Add the callback function to the vector of uint16_t callbacks
-            tcp::vUInt16Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, int16_t>)
-        {
-            // Add the callback function to the vector of int16_t callbacks
-            tcp::vInt16Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, uint32_t>)
-        {
-            // Add the callback function to the vector of uint32_t callbacks
-            tcp::vUInt32Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, int32_t>)
-        {
-            // Add the callback function to the vector of int32_t callbacks
-            tcp::vInt32Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, float>)
-        {
-            // Add the callback function to the vector of float callbacks
-            tcp::vFloatCallbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, double>)
+        // Configure the client address
+        struct sockaddr_in saClientAddr;
+        memset(&saClientAddr, 0, sizeof(saClientAddr));
+        saClientAddr.sin_family = AF_INET;
+        saClientAddr.sin_port   = htons(nClientPort);
+        if (inet_pton(AF_INET, cClientIPAddress, &saClientAddr.sin_addr) <= 0)
         {
-            // Add the callback function to the vector of double callbacks
-            tcp::vDoubleCallbacks.push_back(std::make_tuple(fnCallback, unCondition));
+            perror("Invalid address/ Address not supported");
+            if (fnCallback)
+            {
+                fnCallback(-1);
+            }
+            return false;
         }
-        else if constexpr (std::is_same_v<T, char>)
+
+        // Pack straight into the buffer that will be queued.
+        RoveCommBufferPool::Buffer stBuffer = m_stSendQueue.AcquireBuffer(GetPackedSize(stPacket));
+        if (PackPacket(stPacket, stBuffer.data(), stBuffer.size()) == 0)
         {
-            // Add the callback function to the vector of char callbacks
-            tcp::vCharCallbacks.push_back(std::make_tuple(fnCallback, unCondition));
+            std::cerr << "Failed to pack TCP packet with data id " << stPacket.unDataId << std::endl;
+            if (fnCallback)
+            {
+                fnCallback(-1);
+            }
+            return false;
         }
+
+        return m_stSendQueue.Enqueue(saClientAddr, std::move(stBuffer), std::move(fnCallback));
     }
 
     /******************************************************************************
-     * @brief Removes a callback function from the vector of TCP callbacks for the
-     *        specified data type. The callback function will no longer be invoked
-     *        when a packet with the specified data id is received.
+     * @brief Queues a TCP packet like SendTCPPacketAsync(), and returns a future
+     *        for how the send ended.
      *
-     * @tparam T - The data type of the RoveCommPacket. Must be one of the
-     *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
-     *             int32_t, float, double, or char.
-     * @param fnCallback - The callback function to remove from the vector of TCP
-     *                     callbacks.
+     * @tparam T - The data type of the RoveCommPacket.
+     * @param stPacket - The RoveCommPacket to send.
+     * @param cClientIPAddress - The IP address of the client to send the packet to.
+     * @param nClientPort - The port of the client to send the packet to.
+     * @return std::future<ssize_t> - Becomes the bytes written, or -1 if the
+     *                                packet was not sent.
      *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
     template<typename T>
-    void RoveCommTCP::RemoveTCPCallback(std::function<void(const RoveCommPacket<T>&)> fnCallback)
+    std::future<ssize_t> RoveCommTCP::SendTCPPacketFuture(const RoveCommPacket<T>& stPacket, const char* cClientIPAddress, int nClientPort)
     {
-        // Acquire a write lock to protect the callback vectors.
-        std::unique_lock<std::shared_mutex> lkCallbackLock(m_muCallbackMutex);
+        std::shared_ptr<std::promise<ssize_t>> pPromise = std::make_shared<std::promise<ssize_t>>();
+        std::future<ssize_t> stFuture                   = pPromise->get_future();
+        SendTCPPacketAsync(stPacket, cClientIPAddress, nClientPort, [pPromise](ssize_t siResult) { pPromise->set_value(siResult); });
 
-        // Remove the callback function from the appropriate vector based on the data type T
-        if constexpr (std::is_same_v<T, uint8_t>)
-        {
-            // Remove the callback function from the vector of uint8_t callbacks
-            tcp::vUInt8Callbacks.erase(std::remove_if(tcp::vUInt8Callbacks.begin(),
-                                                      tcp::vUInt8Callbacks.end(),
-                                                      [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                       tcp::vUInt8Callbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, int8_t>)
-        {
-            // Remove the callback function from the vector of int8_t callbacks
-            tcp::vInt8Callbacks.erase(std::remove_if(tcp::vInt8Callbacks.begin(),
-                                                     tcp::vInt8Callbacks.end(),
-                                                     [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                      tcp::vInt8Callbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, uint16_t>)
-        {
-            // Remove the callback function from the vector of uint16_t callbacks
-            tcp::vUInt16Callbacks.erase(std::remove_if(tcp::vUInt16Callbacks.begin(),
-                                                       tcp::vUInt16Callbacks.end(),
-                                                       [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                        tcp::vUInt16Callbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, int16_t>)
-        {
-            // Remove the callback function from the vector of int16_t callbacks
-            tcp::vInt16Callbacks.erase(std::remove_if(tcp::vInt16Callbacks.begin(),
-                                                      tcp::vInt16Callbacks.end(),
-                                                      [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                       tcp::vInt16Callbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, uint32_t>)
-        {
-            // Remove the callback function from the vector of uint32_t callbacks
-            tcp::vUInt32Callbacks.erase(std::remove_if(tcp::vUInt32Callbacks.begin(),
-                                                       tcp::vUInt32Callbacks.end(),
-                                                       [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                        tcp::vUInt32Callbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, int32_t>)
-        {
-            // Remove the callback function from the vector of int32_t callbacks
-            tcp::vInt32Callbacks.erase(std::remove_if(tcp::vInt32Callbacks.begin(),
-                                                      tcp::vInt32Callbacks.end(),
-                                                      [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                       tcp::vInt32Callbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, float>)
-        {
-            // Remove the callback function from the vector of float callbacks
-            tcp::vFloatCallbacks.erase(std::remove_if(tcp::vFloatCallbacks.begin(),
-                                                      tcp::vFloatCallbacks.end(),
-                                                      [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                       tcp::vFloatCallbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, double>)
-        {
-            // Remove the callback function from the vector of double callbacks
-            tcp::vDoubleCallbacks.erase(std::remove_if(tcp::vDoubleCallbacks.begin(),
-                                                       tcp::vDoubleCallbacks.end(),
-                                                       [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                        tcp::vDoubleCallbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, char>)
-        {
-            // Remove the callback function from the vector of char callbacks
-            tcp::vCharCallbacks.erase(std::remove_if(tcp::vCharCallbacks.begin(),
-                                                     tcp::vCharCallbacks.end(),
-                                                     [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                      tcp::vCharCallbacks.end());
-        }
+        return stFuture;
     }
 
     /******************************************************************************
-     * @brief Processes a received packet and invokes the appropriate callback
-     *        function from the vector of TCP callbacks for the specified data type.
-     *        The data is unpacked into a RoveCommPacket and the appropriate
-     *        callback function is invoked based on the data id.
+     * @brief Set the backpressure SendTCPPacketAsync() applies to a destination
+     *        that is not keeping up, and how long a queued packet may wait.
      *
-     * @tparam T - The data type of the RoveCommPacket. Must be one of the
-     *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
-     *             int32_t, float, double, or char.
-     * @param stData - The received RoveCommData to process and invoke the
-     *                 appropriate callback function.
-     * @param vCallbacks - The vector of TCP callbacks for the specified data type.
-     *                     The callback function will be invoked based on the data id
-     *                     of the received packet.
+     * @param siHighWaterMark - The bytes a destination's write buffer may hold
+     *                          before new sends to it are refused or wait.
+     * @param ePolicy - Whether a send over the mark is refused or waits for room.
+     * @param tmSendTimeout - How long a packet may wait to be written, and the
+     *                        longest a send waits for room.
      *
-     * @note This method is not intended to be called directly. It is called by
-     *       the ReceiveTCPPacketAndCallback method to process a received packet
-     *       and invoke the appropriate callback function.
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::SetTCPSendQueueLimits(size_t siHighWaterMark, RoveCommBackpressurePolicy ePolicy, std::chrono::milliseconds tmSendTimeout)
+    {
+        m_stSendQueue.SetLimits(siHighWaterMark, ePolicy, tmSendTimeout);
+    }
+
+    /******************************************************************************
+     * @brief Push every packet sent to a destination with SendTCPPacket() onto the
+     *        wire now, ending a batch of eSendBatched sends.
      *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @param cClientIPAddress - The IP address of the destination.
+     * @param nClientPort - The port of the destination.
+     * @return true - The destination's pooled connection was flushed.
+     * @return false - There is no pooled connection to the destination.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    template<typename T>
-    void RoveCommTCP::ProcessPacket(const RoveCommData& stData,
-                                    const std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<T>&)>, uint16_t>>& vCallbacks)
+    bool RoveCommTCP::FlushTCP(const char* cClientIPAddress, int nClientPort)
     {
-        // Create instance variables.
-        RoveCommPacket<T> stPacket = UnpackData<T>(stData);
+        return m_stConnectionPool.Flush(cClientIPAddress, nClientPort);
+    }
 
-        // Acquire a read lock to protect the callback vectors.
-        std::shared_lock<std::shared_mutex> lkCallbackLock(m_muCallbackMutex);
+    /******************************************************************************
+     * @brief Push every packet sent with SendTCPPacket() onto the wire now, over
+     *        every pooled connection.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::FlushTCP()
+    {
+        m_stConnectionPool.FlushAll();
+    }
 
-        // Invoke registered callbacks
-        for (const std::tuple<std::function<void(const rovecomm::RoveCommPacket<T>&)>, uint16_t>& tpCallbackInfo : vCallbacks)
-        {
-            const std::function<void(const rovecomm::RoveCommPacket<T>&)>& fnCallback = std::get<0>(tpCallbackInfo);
-            const uint16_t& unCondition                                               = std::get<1>(tpCallbackInfo);
+    /******************************************************************************
+     * @brief Choose whether SendTCPPacket() disables Nagle's algorithm for every
+     *        packet sent with eSendDefault, so that none waits for the previous
+     *        one to be acknowledged. It is enabled by default.
+     *
+     * @param bNoDelay - Whether to push every packet at once.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::SetTCPNoDelay(bool bNoDelay)
+    {
+        m_stConnectionPool.SetNoDelay(bNoDelay);
+    }
 
-            if (unCondition == stPacket.unDataId)
-            {
-                fnCallback(stPacket);
-            }
-        }
+    /******************************************************************************
+     * @brief Mark a latency-critical data id, whose packets SendTCPPacket()
+     *        pushes at once with Nagle's algorithm disabled unless the send asks
+     *        for another mode.
+     *
+     * @param unDataId - The data id to mark.
+     * @param bNoDelay - Whether its packets are pushed at once.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::SetTCPNoDelay(uint16_t unDataId, bool bNoDelay)
+    {
+        m_pNoDelayDataIds[unDataId].store(bNoDelay, std::memory_order_relaxed);
     }
 
     /******************************************************************************
-     * @brief Receives a TCP packet from a client and invokes the appropriate
-     *        callback function from the vector of TCP callbacks for the specified
-     *        data type. The data is unpacked into a RoveCommPacket and the
-     *        appropriate callback function is invoked based on the data id.
+     * @brief Mark every data id in a manifest map, such as manifest::Core::COMMANDS,
+     *        as latency-critical.
      *
-     * @note This method is not intended to be called directly. It is called by
-     *       the ThreadedContinuousCode method to receive a TCP packet from a client
-     *       and invoke the appropriate callback function. This method will run
-     *       indefinitely and will block the thread until a client connection is
-     *       accepted and data is received.
+     * @param mpEntries - The manifest entries to mark.
+     * @param bNoDelay - Whether their packets are pushed at once.
      *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    void RoveCommTCP::ReceiveTCPPacketAndCallback()
+    void RoveCommTCP::SetTCPNoDelay(const std::map<std::string, manifest::ManifestEntry>& mpEntries, bool bNoDelay)
     {
-        if (m_nCurrentTCPClientSocket == -1)
+        for (const auto& stEntry : mpEntries)
         {
-            // Accept a client connection
-            struct sockaddr_in m_saClientAddr;
-            socklen_t sklClientAddrLen = sizeof(m_saClientAddr);
-            m_nCurrentTCPClientSocket  = accept(m_nTCPSocket, (struct sockaddr*) &m_saClientAddr, &sklClientAddrLen);
+            SetTCPNoDelay(static_cast<uint16_t>(stEntry.second.DATA_ID), bNoDelay);
         }
-        else
-        {
-            // Receive data from the client
-            RoveCommData stData;
-#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
-            ssize_t siBytesReceived = recv(m_nCurrentTCPClientSocket, reinterpret_cast<char*>(&stData), sizeof(stData), 0);
-#else
-            ssize_t siBytesReceived = recv(m_nCurrentTCPClientSocket, &stData, sizeof(stData), MSG_DONTWAIT);
-#endif
+    }
 
-            // Process the received packet and invoke the appropriate callback
-            if (siBytesReceived != -1)
-            {
-                // Extract the data id from the received data
-                uint16_t unDataId = (static_cast<uint16_t>(stData.unBytes[1]) << 8) | static_cast<uint16_t>(stData.unBytes[2]);
+    /******************************************************************************
+     * @brief Get whether a data id is marked as latency-critical.
+     *
+     * @param unDataId - The data id to look up.
+     * @return true - Its packets are pushed at once.
+     * @return false - Its packets follow the connection's Nagle setting.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCP::GetTCPNoDelay(uint16_t unDataId) const
+    {
+        return m_pNoDelayDataIds[unDataId].load(std::memory_order_relaxed);
+    }
 
-                // Determine the data type from the received data
-                // manifest::DataTypes eDataType = manifest::Helpers::GetDataTypeFromId(unDataId);
-                manifest::DataTypes eDataType = static_cast<manifest::DataTypes>(stData.unBytes[5]);
+    /******************************************************************************
+     * @brief Choose whether SendTCPPacket() keeps a connection open to each
+     *        destination and reuses it, which is the default, or opens and closes
+     *        one for every packet as older RoveComm nodes expect.
+     *
+     * @param bPooled - Whether to keep connections open. Turning pooling off
+     *                  closes the connections that are open.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::SetTCPConnectionPooling(bool bPooled)
+    {
+        m_bConnectionPooling = bPooled;
+        if (!bPooled)
+        {
+            m_stConnectionPool.CloseAll();
+        }
+    }
 
-                // Convert RoveCommData to appropriate RoveCommPacket based on data type
-                switch (eDataType)
+    /******************************************************************************
+     * @brief Set how long SendTCPPacket() refuses to send to a destination after
+     *        failing to connect to it, and how long SendTCPPacketAsync() waits
+     *        before reconnecting. The delay starts at the minimum, doubles with
+     *        every further failure up to the maximum, and is reset by a
+     *        successful connection.
+     *
+     * @param tmMinBackoff - The delay after the first failure.
+     * @param tmMaxBackoff - The longest delay.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::SetTCPReconnectBackoff(std::chrono::milliseconds tmMinBackoff, std::chrono::milliseconds tmMaxBackoff)
+    {
+        m_stConnectionPool.SetBackoff(tmMinBackoff, tmMaxBackoff);
+        m_stSendQueue.SetBackoff(tmMinBackoff, tmMaxBackoff);
+    }
+
+    /******************************************************************************
+     * @brief Set the largest packet a client may send. A client whose next packet
+     *        header announces more is closed as soon as the header arrives, which
+     *        bounds the memory each connection can make this node hold. Applies
+     *        to connections accepted afterwards.
+     *
+     * @param siMaxFrameSize - The largest packet in bytes, header included.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::SetTCPMaxFrameSize(size_t siMaxFrameSize)
+    {
+        m_siMaxFrameSize = siMaxFrameSize;
+    }
+
+    /******************************************************************************
+     * @brief Adds a callback function to the index of TCP callbacks for the
+     *        specified data type. The callback function will be invoked when a
+     *        packet with the specified data id is received.
+     *
+     * @tparam T - The data type of the RoveCommPacket. Must be one of the
+     *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
+     *             int32_t, float, double, or char.
+     * @param fnCallback - The callback function to add to the index of TCP
+     *                     callbacks.
+     * @param unCondition - The data id of the packet that will invoke the
+     *                      callback function.
+     * @return RoveCommCallbackHandle - A handle that removes exactly this callback.
+     *                                  It may be ignored if the callback is never
+     *                                  removed.
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommCallbackHandle RoveCommTCP::AddTCPCallback(std::function<void(const RoveCommPacket<T>&)> fnCallback, const uint16_t& unCondition)
+    {
+        // Add the callback function to this node's TCP callbacks for the specified data type
+        return m_stCallbacks.Get<T>().Add(fnCallback, unCondition);
+    }
+
+    /******************************************************************************
+     * @brief Removes a callback function from the index of TCP callbacks for the
+     *        specified data type. The callback function will no longer be invoked
+     *        when a packet with the specified data id is received.
+     *
+     * @tparam T - The data type of the RoveCommPacket. Must be one of the
+     *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
+     *             int32_t, float, double, or char.
+     * @param fnCallback - The callback function to remove from the index of TCP
+     *                     callbacks.
+     *
+     * @note Callbacks are matched by their target type, so this removes every
+     *       TCP callback for T whose target has the same type, such as every
+     *       copy of the same lambda. Use the handle returned when the callback was
+     *       added to remove exactly one registration.
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    void RoveCommTCP::RemoveTCPCallback(std::function<void(const RoveCommPacket<T>&)> fnCallback)
+    {
+        // Remove the callback function from this node's TCP callbacks for the specified data type
+        m_stCallbacks.Get<T>().RemoveIf([&](const auto& fnRegistered) { return fnRegistered.target_type() == fnCallback.target_type(); });
+    }
+
+    /******************************************************************************
+     * @brief Adds a view callback function to the index of TCP view callbacks for
+     *        the specified data type. View callbacks receive a RoveCommPacketView
+     *        over the receive buffer, so no memory is allocated or copied before
+     *        they are invoked.
+     *
+     * @tparam T - The data type of the RoveCommPacketView. Must be one of the
+     *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
+     *             int32_t, float, double, or char.
+     * @param fnCallback - The callback function to add to the index of TCP view
+     *                     callbacks.
+     * @param unCondition - The data id of the packet that will invoke the
+     *                      callback function.
+     * @return RoveCommCallbackHandle - A handle that removes exactly this callback.
+     *
+     * @note The view is only valid until the callback returns. Use
+     *       RoveCommPacketView::ToPacket() to keep the data.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommCallbackHandle RoveCommTCP::AddTCPViewCallback(std::function<void(const RoveCommPacketView<T>&)> fnCallback, const uint16_t& unCondition)
+    {
+        // Add the callback function to this node's TCP view callbacks for the specified data type
+        return m_stViewCallbacks.Get<T>().Add(fnCallback, unCondition);
+    }
+
+    /******************************************************************************
+     * @brief Removes a view callback function from the index of TCP view
+     *        callbacks for the specified data type.
+     *
+     * @tparam T - The data type of the RoveCommPacketView. Must be one of the
+     *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
+     *             int32_t, float, double, or char.
+     * @param fnCallback - The callback function to remove from the index of TCP
+     *                     view callbacks.
+     *
+     * @note Callbacks are matched by their target type, so this removes every
+     *       TCP view callback for T whose target has the same type, such as every
+     *       copy of the same lambda. Use the handle returned when the callback was
+     *       added to remove exactly one registration.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    void RoveCommTCP::RemoveTCPViewCallback(std::function<void(const RoveCommPacketView<T>&)> fnCallback)
+    {
+        // Remove the callback function from this node's TCP view callbacks for the specified data type
+        m_stViewCallbacks.Get<T>().RemoveIf([&](const auto& fnRegistered) { return fnRegistered.target_type() == fnCallback.target_type(); });
+    }
+
+    /******************************************************************************
+     * @brief Get the most recent packet received for a data id, without
+     *        registering a callback. Reading never blocks the receive thread.
+     *
+     * @tparam T - The data type of the RoveCommPacket. Must be one of the
+     *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
+     *             int32_t, float, double, or char.
+     * @param unDataId - The data id to read.
+     * @return RoveCommLatestValue<T> - The packet, its receive time and sequence
+     *                                  number. bValid is false if no packet of this
+     *                                  data id and data type was received yet.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommLatestValue<T> RoveCommTCP::GetLatestValue(const uint16_t& unDataId) const
+    {
+        RoveCommLatestValue<T> stValue;
+        m_stLatestValues.Read<T>(unDataId, stValue);
+        return stValue;
+    }
+
+    /******************************************************************************
+     * @brief Get the most recent packet received for a data id into an existing
+     *        value. Polling into the same value reuses its packet's vector, so it
+     *        does not allocate once the vector has grown to the packet's size.
+     *
+     * @tparam T - The data type of the RoveCommPacket. Must be one of the
+     *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
+     *             int32_t, float, double, or char.
+     * @param unDataId - The data id to read.
+     * @param stValue - Filled with the packet, its receive time and its sequence
+     *                  number.
+     * @return true - A packet of this data id and data type was read.
+     * @return false - No packet of this data id was received yet, or the last one
+     *                 had a different data type.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    bool RoveCommTCP::GetLatestValue(const uint16_t& unDataId, RoveCommLatestValue<T>& stValue) const
+    {
+        return m_stLatestValues.Read<T>(unDataId, stValue);
+    }
+
+    /******************************************************************************
+     * @brief Get how many packets of a data id this node has received. Comparing
+     *        it with the sequence number of the last value read tells a poller
+     *        whether anything new arrived, without decoding the packet.
+     *
+     * @param unDataId - The data id to look up.
+     * @return uint64_t - The number of packets, 0 if none were received.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint64_t RoveCommTCP::GetLatestSequence(const uint16_t& unDataId) const
+    {
+        return m_stLatestValues.GetSequence(unDataId);
+    }
+
+    /******************************************************************************
+     * @brief Start keeping a fixed number of samples of a data id. The ring is
+     *        allocated here and filled by the receive thread, so memory use is
+     *        bounded by the capacities passed to this function.
+     *
+     * @param unDataId - The data id to keep.
+     * @param eDataType - The data type of its packets.
+     * @param unDataCount - The number of values kept per sample.
+     * @param siCapacity - The number of samples kept.
+     * @return true - The history was enabled.
+     * @return false - The data count or capacity was zero.
+     *
+     * @note Enabling a data id that already has a history starts a new, empty one.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCP::EnableHistory(const uint16_t& unDataId, manifest::DataTypes eDataType, uint16_t unDataCount, size_t siCapacity)
+    {
+        return m_stHistory.EnableHistory(unDataId, eDataType, unDataCount, siCapacity);
+    }
+
+    /******************************************************************************
+     * @brief Start keeping a fixed number of samples of a manifest entry, such as
+     *        manifest::Core::TELEMETRY.at("DRIVESPEEDS").
+     *
+     * @param stEntry - The manifest entry to keep.
+     * @param siCapacity - The number of samples kept.
+     * @return true - The history was enabled.
+     * @return false - The data count or capacity was zero.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCP::EnableHistory(const manifest::ManifestEntry& stEntry, size_t siCapacity)
+    {
+        return m_stHistory.EnableHistory(stEntry, siCapacity);
+    }
+
+    /******************************************************************************
+     * @brief Start keeping a fixed number of samples of every entry in a manifest
+     *        map, such as manifest::Core::TELEMETRY.
+     *
+     * @param mpEntries - The manifest entries to keep.
+     * @param siCapacity - The number of samples kept per data id.
+     * @return true - The history of every entry was enabled.
+     * @return false - At least one entry could not be enabled.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCP::EnableHistory(const std::map<std::string, manifest::ManifestEntry>& mpEntries, size_t siCapacity)
+    {
+        return m_stHistory.EnableHistory(mpEntries, siCapacity);
+    }
+
+    /******************************************************************************
+     * @brief Get the number of bytes allocated for this node's history rings.
+     *
+     * @return size_t - The memory used by samples.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommTCP::GetHistoryMemoryUsage() const
+    {
+        return m_stHistory.GetMemoryUsage();
+    }
+
+    /******************************************************************************
+     * @brief Get the last samples received for a data id, oldest first. The window
+     *        points into the history ring, so nothing is copied.
+     *
+     * @tparam T - The data type of the packets. Must be one of the following:
+     *             uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t, float,
+     *             double, or char.
+     * @param unDataId - The data id to query.
+     * @param siCount - The number of samples wanted.
+     * @return RoveCommHistoryWindow<T> - The samples, empty if history of this
+     *                                    type is not enabled for the data id.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommHistoryWindow<T> RoveCommTCP::GetLastSamples(const uint16_t& unDataId, size_t siCount) const
+    {
+        return m_stHistory.GetLast<T>(unDataId, siCount);
+    }
+
+    /******************************************************************************
+     * @brief Get the samples of a data id received at or after a point in time,
+     *        oldest first. The window points into the history ring, so nothing is
+     *        copied.
+     *
+     * @tparam T - The data type of the packets. Must be one of the following:
+     *             uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t, float,
+     *             double, or char.
+     * @param unDataId - The data id to query.
+     * @param tmSince - The earliest receive time wanted.
+     * @return RoveCommHistoryWindow<T> - The samples, empty if history of this
+     *                                    type is not enabled for the data id.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommHistoryWindow<T> RoveCommTCP::GetSamplesSince(const uint16_t& unDataId, std::chrono::steady_clock::time_point tmSince) const
+    {
+        return m_stHistory.GetSince<T>(unDataId, tmSince);
+    }
+
+    /******************************************************************************
+     * @brief Receive stream transfers with a data id straight into a buffer the
+     *        application owns. Transfers are sent with a RoveCommTCPStream
+     *        connected to this node's port, and are refused while the data id has
+     *        no sink, while its sink is busy, or if they do not fit the buffer.
+     *
+     * @param unDataId - The data id of the transfers.
+     * @param pBuffer - Where the bytes are written. It must stay valid while the
+     *                  sink is set and until a transfer into it has ended.
+     * @param siCapacity - The size of the buffer.
+     * @param fnCallback - Called on the stream receiver's thread for every chunk
+     *                     written and once when a transfer completes or fails.
+     * @return true - The sink was set, replacing any the data id had.
+     * @return false - The buffer is null, or a transfer into the data id's
+     *                 current sink is in progress.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCP::SetTCPStreamBuffer(uint16_t unDataId, uint8_t* pBuffer, size_t siCapacity, RoveCommStreamCallback fnCallback)
+    {
+        return m_stStreamReceiver.SetBufferSink(unDataId, pBuffer, siCapacity, std::move(fnCallback));
+    }
+
+    /******************************************************************************
+     * @brief Receive stream transfers with a data id straight into a file. On
+     *        Linux the bytes are spliced from the socket into the file, so they
+     *        are never copied into user space. Each transfer replaces the file.
+     *
+     * @param unDataId - The data id of the transfers.
+     * @param szPath - The path of the file, created if it does not exist.
+     * @param fnCallback - Called on the stream receiver's thread for every chunk
+     *                     written and once when a transfer completes or fails.
+     * @return true - The sink was set, replacing any the data id had.
+     * @return false - The path is empty, or a transfer into the data id's
+     *                 current sink is in progress.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCP::SetTCPStreamFile(uint16_t unDataId, const std::string& szPath, RoveCommStreamCallback fnCallback)
+    {
+        return m_stStreamReceiver.SetFileSink(unDataId, szPath, std::move(fnCallback));
+    }
+
+    /******************************************************************************
+     * @brief Stop receiving stream transfers with a data id. A transfer already
+     *        in progress is still written into the old sink.
+     *
+     * @param unDataId - The data id to remove.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::RemoveTCPStreamSink(uint16_t unDataId)
+    {
+        m_stStreamReceiver.RemoveSink(unDataId);
+    }
+
+    /******************************************************************************
+     * @brief Set how long a stream connection may go without receiving anything.
+     *        A connection that stalls partway through a header or a transfer is
+     *        closed after tmStallTimeout, failing the transfer and freeing its
+     *        sink. A connection between transfers is closed after tmIdleTimeout.
+     *
+     * @param tmStallTimeout - The limit partway through a header or a transfer.
+     * @param tmIdleTimeout - The limit between transfers.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::SetTCPStreamTimeouts(std::chrono::milliseconds tmStallTimeout, std::chrono::milliseconds tmIdleTimeout)
+    {
+        m_stStreamReceiver.SetTimeouts(tmStallTimeout, tmIdleTimeout);
+    }
+
+    /******************************************************************************
+     * @brief Processes a received packet and invokes the appropriate callback
+     *        functions from this node's TCP callbacks for the specified data
+     *        type. View callbacks are invoked with a view over the receive buffer.
+     *        The data is only unpacked into a RoveCommPacket if a packet callback
+     *        matches the data id.
+     *
+     * @tparam T - The data type of the RoveCommPacket. Must be one of the
+     *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
+     *             int32_t, float, double, or char.
+     * @param pData - The received bytes to process and invoke the appropriate
+     *                callback function.
+     * @param siDataSize - The number of bytes received.
+     *
+     * @note This method is not intended to be called directly. It is called by
+     *       the ReceiveTCPPacketAndCallback method to process a received packet
+     *       and invoke the appropriate callback function.
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    void RoveCommTCP::ProcessPacket(const uint8_t* pData, size_t siDataSize)
+    {
+        // View the received data without copying it.
+        RoveCommPacketView<T> stView = ViewData<T>(pData, siDataSize);
+
+        // Pin the current callback snapshots. This never waits on a thread that is adding or removing callbacks.
+        typename RoveCommCallbackRegistry<TCPViewCallback<T>>::Snapshot stViewSnapshot = m_stViewCallbacks.Get<T>().Read();
+        typename RoveCommCallbackRegistry<TCPCallback<T>>::Snapshot stSnapshot         = m_stCallbacks.Get<T>().Read();
+
+        // Invoke the view callbacks registered for this data id.
+        const std::vector<std::function<void(const rovecomm::RoveCommPacketView<T>&)>>* pViewCallbacks = stViewSnapshot->Find(stView.unDataId);
+        if (pViewCallbacks != nullptr)
+        {
+            for (const std::function<void(const rovecomm::RoveCommPacketView<T>&)>& fnCallback : *pViewCallbacks)
+            {
+                fnCallback(stView);
+            }
+        }
+
+        // Invoke the packet callbacks registered for this data id, unpacking the data once for all of them.
+        const std::vector<std::function<void(const rovecomm::RoveCommPacket<T>&)>>* pCallbacks = stSnapshot->Find(stView.unDataId);
+        if (pCallbacks != nullptr && !pCallbacks->empty())
+        {
+            RoveCommPacket<T> stPacket = stView.ToPacket();
+            for (const std::function<void(const rovecomm::RoveCommPacket<T>&)>& fnCallback : *pCallbacks)
+            {
+                fnCallback(stPacket);
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Dispatch a received packet to the appropriate callback functions.
+     *        Since data types are not known at compile time, this function calls
+     *        the appropriate ProcessPacket function based on the data type of the
+     *        received packet.
+     *
+     * @param pData - The received bytes, at least a packet header long.
+     * @param siDataSize - The number of bytes received.
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @date 2024-02-07
+     ******************************************************************************/
+    void RoveCommTCP::DispatchTCPPacket(const uint8_t* pData, size_t siDataSize)
+    {
+        // Determine the data type from the received data
+        // manifest::DataTypes eDataType = manifest::Helpers::GetDataTypeFromId(unDataId);
+        manifest::DataTypes eDataType = static_cast<manifest::DataTypes>(pData[5]);
+
+        // Convert the received bytes to the appropriate RoveCommPacket based on data type
+        switch (eDataType)
+        {
+            case manifest::DataTypes::UINT8_T: ProcessPacket<uint8_t>(pData, siDataSize); break;
+            case manifest::DataTypes::INT8_T: ProcessPacket<int8_t>(pData, siDataSize); break;
+            case manifest::DataTypes::UINT16_T: ProcessPacket<uint16_t>(pData, siDataSize); break;
+            case manifest::DataTypes::INT16_T: ProcessPacket<int16_t>(pData, siDataSize); break;
+            case manifest::DataTypes::UINT32_T: ProcessPacket<uint32_t>(pData, siDataSize); break;
+            case manifest::DataTypes::INT32_T: ProcessPacket<int32_t>(pData, siDataSize); break;
+            case manifest::DataTypes::FLOAT_T: ProcessPacket<float>(pData, siDataSize); break;
+            case manifest::DataTypes::DOUBLE_T: ProcessPacket<double>(pData, siDataSize); break;
+            case manifest::DataTypes::CHAR: ProcessPacket<char>(pData, siDataSize); break;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Record a complete packet received over TCP for the latest value
+     *        cache and history, then run its callbacks or queue it for the
+     *        dispatch workers.
+     *
+     * @param pData - The packet's bytes, exactly one packet long.
+     * @param siDataSize - The size of the packet.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::HandleTCPPacket(const uint8_t* pData, size_t siDataSize)
+    {
+        // Pollers see the packet as soon as it is read, even if its callbacks are still queued.
+        std::chrono::steady_clock::time_point tmReceived = std::chrono::steady_clock::now();
+        m_stLatestValues.Update(pData, siDataSize, tmReceived);
+        m_stHistory.Update(pData, siDataSize, tmReceived);
+
+        if (m_pDispatcher != nullptr)
+        {
+            // TCP callbacks do not take an address, so queue the packet with an empty one.
+            struct sockaddr_in saNoAddress;
+            memset(&saNoAddress, 0, sizeof(saNoAddress));
+            m_pDispatcher->Push(pData, siDataSize, saNoAddress);
+        }
+        else
+        {
+            DispatchTCPPacket(pData, siDataSize);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Read what has arrived on a client connection and handle every
+     *        complete packet in it. The start of a packet that has not fully
+     *        arrived is kept in the client's buffer for the next read.
+     *
+     * @param stClient - The client connection to read from.
+     * @return true - The connection stays open.
+     * @return false - The connection was closed by the peer, failed, sent a
+     *                 packet that cannot be parsed, or was handed to the stream
+     *                 receiver. The caller must remove it with RemoveClient().
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCP::ReceiveFromClient(TCPClient& stClient)
+    {
+        // A stream connection is handed to the stream receiver before anything is read from it.
+        if (!stClient.bIdentified)
+        {
+            uint8_t unFirstByte;
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+            ssize_t siPeeked = recv(stClient.nSocket, reinterpret_cast<char*>(&unFirstByte), 1, MSG_PEEK);
+#else
+            ssize_t siPeeked = recv(stClient.nSocket, &unFirstByte, 1, MSG_PEEK | MSG_DONTWAIT);
+#endif
+            if (siPeeked == 1 && unFirstByte == ROVECOMM_STREAM_VERSION)
+            {
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+                epoll_ctl(m_nEpollFD, EPOLL_CTL_DEL, stClient.nSocket, nullptr);
+#endif
+                m_stStreamReceiver.AddConnection(stClient.nSocket);
+                stClient.nSocket = -1;
+                return false;
+            }
+            stClient.bIdentified = siPeeked == 1;
+        }
+
+        // Receive data from the client after the start of any packet already buffered.
+        RoveCommTCPFramer& stFramer = stClient.stFramer;
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        ssize_t siBytesReceived = recv(stClient.nSocket, reinterpret_cast<char*>(stFramer.GetWriteBuffer()), static_cast<int>(stFramer.GetWriteCapacity()), 0);
+#else
+        ssize_t siBytesReceived = recv(stClient.nSocket, stFramer.GetWriteBuffer(), stFramer.GetWriteCapacity(), MSG_DONTWAIT);
+#endif
+        if (siBytesReceived == -1 && (GET_LAST_ERROR == EAGAIN || GET_LAST_ERROR == EWOULDBLOCK))
+        {
+            return true;
+        }
+        if (siBytesReceived <= 0)
+        {
+            return false;
+        }
+        stFramer.Commit(siBytesReceived);
+        m_unBytesReceived += siBytesReceived;
+
+        // Handle every complete packet, a peer may send several before this thread gets to read them.
+        const uint8_t* pFrame;
+        size_t siFrameSize;
+        while (stFramer.NextFrame(pFrame, siFrameSize))
+        {
+            HandleTCPPacket(pFrame, siFrameSize);
+            m_unPacketsReceived++;
+        }
+
+        // Nothing after a rejected header can be found again, so the connection is closed.
+        switch (stFramer.GetError())
+        {
+            case eFrameNoError: return true;
+            case eFrameOversized:
+                std::cerr << "Closing TCP client that sent a packet larger than " << m_siMaxFrameSize << " bytes." << std::endl;
+                m_unOversizedFrames++;
+                return false;
+            default:
+                std::cerr << "Closing TCP client that sent a malformed packet header." << std::endl;
+                m_unMalformedFrames++;
+                return false;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Accepts client connections and receives TCP packets from every open
+     *        one, invoking the appropriate callback functions from the index of
+     *        TCP callbacks for each packet's data type. Connections are kept open,
+     *        so each client may send any number of packets over one connection,
+     *        and any number of clients may be connected at once.
+     *
+     * @note This method is not intended to be called directly. It is called by
+     *       the ThreadedContinuousCode method. It blocks in WaitForTCPEvents()
+     *       until a connection is readable, the node is closed, or
+     *       ROVECOMM_EVENT_WAIT_TIMEOUT_MS elapses.
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::ReceiveTCPPacketAndCallback()
+    {
+        if (!WaitForTCPEvents())
+        {
+            return;
+        }
+
+        for (int nSocket : m_vReadySockets)
+        {
+            if (nSocket == m_nTCPSocket)
+            {
+                AcceptClients();
+                continue;
+            }
+
+            // Ignore a socket that is no longer a client.
+            std::map<int, TCPClient>::iterator itClient = m_mpClients.find(nSocket);
+            if (itClient == m_mpClients.end())
+            {
+                continue;
+            }
+
+            if (!ReceiveFromClient(itClient->second))
+            {
+                RemoveClient(nSocket);
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Create the epoll instance and the wakeup eventfd the receive thread
+     *        waits on, and register the listening socket and the eventfd. Client
+     *        sockets are registered as they are accepted.
+     *
+     * @return true - The event objects were created and registered.
+     * @return false - An error occurred while creating the event objects.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCP::InitReceiveEvents()
+    {
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        // Windows has no epoll/eventfd, WaitForTCPEvents() falls back to WSAPoll with a timeout.
+        return true;
+#else
+        // Create the epoll instance.
+        m_nEpollFD = epoll_create1(EPOLL_CLOEXEC);
+        if (m_nEpollFD == -1)
+        {
+            perror("Failed to create TCP epoll instance");
+            return false;
+        }
+
+        // Create the eventfd used to wake the receive thread on shutdown.
+        m_nWakeupFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_nWakeupFD == -1)
+        {
+            perror("Failed to create TCP wakeup eventfd");
+            CloseReceiveEvents();
+            return false;
+        }
+
+        // Register the listening socket and the wakeup eventfd.
+        struct epoll_event stEvent;
+        memset(&stEvent, 0, sizeof(stEvent));
+        stEvent.events  = EPOLLIN;
+        stEvent.data.fd = m_nTCPSocket;
+        if (epoll_ctl(m_nEpollFD, EPOLL_CTL_ADD, m_nTCPSocket, &stEvent) == -1)
+        {
+            perror("Failed to register TCP socket with epoll");
+            CloseReceiveEvents();
+            return false;
+        }
+
+        stEvent.data.fd = m_nWakeupFD;
+        if (epoll_ctl(m_nEpollFD, EPOLL_CTL_ADD, m_nWakeupFD, &stEvent) == -1)
+        {
+            perror("Failed to register TCP wakeup eventfd with epoll");
+            CloseReceiveEvents();
+            return false;
+        }
+
+        return true;
+#endif
+    }
+
+    /******************************************************************************
+     * @brief Block the receive thread until the listening socket or a client
+     *        connection is readable, the node is asked to stop, or
+     *        ROVECOMM_EVENT_WAIT_TIMEOUT_MS elapses, and collect the readable
+     *        sockets into m_vReadySockets.
+     *
+     * @return true - At least one socket is readable.
+     * @return false - The wait timed out or was interrupted by WakeReceiveThread().
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCP::WaitForTCPEvents()
+    {
+        m_vReadySockets.clear();
+
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        std::vector<WSAPOLLFD> vPollFDs;
+        vPollFDs.reserve(m_mpClients.size() + 1);
+        vPollFDs.push_back({m_nTCPSocket.load(), POLLRDNORM, 0});
+        for (const std::pair<const int, TCPClient>& stClient : m_mpClients)
+        {
+            vPollFDs.push_back({stClient.first, POLLRDNORM, 0});
+        }
+
+        if (WSAPoll(vPollFDs.data(), static_cast<ULONG>(vPollFDs.size()), rovecomm::ROVECOMM_EVENT_WAIT_TIMEOUT_MS) <= 0)
+        {
+            return false;
+        }
+        for (const WSAPOLLFD& stPollFD : vPollFDs)
+        {
+            if (stPollFD.revents != 0)
+            {
+                m_vReadySockets.push_back(static_cast<int>(stPollFD.fd));
+            }
+        }
+#else
+        struct epoll_event aEvents[ROVECOMM_TCP_EVENT_BATCH_SIZE];
+        int nReady = epoll_wait(m_nEpollFD, aEvents, ROVECOMM_TCP_EVENT_BATCH_SIZE, rovecomm::ROVECOMM_EVENT_WAIT_TIMEOUT_MS);
+
+        for (int nIter = 0; nIter < nReady; ++nIter)
+        {
+            if (aEvents[nIter].data.fd == m_nWakeupFD)
+            {
+                // Consume the wakeup so the next wait blocks again.
+                uint64_t unWakeups;
+                if (read(m_nWakeupFD, &unWakeups, sizeof(unWakeups)) == -1 && errno != EAGAIN)
                 {
-                    case manifest::DataTypes::UINT8_T: ProcessPacket<uint8_t>(stData, tcp::vUInt8Callbacks); break;
-                    case manifest::DataTypes::INT8_T: ProcessPacket<int8_t>(stData, tcp::vInt8Callbacks); break;
-                    case manifest::DataTypes::UINT16_T: ProcessPacket<uint16_t>(stData, tcp::vUInt16Callbacks); break;
-                    case manifest::DataTypes::INT16_T: ProcessPacket<int16_t>(stData, tcp::vInt16Callbacks); break;
-                    case manifest::DataTypes::UINT32_T: ProcessPacket<uint32_t>(stData, tcp::vUInt32Callbacks); break;
-                    case manifest::DataTypes::INT32_T: ProcessPacket<int32_t>(stData, tcp::vInt32Callbacks); break;
-                    case manifest::DataTypes::FLOAT_T: ProcessPacket<float>(stData, tcp::vFloatCallbacks); break;
-                    case manifest::DataTypes::DOUBLE_T: ProcessPacket<double>(stData, tcp::vDoubleCallbacks); break;
-                    case manifest::DataTypes::CHAR: ProcessPacket<char>(stData, tcp::vCharCallbacks); break;
+                    perror("Failed to read TCP wakeup eventfd");
                 }
+            }
+            else
+            {
+                m_vReadySockets.push_back(aEvents[nIter].data.fd);
+            }
+        }
+#endif
+
+        return !m_vReadySockets.empty();
+    }
+
+    /******************************************************************************
+     * @brief Accept every pending client connection and start watching it for
+     *        data. Connections beyond ROVECOMM_TCP_MAX_CLIENTS are closed at once.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::AcceptClients()
+    {
+        while (true)
+        {
+            struct sockaddr_in saClientAddr;
+            socklen_t sklClientAddrLen = sizeof(saClientAddr);
+            int nClientSocket          = accept(m_nTCPSocket, (struct sockaddr*) &saClientAddr, &sklClientAddrLen);
+            if (nClientSocket == -1)
+            {
+                break;
+            }
+            m_unConnectionsAccepted++;
+
+            if (m_mpClients.size() >= static_cast<size_t>(ROVECOMM_TCP_MAX_CLIENTS))
+            {
+                CLOSE_SOCKET(nClientSocket);
+                m_unConnectionsRejected++;
+                continue;
+            }
 
-                // Close the client socket
-                close(m_nCurrentTCPClientSocket);
-                m_nCurrentTCPClientSocket = -1;
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+            struct epoll_event stEvent;
+            memset(&stEvent, 0, sizeof(stEvent));
+            stEvent.events  = EPOLLIN | EPOLLRDHUP;
+            stEvent.data.fd = nClientSocket;
+            if (epoll_ctl(m_nEpollFD, EPOLL_CTL_ADD, nClientSocket, &stEvent) == -1)
+            {
+                perror("Failed to register TCP client with epoll");
+                CLOSE_SOCKET(nClientSocket);
+                m_unConnectionsRejected++;
+                continue;
             }
-            // Still waiting for data or connection return without error.
-            else if (siBytesReceived == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+#endif
+
+            m_mpClients.emplace(nClientSocket, TCPClient{nClientSocket, false, RoveCommTCPFramer(m_siMaxFrameSize)});
+            m_siOpenConnections++;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Forget a client connection, closing it unless it was handed to the
+     *        stream receiver.
+     *
+     * @param nSocket - The socket the client was accepted on.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::RemoveClient(int nSocket)
+    {
+        std::map<int, TCPClient>::iterator itClient = m_mpClients.find(nSocket);
+        if (itClient == m_mpClients.end())
+        {
+            return;
+        }
+
+        if (itClient->second.nSocket != -1)
+        {
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+            epoll_ctl(m_nEpollFD, EPOLL_CTL_DEL, nSocket, nullptr);
+#endif
+            CLOSE_SOCKET(nSocket);
+            m_unConnectionsClosed++;
+        }
+
+        m_mpClients.erase(itClient);
+        m_siOpenConnections--;
+    }
+
+    /******************************************************************************
+     * @brief Interrupt a receive thread that is sleeping in WaitForTCPEvents().
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::WakeReceiveThread()
+    {
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+        if (m_nWakeupFD != -1)
+        {
+            uint64_t unWakeup = 1;
+            if (write(m_nWakeupFD, &unWakeup, sizeof(unWakeup)) == -1)
             {
-                return;
+                perror("Failed to write TCP wakeup eventfd");
             }
         }
+#endif
+    }
+
+    /******************************************************************************
+     * @brief Close the epoll instance and wakeup eventfd the receive thread waits
+     *        on.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCP::CloseReceiveEvents()
+    {
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+        if (m_nWakeupFD != -1)
+        {
+            close(m_nWakeupFD);
+            m_nWakeupFD = -1;
+        }
+
+        if (m_nEpollFD != -1)
+        {
+            close(m_nEpollFD);
+            m_nEpollFD = -1;
+        }
+#endif
     }
 
     /******************************************************************************
@@ -511,22 +1640,35 @@ namespace rovecomm
     }
 
     /******************************************************************************
-     * @brief The pooled linear code for the TCP class. This method is not
-     *        implemented and will do nothing.
+     * @brief The pooled linear code for the TCP class. Each task is one dispatch
+     *        worker, which runs the callbacks for queued packets until the
+     *        dispatch queues are closed and drained. The first tasks serve the
+     *        dedicated priority lanes.
      *
      * @note This method is not intended to be called directly. It is called by
-     *       the Start method to start the pooled linear code.
+     *       RunDetachedPool() to start the dispatch workers.
      *
      * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    void RoveCommTCP::PooledLinearCode() {}
+    void RoveCommTCP::PooledLinearCode()
+    {
+        RoveCommDispatchQueue::Consumer fnDispatch = [this](const uint8_t* pData, size_t siDataSize, const sockaddr_in& saClientAddr)
+        {
+            (void) saClientAddr;
+            DispatchTCPPacket(pData, siDataSize);
+        };
+
+        m_pDispatcher->RunWorker(fnDispatch);
+    }
 
     /******************************************************************************
      * @brief Closes the TCP socket.
      *
      * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
     void RoveCommTCP::CloseTCPSocket()
     {
@@ -535,10 +1677,30 @@ namespace rovecomm
         {
             // Stop the threaded continuous code
             RequestStop();
+            WakeReceiveThread();
+
+            // Let the dispatch workers finish the queued packets and exit.
+            if (m_pDispatcher != nullptr)
+            {
+                m_pDispatcher->Close();
+            }
             Join();
 
+            // No more connections can be handed over, so the stream receiver can close its own.
+            m_stStreamReceiver.Disable();
+
+            // Close the client connections, and the connections this node opened to send.
+            while (!m_mpClients.empty())
+            {
+                RemoveClient(m_mpClients.begin()->first);
+            }
+            m_stConnectionPool.CloseAll();
+            m_stSendQueue.Disable();
+            CloseReceiveEvents();
+
             // Close the TCP socket
             CLOSE_SOCKET(m_nTCPSocket);
+            m_nTCPSocket = -1;
 
 #if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
             WSACleanup();
@@ -547,41 +1709,120 @@ namespace rovecomm
     }
 
     // Explicitly define template function types for TCP class
-    template ssize_t RoveCommTCP::SendTCPPacket<uint8_t>(const RoveCommPacket<uint8_t>&, const char*, int);
-    template void RoveCommTCP::AddTCPCallback<uint8_t>(std::function<void(const RoveCommPacket<uint8_t>&)>, const uint16_t&);
+    template ssize_t RoveCommTCP::SendTCPPacket<uint8_t>(const RoveCommPacket<uint8_t>&, const char*, int, RoveCommTCPSendMode);
+    template bool RoveCommTCP::SendTCPPacketAsync<uint8_t>(const RoveCommPacket<uint8_t>&, const char*, int, RoveCommSendCallback);
+    template std::future<ssize_t> RoveCommTCP::SendTCPPacketFuture<uint8_t>(const RoveCommPacket<uint8_t>&, const char*, int);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPCallback<uint8_t>(std::function<void(const RoveCommPacket<uint8_t>&)>, const uint16_t&);
     template void RoveCommTCP::RemoveTCPCallback<uint8_t>(std::function<void(const RoveCommPacket<uint8_t>&)>);
-    template void RoveCommTCP::ProcessPacket<uint8_t>(const RoveCommData& stData,
-                                                      const std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<uint8_t>&)>, uint16_t>>& vCallbacks);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPViewCallback<uint8_t>(std::function<void(const RoveCommPacketView<uint8_t>&)>, const uint16_t&);
+    template void RoveCommTCP::RemoveTCPViewCallback<uint8_t>(std::function<void(const RoveCommPacketView<uint8_t>&)>);
+    template void RoveCommTCP::ProcessPacket<uint8_t>(const uint8_t*, size_t);
+    template RoveCommLatestValue<uint8_t> RoveCommTCP::GetLatestValue<uint8_t>(const uint16_t&) const;
+    template bool RoveCommTCP::GetLatestValue<uint8_t>(const uint16_t&, RoveCommLatestValue<uint8_t>&) const;
+    template RoveCommHistoryWindow<uint8_t> RoveCommTCP::GetLastSamples<uint8_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<uint8_t> RoveCommTCP::GetSamplesSince<uint8_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
-    template ssize_t RoveCommTCP::SendTCPPacket<int8_t>(const RoveCommPacket<int8_t>&, const char*, int);
-    template void RoveCommTCP::AddTCPCallback<int8_t>(std::function<void(const RoveCommPacket<int8_t>&)>, const uint16_t&);
+    template ssize_t RoveCommTCP::SendTCPPacket<int8_t>(const RoveCommPacket<int8_t>&, const char*, int, RoveCommTCPSendMode);
+    template bool RoveCommTCP::SendTCPPacketAsync<int8_t>(const RoveCommPacket<int8_t>&, const char*, int, RoveCommSendCallback);
+    template std::future<ssize_t> RoveCommTCP::SendTCPPacketFuture<int8_t>(const RoveCommPacket<int8_t>&, const char*, int);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPCallback<int8_t>(std::function<void(const RoveCommPacket<int8_t>&)>, const uint16_t&);
     template void RoveCommTCP::RemoveTCPCallback<int8_t>(std::function<void(const RoveCommPacket<int8_t>&)>);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPViewCallback<int8_t>(std::function<void(const RoveCommPacketView<int8_t>&)>, const uint16_t&);
+    template void RoveCommTCP::RemoveTCPViewCallback<int8_t>(std::function<void(const RoveCommPacketView<int8_t>&)>);
+    template void RoveCommTCP::ProcessPacket<int8_t>(const uint8_t*, size_t);
+    template RoveCommLatestValue<int8_t> RoveCommTCP::GetLatestValue<int8_t>(const uint16_t&) const;
+    template bool RoveCommTCP::GetLatestValue<int8_t>(const uint16_t&, RoveCommLatestValue<int8_t>&) const;
+    template RoveCommHistoryWindow<int8_t> RoveCommTCP::GetLastSamples<int8_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<int8_t> RoveCommTCP::GetSamplesSince<int8_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
-    template ssize_t RoveCommTCP::SendTCPPacket<uint16_t>(const RoveCommPacket<uint16_t>&, const char*, int);
-    template void RoveCommTCP::AddTCPCallback<uint16_t>(std::function<void(const RoveCommPacket<uint16_t>&)>, const uint16_t&);
+    template ssize_t RoveCommTCP::SendTCPPacket<uint16_t>(const RoveCommPacket<uint16_t>&, const char*, int, RoveCommTCPSendMode);
+    template bool RoveCommTCP::SendTCPPacketAsync<uint16_t>(const RoveCommPacket<uint16_t>&, const char*, int, RoveCommSendCallback);
+    template std::future<ssize_t> RoveCommTCP::SendTCPPacketFuture<uint16_t>(const RoveCommPacket<uint16_t>&, const char*, int);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPCallback<uint16_t>(std::function<void(const RoveCommPacket<uint16_t>&)>, const uint16_t&);
     template void RoveCommTCP::RemoveTCPCallback<uint16_t>(std::function<void(const RoveCommPacket<uint16_t>&)>);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPViewCallback<uint16_t>(std::function<void(const RoveCommPacketView<uint16_t>&)>, const uint16_t&);
+    template void RoveCommTCP::RemoveTCPViewCallback<uint16_t>(std::function<void(const RoveCommPacketView<uint16_t>&)>);
+    template void RoveCommTCP::ProcessPacket<uint16_t>(const uint8_t*, size_t);
+    template RoveCommLatestValue<uint16_t> RoveCommTCP::GetLatestValue<uint16_t>(const uint16_t&) const;
+    template bool RoveCommTCP::GetLatestValue<uint16_t>(const uint16_t&, RoveCommLatestValue<uint16_t>&) const;
+    template RoveCommHistoryWindow<uint16_t> RoveCommTCP::GetLastSamples<uint16_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<uint16_t> RoveCommTCP::GetSamplesSince<uint16_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
-    template ssize_t RoveCommTCP::SendTCPPacket<int16_t>(const RoveCommPacket<int16_t>&, const char*, int);
-    template void RoveCommTCP::AddTCPCallback<int16_t>(std::function<void(const RoveCommPacket<int16_t>&)>, const uint16_t&);
+    template ssize_t RoveCommTCP::SendTCPPacket<int16_t>(const RoveCommPacket<int16_t>&, const char*, int, RoveCommTCPSendMode);
+    template bool RoveCommTCP::SendTCPPacketAsync<int16_t>(const RoveCommPacket<int16_t>&, const char*, int, RoveCommSendCallback);
+    template std::future<ssize_t> RoveCommTCP::SendTCPPacketFuture<int16_t>(const RoveCommPacket<int16_t>&, const char*, int);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPCallback<int16_t>(std::function<void(const RoveCommPacket<int16_t>&)>, const uint16_t&);
     template void RoveCommTCP::RemoveTCPCallback<int16_t>(std::function<void(const RoveCommPacket<int16_t>&)>);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPViewCallback<int16_t>(std::function<void(const RoveCommPacketView<int16_t>&)>, const uint16_t&);
+    template void RoveCommTCP::RemoveTCPViewCallback<int16_t>(std::function<void(const RoveCommPacketView<int16_t>&)>);
+    template void RoveCommTCP::ProcessPacket<int16_t>(const uint8_t*, size_t);
+    template RoveCommLatestValue<int16_t> RoveCommTCP::GetLatestValue<int16_t>(const uint16_t&) const;
+    template bool RoveCommTCP::GetLatestValue<int16_t>(const uint16_t&, RoveCommLatestValue<int16_t>&) const;
+    template RoveCommHistoryWindow<int16_t> RoveCommTCP::GetLastSamples<int16_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<int16_t> RoveCommTCP::GetSamplesSince<int16_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
-    template ssize_t RoveCommTCP::SendTCPPacket<uint32_t>(const RoveCommPacket<uint32_t>&, const char*, int);
-    template void RoveCommTCP::AddTCPCallback<uint32_t>(std::function<void(const RoveCommPacket<uint32_t>&)>, const uint16_t&);
+    template ssize_t RoveCommTCP::SendTCPPacket<uint32_t>(const RoveCommPacket<uint32_t>&, const char*, int, RoveCommTCPSendMode);
+    template bool RoveCommTCP::SendTCPPacketAsync<uint32_t>(const RoveCommPacket<uint32_t>&, const char*, int, RoveCommSendCallback);
+    template std::future<ssize_t> RoveCommTCP::SendTCPPacketFuture<uint32_t>(const RoveCommPacket<uint32_t>&, const char*, int);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPCallback<uint32_t>(std::function<void(const RoveCommPacket<uint32_t>&)>, const uint16_t&);
     template void RoveCommTCP::RemoveTCPCallback<uint32_t>(std::function<void(const RoveCommPacket<uint32_t>&)>);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPViewCallback<uint32_t>(std::function<void(const RoveCommPacketView<uint32_t>&)>, const uint16_t&);
+    template void RoveCommTCP::RemoveTCPViewCallback<uint32_t>(std::function<void(const RoveCommPacketView<uint32_t>&)>);
+    template void RoveCommTCP::ProcessPacket<uint32_t>(const uint8_t*, size_t);
+    template RoveCommLatestValue<uint32_t> RoveCommTCP::GetLatestValue<uint32_t>(const uint16_t&) const;
+    template bool RoveCommTCP::GetLatestValue<uint32_t>(const uint16_t&, RoveCommLatestValue<uint32_t>&) const;
+    template RoveCommHistoryWindow<uint32_t> RoveCommTCP::GetLastSamples<uint32_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<uint32_t> RoveCommTCP::GetSamplesSince<uint32_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
-    template ssize_t RoveCommTCP::SendTCPPacket<int32_t>(const RoveCommPacket<int32_t>&, const char*, int);
-    template void RoveCommTCP::AddTCPCallback<int32_t>(std::function<void(const RoveCommPacket<int32_t>&)>, const uint16_t&);
+    template ssize_t RoveCommTCP::SendTCPPacket<int32_t>(const RoveCommPacket<int32_t>&, const char*, int, RoveCommTCPSendMode);
+    template bool RoveCommTCP::SendTCPPacketAsync<int32_t>(const RoveCommPacket<int32_t>&, const char*, int, RoveCommSendCallback);
+    template std::future<ssize_t> RoveCommTCP::SendTCPPacketFuture<int32_t>(const RoveCommPacket<int32_t>&, const char*, int);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPCallback<int32_t>(std::function<void(const RoveCommPacket<int32_t>&)>, const uint16_t&);
     template void RoveCommTCP::RemoveTCPCallback<int32_t>(std::function<void(const RoveCommPacket<int32_t>&)>);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPViewCallback<int32_t>(std::function<void(const RoveCommPacketView<int32_t>&)>, const uint16_t&);
+    template void RoveCommTCP::RemoveTCPViewCallback<int32_t>(std::function<void(const RoveCommPacketView<int32_t>&)>);
+    template void RoveCommTCP::ProcessPacket<int32_t>(const uint8_t*, size_t);
+    template RoveCommLatestValue<int32_t> RoveCommTCP::GetLatestValue<int32_t>(const uint16_t&) const;
+    template bool RoveCommTCP::GetLatestValue<int32_t>(const uint16_t&, RoveCommLatestValue<int32_t>&) const;
+    template RoveCommHistoryWindow<int32_t> RoveCommTCP::GetLastSamples<int32_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<int32_t> RoveCommTCP::GetSamplesSince<int32_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
-    template ssize_t RoveCommTCP::SendTCPPacket<float>(const RoveCommPacket<float>&, const char*, int);
-    template void RoveCommTCP::AddTCPCallback<float>(std::function<void(const RoveCommPacket<float>&)>, const uint16_t&);
+    template ssize_t RoveCommTCP::SendTCPPacket<float>(const RoveCommPacket<float>&, const char*, int, RoveCommTCPSendMode);
+    template bool RoveCommTCP::SendTCPPacketAsync<float>(const RoveCommPacket<float>&, const char*, int, RoveCommSendCallback);
+    template std::future<ssize_t> RoveCommTCP::SendTCPPacketFuture<float>(const RoveCommPacket<float>&, const char*, int);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPCallback<float>(std::function<void(const RoveCommPacket<float>&)>, const uint16_t&);
     template void RoveCommTCP::RemoveTCPCallback<float>(std::function<void(const RoveCommPacket<float>&)>);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPViewCallback<float>(std::function<void(const RoveCommPacketView<float>&)>, const uint16_t&);
+    template void RoveCommTCP::RemoveTCPViewCallback<float>(std::function<void(const RoveCommPacketView<float>&)>);
+    template void RoveCommTCP::ProcessPacket<float>(const uint8_t*, size_t);
+    template RoveCommLatestValue<float> RoveCommTCP::GetLatestValue<float>(const uint16_t&) const;
+    template bool RoveCommTCP::GetLatestValue<float>(const uint16_t&, RoveCommLatestValue<float>&) const;
+    template RoveCommHistoryWindow<float> RoveCommTCP::GetLastSamples<float>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<float> RoveCommTCP::GetSamplesSince<float>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
-    template ssize_t RoveCommTCP::SendTCPPacket<double>(const RoveCommPacket<double>&, const char*, int);
-    template void RoveCommTCP::AddTCPCallback<double>(std::function<void(const RoveCommPacket<double>&)>, const uint16_t&);
+    template ssize_t RoveCommTCP::SendTCPPacket<double>(const RoveCommPacket<double>&, const char*, int, RoveCommTCPSendMode);
+    template bool RoveCommTCP::SendTCPPacketAsync<double>(const RoveCommPacket<double>&, const char*, int, RoveCommSendCallback);
+    template std::future<ssize_t> RoveCommTCP::SendTCPPacketFuture<double>(const RoveCommPacket<double>&, const char*, int);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPCallback<double>(std::function<void(const RoveCommPacket<double>&)>, const uint16_t&);
     template void RoveCommTCP::RemoveTCPCallback<double>(std::function<void(const RoveCommPacket<double>&)>);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPViewCallback<double>(std::function<void(const RoveCommPacketView<double>&)>, const uint16_t&);
+    template void RoveCommTCP::RemoveTCPViewCallback<double>(std::function<void(const RoveCommPacketView<double>&)>);
+    template void RoveCommTCP::ProcessPacket<double>(const uint8_t*, size_t);
+    template RoveCommLatestValue<double> RoveCommTCP::GetLatestValue<double>(const uint16_t&) const;
+    template bool RoveCommTCP::GetLatestValue<double>(const uint16_t&, RoveCommLatestValue<double>&) const;
+    template RoveCommHistoryWindow<double> RoveCommTCP::GetLastSamples<double>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<double> RoveCommTCP::GetSamplesSince<double>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
-    template ssize_t RoveCommTCP::SendTCPPacket<char>(const RoveCommPacket<char>&, const char*, int);
-    template void RoveCommTCP::AddTCPCallback<char>(std::function<void(const RoveCommPacket<char>&)>, const uint16_t&);
+    template ssize_t RoveCommTCP::SendTCPPacket<char>(const RoveCommPacket<char>&, const char*, int, RoveCommTCPSendMode);
+    template bool RoveCommTCP::SendTCPPacketAsync<char>(const RoveCommPacket<char>&, const char*, int, RoveCommSendCallback);
+    template std::future<ssize_t> RoveCommTCP::SendTCPPacketFuture<char>(const RoveCommPacket<char>&, const char*, int);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPCallback<char>(std::function<void(const RoveCommPacket<char>&)>, const uint16_t&);
     template void RoveCommTCP::RemoveTCPCallback<char>(std::function<void(const RoveCommPacket<char>&)>);
+    template RoveCommCallbackHandle RoveCommTCP::AddTCPViewCallback<char>(std::function<void(const RoveCommPacketView<char>&)>, const uint16_t&);
+    template void RoveCommTCP::RemoveTCPViewCallback<char>(std::function<void(const RoveCommPacketView<char>&)>);
+    template void RoveCommTCP::ProcessPacket<char>(const uint8_t*, size_t);
+    template RoveCommLatestValue<char> RoveCommTCP::GetLatestValue<char>(const uint16_t&) const;
+    template bool RoveCommTCP::GetLatestValue<char>(const uint16_t&, RoveCommLatestValue<char>&) const;
+    template RoveCommHistoryWindow<char> RoveCommTCP::GetLastSamples<char>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<char> RoveCommTCP::GetSamplesSince<char>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 }    // namespace rovecomm
@@ -14,18 +14,32 @@
 #define ROVECOMM_TCP_H
 
 #include "ExternalIncludes.h"
+#include "RoveCommBufferPool.h"
+#include "RoveCommCallbackRegistry.h"
 #include "RoveCommConsts.h"
 #include "RoveCommGlobals.h"
+#include "RoveCommHistory.h"
+#include "RoveCommLatestValueCache.h"
 #include "RoveCommManifest.h"
 #include "RoveCommPacket.h"
+#include "RoveCommPriorityDispatcher.h"
+#include "RoveCommTCPConnectionPool.h"
+#include "RoveCommTCPFramer.h"
+#include "RoveCommTCPSendQueue.h"
+#include "RoveCommTCPStream.h"
 
 /// \cond
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <csignal>
 #include <cstring>
 #include <functional>
+#include <future>
 #include <iostream>
-#include <shared_mutex>
+#include <limits>
+#include <map>
+#include <memory>
 #include <unistd.h>
 #include <vector>
 
@@ -41,6 +55,20 @@
  ******************************************************************************/
 namespace rovecomm
 {
+    // Define a struct for reporting a snapshot of a TCP node's client connection counters.
+    struct RoveCommTCPServerStatistics
+    {
+        public:
+            uint64_t unConnectionsAccepted;    // Client connections accepted, including stream connections.
+            uint64_t unConnectionsRejected;    // Client connections closed at once because ROVECOMM_TCP_MAX_CLIENTS were open.
+            uint64_t unConnectionsClosed;      // Client connections closed by either end, or for sending a rejected packet header.
+            uint64_t unPacketsReceived;        // Complete packets read from client connections.
+            uint64_t unBytesReceived;          // Bytes read from client connections.
+            uint64_t unOversizedFrames;        // Packet headers rejected for announcing more than the maximum frame size.
+            uint64_t unMalformedFrames;        // Packet headers rejected for a wrong version or an unknown data type.
+            size_t siOpenConnections;          // Client connections currently open, not counting stream connections.
+    };
+
     /******************************************************************************
      * @brief The RoveCommTCP class is used to send and receive data over a TCP
      *        connection.
@@ -50,19 +78,83 @@ namespace rovecomm
      ******************************************************************************/
     class RoveCommTCP : AutonomyThread<void>
     {
+        public:
+            // Define the callback types for each data type.
+            template<typename T>
+            using TCPCallback = std::function<void(const RoveCommPacket<T>&)>;
+            template<typename T>
+            using TCPViewCallback = std::function<void(const RoveCommPacketView<T>&)>;
+
         private:
+            // An accepted connection, and the framer holding the start of a packet that has only partly arrived on it.
+            struct TCPClient
+            {
+                public:
+                    int nSocket;
+                    bool bIdentified;
+                    RoveCommTCPFramer stFramer;
+            };
+
             // Private member variables
             std::atomic_int m_nTCPSocket;
             struct sockaddr_in m_saTCPServerAddr;
-            std::atomic_int m_nCurrentTCPClientSocket;
-            struct sockaddr_in m_saClientAddr;
-            std::shared_mutex m_muCallbackMutex;
+            int m_nEpollFD;
+            int m_nWakeupFD;
+            std::vector<int> m_vReadySockets;
+            RoveCommBufferPool m_stSendBufferPool;
+
+            // Open client connections, keyed by socket. Only the receive thread touches them.
+            std::map<int, TCPClient> m_mpClients;
+            std::atomic<uint64_t> m_unConnectionsAccepted;
+            std::atomic<uint64_t> m_unConnectionsRejected;
+            std::atomic<uint64_t> m_unConnectionsClosed;
+            std::atomic<uint64_t> m_unPacketsReceived;
+            std::atomic<uint64_t> m_unBytesReceived;
+            std::atomic<size_t> m_siOpenConnections;
+            std::atomic<uint64_t> m_unOversizedFrames;
+            std::atomic<uint64_t> m_unMalformedFrames;
+            std::atomic<size_t> m_siMaxFrameSize;
+
+            // Connections kept open for SendTCPPacket(), one per destination.
+            RoveCommTCPConnectionPool m_stConnectionPool;
+            std::atomic<bool> m_bConnectionPooling;
+            std::unique_ptr<std::atomic<bool>[]> m_pNoDelayDataIds;
+
+            // Write buffers and connections for SendTCPPacketAsync(), flushed by their own thread.
+            RoveCommTCPSendQueue m_stSendQueue;
+
+            RoveCommCallbackTable<TCPCallback> m_stCallbacks;
+            RoveCommCallbackTable<TCPViewCallback> m_stViewCallbacks;
+
+            // Asynchronous callback dispatch. Disabled while m_unDispatchThreads is 0.
+            unsigned int m_unDispatchThreads;
+            RoveCommPriorityTable m_stPriorities;
+            std::array<bool, ePriorityCount> m_aDedicatedDispatchLanes;
+            std::unique_ptr<RoveCommPriorityDispatcher> m_pDispatcher;
+
+            // Latest packet of every data id, and the history of selected ones, for polling.
+            RoveCommLatestValueCache m_stLatestValues;
+            RoveCommHistoryStore m_stHistory;
+
+            // Connections that start with ROVECOMM_STREAM_VERSION are handed to the stream receiver.
+            RoveCommTCPStreamReceiver m_stStreamReceiver;
 
             // Packet processing functions
             template<typename T>
-            void ProcessPacket(const RoveCommData& stData, const std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<T>&)>, uint16_t>>& vCallbacks);
+            void ProcessPacket(const uint8_t* pData, size_t siDataSize);
+            void DispatchTCPPacket(const uint8_t* pData, size_t siDataSize);
+            void HandleTCPPacket(const uint8_t* pData, size_t siDataSize);
+            bool ReceiveFromClient(TCPClient& stClient);
             void ReceiveTCPPacketAndCallback();
 
+            // Connection management functions
+            bool InitReceiveEvents();
+            bool WaitForTCPEvents();
+            void AcceptClients();
+            void RemoveClient(int nSocket);
+            void WakeReceiveThread();
+            void CloseReceiveEvents();
+
             // AutonomyThread member functions
             void ThreadedContinuousCode() override;
             void PooledLinearCode() override;
@@ -74,31 +166,100 @@ namespace rovecomm
             ~RoveCommTCP();
 
             // Initialization
+            // The dispatch can only be changed while the socket is closed, it is refused once InitTCPSocket() succeeded.
+            bool SetCallbackDispatch(unsigned int unWorkerThreads,
+                                     size_t siQueueCapacity         = ROVECOMM_DISPATCH_QUEUE_CAPACITY,
+                                     RoveCommOverflowPolicy ePolicy = eOverflowDropOldest);
+            unsigned int GetCallbackDispatchThreads() const;
+            void SetDedicatedDispatchThread(RoveCommPriority ePriority, bool bDedicated = true);
+            void SetDataIdPriority(uint16_t unDataId, RoveCommPriority ePriority);
+            void SetDataIdPriority(const std::map<std::string, manifest::ManifestEntry>& mpEntries, RoveCommPriority ePriority);
+            void SetManifestPriorities(const std::map<std::string, manifest::ManifestEntry>& mpCommands,
+                                       const std::map<std::string, manifest::ManifestEntry>& mpTelemetry,
+                                       const std::map<std::string, manifest::ManifestEntry>& mpErrors);
+            RoveCommPriority GetDataIdPriority(uint16_t unDataId) const;
             bool InitTCPSocket(const char* cIPAddress, int nPort);
 
             // Data transmission
             template<typename T>
-            ssize_t SendTCPPacket(const RoveCommPacket<T>& stData, const char* cClientIPAddress, int nClientPort);
+            ssize_t SendTCPPacket(const RoveCommPacket<T>& stData, const char* cClientIPAddress, int nClientPort, RoveCommTCPSendMode eMode = eSendDefault);
+            template<typename T>
+            bool SendTCPPacketAsync(const RoveCommPacket<T>& stData, const char* cClientIPAddress, int nClientPort, RoveCommSendCallback fnCallback = nullptr);
+            template<typename T>
+            std::future<ssize_t> SendTCPPacketFuture(const RoveCommPacket<T>& stData, const char* cClientIPAddress, int nClientPort);
+            bool FlushTCP(const char* cClientIPAddress, int nClientPort);
+            void FlushTCP();
+            void SetTCPConnectionPooling(bool bPooled);
+            void SetTCPNoDelay(bool bNoDelay);
+            void SetTCPNoDelay(uint16_t unDataId, bool bNoDelay);
+            void SetTCPNoDelay(const std::map<std::string, manifest::ManifestEntry>& mpEntries, bool bNoDelay);
+            bool GetTCPNoDelay(uint16_t unDataId) const;
+            void SetTCPSendQueueLimits(size_t siHighWaterMark,
+                                       RoveCommBackpressurePolicy ePolicy      = eBackpressureReject,
+                                       std::chrono::milliseconds tmSendTimeout = std::chrono::milliseconds(ROVECOMM_TCP_SEND_TIMEOUT_MS));
+            void SetTCPReconnectBackoff(std::chrono::milliseconds tmMinBackoff, std::chrono::milliseconds tmMaxBackoff);
+            void SetTCPMaxFrameSize(size_t siMaxFrameSize);
 
             // Callback management
             template<typename T>
-            void AddTCPCallback(std::function<void(const RoveCommPacket<T>&)> fnCallback, const uint16_t& unCondition);
+            RoveCommCallbackHandle AddTCPCallback(std::function<void(const RoveCommPacket<T>&)> fnCallback, const uint16_t& unCondition);
 
             template<typename T>
             void RemoveTCPCallback(std::function<void(const RoveCommPacket<T>&)> fnCallback);
 
+            template<typename T>
+            RoveCommCallbackHandle AddTCPViewCallback(std::function<void(const RoveCommPacketView<T>&)> fnCallback, const uint16_t& unCondition);
+
+            template<typename T>
+            void RemoveTCPViewCallback(std::function<void(const RoveCommPacketView<T>&)> fnCallback);
+
+            // Latest value functions
+            template<typename T>
+            RoveCommLatestValue<T> GetLatestValue(const uint16_t& unDataId) const;
+
+            template<typename T>
+            bool GetLatestValue(const uint16_t& unDataId, RoveCommLatestValue<T>& stValue) const;
+
+            uint64_t GetLatestSequence(const uint16_t& unDataId) const;
+
+            // History functions
+            bool EnableHistory(const uint16_t& unDataId, manifest::DataTypes eDataType, uint16_t unDataCount, size_t siCapacity = ROVECOMM_HISTORY_DEFAULT_CAPACITY);
+            bool EnableHistory(const manifest::ManifestEntry& stEntry, size_t siCapacity = ROVECOMM_HISTORY_DEFAULT_CAPACITY);
+            bool EnableHistory(const std::map<std::string, manifest::ManifestEntry>& mpEntries, size_t siCapacity = ROVECOMM_HISTORY_DEFAULT_CAPACITY);
+            size_t GetHistoryMemoryUsage() const;
+
+            template<typename T>
+            RoveCommHistoryWindow<T> GetLastSamples(const uint16_t& unDataId, size_t siCount) const;
+
+            template<typename T>
+            RoveCommHistoryWindow<T> GetSamplesSince(const uint16_t& unDataId, std::chrono::steady_clock::time_point tmSince) const;
+
+            // Stream functions
+            bool SetTCPStreamBuffer(uint16_t unDataId, uint8_t* pBuffer, size_t siCapacity, RoveCommStreamCallback fnCallback = nullptr);
+            bool SetTCPStreamFile(uint16_t unDataId, const std::string& szPath, RoveCommStreamCallback fnCallback = nullptr);
+            void RemoveTCPStreamSink(uint16_t unDataId);
+            void SetTCPStreamTimeouts(std::chrono::milliseconds tmStallTimeout,
+                                      std::chrono::milliseconds tmIdleTimeout = std::chrono::milliseconds(ROVECOMM_STREAM_IDLE_TIMEOUT_MS));
+
             // Deinitialization
             void CloseTCPSocket();
 
+            // Statistics
+            RoveCommDispatchStatistics GetDispatchStatistics() const;
+            RoveCommDispatchStatistics GetDispatchStatistics(RoveCommPriority ePriority) const;
+            RoveCommStreamStatistics GetTCPStreamStatistics() const;
+            RoveCommConnectionPoolStatistics GetTCPConnectionPoolStatistics() const;
+            RoveCommSendQueueStatistics GetTCPSendQueueStatistics() const;
+            RoveCommTCPServerStatistics GetTCPServerStatistics() const;
+
             // Selectively make inherited method public so we can get RoveCommNode FPS.
             using AutonomyThread::GetIPS;
 
             // NOTE: These functions are for testing purposes only and should not be used in production code!
             template<typename T>
-            void CallProcessPacket(const RoveCommData& stData,
-                                   const std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<T>&)>, uint16_t>>& vCallbacks)
+            void CallProcessPacket(const RoveCommData& stData)
             {
-                ProcessPacket(stData, vCallbacks);
+                ProcessPacket<T>(stData.unBytes, sizeof(stData.unBytes));
             }
     };
 }    // namespace rovecomm
@@ -0,0 +1,558 @@
+/******************************************************************************
+ * @brief RoveComm TCP Connection Pool Implementation.
+ *
+ * @file RoveCommTCPConnectionPool.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommTCPConnectionPool.h"
+
+/// \cond
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+/// \endcond
+
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+#define CLOSE_SOCKET    closesocket
+#define POOL_SEND_FLAGS 0
+#else
+#include <netinet/tcp.h>
+#include <sys/time.h>
+#define CLOSE_SOCKET    close
+#define POOL_SEND_FLAGS MSG_NOSIGNAL
+#endif
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Construct a new, empty connection pool.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommTCPConnectionPool::RoveCommTCPConnectionPool()
+    {
+        m_tmMinBackoff = std::chrono::milliseconds(ROVECOMM_TCP_RECONNECT_MIN_MS);
+        m_tmMaxBackoff = std::chrono::milliseconds(ROVECOMM_TCP_RECONNECT_MAX_MS);
+        m_bNoDelay     = false;
+
+        // Initialize the statistics.
+        m_unConnects         = 0;
+        m_unReuses           = 0;
+        m_unStaleConnections = 0;
+        m_unConnectFailures  = 0;
+        m_unBackoffRejects   = 0;
+        m_unSendFailures     = 0;
+        m_unBatchedSends     = 0;
+        m_unFlushes          = 0;
+        m_siOpenConnections  = 0;
+    }
+
+    /******************************************************************************
+     * @brief Destroy the connection pool, closing every connection.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommTCPConnectionPool::~RoveCommTCPConnectionPool()
+    {
+        CloseAll();
+    }
+
+    /******************************************************************************
+     * @brief Set how long sends to an unreachable destination are refused before
+     *        the next connection attempt.
+     *
+     * @param tmMinBackoff - The delay after the first failed attempt.
+     * @param tmMaxBackoff - The longest delay, reached by doubling.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPConnectionPool::SetBackoff(std::chrono::milliseconds tmMinBackoff, std::chrono::milliseconds tmMaxBackoff)
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        m_tmMinBackoff = tmMinBackoff;
+        m_tmMaxBackoff = std::max(tmMinBackoff, tmMaxBackoff);
+    }
+
+    /******************************************************************************
+     * @brief Choose whether Nagle's algorithm is disabled on every connection for
+     *        eSendDefault sends. Open connections change on their next send.
+     *
+     * @param bNoDelay - Whether to push every packet at once.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPConnectionPool::SetNoDelay(bool bNoDelay)
+    {
+        m_bNoDelay = bNoDelay;
+    }
+
+    /******************************************************************************
+     * @brief Send bytes to a destination over its pooled connection, opening the
+     *        connection if there is none yet.
+     *
+     * @param cIPAddress - The IP address of the destination.
+     * @param nPort - The port of the destination.
+     * @param pData - The bytes to send.
+     * @param siDataSize - The number of bytes to send.
+     * @param eMode - When the bytes are pushed onto the wire.
+     * @return ssize_t - The number of bytes sent, or -1 if the address is invalid,
+     *                   the destination is backing off, or the send failed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    ssize_t RoveCommTCPConnectionPool::Send(const char* cIPAddress, int nPort, const uint8_t* pData, size_t siDataSize, RoveCommTCPSendMode eMode)
+    {
+        // Convert IP address to binary form
+        struct sockaddr_in saAddress;
+        memset(&saAddress, 0, sizeof(saAddress));
+        saAddress.sin_family = AF_INET;
+        saAddress.sin_port   = htons(nPort);
+        if (inet_pton(AF_INET, cIPAddress, &saAddress.sin_addr) <= 0)
+        {
+            perror("Invalid address/ Address not supported");
+            return -1;
+        }
+
+        // Find the destination, adding it on the first send.
+        Destination* pDestination = FindDestination(saAddress, true);
+        std::lock_guard<std::mutex> lkDestinationLock(pDestination->muDestinationMutex);
+
+        // A peer that closed the connection while it was idle is noticed here, before a packet is lost to it.
+        if (pDestination->nSocket != -1 && IsClosedByPeer(pDestination->nSocket))
+        {
+            Disconnect(*pDestination);
+            m_unStaleConnections.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        bool bReused = pDestination->nSocket != -1;
+        if (bReused)
+        {
+            m_unReuses.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (!Connect(*pDestination, saAddress))
+        {
+            return -1;
+        }
+
+        ApplySendMode(*pDestination, eMode);
+        ssize_t siBytesSent = SendAll(pDestination->nSocket, pData, siDataSize);
+
+        // A reused connection may have broken without the peer saying so. Retry once on a new one.
+        if (siBytesSent == -1 && bReused)
+        {
+            Disconnect(*pDestination);
+            m_unStaleConnections.fetch_add(1, std::memory_order_relaxed);
+            if (!Connect(*pDestination, saAddress))
+            {
+                return -1;
+            }
+            ApplySendMode(*pDestination, eMode);
+            siBytesSent = SendAll(pDestination->nSocket, pData, siDataSize);
+        }
+
+        if (siBytesSent == -1)
+        {
+            perror("Failed to send data to TCP client socket");
+            Disconnect(*pDestination);
+            m_unSendFailures.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return siBytesSent;
+    }
+
+    /******************************************************************************
+     * @brief Push everything sent to a destination onto the wire now, ending the
+     *        batch of a corked connection.
+     *
+     * @param cIPAddress - The IP address of the destination.
+     * @param nPort - The port of the destination.
+     * @return true - The destination's connection was flushed.
+     * @return false - The destination has no open connection.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPConnectionPool::Flush(const char* cIPAddress, int nPort)
+    {
+        struct sockaddr_in saAddress;
+        memset(&saAddress, 0, sizeof(saAddress));
+        saAddress.sin_family = AF_INET;
+        saAddress.sin_port   = htons(nPort);
+        if (inet_pton(AF_INET, cIPAddress, &saAddress.sin_addr) <= 0)
+        {
+            perror("Invalid address/ Address not supported");
+            return false;
+        }
+
+        Destination* pDestination = FindDestination(saAddress, false);
+        if (pDestination == nullptr)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lkDestinationLock(pDestination->muDestinationMutex);
+        if (pDestination->nSocket == -1)
+        {
+            return false;
+        }
+        PushPending(*pDestination);
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Push everything sent over every pooled connection onto the wire now.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPConnectionPool::FlushAll()
+    {
+        for (Destination* pDestination : GetDestinations())
+        {
+            std::lock_guard<std::mutex> lkDestinationLock(pDestination->muDestinationMutex);
+            if (pDestination->nSocket != -1)
+            {
+                PushPending(*pDestination);
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Close every pooled connection. Later sends open new ones.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPConnectionPool::CloseAll()
+    {
+        for (Destination* pDestination : GetDestinations())
+        {
+            std::lock_guard<std::mutex> lkDestinationLock(pDestination->muDestinationMutex);
+            Disconnect(*pDestination);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the pool's counters.
+     *
+     * @return RoveCommConnectionPoolStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommConnectionPoolStatistics RoveCommTCPConnectionPool::GetStatistics() const
+    {
+        RoveCommConnectionPoolStatistics stStatistics;
+        stStatistics.unConnects         = m_unConnects.load(std::memory_order_relaxed);
+        stStatistics.unReuses           = m_unReuses.load(std::memory_order_relaxed);
+        stStatistics.unStaleConnections = m_unStaleConnections.load(std::memory_order_relaxed);
+        stStatistics.unConnectFailures  = m_unConnectFailures.load(std::memory_order_relaxed);
+        stStatistics.unBackoffRejects   = m_unBackoffRejects.load(std::memory_order_relaxed);
+        stStatistics.unSendFailures     = m_unSendFailures.load(std::memory_order_relaxed);
+        stStatistics.unBatchedSends     = m_unBatchedSends.load(std::memory_order_relaxed);
+        stStatistics.unFlushes          = m_unFlushes.load(std::memory_order_relaxed);
+        stStatistics.siOpenConnections  = m_siOpenConnections.load(std::memory_order_relaxed);
+
+        return stStatistics;
+    }
+
+    /******************************************************************************
+     * @brief Open a connection to a destination, unless it is still backing off
+     *        from an earlier failure. Must be called with the destination's mutex
+     *        held.
+     *
+     * @param stDestination - The destination to connect.
+     * @param saAddress - Its address.
+     * @return true - The destination has an open connection.
+     * @return false - The destination is backing off or the connection failed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPConnectionPool::Connect(Destination& stDestination, const sockaddr_in& saAddress)
+    {
+        std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+        if (tmNow < stDestination.tmRetryAfter)
+        {
+            m_unBackoffRejects.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        // Create a TCP socket and connect to the destination.
+        int nSocket = socket(AF_INET, SOCK_STREAM, 0);
+        if (nSocket == -1)
+        {
+            perror("Failed to create TCP client socket");
+            return false;
+        }
+
+        if (connect(nSocket, (const struct sockaddr*) &saAddress, sizeof(saAddress)) == -1)
+        {
+            perror("Connection failed");
+            CLOSE_SOCKET(nSocket);
+
+            // Wait twice as long after every failure in a row, up to the maximum.
+            std::chrono::milliseconds tmMinBackoff;
+            std::chrono::milliseconds tmMaxBackoff;
+            {
+                std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+                tmMinBackoff = m_tmMinBackoff;
+                tmMaxBackoff = m_tmMaxBackoff;
+            }
+            std::chrono::milliseconds tmBackoff = tmMinBackoff * (1LL << std::min(stDestination.unFailures, 16u));
+            stDestination.unFailures++;
+            stDestination.tmRetryAfter = tmNow + std::min(tmBackoff, tmMaxBackoff);
+            m_unConnectFailures.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        stDestination.nSocket      = nSocket;
+        stDestination.bNoDelay     = false;
+        stDestination.bCorked      = false;
+        stDestination.unFailures   = 0;
+        stDestination.tmRetryAfter = std::chrono::steady_clock::time_point();
+        m_unConnects.fetch_add(1, std::memory_order_relaxed);
+        m_siOpenConnections.fetch_add(1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Close a destination's connection, if it has one. Must be called with
+     *        the destination's mutex held.
+     *
+     * @param stDestination - The destination to disconnect.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPConnectionPool::Disconnect(Destination& stDestination)
+    {
+        if (stDestination.nSocket != -1)
+        {
+            CLOSE_SOCKET(stDestination.nSocket);
+            stDestination.nSocket = -1;
+            m_siOpenConnections.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Set a destination's connection up for a send: uncork it for a send
+     *        that is not batched, which pushes the batch before it, set its Nagle
+     *        option, and cork it for a batched send. The options are only changed
+     *        when they differ from the connection's. Must be called with the
+     *        destination's mutex held.
+     *
+     * @param stDestination - The destination, with an open connection.
+     * @param eMode - The send mode of the next send.
+     *
+     * @note Where TCP_CORK is not available, eSendBatched sends like eSendDefault.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPConnectionPool::ApplySendMode(Destination& stDestination, RoveCommTCPSendMode eMode)
+    {
+        int nOption = 0;
+#ifdef TCP_CORK
+        if (stDestination.bCorked && eMode != eSendBatched)
+        {
+            setsockopt(stDestination.nSocket, IPPROTO_TCP, TCP_CORK, &nOption, sizeof(nOption));
+            stDestination.bCorked = false;
+            m_unFlushes.fetch_add(1, std::memory_order_relaxed);
+        }
+#endif
+
+        // A corked connection holds partial segments whatever its Nagle option, so a batch leaves it as it is.
+        bool bNoDelay = eMode == eSendNoDelay || (eMode == eSendDefault && m_bNoDelay);
+        if (eMode != eSendBatched && bNoDelay != stDestination.bNoDelay)
+        {
+            nOption = bNoDelay ? 1 : 0;
+            setsockopt(stDestination.nSocket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&nOption), sizeof(nOption));
+            stDestination.bNoDelay = bNoDelay;
+        }
+
+        if (eMode == eSendBatched)
+        {
+#ifdef TCP_CORK
+            if (!stDestination.bCorked)
+            {
+                nOption = 1;
+                setsockopt(stDestination.nSocket, IPPROTO_TCP, TCP_CORK, &nOption, sizeof(nOption));
+                stDestination.bCorked = true;
+            }
+#endif
+            m_unBatchedSends.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Push the bytes a connection is holding, whether corked or delayed by
+     *        Nagle's algorithm. Must be called with the destination's mutex held.
+     *
+     * @param stDestination - The destination, with an open connection.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPConnectionPool::PushPending(Destination& stDestination)
+    {
+        int nOption = 0;
+#ifdef TCP_CORK
+        if (stDestination.bCorked)
+        {
+            setsockopt(stDestination.nSocket, IPPROTO_TCP, TCP_CORK, &nOption, sizeof(nOption));
+            stDestination.bCorked = false;
+        }
+#endif
+
+        // Turning Nagle's algorithm off sends what it is holding, so it is turned off and back on.
+        if (!stDestination.bNoDelay)
+        {
+            nOption = 1;
+            setsockopt(stDestination.nSocket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&nOption), sizeof(nOption));
+            nOption = 0;
+            setsockopt(stDestination.nSocket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&nOption), sizeof(nOption));
+        }
+        m_unFlushes.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /******************************************************************************
+     * @brief Find the pooled entry of a destination.
+     *
+     * @param saAddress - The address of the destination.
+     * @param bCreate - Whether to add an entry if there is none.
+     * @return Destination* - The entry, or nullptr if there is none and bCreate is
+     *                        false. Entries live as long as the pool.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommTCPConnectionPool::Destination* RoveCommTCPConnectionPool::FindDestination(const sockaddr_in& saAddress, bool bCreate)
+    {
+        uint64_t unKey = (static_cast<uint64_t>(ntohl(saAddress.sin_addr.s_addr)) << 16) | ntohs(saAddress.sin_port);
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        std::map<uint64_t, std::unique_ptr<Destination>>::iterator itEntry = m_mpDestinations.find(unKey);
+        if (itEntry != m_mpDestinations.end())
+        {
+            return itEntry->second.get();
+        }
+        if (!bCreate)
+        {
+            return nullptr;
+        }
+
+        std::unique_ptr<Destination>& pEntry = m_mpDestinations[unKey];
+        pEntry                               = std::make_unique<Destination>();
+        pEntry->nSocket                      = -1;
+        pEntry->bNoDelay                     = false;
+        pEntry->bCorked                      = false;
+        pEntry->unFailures                   = 0;
+        pEntry->tmRetryAfter                 = std::chrono::steady_clock::time_point();
+
+        return pEntry.get();
+    }
+
+    /******************************************************************************
+     * @brief Get every pooled destination. The pool mutex is released before the
+     *        caller locks any of them, since Send() holds a destination's mutex
+     *        while it takes the pool mutex.
+     *
+     * @return std::vector<Destination*> - The destinations. Entries live as long
+     *                                     as the pool.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    std::vector<RoveCommTCPConnectionPool::Destination*> RoveCommTCPConnectionPool::GetDestinations() const
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        std::vector<Destination*> vDestinations;
+        vDestinations.reserve(m_mpDestinations.size());
+        for (const std::pair<const uint64_t, std::unique_ptr<Destination>>& stEntry : m_mpDestinations)
+        {
+            vDestinations.push_back(stEntry.second.get());
+        }
+
+        return vDestinations;
+    }
+
+    /******************************************************************************
+     * @brief Check, without blocking, whether the peer has closed or reset a
+     *        connection. Receivers never send on a packet connection, so anything
+     *        but "no data yet" means the connection is gone.
+     *
+     * @param nSocket - The connection to check.
+     * @return true - The peer closed or reset the connection.
+     * @return false - The connection is still open.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPConnectionPool::IsClosedByPeer(int nSocket) const
+    {
+        char cByte;
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        u_long unMode = 1;
+        ioctlsocket(nSocket, FIONBIO, &unMode);
+        int nBytesReceived = recv(nSocket, &cByte, 1, MSG_PEEK);
+        unMode             = 0;
+        ioctlsocket(nSocket, FIONBIO, &unMode);
+        return nBytesReceived == 0 || (nBytesReceived == -1 && WSAGetLastError() != WSAEWOULDBLOCK);
+#else
+        ssize_t siBytesReceived = recv(nSocket, &cByte, 1, MSG_PEEK | MSG_DONTWAIT);
+        return siBytesReceived == 0 || (siBytesReceived == -1 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+#endif
+    }
+
+    /******************************************************************************
+     * @brief Send every byte on a connection, continuing after partial sends.
+     *
+     * @param nSocket - The connection to send on.
+     * @param pData - The bytes to send.
+     * @param siDataSize - The number of bytes to send.
+     * @return ssize_t - The number of bytes sent, or -1 if the connection failed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    ssize_t RoveCommTCPConnectionPool::SendAll(int nSocket, const uint8_t* pData, size_t siDataSize)
+    {
+        size_t siBytesSent = 0;
+        while (siBytesSent < siDataSize)
+        {
+            ssize_t siSent = send(nSocket, reinterpret_cast<const char*>(pData + siBytesSent), siDataSize - siBytesSent, POOL_SEND_FLAGS);
+            if (siSent == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return -1;
+            }
+            siBytesSent += static_cast<size_t>(siSent);
+        }
+
+        return static_cast<ssize_t>(siBytesSent);
+    }
+}    // namespace rovecomm
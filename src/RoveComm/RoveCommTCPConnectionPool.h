@@ -0,0 +1,154 @@
+/******************************************************************************
+ * @brief The RoveCommTCPConnectionPool class keeps one TCP connection open per
+ *        destination, so that packets sent with SendTCPPacket() do not each pay
+ *        for a handshake and leave a socket in TIME_WAIT.
+ *
+ * @file RoveCommTCPConnectionPool.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_TCP_CONNECTION_POOL_H
+#define ROVECOMM_TCP_CONNECTION_POOL_H
+
+#include "RoveCommConsts.h"
+#include "RoveCommPacket.h"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    // Define an enum for selecting when a pooled send is pushed onto the wire.
+    enum RoveCommTCPSendMode
+    {
+        eSendDefault,    // Pushed when the connection's Nagle setting allows.
+        eSendNoDelay,    // Pushed at once, with Nagle's algorithm disabled on the connection.
+        eSendBatched     // Held in the corked connection until Flush() or the next send that is not batched.
+    };
+
+    // Define a struct for reporting a snapshot of a connection pool's counters.
+    struct RoveCommConnectionPoolStatistics
+    {
+        public:
+            uint64_t unConnects;            // Connections opened.
+            uint64_t unReuses;              // Sends on a connection that was already open.
+            uint64_t unStaleConnections;    // Open connections found closed by the peer and replaced.
+            uint64_t unConnectFailures;     // Connection attempts that failed.
+            uint64_t unBackoffRejects;      // Sends refused without trying, because the destination is backing off.
+            uint64_t unSendFailures;        // Sends that failed on a new connection.
+            uint64_t unBatchedSends;        // Sends held in a corked connection.
+            uint64_t unFlushes;             // Corked or delayed bytes pushed by Flush() or an unbatched send.
+            size_t siOpenConnections;       // Connections currently open.
+    };
+
+    /******************************************************************************
+     * @brief Keeps one connection per destination address and port. A connection
+     *        is opened by the first send to its destination and reused by every
+     *        later one. Before it is reused it is checked for having been closed by
+     *        the peer, and a send that fails on a reused connection is retried once
+     *        on a new one, so a restarted receiver only costs a reconnect.
+     *
+     *        When a destination cannot be reached, further sends to it fail at once
+     *        until a backoff delay has passed, instead of each blocking in
+     *        connect(). The delay doubles with every failed attempt, up to a limit,
+     *        and is reset by the next successful one.
+     *
+     *        Each send chooses when its bytes go out. Nagle's algorithm, which
+     *        holds a small packet until the previous one is acknowledged, is on
+     *        unless SetNoDelay() turns it off for the pool or a send asks for
+     *        eSendNoDelay. A burst of eSendBatched sends corks the connection so
+     *        they leave in full segments, and Flush() pushes them.
+     *
+     * @note Sends to one destination are serialized, so packets from different
+     *       threads are never interleaved on the connection. Sends to different
+     *       destinations run in parallel.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommTCPConnectionPool
+    {
+        private:
+            struct Destination
+            {
+                public:
+                    std::mutex muDestinationMutex;
+                    int nSocket;
+                    bool bNoDelay;
+                    bool bCorked;
+                    unsigned int unFailures;
+                    std::chrono::steady_clock::time_point tmRetryAfter;
+            };
+
+            // Private member variables
+            mutable std::mutex m_muPoolMutex;
+            std::map<uint64_t, std::unique_ptr<Destination>> m_mpDestinations;
+            std::chrono::milliseconds m_tmMinBackoff;
+            std::chrono::milliseconds m_tmMaxBackoff;
+            std::atomic<bool> m_bNoDelay;
+
+            // Statistics counters.
+            std::atomic<uint64_t> m_unConnects;
+            std::atomic<uint64_t> m_unReuses;
+            std::atomic<uint64_t> m_unStaleConnections;
+            std::atomic<uint64_t> m_unConnectFailures;
+            std::atomic<uint64_t> m_unBackoffRejects;
+            std::atomic<uint64_t> m_unSendFailures;
+            std::atomic<uint64_t> m_unBatchedSends;
+            std::atomic<uint64_t> m_unFlushes;
+            std::atomic<size_t> m_siOpenConnections;
+
+            // Connection functions
+            bool Connect(Destination& stDestination, const sockaddr_in& saAddress);
+            void Disconnect(Destination& stDestination);
+            void ApplySendMode(Destination& stDestination, RoveCommTCPSendMode eMode);
+            void PushPending(Destination& stDestination);
+            Destination* FindDestination(const sockaddr_in& saAddress, bool bCreate);
+            std::vector<Destination*> GetDestinations() const;
+            bool IsClosedByPeer(int nSocket) const;
+            ssize_t SendAll(int nSocket, const uint8_t* pData, size_t siDataSize);
+
+        public:
+            // Constructor
+            RoveCommTCPConnectionPool();
+            RoveCommTCPConnectionPool(const RoveCommTCPConnectionPool&)            = delete;
+            RoveCommTCPConnectionPool& operator=(const RoveCommTCPConnectionPool&) = delete;
+            // Destructor
+            ~RoveCommTCPConnectionPool();
+
+            // Configuration functions
+            void SetBackoff(std::chrono::milliseconds tmMinBackoff, std::chrono::milliseconds tmMaxBackoff);
+            void SetNoDelay(bool bNoDelay);
+
+            // Transmission functions
+            ssize_t Send(const char* cIPAddress, int nPort, const uint8_t* pData, size_t siDataSize, RoveCommTCPSendMode eMode = eSendDefault);
+            bool Flush(const char* cIPAddress, int nPort);
+            void FlushAll();
+            void CloseAll();
+
+            // Accessors
+            RoveCommConnectionPoolStatistics GetStatistics() const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_TCP_CONNECTION_POOL_H
@@ -0,0 +1,252 @@
+/******************************************************************************
+ * @brief RoveComm TCP Framer Implementation.
+ *
+ * @file RoveCommTCPFramer.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommTCPFramer.h"
+
+/// \cond
+#include <algorithm>
+#include <cstring>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Check a packet header read from a TCP connection and compute the size
+     *        of the packet it starts.
+     *
+     * @param pHeader - The header, at least ROVECOMM_PACKET_HEADER_SIZE bytes.
+     * @param siMaxFrameSize - The largest packet to accept.
+     * @param siFrameSize - Set to the packed size of the packet, header included,
+     *                      if the header is accepted.
+     * @return RoveCommFrameError - eFrameNoError, or why the header was rejected.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommFrameError CheckFrameHeader(const uint8_t* pHeader, size_t siMaxFrameSize, size_t& siFrameSize)
+    {
+        if (pHeader[0] != ROVECOMM_VERSION)
+        {
+            return eFrameBadVersion;
+        }
+
+        size_t siElementSize = GetDataTypeSize(static_cast<manifest::DataTypes>(pHeader[5]));
+        if (siElementSize == 0)
+        {
+            return eFrameUnknownDataType;
+        }
+
+        size_t siDataCount = (static_cast<size_t>(pHeader[3]) << 8) | pHeader[4];
+        size_t siSize      = ROVECOMM_PACKET_HEADER_SIZE + siElementSize * siDataCount;
+        if (siSize > siMaxFrameSize)
+        {
+            return eFrameOversized;
+        }
+
+        siFrameSize = siSize;
+        return eFrameNoError;
+    }
+
+    /******************************************************************************
+     * @brief Construct a new RoveCommTCPFramer object.
+     *
+     * @param siMaxFrameSize - The largest packet to accept. Never less than a
+     *                         packet header.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommTCPFramer::RoveCommTCPFramer(size_t siMaxFrameSize)
+    {
+        m_siStart        = 0;
+        m_siEnd          = 0;
+        m_siMaxFrameSize = std::max<size_t>(siMaxFrameSize, ROVECOMM_PACKET_HEADER_SIZE);
+        m_eError         = eFrameNoError;
+        m_vBuffer.resize(ROVECOMM_TCP_FRAMER_BUFFER_SIZE);
+    }
+
+    /******************************************************************************
+     * @brief Get where the next bytes read from the connection go.
+     *
+     * @return uint8_t* - The first free byte of the buffer.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint8_t* RoveCommTCPFramer::GetWriteBuffer()
+    {
+        return m_vBuffer.data() + m_siEnd;
+    }
+
+    /******************************************************************************
+     * @brief Get how many bytes may be written at GetWriteBuffer(). After
+     *        NextFrame() has returned false without an error this is never 0, so a
+     *        read can always make progress.
+     *
+     * @return size_t - The free bytes at the end of the buffer.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommTCPFramer::GetWriteCapacity() const
+    {
+        return m_vBuffer.size() - m_siEnd;
+    }
+
+    /******************************************************************************
+     * @brief Add bytes that were written at GetWriteBuffer() to the stream.
+     *
+     * @param siBytes - The number of bytes written, at most GetWriteCapacity().
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPFramer::Commit(size_t siBytes)
+    {
+        m_siEnd += std::min(siBytes, GetWriteCapacity());
+    }
+
+    /******************************************************************************
+     * @brief Take the next complete packet from the stream.
+     *
+     * @param pFrame - Set to the first byte of the packet. It stays valid until
+     *                 NextFrame() returns false.
+     * @param siFrameSize - Set to the size of the packet, header included.
+     * @return true - A packet was returned.
+     * @return false - No complete packet is buffered, or a header was rejected,
+     *                 which GetError() reports. The start of an incomplete packet
+     *                 has been moved to the front of the buffer.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPFramer::NextFrame(const uint8_t*& pFrame, size_t& siFrameSize)
+    {
+        if (m_eError != eFrameNoError)
+        {
+            return false;
+        }
+
+        size_t siNextFrameSize = 0;
+        if (m_siEnd - m_siStart >= ROVECOMM_PACKET_HEADER_SIZE)
+        {
+            m_eError = CheckFrameHeader(m_vBuffer.data() + m_siStart, m_siMaxFrameSize, siNextFrameSize);
+            if (m_eError != eFrameNoError)
+            {
+                return false;
+            }
+
+            if (m_siEnd - m_siStart >= siNextFrameSize)
+            {
+                pFrame      = m_vBuffer.data() + m_siStart;
+                siFrameSize = siNextFrameSize;
+                m_siStart += siNextFrameSize;
+                return true;
+            }
+        }
+
+        Compact(siNextFrameSize);
+        return false;
+    }
+
+    /******************************************************************************
+     * @brief Move the start of an incomplete packet to the front of the buffer,
+     *        and size the buffer so the whole packet fits. A buffer grown for a
+     *        large packet is shrunk again once it is empty.
+     *
+     * @param siNextFrameSize - The size of the incomplete packet, or 0 if its
+     *                          header has not fully arrived.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPFramer::Compact(size_t siNextFrameSize)
+    {
+        if (m_siStart > 0)
+        {
+            memmove(m_vBuffer.data(), m_vBuffer.data() + m_siStart, m_siEnd - m_siStart);
+            m_siEnd -= m_siStart;
+            m_siStart = 0;
+        }
+
+        if (siNextFrameSize > m_vBuffer.size())
+        {
+            m_vBuffer.resize(siNextFrameSize);
+        }
+        else if (m_siEnd == 0 && m_vBuffer.size() > static_cast<size_t>(ROVECOMM_TCP_FRAMER_BUFFER_SIZE))
+        {
+            m_vBuffer.resize(ROVECOMM_TCP_FRAMER_BUFFER_SIZE);
+            m_vBuffer.shrink_to_fit();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Discard all buffered bytes and any error, to start on a new stream.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPFramer::Reset()
+    {
+        m_siStart = 0;
+        m_siEnd   = 0;
+        m_eError  = eFrameNoError;
+        Compact(0);
+    }
+
+    /******************************************************************************
+     * @brief Get why the framer stopped returning packets.
+     *
+     * @return RoveCommFrameError - eFrameNoError while the stream is valid.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommFrameError RoveCommTCPFramer::GetError() const
+    {
+        return m_eError;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of bytes received but not yet returned as packets.
+     *
+     * @return size_t - The buffered bytes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommTCPFramer::GetBufferedBytes() const
+    {
+        return m_siEnd - m_siStart;
+    }
+
+    /******************************************************************************
+     * @brief Get the size of the buffer, which is larger than
+     *        ROVECOMM_TCP_FRAMER_BUFFER_SIZE while a large packet is arriving.
+     *
+     * @return size_t - The buffer size in bytes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommTCPFramer::GetBufferSize() const
+    {
+        return m_vBuffer.size();
+    }
+}    // namespace rovecomm
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * @brief The RoveCommTCPFramer class splits the byte stream of a TCP connection
+ *        back into the RoveComm packets that were sent over it.
+ *
+ * @file RoveCommTCPFramer.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_TCP_FRAMER_H
+#define ROVECOMM_TCP_FRAMER_H
+
+#include "RoveCommConsts.h"
+#include "RoveCommPacket.h"
+
+/// \cond
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    // Define an enum for why a packet header read from a TCP connection was rejected.
+    enum RoveCommFrameError
+    {
+        eFrameNoError,            // The header describes a packet that can be received.
+        eFrameBadVersion,         // The first byte is not ROVECOMM_VERSION.
+        eFrameUnknownDataType,    // The data type is not one of the manifest's, so the packet cannot be measured.
+        eFrameOversized           // The packet is larger than the framer accepts.
+    };
+
+    // Framing functions
+    RoveCommFrameError CheckFrameHeader(const uint8_t* pHeader, size_t siMaxFrameSize, size_t& siFrameSize);
+
+    /******************************************************************************
+     * @brief Splits the bytes received on one TCP connection into packets. The
+     *        size of each packet is computed from its header, as the data count
+     *        times the size of the data type, so any number of packets can be
+     *        taken from one read and the start of a packet that has only partly
+     *        arrived is kept for the next one.
+     *
+     *        Every header is checked as soon as its six bytes have arrived. TCP
+     *        has no markers to find the next packet by, so once a header is bad
+     *        nothing after it can be trusted. The framer stops returning packets,
+     *        and the connection should be closed rather than scanned for bytes
+     *        that happen to look like a header. A packet larger than the buffer
+     *        grows it, unless the packet is over the maximum frame size, in which
+     *        case it is rejected from its header without waiting for its bytes.
+     *
+     * @note Bytes are read straight into the framer: call GetWriteBuffer() and
+     *       GetWriteCapacity(), recv() into them, then Commit() the bytes read
+     *       and call NextFrame() until it returns false.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommTCPFramer
+    {
+        private:
+            // Private member variables
+            std::vector<uint8_t> m_vBuffer;
+            size_t m_siStart;
+            size_t m_siEnd;
+            size_t m_siMaxFrameSize;
+            RoveCommFrameError m_eError;
+
+            // Buffer management functions
+            void Compact(size_t siNextFrameSize);
+
+        public:
+            // Constructor
+            RoveCommTCPFramer(size_t siMaxFrameSize = ROVECOMM_TCP_MAX_FRAME_SIZE);
+
+            // Receive functions
+            uint8_t* GetWriteBuffer();
+            size_t GetWriteCapacity() const;
+            void Commit(size_t siBytes);
+            bool NextFrame(const uint8_t*& pFrame, size_t& siFrameSize);
+            void Reset();
+
+            // Accessors
+            RoveCommFrameError GetError() const;
+            size_t GetBufferedBytes() const;
+            size_t GetBufferSize() const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_TCP_FRAMER_H
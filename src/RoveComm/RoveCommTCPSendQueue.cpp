@@ -0,0 +1,726 @@
+/******************************************************************************
+ * @brief RoveComm TCP Send Queue Implementation.
+ *
+ * @file RoveCommTCPSendQueue.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommTCPSendQueue.h"
+
+/// \cond
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+/// \endcond
+
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+#define CLOSE_SOCKET     closesocket
+#define SOCKET_ERROR_NUM WSAGetLastError()
+#define SEND_WOULD_BLOCK WSAEWOULDBLOCK
+#define CONNECT_PENDING  WSAEWOULDBLOCK
+#define poll             WSAPoll
+typedef WSAPOLLFD pollfd_t;
+#else
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/uio.h>
+#define CLOSE_SOCKET     close
+#define SOCKET_ERROR_NUM errno
+#define SEND_WOULD_BLOCK EAGAIN
+#define CONNECT_PENDING  EINPROGRESS
+typedef struct pollfd pollfd_t;
+#endif
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Construct a new, empty send queue. Its thread is started by the
+     *        first packet queued.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommTCPSendQueue::RoveCommTCPSendQueue() : m_stBufferPool(4 * ROVECOMM_TCP_SEND_GATHER_MAX)
+    {
+        m_siHighWaterMark  = ROVECOMM_TCP_SEND_HIGH_WATER_MARK;
+        m_ePolicy          = eBackpressureReject;
+        m_tmSendTimeout    = std::chrono::milliseconds(ROVECOMM_TCP_SEND_TIMEOUT_MS);
+        m_tmMinBackoff     = std::chrono::milliseconds(ROVECOMM_TCP_RECONNECT_MIN_MS);
+        m_tmMaxBackoff     = std::chrono::milliseconds(ROVECOMM_TCP_RECONNECT_MAX_MS);
+        m_unBlockedSenders = 0;
+        m_nWakeupFD        = -1;
+        m_bEnabled         = false;
+
+        // Initialize the statistics.
+        m_unQueued            = 0;
+        m_unSent              = 0;
+        m_unRejected          = 0;
+        m_unTimedOut          = 0;
+        m_unBlockedWaits      = 0;
+        m_unFlushes           = 0;
+        m_unConnects          = 0;
+        m_unConnectFailures   = 0;
+        m_siQueuedBytes       = 0;
+        m_siMaxQueuedBytes    = 0;
+        m_unFlushLatencySumUs = 0;
+        m_unMaxFlushLatencyUs = 0;
+    }
+
+    /******************************************************************************
+     * @brief Destroy the send queue, failing every packet that is still queued.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommTCPSendQueue::~RoveCommTCPSendQueue()
+    {
+        Disable();
+    }
+
+    /******************************************************************************
+     * @brief Set how much each destination may buffer and how long a packet may
+     *        wait to be written.
+     *
+     * @param siHighWaterMark - The bytes a destination's write buffer may hold
+     *                          before backpressure applies. A packet is always
+     *                          accepted into an empty buffer, however large.
+     * @param ePolicy - Whether a send over the mark is refused or waits.
+     * @param tmSendTimeout - How long a packet may wait to be written, and how
+     *                        long eBackpressureBlock waits for room.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::SetLimits(size_t siHighWaterMark, RoveCommBackpressurePolicy ePolicy, std::chrono::milliseconds tmSendTimeout)
+    {
+        std::lock_guard<std::mutex> lkQueueLock(m_muQueueMutex);
+        m_siHighWaterMark = siHighWaterMark;
+        m_ePolicy         = ePolicy;
+        m_tmSendTimeout   = tmSendTimeout;
+    }
+
+    /******************************************************************************
+     * @brief Set how long the I/O thread waits before reconnecting to a
+     *        destination whose connection failed.
+     *
+     * @param tmMinBackoff - The delay after the first failure.
+     * @param tmMaxBackoff - The longest delay, reached by doubling.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::SetBackoff(std::chrono::milliseconds tmMinBackoff, std::chrono::milliseconds tmMaxBackoff)
+    {
+        std::lock_guard<std::mutex> lkQueueLock(m_muQueueMutex);
+        m_tmMinBackoff = tmMinBackoff;
+        m_tmMaxBackoff = std::max(tmMinBackoff, tmMaxBackoff);
+    }
+
+    /******************************************************************************
+     * @brief Get a pooled buffer to pack a packet into before queueing it.
+     *
+     * @param siSize - The packed size of the packet.
+     * @return RoveCommBufferPool::Buffer - A buffer of exactly that size.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommBufferPool::Buffer RoveCommTCPSendQueue::AcquireBuffer(size_t siSize)
+    {
+        return m_stBufferPool.Acquire(siSize);
+    }
+
+    /******************************************************************************
+     * @brief Queue a packed packet for a destination. Returns as soon as the
+     *        packet is buffered, or once it is refused.
+     *
+     * @param saAddress - The destination.
+     * @param stBuffer - The packed packet, from AcquireBuffer().
+     * @param fnCallback - Called once with the bytes written when the packet has
+     *                     been written in full, or with -1 if it is refused, times
+     *                     out, or the queue is disabled first. May be null.
+     * @return true - The packet was queued.
+     * @return false - The packet was refused by backpressure, and fnCallback has
+     *                 already been called.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPSendQueue::Enqueue(const sockaddr_in& saAddress, RoveCommBufferPool::Buffer&& stBuffer, RoveCommSendCallback fnCallback)
+    {
+        size_t siSize                               = stBuffer.size();
+        uint64_t unKey                              = (static_cast<uint64_t>(ntohl(saAddress.sin_addr.s_addr)) << 16) | ntohs(saAddress.sin_port);
+        std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+
+        std::unique_lock<std::mutex> lkQueueLock(m_muQueueMutex);
+
+        // The I/O thread starts with the first packet, so a node that never queues one never runs it.
+        if (!m_bEnabled)
+        {
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+            m_nWakeupFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (m_nWakeupFD == -1)
+            {
+                perror("Failed to create TCP send queue wakeup eventfd");
+                lkQueueLock.unlock();
+                m_unRejected.fetch_add(1, std::memory_order_relaxed);
+                if (fnCallback)
+                {
+                    fnCallback(-1);
+                }
+                return false;
+            }
+#endif
+            m_bEnabled = true;
+            Start();
+        }
+
+        // Find the destination, adding it on the first send.
+        std::pair<std::map<uint64_t, Connection>::iterator, bool> stEntry = m_mpConnections.try_emplace(unKey);
+        Connection& stConnection                                          = stEntry.first->second;
+        if (stEntry.second)
+        {
+            stConnection.saAddress     = saAddress;
+            stConnection.nSocket       = -1;
+            stConnection.bConnecting   = false;
+            stConnection.siQueuedBytes = 0;
+            stConnection.unFailures    = 0;
+            stConnection.tmRetryAfter  = std::chrono::steady_clock::time_point();
+        }
+
+        // Apply backpressure while the buffer is over the high-water mark.
+        auto fnOverMark = [&]() { return stConnection.siQueuedBytes > 0 && stConnection.siQueuedBytes + siSize > m_siHighWaterMark; };
+        if (fnOverMark() && m_ePolicy == eBackpressureBlock)
+        {
+            m_unBlockedWaits.fetch_add(1, std::memory_order_relaxed);
+            m_unBlockedSenders++;
+            m_cvDrained.wait_until(lkQueueLock, tmNow + m_tmSendTimeout, [&]() { return !m_bEnabled || !fnOverMark(); });
+            m_unBlockedSenders--;
+            tmNow = std::chrono::steady_clock::now();
+        }
+        if (!m_bEnabled || fnOverMark())
+        {
+            lkQueueLock.unlock();
+            m_unRejected.fetch_add(1, std::memory_order_relaxed);
+            if (fnCallback)
+            {
+                fnCallback(-1);
+            }
+            return false;
+        }
+
+        // Buffer the packet. The thread only needs waking if it had nothing to write here.
+        bool bWasEmpty = stConnection.dqPackets.empty();
+        stConnection.dqPackets.push_back(PendingPacket{std::move(stBuffer), 0, tmNow, std::move(fnCallback)});
+        stConnection.siQueuedBytes += siSize;
+        size_t siQueuedBytes = m_siQueuedBytes.fetch_add(siSize, std::memory_order_relaxed) + siSize;
+        if (siQueuedBytes > m_siMaxQueuedBytes.load(std::memory_order_relaxed))
+        {
+            m_siMaxQueuedBytes.store(siQueuedBytes, std::memory_order_relaxed);
+        }
+        m_unQueued.fetch_add(1, std::memory_order_relaxed);
+        lkQueueLock.unlock();
+
+        if (bWasEmpty)
+        {
+            WakeThread();
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Stop the I/O thread and close every connection, after one last
+     *        attempt to write what is buffered. Packets that could not be written
+     *        are failed. The next packet queued starts the thread again.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::Disable()
+    {
+        {
+            std::lock_guard<std::mutex> lkQueueLock(m_muQueueMutex);
+            if (!m_bEnabled)
+            {
+                return;
+            }
+            m_bEnabled = false;
+            m_cvDrained.notify_all();
+        }
+
+        RequestStop();
+        WakeThread();
+        Join();
+
+        // The thread has exited, so the connections can be closed from here. They are kept, since a blocked sender may still hold one.
+        std::vector<Completion> vCompletions;
+        {
+            std::lock_guard<std::mutex> lkQueueLock(m_muQueueMutex);
+            std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+            for (std::pair<const uint64_t, Connection>& stEntry : m_mpConnections)
+            {
+                Connection& stConnection = stEntry.second;
+                if (stConnection.nSocket != -1 && !stConnection.bConnecting)
+                {
+                    Flush(stConnection, tmNow, vCompletions);
+                }
+                while (!stConnection.dqPackets.empty())
+                {
+                    vCompletions.emplace_back(std::move(stConnection.dqPackets.front().fnCallback), -1);
+                    RemovePacket(stConnection);
+                }
+                if (stConnection.nSocket != -1)
+                {
+                    CLOSE_SOCKET(stConnection.nSocket);
+                    stConnection.nSocket     = -1;
+                    stConnection.bConnecting = false;
+                }
+            }
+
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+            close(m_nWakeupFD);
+            m_nWakeupFD = -1;
+#endif
+        }
+
+        for (Completion& stCompletion : vCompletions)
+        {
+            if (stCompletion.first)
+            {
+                stCompletion.first(stCompletion.second);
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the queue's counters.
+     *
+     * @return RoveCommSendQueueStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommSendQueueStatistics RoveCommTCPSendQueue::GetStatistics() const
+    {
+        RoveCommSendQueueStatistics stStatistics;
+        stStatistics.unQueued             = m_unQueued.load(std::memory_order_relaxed);
+        stStatistics.unSent               = m_unSent.load(std::memory_order_relaxed);
+        stStatistics.unRejected           = m_unRejected.load(std::memory_order_relaxed);
+        stStatistics.unTimedOut           = m_unTimedOut.load(std::memory_order_relaxed);
+        stStatistics.unBlockedWaits       = m_unBlockedWaits.load(std::memory_order_relaxed);
+        stStatistics.unFlushes            = m_unFlushes.load(std::memory_order_relaxed);
+        stStatistics.unConnects           = m_unConnects.load(std::memory_order_relaxed);
+        stStatistics.unConnectFailures    = m_unConnectFailures.load(std::memory_order_relaxed);
+        stStatistics.siQueuedBytes        = m_siQueuedBytes.load(std::memory_order_relaxed);
+        stStatistics.siMaxQueuedBytes     = m_siMaxQueuedBytes.load(std::memory_order_relaxed);
+        stStatistics.unMeanFlushLatencyUs = stStatistics.unSent == 0 ? 0 : m_unFlushLatencySumUs.load(std::memory_order_relaxed) / stStatistics.unSent;
+        stStatistics.unMaxFlushLatencyUs  = m_unMaxFlushLatencyUs.load(std::memory_order_relaxed);
+
+        return stStatistics;
+    }
+
+    /******************************************************************************
+     * @brief Start a non-blocking connection to a destination. It completes in
+     *        FinishConnect() once the socket becomes writable.
+     *
+     * @param stConnection - The destination to connect.
+     * @param tmNow - The current time.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::StartConnect(Connection& stConnection, std::chrono::steady_clock::time_point tmNow)
+    {
+        int nSocket = socket(AF_INET, SOCK_STREAM, 0);
+        if (nSocket == -1)
+        {
+            perror("Failed to create TCP client socket");
+            FailConnection(stConnection, tmNow);
+            return;
+        }
+
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        u_long unMode = 1;
+        ioctlsocket(nSocket, FIONBIO, &unMode);
+#else
+        fcntl(nSocket, F_SETFL, fcntl(nSocket, F_GETFL) | O_NONBLOCK);
+#endif
+
+        // Every write already gathers what is buffered, so Nagle's algorithm would only delay it.
+        int nNoDelay = 1;
+        setsockopt(nSocket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&nNoDelay), sizeof(nNoDelay));
+
+        stConnection.nSocket     = nSocket;
+        stConnection.bConnecting = true;
+        if (connect(nSocket, (const struct sockaddr*) &stConnection.saAddress, sizeof(stConnection.saAddress)) == 0)
+        {
+            FinishConnect(stConnection, tmNow);
+        }
+        else if (SOCKET_ERROR_NUM != CONNECT_PENDING)
+        {
+            FailConnection(stConnection, tmNow);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Check whether a pending connection has opened.
+     *
+     * @param stConnection - The destination being connected.
+     * @param tmNow - The current time.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::FinishConnect(Connection& stConnection, std::chrono::steady_clock::time_point tmNow)
+    {
+        int nError          = 0;
+        socklen_t sklLength = sizeof(nError);
+        if (getsockopt(stConnection.nSocket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&nError), &sklLength) == -1 || nError != 0)
+        {
+            FailConnection(stConnection, tmNow);
+            return;
+        }
+
+        stConnection.bConnecting  = false;
+        stConnection.unFailures   = 0;
+        stConnection.tmRetryAfter = std::chrono::steady_clock::time_point();
+        m_unConnects.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /******************************************************************************
+     * @brief Close a destination's connection after it failed, and wait twice as
+     *        long before the next attempt after every failure in a row, up to the
+     *        maximum. A packet that was partly written is sent again from its
+     *        start over the next connection.
+     *
+     * @param stConnection - The destination whose connection failed.
+     * @param tmNow - The current time.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::FailConnection(Connection& stConnection, std::chrono::steady_clock::time_point tmNow)
+    {
+        if (stConnection.nSocket != -1)
+        {
+            CLOSE_SOCKET(stConnection.nSocket);
+            stConnection.nSocket = -1;
+        }
+        stConnection.bConnecting = false;
+        if (!stConnection.dqPackets.empty())
+        {
+            stConnection.dqPackets.front().siWritten = 0;
+        }
+
+        std::chrono::milliseconds tmBackoff = m_tmMinBackoff * (1LL << std::min(stConnection.unFailures, 16u));
+        stConnection.unFailures++;
+        stConnection.tmRetryAfter = tmNow + std::min(tmBackoff, m_tmMaxBackoff);
+        m_unConnectFailures.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /******************************************************************************
+     * @brief Write as much of a destination's buffer as its connection takes,
+     *        gathering up to ROVECOMM_TCP_SEND_GATHER_MAX packets per write.
+     *
+     * @param stConnection - The destination to flush. Its connection is open.
+     * @param tmNow - The current time.
+     * @param vCompletions - The callbacks of packets written in full are added.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::Flush(Connection& stConnection, std::chrono::steady_clock::time_point tmNow, std::vector<Completion>& vCompletions)
+    {
+        while (!stConnection.dqPackets.empty())
+        {
+            // Gather the unwritten part of every buffered packet, up to the limit.
+            size_t siGathered = 0;
+            size_t siBytes    = 0;
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+            WSABUF aVectors[ROVECOMM_TCP_SEND_GATHER_MAX];
+            for (std::deque<PendingPacket>::iterator itPacket = stConnection.dqPackets.begin();
+                 itPacket != stConnection.dqPackets.end() && siGathered < ROVECOMM_TCP_SEND_GATHER_MAX;
+                 ++itPacket, ++siGathered)
+            {
+                aVectors[siGathered].buf = reinterpret_cast<char*>(itPacket->stBuffer.data() + itPacket->siWritten);
+                aVectors[siGathered].len = static_cast<ULONG>(itPacket->stBuffer.size() - itPacket->siWritten);
+                siBytes += aVectors[siGathered].len;
+            }
+
+            DWORD dwSent   = 0;
+            ssize_t siSent = WSASend(stConnection.nSocket, aVectors, static_cast<DWORD>(siGathered), &dwSent, 0, nullptr, nullptr) == 0 ? dwSent : -1;
+#else
+            struct iovec aVectors[ROVECOMM_TCP_SEND_GATHER_MAX];
+            for (std::deque<PendingPacket>::iterator itPacket = stConnection.dqPackets.begin();
+                 itPacket != stConnection.dqPackets.end() && siGathered < ROVECOMM_TCP_SEND_GATHER_MAX;
+                 ++itPacket, ++siGathered)
+            {
+                aVectors[siGathered].iov_base = itPacket->stBuffer.data() + itPacket->siWritten;
+                aVectors[siGathered].iov_len  = itPacket->stBuffer.size() - itPacket->siWritten;
+                siBytes += aVectors[siGathered].iov_len;
+            }
+
+            // sendmsg() is writev() with flags, so a closed peer fails the write instead of raising SIGPIPE.
+            struct msghdr stMessage;
+            memset(&stMessage, 0, sizeof(stMessage));
+            stMessage.msg_iov    = aVectors;
+            stMessage.msg_iovlen = siGathered;
+            ssize_t siSent       = sendmsg(stConnection.nSocket, &stMessage, MSG_NOSIGNAL | MSG_DONTWAIT);
+#endif
+            m_unFlushes.fetch_add(1, std::memory_order_relaxed);
+            if (siSent == -1)
+            {
+                if (SOCKET_ERROR_NUM != SEND_WOULD_BLOCK && SOCKET_ERROR_NUM != EWOULDBLOCK && SOCKET_ERROR_NUM != EINTR)
+                {
+                    FailConnection(stConnection, tmNow);
+                }
+                return;
+            }
+
+            // Complete the packets that were written in full, and note how far into the next one the write got.
+            size_t siRemaining = static_cast<size_t>(siSent);
+            while (siRemaining > 0)
+            {
+                PendingPacket& stPacket = stConnection.dqPackets.front();
+                size_t siUnwritten      = stPacket.stBuffer.size() - stPacket.siWritten;
+                if (siRemaining < siUnwritten)
+                {
+                    stPacket.siWritten += siRemaining;
+                    break;
+                }
+                siRemaining -= siUnwritten;
+
+                uint64_t unLatencyUs = std::chrono::duration_cast<std::chrono::microseconds>(tmNow - stPacket.tmQueued).count();
+                m_unFlushLatencySumUs.fetch_add(unLatencyUs, std::memory_order_relaxed);
+                if (unLatencyUs > m_unMaxFlushLatencyUs.load(std::memory_order_relaxed))
+                {
+                    m_unMaxFlushLatencyUs.store(unLatencyUs, std::memory_order_relaxed);
+                }
+                m_unSent.fetch_add(1, std::memory_order_relaxed);
+                vCompletions.emplace_back(std::move(stPacket.fnCallback), static_cast<ssize_t>(stPacket.stBuffer.size()));
+                RemovePacket(stConnection);
+            }
+
+            // The socket buffer is full, the rest waits until the connection is writable again.
+            if (static_cast<size_t>(siSent) < siBytes)
+            {
+                return;
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Fail the packets that have waited longer than the send timeout. A
+     *        packet that timed out after it was partly written means the link is
+     *        stalled, and its connection is closed, since the rest of the stream
+     *        could not be parsed without it.
+     *
+     * @param stConnection - The destination to check.
+     * @param tmNow - The current time.
+     * @param vCompletions - The callbacks of the failed packets are added.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::ExpirePackets(Connection& stConnection, std::chrono::steady_clock::time_point tmNow, std::vector<Completion>& vCompletions)
+    {
+        // Packets are queued in order, so only the oldest ones can have timed out.
+        while (!stConnection.dqPackets.empty() && tmNow - stConnection.dqPackets.front().tmQueued >= m_tmSendTimeout)
+        {
+            if (stConnection.dqPackets.front().siWritten > 0)
+            {
+                FailConnection(stConnection, tmNow);
+            }
+
+            m_unTimedOut.fetch_add(1, std::memory_order_relaxed);
+            vCompletions.emplace_back(std::move(stConnection.dqPackets.front().fnCallback), -1);
+            RemovePacket(stConnection);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Remove the oldest packet from a destination's buffer, returning its
+     *        buffer to the pool.
+     *
+     * @param stConnection - The destination. Its buffer is not empty.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::RemovePacket(Connection& stConnection)
+    {
+        size_t siSize = stConnection.dqPackets.front().stBuffer.size();
+        stConnection.dqPackets.pop_front();
+        stConnection.siQueuedBytes -= siSize;
+        m_siQueuedBytes.fetch_sub(siSize, std::memory_order_relaxed);
+    }
+
+    /******************************************************************************
+     * @brief Interrupt the I/O thread while it waits in poll().
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::WakeThread()
+    {
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+        if (m_nWakeupFD != -1)
+        {
+            uint64_t unWakeup = 1;
+            if (write(m_nWakeupFD, &unWakeup, sizeof(unWakeup)) == -1)
+            {
+                perror("Failed to write TCP send queue wakeup eventfd");
+            }
+        }
+#endif
+    }
+
+    /******************************************************************************
+     * @brief Wait until a connection can be written, opens, or fails, or a packet
+     *        is queued, then connect, flush and expire every destination.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::ThreadedContinuousCode()
+    {
+        // Wait on every open connection and the wakeup eventfd, which is always the first entry.
+        std::vector<pollfd_t> vPollFDs;
+        std::vector<Connection*> vPolledConnections;
+        int nTimeoutMs = ROVECOMM_EVENT_WAIT_TIMEOUT_MS;
+        {
+            std::lock_guard<std::mutex> lkQueueLock(m_muQueueMutex);
+            std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+
+            pollfd_t stPollFD;
+            stPollFD.fd      = m_nWakeupFD;
+            stPollFD.events  = POLLIN;
+            stPollFD.revents = 0;
+            vPollFDs.push_back(stPollFD);
+            for (std::pair<const uint64_t, Connection>& stEntry : m_mpConnections)
+            {
+                Connection& stConnection = stEntry.second;
+                if (stConnection.nSocket != -1)
+                {
+                    // Receivers never send on a packet connection, so a readable one has been closed or reset.
+                    stPollFD.fd     = stConnection.nSocket;
+                    stPollFD.events = POLLIN;
+                    if (stConnection.bConnecting || !stConnection.dqPackets.empty())
+                    {
+                        stPollFD.events |= POLLOUT;
+                    }
+                    vPollFDs.push_back(stPollFD);
+                    vPolledConnections.push_back(&stConnection);
+                }
+                if (!stConnection.dqPackets.empty())
+                {
+                    // Wake in time to expire the oldest packet, and to reconnect once the backoff has passed.
+                    std::chrono::steady_clock::time_point tmWakeAt = stConnection.dqPackets.front().tmQueued + m_tmSendTimeout;
+                    if (stConnection.nSocket == -1)
+                    {
+                        tmWakeAt = std::min(tmWakeAt, stConnection.tmRetryAfter);
+                    }
+                    int64_t nWakeMs = std::chrono::duration_cast<std::chrono::milliseconds>(tmWakeAt - tmNow).count() + 1;
+                    nTimeoutMs      = static_cast<int>(std::max<int64_t>(0, std::min<int64_t>(nTimeoutMs, nWakeMs)));
+                }
+            }
+        }
+
+        int nReady = poll(vPollFDs.data(), vPollFDs.size(), nTimeoutMs);
+
+        std::vector<Completion> vCompletions;
+        {
+            std::lock_guard<std::mutex> lkQueueLock(m_muQueueMutex);
+            std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+            if (nReady > 0 && vPollFDs[0].revents != 0)
+            {
+                // Consume the wakeup so the next wait blocks again.
+                uint64_t unWakeups;
+                if (read(m_nWakeupFD, &unWakeups, sizeof(unWakeups)) == -1 && errno != EAGAIN)
+                {
+                    perror("Failed to read TCP send queue wakeup eventfd");
+                }
+            }
+#endif
+
+            // Finish the connections that opened or failed, and close the ones the peer closed.
+            for (size_t siIter = 0; nReady > 0 && siIter < vPolledConnections.size(); ++siIter)
+            {
+                Connection& stConnection = *vPolledConnections[siIter];
+                short sEvents            = vPollFDs[siIter + 1].revents;
+                if (sEvents == 0 || stConnection.nSocket != vPollFDs[siIter + 1].fd)
+                {
+                    continue;
+                }
+
+                if (stConnection.bConnecting)
+                {
+                    FinishConnect(stConnection, tmNow);
+                }
+                else if (sEvents & (POLLIN | POLLERR | POLLHUP))
+                {
+                    FailConnection(stConnection, tmNow);
+                }
+            }
+
+            // Connect, flush and expire every destination with packets.
+            for (std::pair<const uint64_t, Connection>& stEntry : m_mpConnections)
+            {
+                Connection& stConnection = stEntry.second;
+                if (stConnection.dqPackets.empty())
+                {
+                    continue;
+                }
+
+                if (stConnection.nSocket == -1 && tmNow >= stConnection.tmRetryAfter)
+                {
+                    StartConnect(stConnection, tmNow);
+                }
+                if (stConnection.nSocket != -1 && !stConnection.bConnecting)
+                {
+                    Flush(stConnection, tmNow, vCompletions);
+                }
+                ExpirePackets(stConnection, tmNow, vCompletions);
+            }
+
+            // Let senders waiting for room check again.
+            if (m_unBlockedSenders > 0)
+            {
+                m_cvDrained.notify_all();
+            }
+        }
+
+        for (Completion& stCompletion : vCompletions)
+        {
+            if (stCompletion.first)
+            {
+                stCompletion.first(stCompletion.second);
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief The send queue does not use the thread pool.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPSendQueue::PooledLinearCode() {}
+}    // namespace rovecomm
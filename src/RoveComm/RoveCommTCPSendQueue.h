@@ -0,0 +1,186 @@
+/******************************************************************************
+ * @brief The RoveCommTCPSendQueue class sends TCP packets from an I/O thread, so
+ *        that the thread that sends a packet never waits on connect() or send().
+ *
+ * @file RoveCommTCPSendQueue.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_TCP_SEND_QUEUE_H
+#define ROVECOMM_TCP_SEND_QUEUE_H
+
+#include "ExternalIncludes.h"
+#include "RoveCommBufferPool.h"
+#include "RoveCommConsts.h"
+#include "RoveCommPacket.h"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    // Define an enum for selecting what a send does when its connection's write buffer is over the high-water mark.
+    enum RoveCommBackpressurePolicy
+    {
+        eBackpressureReject,    // Refuse the send at once.
+        eBackpressureBlock      // Wait for the I/O thread to flush below the mark, and refuse the send if the send timeout passes first.
+    };
+
+    // Define the function type that is told how a queued send ended: the bytes written, or -1 if the packet was not sent.
+    using RoveCommSendCallback = std::function<void(ssize_t)>;
+
+    // Define a struct for reporting a snapshot of a send queue's counters.
+    struct RoveCommSendQueueStatistics
+    {
+        public:
+            uint64_t unQueued;                // Packets accepted into a write buffer.
+            uint64_t unSent;                  // Packets written to their connection in full.
+            uint64_t unRejected;              // Sends refused because their write buffer was over the high-water mark.
+            uint64_t unTimedOut;              // Queued packets discarded for not being written within the send timeout.
+            uint64_t unBlockedWaits;          // Sends that waited for their write buffer to drain.
+            uint64_t unFlushes;               // Gathered writes made by the I/O thread.
+            uint64_t unConnects;              // Connections opened by the I/O thread.
+            uint64_t unConnectFailures;       // Connection attempts that failed or were closed by the peer.
+            size_t siQueuedBytes;             // Bytes waiting in every write buffer.
+            size_t siMaxQueuedBytes;          // The most bytes that have waited at once.
+            uint64_t unMeanFlushLatencyUs;    // Mean time from queueing a packet to writing its last byte.
+            uint64_t unMaxFlushLatencyUs;     // Longest time from queueing a packet to writing its last byte.
+    };
+
+    /******************************************************************************
+     * @brief Keeps a write buffer and a non-blocking connection per destination,
+     *        and a thread that connects and flushes them. Queueing a packet copies
+     *        it into its destination's buffer and returns at once, and the thread
+     *        writes everything buffered for a destination with one gathered write
+     *        whenever the connection can take it.
+     *
+     *        When a destination's buffer holds more than the high-water mark, new
+     *        sends to it are refused or wait for it to drain, as the backpressure
+     *        policy says. A packet that is not written within the send timeout is
+     *        discarded, so a stalled link fails its sends instead of holding them
+     *        forever. A connection the peer closes or resets is reopened with the
+     *        same backoff as RoveCommTCPConnectionPool, and the packets still
+     *        buffered for it are sent over the new one.
+     *
+     * @note Completion callbacks run on the I/O thread, or on the sending thread
+     *       if the send is refused. They must not block.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommTCPSendQueue : AutonomyThread<void>
+    {
+        private:
+            struct PendingPacket
+            {
+                public:
+                    RoveCommBufferPool::Buffer stBuffer;
+                    size_t siWritten;
+                    std::chrono::steady_clock::time_point tmQueued;
+                    RoveCommSendCallback fnCallback;
+            };
+
+            struct Connection
+            {
+                public:
+                    sockaddr_in saAddress;
+                    int nSocket;
+                    bool bConnecting;
+                    std::deque<PendingPacket> dqPackets;
+                    size_t siQueuedBytes;
+                    unsigned int unFailures;
+                    std::chrono::steady_clock::time_point tmRetryAfter;
+            };
+
+            // A callback to run once the queue mutex is released, and the result to give it.
+            using Completion = std::pair<RoveCommSendCallback, ssize_t>;
+
+            // Private member variables
+            std::mutex m_muQueueMutex;
+            std::condition_variable m_cvDrained;
+            std::map<uint64_t, Connection> m_mpConnections;
+            RoveCommBufferPool m_stBufferPool;
+            size_t m_siHighWaterMark;
+            RoveCommBackpressurePolicy m_ePolicy;
+            std::chrono::milliseconds m_tmSendTimeout;
+            std::chrono::milliseconds m_tmMinBackoff;
+            std::chrono::milliseconds m_tmMaxBackoff;
+            unsigned int m_unBlockedSenders;
+            int m_nWakeupFD;
+            bool m_bEnabled;
+
+            // Statistics counters.
+            std::atomic<uint64_t> m_unQueued;
+            std::atomic<uint64_t> m_unSent;
+            std::atomic<uint64_t> m_unRejected;
+            std::atomic<uint64_t> m_unTimedOut;
+            std::atomic<uint64_t> m_unBlockedWaits;
+            std::atomic<uint64_t> m_unFlushes;
+            std::atomic<uint64_t> m_unConnects;
+            std::atomic<uint64_t> m_unConnectFailures;
+            std::atomic<size_t> m_siQueuedBytes;
+            std::atomic<size_t> m_siMaxQueuedBytes;
+            std::atomic<uint64_t> m_unFlushLatencySumUs;
+            std::atomic<uint64_t> m_unMaxFlushLatencyUs;
+
+            // Connection functions, called with the queue mutex held.
+            void StartConnect(Connection& stConnection, std::chrono::steady_clock::time_point tmNow);
+            void FinishConnect(Connection& stConnection, std::chrono::steady_clock::time_point tmNow);
+            void FailConnection(Connection& stConnection, std::chrono::steady_clock::time_point tmNow);
+            void Flush(Connection& stConnection, std::chrono::steady_clock::time_point tmNow, std::vector<Completion>& vCompletions);
+            void ExpirePackets(Connection& stConnection, std::chrono::steady_clock::time_point tmNow, std::vector<Completion>& vCompletions);
+            void RemovePacket(Connection& stConnection);
+            void WakeThread();
+
+            // AutonomyThread member functions
+            void ThreadedContinuousCode() override;
+            void PooledLinearCode() override;
+
+        public:
+            // Constructor
+            RoveCommTCPSendQueue();
+            RoveCommTCPSendQueue(const RoveCommTCPSendQueue&)            = delete;
+            RoveCommTCPSendQueue& operator=(const RoveCommTCPSendQueue&) = delete;
+            // Destructor
+            ~RoveCommTCPSendQueue();
+
+            // Configuration functions
+            void SetLimits(size_t siHighWaterMark, RoveCommBackpressurePolicy ePolicy, std::chrono::milliseconds tmSendTimeout);
+            void SetBackoff(std::chrono::milliseconds tmMinBackoff, std::chrono::milliseconds tmMaxBackoff);
+
+            // Transmission functions
+            RoveCommBufferPool::Buffer AcquireBuffer(size_t siSize);
+            bool Enqueue(const sockaddr_in& saAddress, RoveCommBufferPool::Buffer&& stBuffer, RoveCommSendCallback fnCallback);
+
+            // Lifetime functions
+            void Disable();
+
+            // Accessors
+            RoveCommSendQueueStatistics GetStatistics() const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_TCP_SEND_QUEUE_H
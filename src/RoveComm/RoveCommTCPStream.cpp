@@ -0,0 +1,1292 @@
+/******************************************************************************
+ * @brief RoveComm TCP Stream Implementation.
+ *
+ * @file RoveCommTCPStream.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommTCPStream.h"
+
+/// \cond
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+/// \endcond
+
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+#include <io.h>
+#define CLOSE_SOCKET      closesocket
+#define STREAM_SEND_FLAGS 0
+#define poll              WSAPoll
+typedef WSAPOLLFD pollfd_t;
+#else
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#define CLOSE_SOCKET      close
+#define STREAM_SEND_FLAGS MSG_NOSIGNAL
+typedef struct pollfd pollfd_t;
+#endif
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Write a stream header into a buffer.
+     *
+     * @param stHeader - The header to write.
+     * @param pBuffer - The buffer to write into, at least
+     *                  ROVECOMM_STREAM_HEADER_SIZE bytes long.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void PackStreamHeader(const RoveCommStreamHeader& stHeader, uint8_t* pBuffer)
+    {
+        uint16_t unDataId     = htons(stHeader.unDataId);
+        uint32_t unTransferId = htonl(stHeader.unTransferId);
+        uint64_t unTotalSize  = htonll(stHeader.unTotalSize);
+        uint32_t unChunkSize  = htonl(stHeader.unChunkSize);
+
+        pBuffer[0] = ROVECOMM_STREAM_VERSION;
+        std::memcpy(pBuffer + 1, &unDataId, sizeof(unDataId));
+        std::memcpy(pBuffer + 3, &unTransferId, sizeof(unTransferId));
+        std::memcpy(pBuffer + 7, &unTotalSize, sizeof(unTotalSize));
+        std::memcpy(pBuffer + 15, &unChunkSize, sizeof(unChunkSize));
+    }
+
+    /******************************************************************************
+     * @brief Read a stream header from received bytes.
+     *
+     * @param pData - The received bytes.
+     * @param siDataSize - The number of bytes received.
+     * @param stHeader - Filled with the header.
+     * @return true - The header is valid.
+     * @return false - The bytes are too short, do not start with
+     *                 ROVECOMM_STREAM_VERSION, or have an invalid chunk size.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool UnpackStreamHeader(const uint8_t* pData, size_t siDataSize, RoveCommStreamHeader& stHeader)
+    {
+        if (siDataSize < ROVECOMM_STREAM_HEADER_SIZE || pData[0] != ROVECOMM_STREAM_VERSION)
+        {
+            return false;
+        }
+
+        uint16_t unDataId;
+        uint32_t unTransferId;
+        uint64_t unTotalSize;
+        uint32_t unChunkSize;
+        std::memcpy(&unDataId, pData + 1, sizeof(unDataId));
+        std::memcpy(&unTransferId, pData + 3, sizeof(unTransferId));
+        std::memcpy(&unTotalSize, pData + 7, sizeof(unTotalSize));
+        std::memcpy(&unChunkSize, pData + 15, sizeof(unChunkSize));
+
+        stHeader.unDataId     = ntohs(unDataId);
+        stHeader.unTransferId = ntohl(unTransferId);
+        stHeader.unTotalSize  = ntohll(unTotalSize);
+        stHeader.unChunkSize  = ntohl(unChunkSize);
+
+        return stHeader.unChunkSize > 0 && stHeader.unChunkSize <= static_cast<uint32_t>(ROVECOMM_STREAM_MAX_CHUNK_SIZE);
+    }
+
+    /******************************************************************************
+     * @brief Construct a new, unconnected stream.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommTCPStream::RoveCommTCPStream()
+    {
+        m_nSocket          = -1;
+        m_unNextTransferId = 0;
+        m_siChunkSize      = ROVECOMM_STREAM_CHUNK_SIZE;
+        m_unWindowChunks   = ROVECOMM_STREAM_WINDOW_CHUNKS;
+        m_siAckReceived    = 0;
+    }
+
+    /******************************************************************************
+     * @brief Destroy the stream, closing its connection.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommTCPStream::~RoveCommTCPStream()
+    {
+        Close();
+    }
+
+    /******************************************************************************
+     * @brief Open the connection that transfers are sent over. A stream that is
+     *        already connected is closed first.
+     *
+     * @param cIPAddress - The IP address of the receiving RoveCommTCP node.
+     * @param nPort - The port the receiving node listens on.
+     * @return true - The connection is open.
+     * @return false - The address is invalid or the connection failed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStream::Connect(const char* cIPAddress, int nPort)
+    {
+        Close();
+
+        // Create a TCP socket
+        m_nSocket = socket(AF_INET, SOCK_STREAM, 0);
+        if (m_nSocket == -1)
+        {
+            perror("Failed to create TCP stream socket");
+            return false;
+        }
+
+        // Configure the receiver address
+        struct sockaddr_in saReceiverAddr;
+        memset(&saReceiverAddr, 0, sizeof(saReceiverAddr));
+        saReceiverAddr.sin_family = AF_INET;
+        saReceiverAddr.sin_port   = htons(nPort);
+        if (inet_pton(AF_INET, cIPAddress, &saReceiverAddr.sin_addr) <= 0)
+        {
+            perror("Invalid address/ Address not supported");
+            Close();
+            return false;
+        }
+
+        // A receiver that stops reading or acknowledging fails the transfer instead of blocking it forever.
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        DWORD dwTimeout = ROVECOMM_STREAM_TIMEOUT_MS;
+        setsockopt(m_nSocket, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&dwTimeout), sizeof(dwTimeout));
+        setsockopt(m_nSocket, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&dwTimeout), sizeof(dwTimeout));
+#else
+        struct timeval tvTimeout;
+        tvTimeout.tv_sec  = ROVECOMM_STREAM_TIMEOUT_MS / 1000;
+        tvTimeout.tv_usec = (ROVECOMM_STREAM_TIMEOUT_MS % 1000) * 1000;
+        setsockopt(m_nSocket, SOL_SOCKET, SO_RCVTIMEO, &tvTimeout, sizeof(tvTimeout));
+        setsockopt(m_nSocket, SOL_SOCKET, SO_SNDTIMEO, &tvTimeout, sizeof(tvTimeout));
+#endif
+
+        // Connect to the receiver
+        if (connect(m_nSocket, (struct sockaddr*) &saReceiverAddr, sizeof(saReceiverAddr)) == -1)
+        {
+            perror("TCP stream connection failed");
+            Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Check if the stream has an open connection.
+     *
+     * @return true - Transfers can be sent.
+     * @return false - Connect() was not called, or the last transfer failed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStream::IsConnected() const
+    {
+        return m_nSocket != -1;
+    }
+
+    /******************************************************************************
+     * @brief Close the stream's connection.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPStream::Close()
+    {
+        if (m_nSocket != -1)
+        {
+            CLOSE_SOCKET(m_nSocket);
+            m_nSocket = -1;
+        }
+        m_siAckReceived = 0;
+    }
+
+    /******************************************************************************
+     * @brief Set the size of the chunks the receiver acknowledges, and how many
+     *        unacknowledged chunks may be in flight. A larger window keeps a fast
+     *        link busy, a smaller one bounds the memory a slow receiver ties up.
+     *
+     * @param siChunkSize - Bytes per chunk, up to ROVECOMM_STREAM_MAX_CHUNK_SIZE.
+     * @param unWindowChunks - Chunks that may be unacknowledged, at least 1.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPStream::SetFlowControl(size_t siChunkSize, unsigned int unWindowChunks)
+    {
+        m_siChunkSize    = std::min(std::max(siChunkSize, static_cast<size_t>(1)), static_cast<size_t>(ROVECOMM_STREAM_MAX_CHUNK_SIZE));
+        m_unWindowChunks = std::max(unWindowChunks, 1u);
+    }
+
+    /******************************************************************************
+     * @brief Send a buffer as one transfer. The call returns once the receiver
+     *        has written every byte, or the transfer failed.
+     *
+     * @param unDataId - The data id of the sink the receiver writes into.
+     * @param pData - The bytes to send. They are sent from here without copying,
+     *                so they must not change until the call returns.
+     * @param siDataSize - The number of bytes to send.
+     * @param fnCallback - Called on this thread whenever more chunks have been
+     *                     acknowledged, and once when the transfer completes or
+     *                     fails. May be empty.
+     * @return true - The receiver wrote every byte.
+     * @return false - The transfer was refused or failed, and the connection was
+     *                 closed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStream::SendBuffer(uint16_t unDataId, const uint8_t* pData, size_t siDataSize, RoveCommStreamCallback fnCallback)
+    {
+        return Transfer(unDataId, pData, siDataSize, fnCallback);
+    }
+
+    /******************************************************************************
+     * @brief Send a file as one transfer. The file is mapped into memory and the
+     *        socket reads its pages straight from the page cache, so it is never
+     *        copied into a user space buffer.
+     *
+     * @param unDataId - The data id of the sink the receiver writes into.
+     * @param szPath - The path of the file to send.
+     * @param fnCallback - Called on this thread whenever more chunks have been
+     *                     acknowledged, and once when the transfer completes or
+     *                     fails. May be empty.
+     * @return true - The receiver wrote every byte.
+     * @return false - The file could not be read, or the transfer failed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStream::SendFile(uint16_t unDataId, const char* szPath, RoveCommStreamCallback fnCallback)
+    {
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        // Windows has no mmap, read the file into memory instead.
+        std::ifstream fsFile(szPath, std::ios::binary);
+        if (!fsFile)
+        {
+            perror("Failed to open file for TCP stream");
+            return false;
+        }
+        std::vector<uint8_t> vFile((std::istreambuf_iterator<char>(fsFile)), std::istreambuf_iterator<char>());
+        return Transfer(unDataId, vFile.data(), vFile.size(), fnCallback);
+#else
+        int nFileDescriptor = open(szPath, O_RDONLY | O_CLOEXEC);
+        if (nFileDescriptor == -1)
+        {
+            perror("Failed to open file for TCP stream");
+            return false;
+        }
+
+        struct stat stFileStat;
+        if (fstat(nFileDescriptor, &stFileStat) == -1)
+        {
+            perror("Failed to stat file for TCP stream");
+            close(nFileDescriptor);
+            return false;
+        }
+
+        // An empty file cannot be mapped, but is still a valid transfer.
+        size_t siFileSize = static_cast<size_t>(stFileStat.st_size);
+        if (siFileSize == 0)
+        {
+            close(nFileDescriptor);
+            return Transfer(unDataId, nullptr, 0, fnCallback);
+        }
+
+        // The mapping stays valid after the descriptor is closed.
+        void* pMapping = mmap(nullptr, siFileSize, PROT_READ, MAP_PRIVATE, nFileDescriptor, 0);
+        close(nFileDescriptor);
+        if (pMapping == MAP_FAILED)
+        {
+            perror("Failed to map file for TCP stream");
+            return false;
+        }
+        madvise(pMapping, siFileSize, MADV_SEQUENTIAL);
+
+        bool bSent = Transfer(unDataId, static_cast<const uint8_t*>(pMapping), siFileSize, fnCallback);
+        munmap(pMapping, siFileSize);
+
+        return bSent;
+#endif
+    }
+
+    /******************************************************************************
+     * @brief Send bytes on the connection, waiting until all of them are accepted
+     *        by the socket or the send timeout passes.
+     *
+     * @param pData - The bytes to send.
+     * @param siDataSize - The number of bytes to send.
+     * @return true - Every byte was sent.
+     * @return false - The connection failed or timed out.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStream::SendBytes(const uint8_t* pData, size_t siDataSize)
+    {
+        while (siDataSize > 0)
+        {
+            ssize_t siBytesSent = send(m_nSocket, reinterpret_cast<const char*>(pData), siDataSize, STREAM_SEND_FLAGS);
+            if (siBytesSent == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                perror("Failed to send TCP stream data");
+                return false;
+            }
+
+            pData += siBytesSent;
+            siDataSize -= static_cast<size_t>(siBytesSent);
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Read the acknowledgements the receiver has sent. Acknowledgements are
+     *        8 byte totals of the bytes written, so only the last one matters, but
+     *        one may arrive split across reads.
+     *
+     * @param bWait - Whether to wait until at least one acknowledgement arrives.
+     * @param unAcked - Set to the last acknowledged total.
+     * @return int - The number of acknowledgements read, or -1 if the connection
+     *               failed, timed out, or the receiver refused the transfer.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    int RoveCommTCPStream::ReadAcks(bool bWait, uint64_t& unAcked)
+    {
+        int nAcks = 0;
+        while (true)
+        {
+            ssize_t siBytesReceived = recv(m_nSocket,
+                                           reinterpret_cast<char*>(m_aAck + m_siAckReceived),
+                                           ROVECOMM_STREAM_ACK_SIZE - m_siAckReceived,
+                                           bWait ? 0 : MSG_DONTWAIT);
+            if (siBytesReceived == 0)
+            {
+                return -1;
+            }
+            if (siBytesReceived == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                if (!bWait && (errno == EAGAIN || errno == EWOULDBLOCK))
+                {
+                    return nAcks;
+                }
+                return -1;
+            }
+
+            m_siAckReceived += static_cast<size_t>(siBytesReceived);
+            if (m_siAckReceived == ROVECOMM_STREAM_ACK_SIZE)
+            {
+                m_siAckReceived = 0;
+                uint64_t unAck;
+                std::memcpy(&unAck, m_aAck, sizeof(unAck));
+                unAck = ntohll(unAck);
+                if (unAck == ROVECOMM_STREAM_REJECTED)
+                {
+                    return -1;
+                }
+
+                // Once one acknowledgement is in, only take what is already waiting.
+                unAcked = unAck;
+                bWait   = false;
+                ++nAcks;
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Send one transfer: the header, then the bytes a chunk at a time,
+     *        never getting more than the window ahead of the acknowledgements.
+     *
+     * @param unDataId - The data id of the sink the receiver writes into.
+     * @param pData - The bytes to send.
+     * @param siDataSize - The number of bytes to send.
+     * @param fnCallback - Called with the progress of the transfer. May be empty.
+     * @return true - The receiver wrote every byte.
+     * @return false - The transfer failed, and the connection was closed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStream::Transfer(uint16_t unDataId, const uint8_t* pData, size_t siDataSize, const RoveCommStreamCallback& fnCallback)
+    {
+        RoveCommStreamStatus stStatus;
+        stStatus.unDataId     = unDataId;
+        stStatus.unTransferId = m_unNextTransferId++;
+        stStatus.unBytesDone  = 0;
+        stStatus.unBytesTotal = siDataSize;
+        stStatus.eState       = eStreamInProgress;
+
+        // Report the outcome, closing the connection since its position in the stream is unknown after a failure.
+        auto fnFinish = [&](RoveCommStreamState eState)
+        {
+            if (eState == eStreamFailed)
+            {
+                Close();
+            }
+            stStatus.eState = eState;
+            if (fnCallback)
+            {
+                fnCallback(stStatus);
+            }
+            return eState == eStreamComplete;
+        };
+        if (m_nSocket == -1)
+        {
+            return fnFinish(eStreamFailed);
+        }
+
+        // Send the header and wait for the receiver to accept the transfer with an acknowledgement of 0.
+        RoveCommStreamHeader stHeader;
+        stHeader.unDataId     = unDataId;
+        stHeader.unTransferId = stStatus.unTransferId;
+        stHeader.unTotalSize  = siDataSize;
+        stHeader.unChunkSize  = static_cast<uint32_t>(m_siChunkSize);
+        uint8_t aHeader[ROVECOMM_STREAM_HEADER_SIZE];
+        PackStreamHeader(stHeader, aHeader);
+
+        uint64_t unAcked = 0;
+        if (!SendBytes(aHeader, sizeof(aHeader)) || ReadAcks(true, unAcked) <= 0 || unAcked != 0)
+        {
+            return fnFinish(eStreamFailed);
+        }
+
+        // Send the chunks, only waiting for acknowledgements once the window is full.
+        uint64_t unWindow = static_cast<uint64_t>(m_siChunkSize) * m_unWindowChunks;
+        uint64_t unSent   = 0;
+        while (unSent < siDataSize || unAcked < siDataSize)
+        {
+            bool bWait = unSent == siDataSize || unSent - unAcked >= unWindow;
+            int nAcks  = ReadAcks(bWait, unAcked);
+            if (nAcks < 0)
+            {
+                return fnFinish(eStreamFailed);
+            }
+            if (nAcks > 0 && unAcked < siDataSize && fnCallback)
+            {
+                stStatus.unBytesDone = unAcked;
+                fnCallback(stStatus);
+            }
+
+            if (unSent < siDataSize && unSent - unAcked < unWindow)
+            {
+                size_t siChunk = static_cast<size_t>(std::min<uint64_t>(m_siChunkSize, siDataSize - unSent));
+                if (!SendBytes(pData + unSent, siChunk))
+                {
+                    return fnFinish(eStreamFailed);
+                }
+                unSent += siChunk;
+            }
+        }
+
+        stStatus.unBytesDone = siDataSize;
+        return fnFinish(eStreamComplete);
+    }
+
+    /******************************************************************************
+     * @brief Construct a new, disabled stream receiver.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommTCPStreamReceiver::RoveCommTCPStreamReceiver()
+    {
+        m_nWakeupFD      = -1;
+        m_bEnabled       = false;
+        m_tmStallTimeout = std::chrono::milliseconds(ROVECOMM_STREAM_TIMEOUT_MS);
+        m_tmIdleTimeout  = std::chrono::milliseconds(ROVECOMM_STREAM_IDLE_TIMEOUT_MS);
+
+        // Initialize the statistics.
+        m_unConnectionsAccepted = 0;
+        m_unTransfersCompleted  = 0;
+        m_unTransfersRejected   = 0;
+        m_unTransfersFailed     = 0;
+        m_unBytesReceived       = 0;
+        m_unConnectionsTimedOut = 0;
+    }
+
+    /******************************************************************************
+     * @brief Destroy the stream receiver, closing every connection.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommTCPStreamReceiver::~RoveCommTCPStreamReceiver()
+    {
+        Disable();
+    }
+
+    /******************************************************************************
+     * @brief Write transfers with a data id into a buffer the application owns.
+     *        Replaces any sink the data id already has, unless a transfer into
+     *        it is in progress.
+     *
+     * @param unDataId - The data id of the transfers.
+     * @param pBuffer - Where the bytes are written. It must stay valid until the
+     *                  sink is removed and no transfer into it is in progress.
+     * @param siCapacity - The size of the buffer. Larger transfers are refused.
+     * @param fnCallback - Called on the receiver's thread for every chunk written
+     *                     and once when a transfer completes or fails. The buffer
+     *                     is only complete once eStreamComplete is reported.
+     * @return true - The sink was set.
+     * @return false - The buffer is null, or the data id's sink is busy.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStreamReceiver::SetBufferSink(uint16_t unDataId, uint8_t* pBuffer, size_t siCapacity, RoveCommStreamCallback fnCallback)
+    {
+        if (pBuffer == nullptr)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lkSinkLock(m_muSinkMutex);
+        Sink& stSink = m_mpSinks[unDataId];
+        if (stSink.bBusy)
+        {
+            return false;
+        }
+        stSink.pBuffer    = pBuffer;
+        stSink.siCapacity = siCapacity;
+        stSink.szPath.clear();
+        stSink.fnCallback = std::move(fnCallback);
+        stSink.bBusy      = false;
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Write transfers with a data id into a file. Each transfer replaces
+     *        the file's contents. Replaces any sink the data id already has,
+     *        unless a transfer into it is in progress.
+     *
+     * @param unDataId - The data id of the transfers.
+     * @param szPath - The path of the file, created if it does not exist.
+     * @param fnCallback - Called on the receiver's thread for every chunk written
+     *                     and once when a transfer completes or fails.
+     * @return true - The sink was set.
+     * @return false - The path is empty, or the data id's sink is busy.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStreamReceiver::SetFileSink(uint16_t unDataId, const std::string& szPath, RoveCommStreamCallback fnCallback)
+    {
+        if (szPath.empty())
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lkSinkLock(m_muSinkMutex);
+        Sink& stSink = m_mpSinks[unDataId];
+        if (stSink.bBusy)
+        {
+            return false;
+        }
+        stSink.pBuffer    = nullptr;
+        stSink.siCapacity = 0;
+        stSink.szPath     = szPath;
+        stSink.fnCallback = std::move(fnCallback);
+        stSink.bBusy      = false;
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Stop accepting transfers with a data id. A transfer already in
+     *        progress is still written into the old sink.
+     *
+     * @param unDataId - The data id to remove.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPStreamReceiver::RemoveSink(uint16_t unDataId)
+    {
+        std::lock_guard<std::mutex> lkSinkLock(m_muSinkMutex);
+        m_mpSinks.erase(unDataId);
+    }
+
+    /******************************************************************************
+     * @brief Take over a connection accepted by the node. The receiver owns the
+     *        socket from now on and closes it when the sender does.
+     *
+     * @param nSocket - The accepted socket, with the stream header unread.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPStreamReceiver::AddConnection(int nSocket)
+    {
+        {
+            std::lock_guard<std::mutex> lkPendingLock(m_muPendingMutex);
+            if (!m_bEnabled)
+            {
+                CLOSE_SOCKET(nSocket);
+                return;
+            }
+            m_vPendingSockets.push_back(nSocket);
+        }
+
+        m_unConnectionsAccepted.fetch_add(1, std::memory_order_relaxed);
+        WakeThread();
+    }
+
+    /******************************************************************************
+     * @brief Set how long a connection may go without receiving anything before
+     *        it is closed. Applies to open connections from the next check on.
+     *
+     * @param tmStallTimeout - The limit partway through a header or a transfer.
+     *                         A transfer that hits it fails and frees its sink.
+     * @param tmIdleTimeout - The limit between transfers.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPStreamReceiver::SetTimeouts(std::chrono::milliseconds tmStallTimeout, std::chrono::milliseconds tmIdleTimeout)
+    {
+        std::lock_guard<std::mutex> lkPendingLock(m_muPendingMutex);
+        m_tmStallTimeout = tmStallTimeout;
+        m_tmIdleTimeout  = tmIdleTimeout;
+    }
+
+    /******************************************************************************
+     * @brief Start the receiver's thread. Called once the node's socket is open.
+     *
+     * @return true - The receiver is running.
+     * @return false - The wakeup eventfd could not be created.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStreamReceiver::Enable()
+    {
+        std::lock_guard<std::mutex> lkPendingLock(m_muPendingMutex);
+        if (m_bEnabled)
+        {
+            return true;
+        }
+
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+        // Create the eventfd used to wake the thread for new connections and on shutdown.
+        m_nWakeupFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_nWakeupFD == -1)
+        {
+            perror("Failed to create TCP stream wakeup eventfd");
+            return false;
+        }
+#endif
+
+        m_bEnabled = true;
+        Start();
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Stop the receiver's thread and close every connection, failing the
+     *        transfers in progress. Called before the node's socket is closed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPStreamReceiver::Disable()
+    {
+        {
+            std::lock_guard<std::mutex> lkPendingLock(m_muPendingMutex);
+            if (!m_bEnabled)
+            {
+                return;
+            }
+            m_bEnabled = false;
+        }
+
+        RequestStop();
+        WakeThread();
+        Join();
+
+        // The thread has exited, so the connections can be closed from here.
+        for (Connection& stConnection : m_vConnections)
+        {
+            CloseConnection(stConnection);
+        }
+        m_vConnections.clear();
+        for (int nSocket : m_vPendingSockets)
+        {
+            CLOSE_SOCKET(nSocket);
+        }
+        m_vPendingSockets.clear();
+
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+        close(m_nWakeupFD);
+        m_nWakeupFD = -1;
+#endif
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the receiver's counters.
+     *
+     * @return RoveCommStreamStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommStreamStatistics RoveCommTCPStreamReceiver::GetStatistics() const
+    {
+        RoveCommStreamStatistics stStatistics;
+        stStatistics.unConnectionsAccepted = m_unConnectionsAccepted.load(std::memory_order_relaxed);
+        stStatistics.unTransfersCompleted  = m_unTransfersCompleted.load(std::memory_order_relaxed);
+        stStatistics.unTransfersRejected   = m_unTransfersRejected.load(std::memory_order_relaxed);
+        stStatistics.unTransfersFailed     = m_unTransfersFailed.load(std::memory_order_relaxed);
+        stStatistics.unBytesReceived       = m_unBytesReceived.load(std::memory_order_relaxed);
+        stStatistics.unConnectionsTimedOut = m_unConnectionsTimedOut.load(std::memory_order_relaxed);
+
+        return stStatistics;
+    }
+
+    /******************************************************************************
+     * @brief Interrupt the receiver's thread if it is waiting in poll().
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPStreamReceiver::WakeThread()
+    {
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+        if (m_nWakeupFD != -1)
+        {
+            uint64_t unWakeup = 1;
+            if (write(m_nWakeupFD, &unWakeup, sizeof(unWakeup)) == -1)
+            {
+                perror("Failed to write TCP stream wakeup eventfd");
+            }
+        }
+#endif
+    }
+
+    /******************************************************************************
+     * @brief Read as much of a transfer header as has arrived, and start the
+     *        transfer once all of it is in.
+     *
+     * @param stConnection - The connection to read from.
+     * @return true - The connection stays open.
+     * @return false - The sender closed the connection or the header was refused.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStreamReceiver::ReceiveHeader(Connection& stConnection)
+    {
+        ssize_t siBytesReceived = recv(stConnection.nSocket,
+                                       reinterpret_cast<char*>(stConnection.aHeader + stConnection.siHeaderReceived),
+                                       ROVECOMM_STREAM_HEADER_SIZE - stConnection.siHeaderReceived,
+                                       MSG_DONTWAIT);
+        if (siBytesReceived == 0)
+        {
+            return false;
+        }
+        if (siBytesReceived == -1)
+        {
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        }
+
+        stConnection.siHeaderReceived += static_cast<size_t>(siBytesReceived);
+        stConnection.tmLastProgress = std::chrono::steady_clock::now();
+        if (stConnection.siHeaderReceived < ROVECOMM_STREAM_HEADER_SIZE)
+        {
+            return true;
+        }
+        stConnection.siHeaderReceived = 0;
+
+        if (!UnpackStreamHeader(stConnection.aHeader, ROVECOMM_STREAM_HEADER_SIZE, stConnection.stHeader))
+        {
+            m_unTransfersRejected.fetch_add(1, std::memory_order_relaxed);
+            SendAck(stConnection, ROVECOMM_STREAM_REJECTED);
+            return false;
+        }
+
+        return StartTransfer(stConnection);
+    }
+
+    /******************************************************************************
+     * @brief Claim the sink of a transfer whose header has arrived, and accept
+     *        the transfer with an acknowledgement of 0, or refuse it.
+     *
+     * @param stConnection - The connection the header arrived on.
+     * @return true - The transfer was accepted.
+     * @return false - The transfer was refused, and the connection must be closed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStreamReceiver::StartTransfer(Connection& stConnection)
+    {
+        const RoveCommStreamHeader& stHeader = stConnection.stHeader;
+
+        // Claim the sink, so a second sender cannot write into it at the same time.
+        bool bAccepted = false;
+        {
+            std::lock_guard<std::mutex> lkSinkLock(m_muSinkMutex);
+            std::map<uint16_t, Sink>::iterator itSink = m_mpSinks.find(stHeader.unDataId);
+            if (itSink != m_mpSinks.end() && !itSink->second.bBusy && (itSink->second.pBuffer == nullptr || stHeader.unTotalSize <= itSink->second.siCapacity))
+            {
+                itSink->second.bBusy = true;
+                stConnection.stSink  = itSink->second;
+                bAccepted            = true;
+            }
+        }
+        if (!bAccepted)
+        {
+            m_unTransfersRejected.fetch_add(1, std::memory_order_relaxed);
+            SendAck(stConnection, ROVECOMM_STREAM_REJECTED);
+            return false;
+        }
+
+        stConnection.bInTransfer     = true;
+        stConnection.unBytesReceived = 0;
+
+        // Open the file of a file sink, replacing its contents.
+        if (stConnection.stSink.pBuffer == nullptr)
+        {
+            stConnection.nFileDescriptor = open(stConnection.stSink.szPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (stConnection.nFileDescriptor == -1)
+            {
+                perror("Failed to open TCP stream file sink");
+                SendAck(stConnection, ROVECOMM_STREAM_REJECTED);
+                FinishTransfer(stConnection, eStreamFailed);
+                return false;
+            }
+        }
+
+        // An empty transfer is complete as soon as it is accepted.
+        if (stHeader.unTotalSize == 0)
+        {
+            FinishTransfer(stConnection, eStreamComplete);
+            return SendAck(stConnection, 0);
+        }
+
+        if (!SendAck(stConnection, 0))
+        {
+            FinishTransfer(stConnection, eStreamFailed);
+            return false;
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Move bytes that have arrived into a file sink. On Linux they are
+     *        spliced from the socket through a pipe into the file, so they never
+     *        enter user space. Where splicing is not supported, they are read
+     *        into a bounce buffer and written from there.
+     *
+     * @param stConnection - The connection to read from.
+     * @param siWanted - The most bytes to move.
+     * @param bWriteFailed - Set to true if the file could not be written.
+     * @return ssize_t - The number of bytes moved, 0 if the sender closed the
+     *                   connection, or -1 with errno set if the read failed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    ssize_t RoveCommTCPStreamReceiver::ReceiveToFile(Connection& stConnection, size_t siWanted, bool& bWriteFailed)
+    {
+#if defined(__linux__)
+        // The pipe is created with the first transfer and reused for the rest of the connection.
+        if (stConnection.bSplice && stConnection.aPipe[0] == -1)
+        {
+            if (pipe2(stConnection.aPipe, O_NONBLOCK | O_CLOEXEC) == -1)
+            {
+                stConnection.bSplice = false;
+            }
+            else
+            {
+                // A pipe as large as a chunk needs fewer splices. The default size still works if this is not allowed.
+                fcntl(stConnection.aPipe[1], F_SETPIPE_SZ, static_cast<int>(stConnection.stHeader.unChunkSize));
+            }
+        }
+
+        if (stConnection.bSplice)
+        {
+            ssize_t siBytesMoved = splice(stConnection.nSocket, nullptr, stConnection.aPipe[1], nullptr, siWanted, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+            if (siBytesMoved == -1 && errno == EINVAL)
+            {
+                stConnection.bSplice = false;
+            }
+            else
+            {
+                // Drain the pipe into the file before the next splice.
+                ssize_t siBytesLeft = siBytesMoved;
+                while (siBytesLeft > 0)
+                {
+                    ssize_t siBytesWritten = splice(stConnection.aPipe[0], nullptr, stConnection.nFileDescriptor, nullptr, siBytesLeft, SPLICE_F_MOVE);
+                    if (siBytesWritten <= 0)
+                    {
+                        if (siBytesWritten == -1 && errno == EINTR)
+                        {
+                            continue;
+                        }
+                        perror("Failed to write TCP stream file sink");
+                        bWriteFailed = true;
+                        break;
+                    }
+                    siBytesLeft -= siBytesWritten;
+                }
+
+                return siBytesMoved;
+            }
+        }
+#endif
+
+        if (m_vBounceBuffer.empty())
+        {
+            m_vBounceBuffer.resize(ROVECOMM_STREAM_CHUNK_SIZE);
+        }
+        siWanted                = std::min(siWanted, m_vBounceBuffer.size());
+        ssize_t siBytesReceived = recv(stConnection.nSocket, reinterpret_cast<char*>(m_vBounceBuffer.data()), siWanted, MSG_DONTWAIT);
+        ssize_t siBytesWritten  = 0;
+        while (siBytesWritten < siBytesReceived)
+        {
+            ssize_t siWritten = write(stConnection.nFileDescriptor, m_vBounceBuffer.data() + siBytesWritten, siBytesReceived - siBytesWritten);
+            if (siWritten == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                perror("Failed to write TCP stream file sink");
+                bWriteFailed = true;
+                break;
+            }
+            siBytesWritten += siWritten;
+        }
+
+        return siBytesReceived;
+    }
+
+    /******************************************************************************
+     * @brief Move the bytes that have arrived into the transfer's sink, up to the
+     *        end of the current chunk, and acknowledge the chunk once it is full.
+     *
+     * @param stConnection - The connection to read from.
+     * @return true - The connection stays open.
+     * @return false - The transfer failed, and the connection must be closed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStreamReceiver::ReceivePayload(Connection& stConnection)
+    {
+        const RoveCommStreamHeader& stHeader = stConnection.stHeader;
+
+        while (true)
+        {
+            // Never read past the end of the chunk, so every acknowledgement lands on a chunk boundary.
+            uint64_t unRemaining  = stHeader.unTotalSize - stConnection.unBytesReceived;
+            uint64_t unToBoundary = stHeader.unChunkSize - stConnection.unBytesReceived % stHeader.unChunkSize;
+            size_t siWanted       = static_cast<size_t>(std::min(unRemaining, unToBoundary));
+
+            bool bWriteFailed = false;
+            ssize_t siBytesReceived;
+            if (stConnection.stSink.pBuffer != nullptr)
+            {
+                siBytesReceived = recv(stConnection.nSocket, reinterpret_cast<char*>(stConnection.stSink.pBuffer + stConnection.unBytesReceived), siWanted, MSG_DONTWAIT);
+            }
+            else
+            {
+                siBytesReceived = ReceiveToFile(stConnection, siWanted, bWriteFailed);
+            }
+
+            if (siBytesReceived == -1 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+            {
+                return true;
+            }
+            if (siBytesReceived <= 0 || bWriteFailed)
+            {
+                FinishTransfer(stConnection, eStreamFailed);
+                return false;
+            }
+
+            stConnection.unBytesReceived += static_cast<uint64_t>(siBytesReceived);
+            stConnection.tmLastProgress = std::chrono::steady_clock::now();
+            m_unBytesReceived.fetch_add(static_cast<uint64_t>(siBytesReceived), std::memory_order_relaxed);
+
+            // The sink is released and its callback run before the sender hears that the transfer is complete.
+            if (stConnection.unBytesReceived == stHeader.unTotalSize)
+            {
+                FinishTransfer(stConnection, eStreamComplete);
+                return SendAck(stConnection, stConnection.unBytesReceived);
+            }
+            if (stConnection.unBytesReceived % stHeader.unChunkSize == 0)
+            {
+                if (!SendAck(stConnection, stConnection.unBytesReceived))
+                {
+                    FinishTransfer(stConnection, eStreamFailed);
+                    return false;
+                }
+
+                if (stConnection.stSink.fnCallback)
+                {
+                    RoveCommStreamStatus stStatus;
+                    stStatus.unDataId     = stHeader.unDataId;
+                    stStatus.unTransferId = stHeader.unTransferId;
+                    stStatus.unBytesDone  = stConnection.unBytesReceived;
+                    stStatus.unBytesTotal = stHeader.unTotalSize;
+                    stStatus.eState       = eStreamInProgress;
+                    stConnection.stSink.fnCallback(stStatus);
+                }
+
+                // Give the other connections a turn after every chunk.
+                return true;
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Send an acknowledgement to the sender. The sender never has more
+     *        than a window of chunks unacknowledged, so there is always room for
+     *        it in the socket buffer.
+     *
+     * @param stConnection - The connection to acknowledge on.
+     * @param unAck - The total bytes written, or ROVECOMM_STREAM_REJECTED.
+     * @return true - The acknowledgement was sent.
+     * @return false - The connection failed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommTCPStreamReceiver::SendAck(Connection& stConnection, uint64_t unAck)
+    {
+        uint64_t unNetworkAck = htonll(unAck);
+        return send(stConnection.nSocket, reinterpret_cast<const char*>(&unNetworkAck), sizeof(unNetworkAck), STREAM_SEND_FLAGS | MSG_DONTWAIT) ==
+               static_cast<ssize_t>(sizeof(unNetworkAck));
+    }
+
+    /******************************************************************************
+     * @brief End the transfer in progress on a connection, releasing its sink and
+     *        reporting the outcome to the sink's callback.
+     *
+     * @param stConnection - The connection whose transfer ended.
+     * @param eState - eStreamComplete or eStreamFailed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPStreamReceiver::FinishTransfer(Connection& stConnection, RoveCommStreamState eState)
+    {
+        if (stConnection.nFileDescriptor != -1)
+        {
+            close(stConnection.nFileDescriptor);
+            stConnection.nFileDescriptor = -1;
+        }
+
+        {
+            std::lock_guard<std::mutex> lkSinkLock(m_muSinkMutex);
+            std::map<uint16_t, Sink>::iterator itSink = m_mpSinks.find(stConnection.stHeader.unDataId);
+            if (itSink != m_mpSinks.end())
+            {
+                itSink->second.bBusy = false;
+            }
+        }
+
+        if (eState == eStreamComplete)
+        {
+            m_unTransfersCompleted.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            m_unTransfersFailed.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        stConnection.bInTransfer = false;
+        if (stConnection.stSink.fnCallback)
+        {
+            RoveCommStreamStatus stStatus;
+            stStatus.unDataId     = stConnection.stHeader.unDataId;
+            stStatus.unTransferId = stConnection.stHeader.unTransferId;
+            stStatus.unBytesDone  = stConnection.unBytesReceived;
+            stStatus.unBytesTotal = stConnection.stHeader.unTotalSize;
+            stStatus.eState       = eState;
+            stConnection.stSink.fnCallback(stStatus);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Close a connection, failing its transfer if one is in progress.
+     *
+     * @param stConnection - The connection to close.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPStreamReceiver::CloseConnection(Connection& stConnection)
+    {
+        if (stConnection.bInTransfer)
+        {
+            FinishTransfer(stConnection, eStreamFailed);
+        }
+
+        for (int& nPipe : stConnection.aPipe)
+        {
+            if (nPipe != -1)
+            {
+                close(nPipe);
+                nPipe = -1;
+            }
+        }
+
+        CLOSE_SOCKET(stConnection.nSocket);
+        stConnection.nSocket = -1;
+    }
+
+    /******************************************************************************
+     * @brief Adopt new connections, wait until any connection has data, and move
+     *        it into the sinks. Connections that have received nothing for longer
+     *        than their timeout are closed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPStreamReceiver::ThreadedContinuousCode()
+    {
+        // Adopt the connections handed over by the node since the last wait.
+        std::chrono::milliseconds tmStallTimeout;
+        std::chrono::milliseconds tmIdleTimeout;
+        {
+            std::lock_guard<std::mutex> lkPendingLock(m_muPendingMutex);
+            tmStallTimeout = m_tmStallTimeout;
+            tmIdleTimeout  = m_tmIdleTimeout;
+            for (int nSocket : m_vPendingSockets)
+            {
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+                // Splicing from a blocking socket can block, whatever flags it is called with.
+                fcntl(nSocket, F_SETFL, fcntl(nSocket, F_GETFL) | O_NONBLOCK);
+#endif
+                Connection stConnection;
+                stConnection.nSocket          = nSocket;
+                stConnection.siHeaderReceived = 0;
+                stConnection.bInTransfer      = false;
+                stConnection.nFileDescriptor  = -1;
+                stConnection.unBytesReceived  = 0;
+                stConnection.aPipe[0]         = -1;
+                stConnection.aPipe[1]         = -1;
+                stConnection.bSplice          = true;
+                stConnection.tmLastProgress   = std::chrono::steady_clock::now();
+                m_vConnections.push_back(std::move(stConnection));
+            }
+            m_vPendingSockets.clear();
+        }
+
+        // Wait on every connection and the wakeup eventfd, which is always the first entry.
+        std::vector<pollfd_t> vPollFDs;
+        vPollFDs.reserve(m_vConnections.size() + 1);
+        pollfd_t stPollFD;
+        stPollFD.fd      = m_nWakeupFD;
+        stPollFD.events  = POLLIN;
+        stPollFD.revents = 0;
+        vPollFDs.push_back(stPollFD);
+        for (const Connection& stConnection : m_vConnections)
+        {
+            stPollFD.fd = stConnection.nSocket;
+            vPollFDs.push_back(stPollFD);
+        }
+
+        // Wake up in time to close the connection that stalls first.
+        std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+        int nTimeoutMs                              = ROVECOMM_EVENT_WAIT_TIMEOUT_MS;
+        for (const Connection& stConnection : m_vConnections)
+        {
+            std::chrono::milliseconds tmTimeout = stConnection.bInTransfer || stConnection.siHeaderReceived > 0 ? tmStallTimeout : tmIdleTimeout;
+            std::chrono::milliseconds tmLeft    = std::chrono::duration_cast<std::chrono::milliseconds>(stConnection.tmLastProgress + tmTimeout - tmNow);
+            nTimeoutMs                          = static_cast<int>(std::max<int64_t>(0, std::min<int64_t>(nTimeoutMs, tmLeft.count() + 1)));
+        }
+
+        int nReady = poll(vPollFDs.data(), vPollFDs.size(), nTimeoutMs);
+        if (nReady < 0)
+        {
+            return;
+        }
+
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+        if (vPollFDs[0].revents != 0)
+        {
+            // Consume the wakeup so the next wait blocks again.
+            uint64_t unWakeups;
+            if (read(m_nWakeupFD, &unWakeups, sizeof(unWakeups)) == -1 && errno != EAGAIN)
+            {
+                perror("Failed to read TCP stream wakeup eventfd");
+            }
+        }
+#endif
+
+        // Serve every connection with data, then drop the ones that were closed.
+        for (size_t siIter = 0; siIter < m_vConnections.size(); ++siIter)
+        {
+            if (vPollFDs[siIter + 1].revents == 0)
+            {
+                continue;
+            }
+
+            Connection& stConnection = m_vConnections[siIter];
+            bool bOpen               = stConnection.bInTransfer ? ReceivePayload(stConnection) : ReceiveHeader(stConnection);
+            if (!bOpen)
+            {
+                CloseConnection(stConnection);
+            }
+        }
+
+        // Close the connections that stalled partway through a header or a transfer, or idled too long between transfers.
+        tmNow = std::chrono::steady_clock::now();
+        for (Connection& stConnection : m_vConnections)
+        {
+            std::chrono::milliseconds tmTimeout = stConnection.bInTransfer || stConnection.siHeaderReceived > 0 ? tmStallTimeout : tmIdleTimeout;
+            if (stConnection.nSocket != -1 && tmNow - stConnection.tmLastProgress >= tmTimeout)
+            {
+                m_unConnectionsTimedOut.fetch_add(1, std::memory_order_relaxed);
+                CloseConnection(stConnection);
+            }
+        }
+        m_vConnections.erase(std::remove_if(m_vConnections.begin(), m_vConnections.end(), [](const Connection& stConnection) { return stConnection.nSocket == -1; }),
+                             m_vConnections.end());
+    }
+
+    /******************************************************************************
+     * @brief The stream receiver does not use the thread pool.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommTCPStreamReceiver::PooledLinearCode() {}
+}    // namespace rovecomm
@@ -0,0 +1,260 @@
+/******************************************************************************
+ * @brief Bulk transfers of large buffers and files over a persistent TCP
+ *        connection. The RoveCommTCPStream class sends them and the
+ *        RoveCommTCPStreamReceiver class writes them straight into a buffer or
+ *        file registered by the application.
+ *
+ * @file RoveCommTCPStream.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_TCP_STREAM_H
+#define ROVECOMM_TCP_STREAM_H
+
+#include "ExternalIncludes.h"
+#include "RoveCommConsts.h"
+#include "RoveCommPacket.h"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief The header in front of every stream transfer. On the wire it is
+     *        [ROVECOMM_STREAM_VERSION][data id 2][transfer id 4][size 8][chunk 4],
+     *        big endian, followed by the raw bytes of the transfer.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    struct RoveCommStreamHeader
+    {
+        public:
+            uint16_t unDataId;        // Selects the sink the receiver writes the transfer into.
+            uint32_t unTransferId;    // Chosen by the sender, counts up on each connection.
+            uint64_t unTotalSize;     // The number of bytes that follow the header.
+            uint32_t unChunkSize;     // The receiver acknowledges every time this many more bytes are written.
+    };
+
+    // Stream header functions
+    void PackStreamHeader(const RoveCommStreamHeader& stHeader, uint8_t* pBuffer);
+    bool UnpackStreamHeader(const uint8_t* pData, size_t siDataSize, RoveCommStreamHeader& stHeader);
+
+    // Define the states a transfer reports to its callback.
+    enum RoveCommStreamState
+    {
+        eStreamInProgress,    // More chunks were written.
+        eStreamComplete,      // Every byte was written by the receiver.
+        eStreamFailed         // The transfer was refused, timed out or the connection was lost.
+    };
+
+    // Define the progress of a transfer, as reported to its callback.
+    struct RoveCommStreamStatus
+    {
+        public:
+            uint16_t unDataId;
+            uint32_t unTransferId;
+            uint64_t unBytesDone;     // Bytes written by the receiver so far.
+            uint64_t unBytesTotal;    // Bytes in the whole transfer.
+            RoveCommStreamState eState;
+    };
+
+    // Define the callback type used by both ends to report progress.
+    using RoveCommStreamCallback = std::function<void(const RoveCommStreamStatus&)>;
+
+    // Define a struct for reporting a snapshot of a stream receiver's counters.
+    struct RoveCommStreamStatistics
+    {
+        public:
+            uint64_t unConnectionsAccepted;    // Stream connections handed to the receiver.
+            uint64_t unTransfersCompleted;     // Transfers written in full.
+            uint64_t unTransfersRejected;      // Transfers refused for having no free sink large enough.
+            uint64_t unTransfersFailed;        // Transfers cut short by the connection, a write error or a stall.
+            uint64_t unBytesReceived;          // Payload bytes written into sinks.
+            uint64_t unConnectionsTimedOut;    // Connections closed for stalling mid-header or mid-transfer, or idling too long.
+    };
+
+    /******************************************************************************
+     * @brief The sending end of a stream. One object holds one connection, which
+     *        stays open for any number of transfers. A transfer sends a header and
+     *        waits for the receiver to accept it, then sends the bytes in chunks.
+     *        The receiver acknowledges each chunk once it is written, and the
+     *        sender stops when a window of chunks is unacknowledged, so a slow
+     *        receiver holds the sender back instead of filling its socket buffers.
+     *
+     *        Buffers are sent from where they are and files are mapped into memory
+     *        and sent the same way, so neither is copied in user space.
+     *
+     * @note A failed transfer closes the connection, Connect() must be called
+     *       again before the next one. Transfers on one object must not overlap.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommTCPStream
+    {
+        private:
+            // Private member variables
+            int m_nSocket;
+            uint32_t m_unNextTransferId;
+            size_t m_siChunkSize;
+            unsigned int m_unWindowChunks;
+            uint8_t m_aAck[ROVECOMM_STREAM_ACK_SIZE];
+            size_t m_siAckReceived;
+
+            // Transfer functions
+            bool SendBytes(const uint8_t* pData, size_t siDataSize);
+            int ReadAcks(bool bWait, uint64_t& unAcked);
+            bool Transfer(uint16_t unDataId, const uint8_t* pData, size_t siDataSize, const RoveCommStreamCallback& fnCallback);
+
+        public:
+            // Constructor
+            RoveCommTCPStream();
+            RoveCommTCPStream(const RoveCommTCPStream&)            = delete;
+            RoveCommTCPStream& operator=(const RoveCommTCPStream&) = delete;
+            // Destructor
+            ~RoveCommTCPStream();
+
+            // Connection functions
+            bool Connect(const char* cIPAddress, int nPort);
+            bool IsConnected() const;
+            void Close();
+
+            // Configuration functions
+            void SetFlowControl(size_t siChunkSize, unsigned int unWindowChunks);
+
+            // Transfer functions
+            bool SendBuffer(uint16_t unDataId, const uint8_t* pData, size_t siDataSize, RoveCommStreamCallback fnCallback = nullptr);
+            bool SendFile(uint16_t unDataId, const char* szPath, RoveCommStreamCallback fnCallback = nullptr);
+    };
+
+    /******************************************************************************
+     * @brief The receiving end of streams. A RoveCommTCP node hands it every
+     *        connection that starts with ROVECOMM_STREAM_VERSION, and one thread
+     *        serves all of them. Each transfer is written straight into the sink
+     *        registered for its data id: a buffer the application owns, or a file
+     *        that is spliced to from the socket without passing through user space.
+     *
+     *        A transfer is refused if its data id has no sink, if the sink is
+     *        busy with another transfer, or if it is larger than the sink's buffer.
+     *
+     *        A connection that stops sending partway through a header or a
+     *        transfer is closed once the stall timeout passes, failing the
+     *        transfer and freeing its sink. A connection between transfers is
+     *        closed once the idle timeout passes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommTCPStreamReceiver : AutonomyThread<void>
+    {
+        private:
+            struct Sink
+            {
+                public:
+                    uint8_t* pBuffer;
+                    size_t siCapacity;
+                    std::string szPath;
+                    RoveCommStreamCallback fnCallback;
+                    bool bBusy;
+            };
+
+            struct Connection
+            {
+                public:
+                    int nSocket;
+                    uint8_t aHeader[ROVECOMM_STREAM_HEADER_SIZE];
+                    size_t siHeaderReceived;
+                    bool bInTransfer;
+                    RoveCommStreamHeader stHeader;
+                    Sink stSink;
+                    int nFileDescriptor;
+                    uint64_t unBytesReceived;
+                    int aPipe[2];
+                    bool bSplice;
+                    std::chrono::steady_clock::time_point tmLastProgress;
+            };
+
+            // Private member variables
+            std::mutex m_muSinkMutex;
+            std::map<uint16_t, Sink> m_mpSinks;
+            std::mutex m_muPendingMutex;
+            std::vector<int> m_vPendingSockets;
+            std::vector<Connection> m_vConnections;
+            std::vector<uint8_t> m_vBounceBuffer;
+            int m_nWakeupFD;
+            bool m_bEnabled;
+            std::chrono::milliseconds m_tmStallTimeout;
+            std::chrono::milliseconds m_tmIdleTimeout;
+
+            // Statistics counters.
+            std::atomic<uint64_t> m_unConnectionsAccepted;
+            std::atomic<uint64_t> m_unTransfersCompleted;
+            std::atomic<uint64_t> m_unTransfersRejected;
+            std::atomic<uint64_t> m_unTransfersFailed;
+            std::atomic<uint64_t> m_unBytesReceived;
+            std::atomic<uint64_t> m_unConnectionsTimedOut;
+
+            // Connection functions
+            bool ReceiveHeader(Connection& stConnection);
+            bool StartTransfer(Connection& stConnection);
+            bool ReceivePayload(Connection& stConnection);
+            ssize_t ReceiveToFile(Connection& stConnection, size_t siWanted, bool& bWriteFailed);
+            bool SendAck(Connection& stConnection, uint64_t unAck);
+            void FinishTransfer(Connection& stConnection, RoveCommStreamState eState);
+            void CloseConnection(Connection& stConnection);
+            void WakeThread();
+
+            // AutonomyThread member functions
+            void ThreadedContinuousCode() override;
+            void PooledLinearCode() override;
+
+        public:
+            // Constructor
+            RoveCommTCPStreamReceiver();
+            RoveCommTCPStreamReceiver(const RoveCommTCPStreamReceiver&)            = delete;
+            RoveCommTCPStreamReceiver& operator=(const RoveCommTCPStreamReceiver&) = delete;
+            // Destructor
+            ~RoveCommTCPStreamReceiver();
+
+            // Sink functions
+            bool SetBufferSink(uint16_t unDataId, uint8_t* pBuffer, size_t siCapacity, RoveCommStreamCallback fnCallback);
+            bool SetFileSink(uint16_t unDataId, const std::string& szPath, RoveCommStreamCallback fnCallback);
+            void RemoveSink(uint16_t unDataId);
+
+            // Connection functions
+            void AddConnection(int nSocket);
+            void SetTimeouts(std::chrono::milliseconds tmStallTimeout, std::chrono::milliseconds tmIdleTimeout);
+
+            // Lifetime functions
+            bool Enable();
+            void Disable();
+
+            // Accessors
+            RoveCommStreamStatistics GetStatistics() const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_TCP_STREAM_H
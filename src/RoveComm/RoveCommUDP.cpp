@@ -17,6 +17,9 @@ typedef SOCKET socket_t;
 #define CLOSE_SOCKET   closesocket
 #define GET_LAST_ERROR WSAGetLastError()
 #else
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 typedef int socket_t;
 #define CLOSE_SOCKET   close
 #define GET_LAST_ERROR errno
@@ -37,428 +40,2310 @@ namespace rovecomm
      *
      *
      * @author clayjay3 (claytonraycowen@gmail.com)
-     * @date 2024-03-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    RoveCommUDP::RoveCommUDP()
+    RoveCommUDP::RoveCommUDP() :
+        m_stPublishers(
+            [this](const RoveCommUDPBatch& stBatch)
+            {
+                // Report a partial send, but not packets the send filter held back.
+                size_t siExpected;
+                return static_cast<size_t>(SendUDPBatchEntries(stBatch, siExpected)) >= siExpected;
+            }),
+        m_stCoalescer([this](const uint8_t* pData, size_t siDataSize) { SendToCoalescedSubscribers(pData, siDataSize); })
     {
         // Initialize member variables.
-        m_nUDPSocket = -1;
+        m_nUDPSocket   = -1;
+        m_eReceiveMode = eEventDriven;
+        m_nEpollFD     = -1;
+        m_nWakeupFD    = -1;
+
+        // Callbacks run on the receive thread until SetCallbackDispatch() is called.
+        m_unDispatchThreads = 0;
+        m_aDedicatedDispatchLanes.fill(false);
+
+        // Fragmented packets are numbered from zero.
+        m_unNextMessageId = 0;
+
+        // Initialize the receive batch and statistics.
+        m_unReceiveBatchSize = rovecomm::ROVECOMM_UDP_RECEIVE_BATCH_SIZE;
+        m_unPacketsReceived  = 0;
+        m_unReceiveSyscalls  = 0;
+        m_unWaitSyscalls     = 0;
+        m_unPacketsSent      = 0;
+        m_unFragmentsSkipped = 0;
+        m_unSendSyscalls     = 0;
 
         // Set an IPS cap in the backend RoveComm thread.
         this->SetMainThreadIPSLimit(rovecomm::ROVECOMM_THREAD_MAX_IPS);
     }
 
     /******************************************************************************
-     * @brief Destroy the RoveCommUDP::RoveCommUDP object.
+     * @brief Destroy the RoveCommUDP::RoveCommUDP object.
+     *
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @date 2024-02-07
+     ******************************************************************************/
+    RoveCommUDP::~RoveCommUDP()
+    {
+        CloseUDPSocket();
+    }
+
+    /******************************************************************************
+     * @brief Select how the receive thread waits for incoming datagrams. In
+     *        eEventDriven mode (the default) the thread sleeps in the kernel until
+     *        the socket becomes readable and then drains every queued datagram. In
+     *        eNonBlockingPoll mode the thread performs one non-blocking read per
+     *        iteration and is capped at ROVECOMM_THREAD_MAX_IPS.
+     *
+     * @param eMode - The receive mode to use.
+     * @return true - The receive mode was changed.
+     * @return false - The socket is open, so the receive thread is already
+     *                 waiting in the current mode.
+     *
+     * @note This must be called before InitUDPSocket().
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::SetReceiveMode(UDPReceiveMode eMode)
+    {
+        if (m_nUDPSocket != -1)
+        {
+            std::cerr << "Cannot change the receive mode while the UDP socket is open." << std::endl;
+            return false;
+        }
+
+        m_eReceiveMode = eMode;
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Get the receive mode used by this node.
+     *
+     * @return UDPReceiveMode - The current receive mode.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommUDP::UDPReceiveMode RoveCommUDP::GetReceiveMode() const
+    {
+        return m_eReceiveMode;
+    }
+
+    /******************************************************************************
+     * @brief Set the maximum number of datagrams the event-driven receive mode
+     *        reads per syscall. Each slot in the batch owns a preallocated receive
+     *        buffer, so larger batches trade memory for fewer syscalls under bursts.
+     *
+     * @param unBatchSize - The number of datagrams per batch. Values below 1 are
+     *                      treated as 1, which reads one datagram per recvfrom.
+     * @return true - The batch size was changed.
+     * @return false - The socket is open, so the receive batch is already
+     *                 allocated and in use by the receive thread.
+     *
+     * @note This must be called before InitUDPSocket().
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::SetReceiveBatchSize(unsigned int unBatchSize)
+    {
+        if (m_nUDPSocket != -1)
+        {
+            std::cerr << "Cannot change the receive batch size while the UDP socket is open." << std::endl;
+            return false;
+        }
+
+        m_unReceiveBatchSize = std::max(1u, unBatchSize);
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Get the maximum number of datagrams read per receive syscall.
+     *
+     * @return unsigned int - The receive batch size.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    unsigned int RoveCommUDP::GetReceiveBatchSize() const
+    {
+        return m_unReceiveBatchSize;
+    }
+
+    /******************************************************************************
+     * @brief Choose where callbacks run. By default they run on the receive thread,
+     *        so a slow callback stops the socket from being drained. With one or
+     *        more worker threads, the receive thread copies each packet into a
+     *        bounded dispatch queue and the workers run the callbacks. There is
+     *        one queue per priority class, and the workers always take the
+     *        highest priority packet first, see SetDataIdPriority().
+     *
+     * @param unWorkerThreads - The number of threads that run callbacks. Pass 0 to
+     *                          run callbacks on the receive thread.
+     * @param siQueueCapacity - The number of packets each priority's queue can hold.
+     * @param ePolicy - What the receive thread does when a queue is full.
+     * @return true - The dispatch was set.
+     * @return false - The socket is open. The receive thread and the workers use
+     *                 the dispatcher until CloseUDPSocket(), so it cannot be
+     *                 replaced until then.
+     *
+     * @note This must be called before InitUDPSocket(). With more than one
+     *       worker, callbacks can run concurrently and packets can be handled
+     *       out of order, so callbacks must be thread safe.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::SetCallbackDispatch(unsigned int unWorkerThreads, size_t siQueueCapacity, RoveCommOverflowPolicy ePolicy)
+    {
+        if (m_nUDPSocket != -1)
+        {
+            std::cerr << "Cannot change the callback dispatch while the UDP socket is open." << std::endl;
+            return false;
+        }
+
+        m_unDispatchThreads = unWorkerThreads;
+        m_pDispatcher.reset();
+        if (unWorkerThreads > 0)
+        {
+            m_pDispatcher = std::make_unique<RoveCommPriorityDispatcher>(m_stPriorities, siQueueCapacity, ePolicy);
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Get the number of worker threads that run callbacks.
+     *
+     * @return unsigned int - The number of workers, 0 if callbacks run on the
+     *                        receive thread.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    unsigned int RoveCommUDP::GetCallbackDispatchThreads() const
+    {
+        return m_unDispatchThreads;
+    }
+
+    /******************************************************************************
+     * @brief Give a priority class a dispatch thread of its own, in addition to the
+     *        workers set with SetCallbackDispatch(). Its packets are then handled
+     *        even while every shared worker is stuck in a slow callback.
+     *
+     * @param ePriority - The priority class to serve.
+     * @param bDedicated - Whether the priority class gets a dedicated thread.
+     *
+     * @note This must be called before InitUDPSocket() to take effect, and only has
+     *       an effect once SetCallbackDispatch() enabled the worker threads.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::SetDedicatedDispatchThread(RoveCommPriority ePriority, bool bDedicated)
+    {
+        m_aDedicatedDispatchLanes[ePriority] = bDedicated;
+    }
+
+    /******************************************************************************
+     * @brief Set the priority class that packets with a data id are dispatched
+     *        with. Data ids default to ePriorityNormal. Priorities only apply when
+     *        callbacks run on worker threads, and can be changed at any time.
+     *
+     * @param unDataId - The data id to classify.
+     * @param ePriority - The priority its packets are dispatched with.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::SetDataIdPriority(uint16_t unDataId, RoveCommPriority ePriority)
+    {
+        m_stPriorities.SetPriority(unDataId, ePriority);
+    }
+
+    /******************************************************************************
+     * @brief Set the priority class of every data id in a manifest map, such as
+     *        manifest::Core::TELEMETRY.
+     *
+     * @param mpEntries - The manifest entries to classify.
+     * @param ePriority - The priority their packets are dispatched with.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::SetDataIdPriority(const std::map<std::string, manifest::ManifestEntry>& mpEntries, RoveCommPriority ePriority)
+    {
+        m_stPriorities.SetPriority(mpEntries, ePriority);
+    }
+
+    /******************************************************************************
+     * @brief Classify a board from its manifest split, so that its commands are
+     *        dispatched ahead of its errors, and its errors ahead of its telemetry.
+     *
+     * @param mpCommands - The board's COMMANDS map, dispatched at ePriorityHigh.
+     * @param mpTelemetry - The board's TELEMETRY map, dispatched at ePriorityLow.
+     * @param mpErrors - The board's ERROR map, dispatched at ePriorityNormal.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::SetManifestPriorities(const std::map<std::string, manifest::ManifestEntry>& mpCommands,
+                                            const std::map<std::string, manifest::ManifestEntry>& mpTelemetry,
+                                            const std::map<std::string, manifest::ManifestEntry>& mpErrors)
+    {
+        m_stPriorities.SetManifestPriorities(mpCommands, mpTelemetry, mpErrors);
+    }
+
+    /******************************************************************************
+     * @brief Get the priority class that packets with a data id are dispatched with.
+     *
+     * @param unDataId - The data id to look up.
+     * @return RoveCommPriority - Its priority.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommPriority RoveCommUDP::GetDataIdPriority(uint16_t unDataId) const
+    {
+        return m_stPriorities.GetPriority(unDataId);
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of this node's receive counters. The syscalls per packet
+     *        ratio counts both the reads and the event waits that were needed to
+     *        receive every packet so far.
+     *
+     * @return UDPStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommUDP::UDPStatistics RoveCommUDP::GetStatistics() const
+    {
+        UDPStatistics stStatistics;
+        stStatistics.unPacketsReceived  = m_unPacketsReceived;
+        stStatistics.unReceiveSyscalls  = m_unReceiveSyscalls;
+        stStatistics.unWaitSyscalls     = m_unWaitSyscalls;
+        stStatistics.dSyscallsPerPacket = 0.0;
+        stStatistics.unPacketsSent      = m_unPacketsSent;
+        stStatistics.unSendSyscalls     = m_unSendSyscalls;
+        stStatistics.unFragmentsSkipped = m_unFragmentsSkipped;
+        if (stStatistics.unPacketsReceived > 0)
+        {
+            stStatistics.dSyscallsPerPacket = static_cast<double>(stStatistics.unReceiveSyscalls + stStatistics.unWaitSyscalls) / stStatistics.unPacketsReceived;
+        }
+
+        return stStatistics;
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the callback dispatch queue's counters.
+     *
+     * @return RoveCommDispatchStatistics - The current counter values, all zero if
+     *                                      callbacks run on the receive thread.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommDispatchStatistics RoveCommUDP::GetDispatchStatistics() const
+    {
+        if (m_pDispatcher == nullptr)
+        {
+            return RoveCommDispatchStatistics{};
+        }
+
+        return m_pDispatcher->GetStatistics();
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the counters of one priority class's dispatch queue.
+     *
+     * @param ePriority - The priority class to report.
+     * @return RoveCommDispatchStatistics - The current counter values, all zero if
+     *                                      callbacks run on the receive thread.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommDispatchStatistics RoveCommUDP::GetDispatchStatistics(RoveCommPriority ePriority) const
+    {
+        if (m_pDispatcher == nullptr)
+        {
+            return RoveCommDispatchStatistics{};
+        }
+
+        return m_pDispatcher->GetStatistics(ePriority);
+    }
+
+    /******************************************************************************
+     * @brief Initialize the UDP socket and bind it to the specified port. This
+     *        method also starts the thread that will continuously receive UDP
+     *        packets and invoke the appropriate callback function.
+     *
+     * @param nPort - The port that the UDP socket is to be bound to. If set to 0,
+     *                then the operating system will automatically assign to an
+     *                available port.
+     * @return true - The UDP socket was successfully initialized and bound.
+     * @return false - An error occurred while initializing the UDP socket.
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::InitUDPSocket(int nPort)
+    {
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        WSADATA wsaData;
+        if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+        {
+            std::cerr << "WSAStartup failed." << std::endl;
+            return 1;
+        }
+#endif
+
+        // Create a UDP socket
+        m_nUDPSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (m_nUDPSocket == -1)
+        {
+            perror("Failed to create UDP socket");
+            return false;
+        }
+        else
+        {
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+            u_long mode = 1;    // 1 to enable non-blocking mode
+            if (ioctlsocket(m_nUDPSocket, FIONBIO, &mode) == SOCKET_ERROR)
+            {
+                // Handle and print error.
+                int err = WSAGetLastError();
+                fprintf(stderr, "Failed to set UDP socket to non-blocking mode. Error code: %d\n", err);
+                return false;
+            }
+#else
+            if (fcntl(m_nUDPSocket, F_SETFL, fcntl(m_nUDPSocket, F_GETFL) | O_NONBLOCK) == -1)
+            {
+                // Handle and print error.
+                perror("Failed to set UDP socket to non-blocking mode.");
+                return false;
+            }
+#endif
+        }
+
+        // Raise the socket buffers so the fragments of a large packet are not dropped while they are queued.
+        int nBufferSize = ROVECOMM_UDP_SOCKET_BUFFER_SIZE;
+        if (setsockopt(m_nUDPSocket, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&nBufferSize), sizeof(nBufferSize)) == -1 ||
+            setsockopt(m_nUDPSocket, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<const char*>(&nBufferSize), sizeof(nBufferSize)) == -1)
+        {
+            perror("Failed to set UDP socket buffer sizes");
+        }
+
+        // Configure the server address
+        sockaddr_in saServerAddr;
+        memset(&saServerAddr, 0, sizeof(saServerAddr));
+        saServerAddr.sin_family      = AF_INET;
+        saServerAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+        saServerAddr.sin_port        = htons(nPort);
+
+        // Bind the socket
+        if (bind(m_nUDPSocket.load(), (struct sockaddr*) &saServerAddr, sizeof(saServerAddr)) == -1)
+        {
+            perror("Failed to bind UDP socket");
+            close(m_nUDPSocket);
+            m_nUDPSocket = -1;
+            return false;
+        }
+
+        // Allocate the receive batch before the receive thread starts.
+        AllocateReceiveBatch();
+
+        // Only the legacy polling mode needs the IPS cap, the event-driven mode sleeps in the kernel instead.
+        if (m_eReceiveMode == eEventDriven)
+        {
+            if (!InitReceiveEvents())
+            {
+                CLOSE_SOCKET(m_nUDPSocket);
+                m_nUDPSocket = -1;
+                return false;
+            }
+
+            this->SetMainThreadIPSLimit(0);
+        }
+        else
+        {
+            this->SetMainThreadIPSLimit(rovecomm::ROVECOMM_THREAD_MAX_IPS);
+        }
+
+        // Size the worker pool before the receive thread starts, since resizing briefly signals every thread to stop.
+        unsigned int unWorkers = 0;
+        if (m_pDispatcher != nullptr)
+        {
+            for (int nIter = 0; nIter < ePriorityCount; ++nIter)
+            {
+                m_pDispatcher->SetDedicatedWorker(static_cast<RoveCommPriority>(nIter), m_aDedicatedDispatchLanes[nIter]);
+            }
+            m_pDispatcher->Open();
+            unWorkers = m_unDispatchThreads + m_pDispatcher->GetDedicatedWorkers();
+            RunDetachedPool(0, unWorkers);
+        }
+
+        // Start the thread
+        Start();
+
+        // Start one long-running dispatch worker per pool thread.
+        if (m_pDispatcher != nullptr)
+        {
+            RunDetachedPool(unWorkers, unWorkers);
+        }
+
+        // Start sending publishers, if there are any, and coalesced datagrams.
+        m_stCoalescer.Enable();
+        m_stPublishers.Enable();
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Send a UDP packet to the specified IP address and port. Packs the
+     *        RoveCommPacket into a buffer sized to the packet and sends it to every
+     *        subscriber and to the specified IP address and port with a single
+     *        sendmmsg call.
+     *
+     * @tparam T - The type of data that is to be sent. This can be any of the types
+     *             defined in the manifest.
+     * @param stPacket - The RoveCommPacket that is to be sent.
+     * @param cIPAddress - The IP address of the client that the packet is to be sent to.
+     *                     Pass "0.0.0.0" to only send to subscribers.
+     * @param nPort - The port that the packet is to be sent to.
+     * @return ssize_t - The number of bytes that were sent to the specified IP
+     *                   address. If the return value is less than 0, then an error
+     *                   occurred or no address was specified. 0 if the send filter
+     *                   of the data id suppressed the packet for that address.
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    ssize_t RoveCommUDP::SendUDPPacket(const RoveCommPacket<T>& stPacket, const char* cIPAddress, int nPort)
+    {
+        // Pack the RoveCommPacket into a small stack buffer, or a pooled buffer if it does not fit.
+        uint8_t aStackBuffer[ROVECOMM_PACKET_STACK_BUFFER_SIZE];
+        uint8_t* pBuffer    = aStackBuffer;
+        size_t siBufferSize = sizeof(aStackBuffer);
+        RoveCommBufferPool::Buffer stPooledBuffer;
+        if (GetPackedSize(stPacket) > siBufferSize)
+        {
+            stPooledBuffer = m_stSendBufferPool.Acquire(GetPackedSize(stPacket));
+            pBuffer        = stPooledBuffer.data();
+            siBufferSize   = stPooledBuffer.size();
+        }
+        size_t siDataSize = PackPacket(stPacket, pBuffer, siBufferSize);
+        if (siDataSize == 0)
+        {
+            std::cerr << "Failed to pack UDP packet with data id " << stPacket.unDataId << std::endl;
+            return -1;
+        }
+
+        // Resolve the specified IP address and port, if one was given.
+        struct sockaddr_in saUDPClientAddr;
+        bool bHasTarget = std::strcmp(cIPAddress, "0.0.0.0") && nPort != 0;
+        if (bHasTarget)
+        {
+            memset(&saUDPClientAddr, 0, sizeof(saUDPClientAddr));
+            saUDPClientAddr.sin_family = AF_INET;
+            saUDPClientAddr.sin_port   = htons(nPort);
+            if (inet_pton(AF_INET, cIPAddress, &saUDPClientAddr.sin_addr) != 1)
+            {
+                std::cerr << "Invalid UDP destination address: " << cIPAddress << std::endl;
+                bHasTarget = false;
+            }
+        }
+
+        return SendUDPData(pBuffer, siDataSize, bHasTarget ? &saUDPClientAddr : nullptr);
+    }
+
+    /******************************************************************************
+     * @brief Create a rate limited publisher for a data id. Packets published to it
+     *        are sent by this node's publisher thread, to every subscriber and to the
+     *        specified IP address and port, at no more than dMaxRateHz. Only the
+     *        latest packet published in each send window is sent.
+     *
+     * @param unDataId - The data id of the packets published.
+     * @param dMaxRateHz - The most packets per second that are sent.
+     * @param cIPAddress - The IP address of the client that the packets are to be
+     *                     sent to. Pass "0.0.0.0" to only send to subscribers.
+     * @param nPort - The port that the packets are to be sent to.
+     * @return std::shared_ptr<RoveCommPublisher> - The publisher, or nullptr if the
+     *                                              rate was not positive.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    std::shared_ptr<RoveCommPublisher> RoveCommUDP::CreatePublisher(const uint16_t& unDataId, double dMaxRateHz, const char* cIPAddress, int nPort)
+    {
+        struct sockaddr_in saUDPClientAddr;
+        bool bHasTarget = ResolveTargetAddress(cIPAddress, nPort, saUDPClientAddr);
+
+        return m_stPublishers.AddPublisher(unDataId, dMaxRateHz, bHasTarget ? &saUDPClientAddr : nullptr);
+    }
+
+    /******************************************************************************
+     * @brief Stop sending a publisher created by CreatePublisher(). A packet it
+     *        still has waiting is dropped.
+     *
+     * @param pPublisher - The publisher to remove.
+     * @return true - The publisher was removed.
+     * @return false - The publisher does not belong to this node.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::RemovePublisher(const std::shared_ptr<RoveCommPublisher>& pPublisher)
+    {
+        return m_stPublishers.RemovePublisher(pPublisher);
+    }
+
+    /******************************************************************************
+     * @brief Start sending a data id at a fixed rate. The producer is called on this
+     *        node's publisher thread once per period and fills in the packet's data.
+     *        Streams whose samples fall on the same tick are sent together, with a
+     *        single syscall.
+     *
+     * @tparam T - The type of data that is to be sent. This can be any of the types
+     *             defined in the manifest.
+     * @param unDataId - The data id of the packets sent.
+     * @param dRateHz - The number of packets per second. The period is rounded to
+     *                  whole scheduler ticks.
+     * @param fnProducer - Fills in vData and returns false to skip a period. It must
+     *                     not block.
+     * @param cIPAddress - The IP address of the client that the packets are to be
+     *                     sent to. Pass "0.0.0.0" to only send to subscribers.
+     * @param nPort - The port that the packets are to be sent to.
+     * @return std::shared_ptr<RoveCommPeriodicStream> - The stream, or nullptr if
+     *                                                   the rate was not positive.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    std::shared_ptr<RoveCommPeriodicStream> RoveCommUDP::AddPeriodicStream(const uint16_t& unDataId,
+                                                                           double dRateHz,
+                                                                           std::function<bool(RoveCommPacket<T>&)> fnProducer,
+                                                                           const char* cIPAddress,
+                                                                           int nPort)
+    {
+        struct sockaddr_in saUDPClientAddr;
+        bool bHasTarget = ResolveTargetAddress(cIPAddress, nPort, saUDPClientAddr);
+
+        return m_stPublishers.AddPeriodicStream<T>(unDataId, dRateHz, std::move(fnProducer), bHasTarget ? &saUDPClientAddr : nullptr);
+    }
+
+    /******************************************************************************
+     * @brief Stop sending a periodic stream created by AddPeriodicStream().
+     *
+     * @param pStream - The stream to remove.
+     * @return true - The stream was removed.
+     * @return false - The stream does not belong to this node.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::RemovePeriodicStream(const std::shared_ptr<RoveCommPeriodicStream>& pStream)
+    {
+        return m_stPublishers.RemovePeriodicStream(pStream);
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the counters of this node's publisher thread.
+     *
+     * @return RoveCommSchedulerStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommSchedulerStatistics RoveCommUDP::GetSchedulerStatistics() const
+    {
+        return m_stPublishers.GetStatistics();
+    }
+
+    /******************************************************************************
+     * @brief Only send packets of a data id when they change. Every send path of
+     *        this node goes through the filter: SendUDPPacket(), SendUDPBatch(),
+     *        publishers and periodic streams. A suppressed packet is simply not
+     *        sent, and an unchanged one still goes out once per keepalive.
+     *
+     * @param unDataId - The data id to filter.
+     * @param stDeadband - When a packet counts as changed, and how often an
+     *                     unchanged one is sent anyway.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::SetSendFilter(const uint16_t& unDataId, const RoveCommDeadband& stDeadband)
+    {
+        m_stSendFilter.SetFilter(unDataId, stDeadband);
+    }
+
+    /******************************************************************************
+     * @brief Only send packets of every entry in a manifest map, such as
+     *        manifest::Core::TELEMETRY, when they change.
+     *
+     * @param mpEntries - The manifest entries to filter.
+     * @param stDeadband - The deadband used for each of them.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::SetSendFilter(const std::map<std::string, manifest::ManifestEntry>& mpEntries, const RoveCommDeadband& stDeadband)
+    {
+        m_stSendFilter.SetFilter(mpEntries, stDeadband);
+    }
+
+    /******************************************************************************
+     * @brief Send every packet of a data id again.
+     *
+     * @param unDataId - The data id to stop filtering.
+     * @return true - The data id was filtered.
+     * @return false - The data id was not filtered.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::ClearSendFilter(const uint16_t& unDataId)
+    {
+        return m_stSendFilter.ClearFilter(unDataId);
+    }
+
+    /******************************************************************************
+     * @brief Get the send filter counters of every filtered data id, added up.
+     *
+     * @return RoveCommSendFilterStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommSendFilterStatistics RoveCommUDP::GetSendFilterStatistics() const
+    {
+        return m_stSendFilter.GetStatistics();
+    }
+
+    /******************************************************************************
+     * @brief Get the send filter counters of one data id.
+     *
+     * @param unDataId - The data id.
+     * @return RoveCommSendFilterStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommSendFilterStatistics RoveCommUDP::GetSendFilterStatistics(const uint16_t& unDataId) const
+    {
+        return m_stSendFilter.GetStatistics(unDataId);
+    }
+
+    /******************************************************************************
+     * @brief Turn coalescing on or off. While it is on, packets for subscribers
+     *        that asked for coalesced datagrams are collected and sent several per
+     *        datagram, once the datagram is full or its oldest packet has waited
+     *        for tmMaxDelay. Legacy subscribers and explicit destinations still get
+     *        one packet per datagram.
+     *
+     * @param bEnabled - Whether packets are coalesced.
+     * @param siMaxDatagramSize - The largest coalesced datagram, in bytes. The
+     *                            default fits an Ethernet frame without IP
+     *                            fragmentation.
+     * @param tmMaxDelay - The longest a packet waits for more packets to join it.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::SetCoalescing(bool bEnabled, size_t siMaxDatagramSize, std::chrono::microseconds tmMaxDelay)
+    {
+        m_stCoalescer.Configure(bEnabled, siMaxDatagramSize, tmMaxDelay);
+    }
+
+    /******************************************************************************
+     * @brief Send the pending coalesced datagram now, such as after the last
+     *        packet of a control cycle.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::FlushCoalesced()
+    {
+        m_stCoalescer.Flush();
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the coalescer's counters.
+     *
+     * @return RoveCommCoalescerStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommCoalescerStatistics RoveCommUDP::GetCoalescerStatistics() const
+    {
+        return m_stCoalescer.GetStatistics();
+    }
+
+    /******************************************************************************
+     * @brief Change the limits on fragmented packets being reassembled. Packets
+     *        that are being reassembled are discarded.
+     *
+     * @param tmTimeout - How long after its first fragment a packet must be
+     *                    complete.
+     * @param siMaxPackets - The number of packets that can be reassembled at once.
+     * @param siMaxBytes - The total size of the packets being reassembled.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::SetReassemblyLimits(std::chrono::milliseconds tmTimeout, size_t siMaxPackets, size_t siMaxBytes)
+    {
+        m_stReassembler.SetLimits(tmTimeout, siMaxPackets, siMaxBytes);
+    }
+
+    /******************************************************************************
+     * @brief Get a snapshot of the reassembler's counters.
+     *
+     * @return RoveCommReassemblyStatistics - The current counter values.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    RoveCommReassemblyStatistics RoveCommUDP::GetReassemblyStatistics() const
+    {
+        return m_stReassembler.GetStatistics();
+    }
+
+    /******************************************************************************
+     * @brief Subscribe this node to another node's telemetry. The SUBSCRIBE packet
+     *        is sent to that node only, and carries the capabilities of this node
+     *        so the other node knows it may send coalesced datagrams, and packets
+     *        too large for one datagram as fragments.
+     *
+     * @param cIPAddress - The IP address of the node to subscribe to.
+     * @param nPort - The RoveComm UDP port of that node.
+     * @param bCoalesced - Whether to ask for several packets per datagram. Pass
+     *                     false for both flags to subscribe like a legacy node.
+     * @param bFragments - Whether to ask for packets too large for one datagram,
+     *                     which are sent as fragments.
+     * @return ssize_t - The number of bytes sent, or -1 if an error occurred.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    ssize_t RoveCommUDP::SubscribeTo(const char* cIPAddress, int nPort, bool bCoalesced, bool bFragments)
+    {
+        uint8_t unFlags = (bCoalesced ? ROVECOMM_SUBSCRIBE_COALESCED : 0) | (bFragments ? ROVECOMM_SUBSCRIBE_FRAGMENTS : 0);
+        return SendSubscription(manifest::System::SUBSCRIBE_DATA_ID, unFlags, cIPAddress, nPort);
+    }
+
+    /******************************************************************************
+     * @brief Unsubscribe this node from another node's telemetry.
+     *
+     * @param cIPAddress - The IP address of the node to unsubscribe from.
+     * @param nPort - The RoveComm UDP port of that node.
+     * @return ssize_t - The number of bytes sent, or -1 if an error occurred.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    ssize_t RoveCommUDP::UnsubscribeFrom(const char* cIPAddress, int nPort)
+    {
+        return SendSubscription(manifest::System::UNSUBSCRIBE_DATA_ID, 0, cIPAddress, nPort);
+    }
+
+    /******************************************************************************
+     * @brief Send a SUBSCRIBE or UNSUBSCRIBE packet to one node only, bypassing
+     *        the subscribers, the send filter and the coalescer.
+     *
+     * @param unDataId - The system data id of the packet.
+     * @param unFlags - The capability flags carried in the packet's element.
+     * @param cIPAddress - The IP address of the node.
+     * @param nPort - The RoveComm UDP port of the node.
+     * @return ssize_t - The number of bytes sent, or -1 if an error occurred.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    ssize_t RoveCommUDP::SendSubscription(uint16_t unDataId, uint8_t unFlags, const char* cIPAddress, int nPort)
+    {
+        uint8_t aBuffer[ROVECOMM_PACKET_HEADER_SIZE + 1];
+        RoveCommPacket<uint8_t> stPacket;
+        stPacket.unDataId    = unDataId;
+        stPacket.unDataCount = 1;
+        stPacket.eDataType   = manifest::DataTypes::UINT8_T;
+        stPacket.vData       = {unFlags};
+
+        sockaddr_in saTargetAddr;
+        size_t siDataSize = PackPacket(stPacket, aBuffer, sizeof(aBuffer));
+        if (siDataSize == 0 || !ResolveTargetAddress(cIPAddress, nPort, saTargetAddr))
+        {
+            return -1;
+        }
+
+        m_unSendSyscalls++;
+        ssize_t siBytesSent = sendto(m_nUDPSocket, reinterpret_cast<const char*>(aBuffer), siDataSize, 0, (struct sockaddr*) &saTargetAddr, sizeof(sockaddr_in));
+        if (siBytesSent != -1)
+        {
+            m_unPacketsSent++;
+        }
+
+        return siBytesSent;
+    }
+
+    /******************************************************************************
+     * @brief Resolve the extra destination given to CreatePublisher() or
+     *        AddPeriodicStream().
+     *
+     * @param cIPAddress - The IP address, or "0.0.0.0" for none.
+     * @param nPort - The port, or 0 for none.
+     * @param saTargetAddr - Filled with the address if there is one.
+     * @return true - An address was given and parsed.
+     * @return false - No address was given, or it could not be parsed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::ResolveTargetAddress(const char* cIPAddress, int nPort, sockaddr_in& saTargetAddr)
+    {
+        if (!std::strcmp(cIPAddress, "0.0.0.0") || nPort == 0)
+        {
+            return false;
+        }
+
+        memset(&saTargetAddr, 0, sizeof(saTargetAddr));
+        saTargetAddr.sin_family = AF_INET;
+        saTargetAddr.sin_port   = htons(nPort);
+        if (inet_pton(AF_INET, cIPAddress, &saTargetAddr.sin_addr) != 1)
+        {
+            std::cerr << "Invalid UDP destination address: " << cIPAddress << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Send already packed bytes to every subscriber and, optionally, to one
+     *        more address. All destinations share the same buffer and are sent with
+     *        a single sendmmsg call. While coalescing is on, subscribers that asked
+     *        for it get the packet in the next coalesced datagram instead. Packets
+     *        larger than ROVECOMM_FRAGMENT_THRESHOLD are sent as fragments.
+     *
+     *        The subscribers and the additional address are checked against the
+     *        send filter separately, and each only becomes the packet's last sent
+     *        destination once a send to it succeeded.
+     *
+     * @param pData - The packed packet bytes to send.
+     * @param siDataSize - The number of bytes to send.
+     * @param pTargetAddr - An additional destination, or nullptr to only send to
+     *                      subscribers.
+     * @return ssize_t - The number of bytes sent to pTargetAddr, 0 if the send
+     *                   filter suppressed the packet for pTargetAddr, or -1 if
+     *                   there was no target or sending to it failed.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    ssize_t RoveCommUDP::SendUDPData(const uint8_t* pData, size_t siDataSize, const sockaddr_in* pTargetAddr)
+    {
+        // Skip destinations that would not be told anything new.
+        bool bTargetSuppressed = pTargetAddr != nullptr && !m_stSendFilter.Check(pData, siDataSize, pTargetAddr);
+        if (bTargetSuppressed)
+        {
+            pTargetAddr = nullptr;
+        }
+
+        ssize_t siBytesSent   = -1;
+        bool bSubscribersSent = false;
+
+        // Packets that would not fit in a receive buffer go out as fragments.
+        if (siDataSize > ROVECOMM_FRAGMENT_THRESHOLD)
+        {
+            bool bToSubscribers;
+            {
+                std::shared_lock<std::shared_mutex> lkSubscriberLock(m_muSubscriberMutex);
+                bToSubscribers = !vSubscribers.empty() && m_stSendFilter.Check(pData, siDataSize, nullptr);
+            }
+
+            bool bTargetSent;
+            SendUDPFragments(pData, siDataSize, bToSubscribers, pTargetAddr, bSubscribersSent, bTargetSent);
+            siBytesSent = bTargetSent ? static_cast<ssize_t>(siDataSize) : -1;
+        }
+        else
+        {
+            bool bCoalesce       = m_stCoalescer.IsActive();
+            bool bHasCoalescedTo = false;
+            {
+                // Acquire a read lock so the receive thread cannot modify the subscribers mid-send.
+                std::shared_lock<std::shared_mutex> lkSubscriberLock(m_muSubscriberMutex);
+                bool bToSubscribers = !vSubscribers.empty() && m_stSendFilter.Check(pData, siDataSize, nullptr);
+
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+                // Send the packet to all subscribers
+                for (const SubscriberInfo& stSubscriber : vSubscribers)
+                {
+                    if (!bToSubscribers)
+                    {
+                        break;
+                    }
+                    if (bCoalesce && stSubscriber.bCoalesced)
+                    {
+                        bHasCoalescedTo = true;
+                        continue;
+                    }
+
+                    m_unSendSyscalls++;
+                    if (sendto(m_nUDPSocket, reinterpret_cast<const char*>(pData), siDataSize, 0, (struct sockaddr*) &stSubscriber.saAddress, sizeof(sockaddr_in)) == -1)
+                    {
+                        // Handle and print error message.
+                        perror("Failed to send data to UDP client socket subscriber.");
+                    }
+                    else
+                    {
+                        m_unPacketsSent++;
+                        bSubscribersSent = true;
+                    }
+                }
+
+                // Send the packet to the specified IP address and port
+                if (pTargetAddr != nullptr)
+                {
+                    m_unSendSyscalls++;
+                    siBytesSent = sendto(m_nUDPSocket, reinterpret_cast<const char*>(pData), siDataSize, 0, (struct sockaddr*) pTargetAddr, sizeof(sockaddr_in));
+                    if (siBytesSent != -1)
+                    {
+                        m_unPacketsSent++;
+                    }
+                }
+#else
+                // Every destination shares the same buffer.
+                struct iovec stIOVec;
+                stIOVec.iov_base = const_cast<uint8_t*>(pData);
+                stIOVec.iov_len  = siDataSize;
+
+                // Build one message per subscriber, plus one for the specified address.
+                std::array<struct mmsghdr, ROVECOMM_ETHERNET_UDP_MAX_SUBSCRIBERS + 1> aMessages;
+                unsigned int unCount = 0;
+                for (const SubscriberInfo& stSubscriber : vSubscribers)
+                {
+                    if (!bToSubscribers)
+                    {
+                        break;
+                    }
+                    if (bCoalesce && stSubscriber.bCoalesced)
+                    {
+                        bHasCoalescedTo = true;
+                        continue;
+                    }
+
+                    memset(&aMessages[unCount], 0, sizeof(struct mmsghdr));
+                    aMessages[unCount].msg_hdr.msg_name    = const_cast<sockaddr_in*>(&stSubscriber.saAddress);
+                    aMessages[unCount].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                    aMessages[unCount].msg_hdr.msg_iov     = &stIOVec;
+                    aMessages[unCount].msg_hdr.msg_iovlen  = 1;
+                    unCount++;
+                }
+                unsigned int unSubscriberCount = unCount;
+
+                if (pTargetAddr != nullptr)
+                {
+                    memset(&aMessages[unCount], 0, sizeof(struct mmsghdr));
+                    aMessages[unCount].msg_hdr.msg_name    = const_cast<sockaddr_in*>(pTargetAddr);
+                    aMessages[unCount].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                    aMessages[unCount].msg_hdr.msg_iov     = &stIOVec;
+                    aMessages[unCount].msg_hdr.msg_iovlen  = 1;
+                    unCount++;
+                }
+
+                SendUDPMessages(aMessages.data(), unCount);
+
+                // The subscribers count as sent if any of them got the packet.
+                for (unsigned int unIter = 0; unIter < unSubscriberCount; ++unIter)
+                {
+                    bSubscribersSent = bSubscribersSent || aMessages[unIter].msg_len > 0;
+                }
+
+                // The target is always the last message, a zero length means it was not sent.
+                if (pTargetAddr != nullptr && aMessages[unCount - 1].msg_len > 0)
+                {
+                    siBytesSent = aMessages[unCount - 1].msg_len;
+                }
+#endif
+            }
+
+            // The coalescer sends under its own lock, which takes the subscriber lock again, so append after releasing it.
+            if (bHasCoalescedTo)
+            {
+                CoalescePacket(pData, siDataSize);
+                bSubscribersSent = true;
+            }
+        }
+
+        // Only destinations that got the packet compare later packets against it.
+        if (bSubscribersSent)
+        {
+            m_stSendFilter.Commit(pData, siDataSize, nullptr);
+        }
+        if (pTargetAddr != nullptr && siBytesSent > 0)
+        {
+            m_stSendFilter.Commit(pData, siDataSize, pTargetAddr);
+        }
+
+        return bTargetSuppressed ? 0 : siBytesSent;
+    }
+
+    /******************************************************************************
+     * @brief Hand a packet bound for the coalescing subscribers to the coalescer.
+     *        A packet it does not take, because it is too large or coalescing was
+     *        just turned off, is sent to those subscribers on its own.
+     *
+     * @param pData - The packed packet bytes.
+     * @param siDataSize - The number of bytes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::CoalescePacket(const uint8_t* pData, size_t siDataSize)
+    {
+        if (!m_stCoalescer.Append(pData, siDataSize))
+        {
+            SendToCoalescedSubscribers(pData, siDataSize);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Send a datagram to every subscriber that asked for coalesced
+     *        datagrams.
+     *
+     * @param pData - The datagram, either a coalesced one or a single packet.
+     * @param siDataSize - The number of bytes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::SendToCoalescedSubscribers(const uint8_t* pData, size_t siDataSize)
+    {
+        std::shared_lock<std::shared_mutex> lkSubscriberLock(m_muSubscriberMutex);
+
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        for (const SubscriberInfo& stSubscriber : vSubscribers)
+        {
+            if (stSubscriber.bCoalesced)
+            {
+                m_unSendSyscalls++;
+                if (sendto(m_nUDPSocket, reinterpret_cast<const char*>(pData), siDataSize, 0, (struct sockaddr*) &stSubscriber.saAddress, sizeof(sockaddr_in)) != -1)
+                {
+                    m_unPacketsSent++;
+                }
+            }
+        }
+#else
+        struct iovec stIOVec;
+        stIOVec.iov_base = const_cast<uint8_t*>(pData);
+        stIOVec.iov_len  = siDataSize;
+
+        std::array<struct mmsghdr, ROVECOMM_ETHERNET_UDP_MAX_SUBSCRIBERS> aMessages;
+        unsigned int unCount = 0;
+        for (const SubscriberInfo& stSubscriber : vSubscribers)
+        {
+            if (stSubscriber.bCoalesced)
+            {
+                memset(&aMessages[unCount], 0, sizeof(struct mmsghdr));
+                aMessages[unCount].msg_hdr.msg_name    = const_cast<sockaddr_in*>(&stSubscriber.saAddress);
+                aMessages[unCount].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                aMessages[unCount].msg_hdr.msg_iov     = &stIOVec;
+                aMessages[unCount].msg_hdr.msg_iovlen  = 1;
+                unCount++;
+            }
+        }
+
+        SendUDPMessages(aMessages.data(), unCount);
+#endif
+    }
+
+    /******************************************************************************
+     * @brief Split a packet that is too large for one datagram into fragments and
+     *        send every fragment to every subscriber that can reassemble them and,
+     *        optionally, to one more address. Each fragment is sent as its header
+     *        followed by a slice of the packed packet, so the packet itself is not
+     *        copied. Subscribers that did not advertise fragment support are
+     *        skipped, since they would drop the fragments as unknown datagrams.
+     *        The fragments go out in bursts of ROVECOMM_FRAGMENT_BURST_SIZE per
+     *        destination, so the receivers' socket buffers do not overflow.
+     *
+     * @param pData - The packed packet bytes.
+     * @param siDataSize - The packed size of the packet.
+     * @param bToSubscribers - Whether the fragments are sent to the subscribers.
+     * @param pTargetAddr - An additional destination, or nullptr to only send to
+     *                      subscribers.
+     * @param bSubscribersSent - Set to whether every fragment was sent to at least
+     *                           one fragment capable subscriber.
+     * @param bTargetSent - Set to whether every fragment was sent to pTargetAddr.
+     * @return unsigned int - The number of fragment datagrams that were sent.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    unsigned int RoveCommUDP::SendUDPFragments(const uint8_t* pData,
+                                               size_t siDataSize,
+                                               bool bToSubscribers,
+                                               const sockaddr_in* pTargetAddr,
+                                               bool& bSubscribersSent,
+                                               bool& bTargetSent)
+    {
+        // Every fragment of the packet shares one message id.
+        RoveCommFragmentHeader stHeader;
+        stHeader.unMessageId = m_unNextMessageId.fetch_add(1, std::memory_order_relaxed);
+        stHeader.unCount     = GetFragmentCount(siDataSize);
+        stHeader.unTotalSize = static_cast<uint32_t>(siDataSize);
+
+        // Acquire a read lock so the receive thread cannot modify the subscribers mid-send.
+        std::shared_lock<std::shared_mutex> lkSubscriberLock(m_muSubscriberMutex);
+
+        // Only subscribers that advertised fragment support receive the fragments.
+        std::array<const sockaddr_in*, ROVECOMM_ETHERNET_UDP_MAX_SUBSCRIBERS> aSubscribers;
+        size_t siSubscribers = 0;
+        if (bToSubscribers)
+        {
+            for (const SubscriberInfo& stSubscriber : vSubscribers)
+            {
+                if (stSubscriber.bFragments)
+                {
+                    aSubscribers[siSubscribers++] = &stSubscriber.saAddress;
+                }
+            }
+            m_unFragmentsSkipped += vSubscribers.size() - siSubscribers;
+        }
+
+        unsigned int unSent = 0;
+        bSubscribersSent    = siSubscribers > 0;
+        bTargetSent         = pTargetAddr != nullptr;
+
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        uint8_t aDatagram[ROVECOMM_FRAGMENT_MAX_DATAGRAM_SIZE];
+        for (stHeader.unIndex = 0; stHeader.unIndex < stHeader.unCount; ++stHeader.unIndex)
+        {
+            // Pause between bursts so the receivers can drain their socket buffers.
+            if (stHeader.unIndex > 0 && stHeader.unIndex % ROVECOMM_FRAGMENT_BURST_SIZE == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(ROVECOMM_FRAGMENT_BURST_GAP_US));
+            }
+
+            size_t siPayloadSize = GetFragmentPayloadSize(stHeader);
+            PackFragmentHeader(stHeader, aDatagram);
+            memcpy(aDatagram + ROVECOMM_FRAGMENT_HEADER_SIZE, pData + GetFragmentOffset(stHeader), siPayloadSize);
+
+            const char* pDatagram   = reinterpret_cast<const char*>(aDatagram);
+            size_t siDatagramSize   = ROVECOMM_FRAGMENT_HEADER_SIZE + siPayloadSize;
+            bool bFragmentDelivered = false;
+            for (size_t siIter = 0; siIter < siSubscribers; ++siIter)
+            {
+                m_unSendSyscalls++;
+                if (sendto(m_nUDPSocket, pDatagram, siDatagramSize, 0, (struct sockaddr*) aSubscribers[siIter], sizeof(sockaddr_in)) != -1)
+                {
+                    unSent++;
+                    bFragmentDelivered = true;
+                }
+            }
+            bSubscribersSent = bSubscribersSent && bFragmentDelivered;
+
+            if (pTargetAddr != nullptr)
+            {
+                m_unSendSyscalls++;
+                if (sendto(m_nUDPSocket, pDatagram, siDatagramSize, 0, (struct sockaddr*) pTargetAddr, sizeof(sockaddr_in)) != -1)
+                {
+                    unSent++;
+                }
+                else
+                {
+                    bTargetSent = false;
+                }
+            }
+        }
+
+        m_unPacketsSent += unSent;
+#else
+        // Two iovecs per fragment, its header and its slice of the packet, shared by all destinations.
+        size_t siDestinations = siSubscribers + (pTargetAddr != nullptr ? 1 : 0);
+        std::vector<uint8_t> vHeaders(stHeader.unCount * ROVECOMM_FRAGMENT_HEADER_SIZE);
+        std::vector<struct iovec> vIOVecs(stHeader.unCount * 2);
+        std::vector<struct mmsghdr> vMessages;
+        vMessages.reserve(stHeader.unCount * siDestinations);
+        for (stHeader.unIndex = 0; stHeader.unIndex < stHeader.unCount; ++stHeader.unIndex)
+        {
+            uint8_t* pHeader = &vHeaders[stHeader.unIndex * ROVECOMM_FRAGMENT_HEADER_SIZE];
+            PackFragmentHeader(stHeader, pHeader);
+            vIOVecs[stHeader.unIndex * 2].iov_base     = pHeader;
+            vIOVecs[stHeader.unIndex * 2].iov_len      = ROVECOMM_FRAGMENT_HEADER_SIZE;
+            vIOVecs[stHeader.unIndex * 2 + 1].iov_base = const_cast<uint8_t*>(pData + GetFragmentOffset(stHeader));
+            vIOVecs[stHeader.unIndex * 2 + 1].iov_len  = GetFragmentPayloadSize(stHeader);
+
+            // Queue a message for each fragment capable subscriber and for the specified address.
+            for (size_t siDestination = 0; siDestination < siDestinations; ++siDestination)
+            {
+                const sockaddr_in* pAddress = siDestination < siSubscribers ? aSubscribers[siDestination] : pTargetAddr;
+
+                struct mmsghdr stMessage;
+                memset(&stMessage, 0, sizeof(stMessage));
+                stMessage.msg_hdr.msg_name    = const_cast<sockaddr_in*>(pAddress);
+                stMessage.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                stMessage.msg_hdr.msg_iov     = &vIOVecs[stHeader.unIndex * 2];
+                stMessage.msg_hdr.msg_iovlen  = 2;
+                vMessages.push_back(stMessage);
+            }
+        }
+
+        // Send the fragments in bursts, pausing in between so the receivers can drain their socket buffers.
+        size_t siBurstMessages = ROVECOMM_FRAGMENT_BURST_SIZE * siDestinations;
+        for (size_t siFirst = 0; siFirst < vMessages.size(); siFirst += siBurstMessages)
+        {
+            if (siFirst > 0)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(ROVECOMM_FRAGMENT_BURST_GAP_US));
+            }
+            unSent += SendUDPMessages(&vMessages[siFirst], static_cast<unsigned int>(std::min(siBurstMessages, vMessages.size() - siFirst)));
+        }
+
+        // Each fragment's subscribers come first and the target last, a zero length means it was not sent.
+        for (size_t siFirst = 0; siFirst < vMessages.size(); siFirst += siDestinations)
+        {
+            bool bFragmentDelivered = false;
+            for (size_t siIter = siFirst; siIter < siFirst + siSubscribers; ++siIter)
+            {
+                bFragmentDelivered = bFragmentDelivered || vMessages[siIter].msg_len > 0;
+            }
+            bSubscribersSent = bSubscribersSent && bFragmentDelivered;
+
+            if (pTargetAddr != nullptr)
+            {
+                bTargetSent = bTargetSent && vMessages[siFirst + siDestinations - 1].msg_len > 0;
+            }
+        }
+#endif
+
+        return unSent;
+    }
+
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+    /******************************************************************************
+     * @brief Send an array of prepared messages with as few sendmmsg calls as
+     *        possible. If the socket send buffer is full, waits up to
+     *        ROVECOMM_UDP_SEND_WAIT_MS for room. If the kernel rejects a message,
+     *        or there is still no room, it is reported and skipped so the remaining
+     *        messages are still sent.
+     *
+     * @param pMessages - The messages to send. Each message's msg_len is set to the
+     *                    number of bytes sent, or 0 if it could not be sent.
+     * @param unCount - The number of messages to send.
+     * @return unsigned int - The number of messages that were sent successfully.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    unsigned int RoveCommUDP::SendUDPMessages(struct mmsghdr* pMessages, unsigned int unCount)
+    {
+        unsigned int unSent       = 0;
+        unsigned int unSuccessful = 0;
+        while (unSent < unCount)
+        {
+            int nSent = sendmmsg(m_nUDPSocket, &pMessages[unSent], std::min(unCount - unSent, static_cast<unsigned int>(ROVECOMM_UDP_SEND_BATCH_MAX)), 0);
+            m_unSendSyscalls++;
+            if (nSent == -1 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS))
+            {
+                // The send buffer is full, wait until the kernel has room and try again.
+                struct pollfd stPollFD;
+                stPollFD.fd     = m_nUDPSocket;
+                stPollFD.events = POLLOUT;
+                if (poll(&stPollFD, 1, ROVECOMM_UDP_SEND_WAIT_MS) > 0)
+                {
+                    continue;
+                }
+            }
+            if (nSent <= 0)
+            {
+                // Handle and print error message, then skip the failed message.
+                perror("Failed to send data to UDP client socket.");
+                pMessages[unSent].msg_len = 0;
+                unSent++;
+            }
+            else
+            {
+                unSent += nSent;
+                unSuccessful += nSent;
+            }
+        }
+
+        m_unPacketsSent += unSuccessful;
+        return unSuccessful;
+    }
+#endif
+
+    /******************************************************************************
+     * @brief Send every packet in a batch with a single syscall. Each packet goes to
+     *        all subscribers and to the address it was added with, if any.
+     *
+     * @param stBatch - The batch of packed packets to send.
+     * @return int - The number of datagrams that were sent, counting every
+     *               subscriber of every packet. Packets held back by the send
+     *               filter are not sent.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    int RoveCommUDP::SendUDPBatch(const RoveCommUDPBatch& stBatch)
+    {
+        size_t siExpected;
+        return SendUDPBatchEntries(stBatch, siExpected);
+    }
+
+    /******************************************************************************
+     * @brief Send the packets of a batch that pass the send filter, with a single
+     *        syscall. The subscribers and a packet's own address are checked
+     *        against the send filter separately, and each only becomes the packet's
+     *        last sent destination once a send to it succeeded.
+     *
+     * @param stBatch - The batch of packed packets to send.
+     * @param siExpected - Set to the number of datagrams the packets that passed
+     *                     the filter should have become.
+     * @return int - The number of datagrams that were sent.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    int RoveCommUDP::SendUDPBatchEntries(const RoveCommUDPBatch& stBatch, size_t& siExpected)
+    {
+        int nSent      = 0;
+        bool bCoalesce = m_stCoalescer.IsActive();
+        std::vector<size_t> vCoalesced;
+        std::vector<size_t> vFragmented;
+
+        // Which destinations of each packet passed the send filter, and which of them got it.
+        size_t siEntries = stBatch.m_vEntries.size();
+        std::vector<bool> vToSubscribers(siEntries, false);
+        std::vector<bool> vToTarget(siEntries, false);
+        std::vector<bool> vSubscribersSent(siEntries, false);
+        std::vector<bool> vTargetSent(siEntries, false);
+        siExpected = 0;
+        {
+            // Acquire a read lock so the receive thread cannot modify the subscribers mid-send.
+            std::shared_lock<std::shared_mutex> lkSubscriberLock(m_muSubscriberMutex);
+
+            // Subscribers that take coalesced datagrams get the batch's packets through the coalescer instead,
+            // and only subscribers that advertised fragment support get the fragments of large packets.
+            size_t siCoalescedSubscribers = 0;
+            size_t siFragmentSubscribers  = 0;
+            for (const SubscriberInfo& stSubscriber : vSubscribers)
+            {
+                siCoalescedSubscribers += bCoalesce && stSubscriber.bCoalesced ? 1 : 0;
+                siFragmentSubscribers += stSubscriber.bFragments ? 1 : 0;
+            }
+
+            // Skip destinations that would not be told anything new.
+            for (size_t siIter = 0; siIter < siEntries; ++siIter)
+            {
+                const RoveCommUDPBatch::BatchEntry& stEntry = stBatch.m_vEntries[siIter];
+                const uint8_t* pData                        = &stBatch.m_vBytes[stEntry.siOffset];
+                vToSubscribers[siIter]                      = !vSubscribers.empty() && m_stSendFilter.Check(pData, stEntry.siSize, nullptr);
+                vToTarget[siIter]                           = stEntry.bHasTarget && m_stSendFilter.Check(pData, stEntry.siSize, &stEntry.saTargetAddr);
+                if (!vToSubscribers[siIter] && !vToTarget[siIter])
+                {
+                    continue;
+                }
+
+                if (stEntry.siSize > ROVECOMM_FRAGMENT_THRESHOLD)
+                {
+                    siExpected += GetFragmentCount(stEntry.siSize) * ((vToSubscribers[siIter] ? siFragmentSubscribers : 0) + (vToTarget[siIter] ? 1 : 0));
+                    vFragmented.push_back(siIter);
+                    continue;
+                }
+                siExpected += (vToSubscribers[siIter] ? vSubscribers.size() - siCoalescedSubscribers : 0) + (vToTarget[siIter] ? 1 : 0);
+                if (vToSubscribers[siIter] && siCoalescedSubscribers > 0)
+                {
+                    vCoalesced.push_back(siIter);
+                }
+            }
+
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+            for (size_t siIter = 0; siIter < siEntries; ++siIter)
+            {
+                const RoveCommUDPBatch::BatchEntry& stEntry = stBatch.m_vEntries[siIter];
+                if (stEntry.siSize > ROVECOMM_FRAGMENT_THRESHOLD)
+                {
+                    continue;
+                }
+
+                const char* pData = reinterpret_cast<const char*>(&stBatch.m_vBytes[stEntry.siOffset]);
+                for (const SubscriberInfo& stSubscriber : vSubscribers)
+                {
+                    if (!vToSubscribers[siIter])
+                    {
+                        break;
+                    }
+                    if (bCoalesce && stSubscriber.bCoalesced)
+                    {
+                        continue;
+                    }
+
+                    m_unSendSyscalls++;
+                    if (sendto(m_nUDPSocket, pData, stEntry.siSize, 0, (struct sockaddr*) &stSubscriber.saAddress, sizeof(sockaddr_in)) != -1)
+                    {
+                        nSent++;
+                        vSubscribersSent[siIter] = true;
+                    }
+                }
+
+                if (vToTarget[siIter])
+                {
+                    m_unSendSyscalls++;
+                    if (sendto(m_nUDPSocket, pData, stEntry.siSize, 0, (struct sockaddr*) &stEntry.saTargetAddr, sizeof(sockaddr_in)) != -1)
+                    {
+                        nSent++;
+                        vTargetSent[siIter] = true;
+                    }
+                }
+            }
+
+            m_unPacketsSent += nSent;
+#else
+            // One iovec per packet, shared by all of that packet's destinations. Each message remembers its packet, and whether it is the target.
+            std::vector<struct iovec> vIOVecs(siEntries);
+            std::vector<struct mmsghdr> vMessages;
+            std::vector<size_t> vOwners;
+            vMessages.reserve(siEntries * (vSubscribers.size() + 1));
+            vOwners.reserve(siEntries * (vSubscribers.size() + 1));
+
+            for (size_t siIter = 0; siIter < siEntries; ++siIter)
+            {
+                const RoveCommUDPBatch::BatchEntry& stEntry = stBatch.m_vEntries[siIter];
+                if (stEntry.siSize > ROVECOMM_FRAGMENT_THRESHOLD || (!vToSubscribers[siIter] && !vToTarget[siIter]))
+                {
+                    continue;
+                }
+                vIOVecs[siIter].iov_base = const_cast<uint8_t*>(&stBatch.m_vBytes[stEntry.siOffset]);
+                vIOVecs[siIter].iov_len  = stEntry.siSize;
+
+                // Queue a message for each plain subscriber and for the packet's own destination.
+                for (size_t siDestination = 0; siDestination <= vSubscribers.size(); ++siDestination)
+                {
+                    const sockaddr_in* pAddress = nullptr;
+                    if (siDestination < vSubscribers.size())
+                    {
+                        if (!vToSubscribers[siIter] || (bCoalesce && vSubscribers[siDestination].bCoalesced))
+                        {
+                            continue;
+                        }
+                        pAddress = &vSubscribers[siDestination].saAddress;
+                    }
+                    else if (vToTarget[siIter])
+                    {
+                        pAddress = &stEntry.saTargetAddr;
+                    }
+                    else
+                    {
+                        continue;
+                    }
+
+                    struct mmsghdr stMessage;
+                    memset(&stMessage, 0, sizeof(stMessage));
+                    stMessage.msg_hdr.msg_name    = const_cast<sockaddr_in*>(pAddress);
+                    stMessage.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                    stMessage.msg_hdr.msg_iov     = &vIOVecs[siIter];
+                    stMessage.msg_hdr.msg_iovlen  = 1;
+                    vMessages.push_back(stMessage);
+                    vOwners.push_back(siIter * 2 + (siDestination < vSubscribers.size() ? 0 : 1));
+                }
+            }
+
+            nSent = SendUDPMessages(vMessages.data(), vMessages.size());
+
+            // A zero length means the message was not sent.
+            for (size_t siIter = 0; siIter < vMessages.size(); ++siIter)
+            {
+                if (vMessages[siIter].msg_len > 0)
+                {
+                    std::vector<bool>& vSentTo = vOwners[siIter] % 2 == 0 ? vSubscribersSent : vTargetSent;
+                    vSentTo[vOwners[siIter] / 2] = true;
+                }
+            }
+#endif
+        }
+
+        // The coalescer sends under its own lock, which takes the subscriber lock again, so append after releasing it.
+        for (size_t siIter : vCoalesced)
+        {
+            const RoveCommUDPBatch::BatchEntry& stEntry = stBatch.m_vEntries[siIter];
+            CoalescePacket(&stBatch.m_vBytes[stEntry.siOffset], stEntry.siSize);
+            vSubscribersSent[siIter] = true;
+        }
+
+        // Packets too large for one datagram are split after the rest of the batch is out.
+        for (size_t siIter : vFragmented)
+        {
+            const RoveCommUDPBatch::BatchEntry& stEntry = stBatch.m_vEntries[siIter];
+            bool bSubscribersSent;
+            bool bTargetSent;
+            nSent += SendUDPFragments(&stBatch.m_vBytes[stEntry.siOffset],
+                                      stEntry.siSize,
+                                      vToSubscribers[siIter],
+                                      vToTarget[siIter] ? &stEntry.saTargetAddr : nullptr,
+                                      bSubscribersSent,
+                                      bTargetSent);
+            vSubscribersSent[siIter] = bSubscribersSent;
+            vTargetSent[siIter]      = bTargetSent;
+        }
+
+        // Only destinations that got a packet compare later packets against it.
+        for (size_t siIter = 0; siIter < siEntries; ++siIter)
+        {
+            const RoveCommUDPBatch::BatchEntry& stEntry = stBatch.m_vEntries[siIter];
+            if (vSubscribersSent[siIter])
+            {
+                m_stSendFilter.Commit(&stBatch.m_vBytes[stEntry.siOffset], stEntry.siSize, nullptr);
+            }
+            if (vTargetSent[siIter])
+            {
+                m_stSendFilter.Commit(&stBatch.m_vBytes[stEntry.siOffset], stEntry.siSize, &stEntry.saTargetAddr);
+            }
+        }
+
+        return nSent;
+    }
+
+    /******************************************************************************
+     * @brief Add a callback function to the list of UDP callbacks. The callback
+     *        function will be invoked when a packet with the specified data id is
+     *        received.
+     *
+     * @tparam T - The type of data that the callback function will be invoked with.
+     *             This can be any of the types defined in the manifest.
+     * @param fnCallback - The callback function that is to be added to the list of
+     *                     UDP callbacks.
+     * @param unCondition - The data id that the callback function is to be invoked
+     *                      with. The callback function will only be invoked when a
+     *                      packet with this data id is received.
+     * @return RoveCommCallbackHandle - A handle that removes exactly this callback.
+     *                                  It may be ignored if the callback is never
+     *                                  removed.
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommCallbackHandle RoveCommUDP::AddUDPCallback(std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)> fnCallback, const uint16_t& unCondition)
+    {
+        // Add the callback function to this node's UDP callbacks for the specified data type
+        return m_stCallbacks.Get<T>().Add(fnCallback, unCondition);
+    }
+
+    /******************************************************************************
+     * @brief Remove a callback function from the list of UDP callbacks. The callback
+     *        function will no longer be invoked when a packet with the specified
+     *        data id is received.
+     *
+     * @tparam T - The type of data that the callback function will be invoked with.
+     *             This can be any of the types defined in the manifest.
+     * @param fnCallback - The callback function that is to be removed from the list
+     *                     of UDP callbacks.
+     *
+     * @note Callbacks are matched by their target type, so this removes every
+     *       UDP callback for T whose target has the same type, such as every
+     *       copy of the same lambda. Use the handle returned when the callback was
+     *       added to remove exactly one registration.
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    void RoveCommUDP::RemoveUDPCallback(std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)> fnCallback)
+    {
+        // Remove the callback function from this node's UDP callbacks for the specified data type
+        m_stCallbacks.Get<T>().RemoveIf([&](const auto& fnRegistered) { return fnRegistered.target_type() == fnCallback.target_type(); });
+    }
+
+    /******************************************************************************
+     * @brief Add a view callback function to the list of UDP view callbacks. View
+     *        callbacks receive a RoveCommPacketView over the receive buffer, so no
+     *        memory is allocated or copied before they are invoked.
+     *
+     * @tparam T - The type of data that the callback function will be invoked with.
+     *             This can be any of the types defined in the manifest.
+     * @param fnCallback - The callback function that is to be added to the list of
+     *                     UDP view callbacks.
+     * @param unCondition - The data id that the callback function is to be invoked
+     *                      with. The callback function will only be invoked when a
+     *                      packet with this data id is received.
+     * @return RoveCommCallbackHandle - A handle that removes exactly this callback.
+     *
+     * @note The view is only valid until the callback returns. Use
+     *       RoveCommPacketView::ToPacket() to keep the data.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommCallbackHandle RoveCommUDP::AddUDPViewCallback(std::function<void(const RoveCommPacketView<T>&, const sockaddr_in&)> fnCallback, const uint16_t& unCondition)
+    {
+        // Add the callback function to this node's UDP view callbacks for the specified data type
+        return m_stViewCallbacks.Get<T>().Add(fnCallback, unCondition);
+    }
+
+    /******************************************************************************
+     * @brief Remove a view callback function from the list of UDP view callbacks.
+     *
+     * @tparam T - The type of data that the callback function will be invoked with.
+     *             This can be any of the types defined in the manifest.
+     * @param fnCallback - The callback function that is to be removed from the list
+     *                     of UDP view callbacks.
+     *
+     * @note Callbacks are matched by their target type, so this removes every
+     *       UDP view callback for T whose target has the same type, such as every
+     *       copy of the same lambda. Use the handle returned when the callback was
+     *       added to remove exactly one registration.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    void RoveCommUDP::RemoveUDPViewCallback(std::function<void(const RoveCommPacketView<T>&, const sockaddr_in&)> fnCallback)
+    {
+        // Remove the callback function from this node's UDP view callbacks for the specified data type
+        m_stViewCallbacks.Get<T>().RemoveIf([&](const auto& fnRegistered) { return fnRegistered.target_type() == fnCallback.target_type(); });
+    }
+
+    /******************************************************************************
+     * @brief Get the most recent packet received for a data id, without
+     *        registering a callback. Reading never blocks the receive thread.
+     *
+     * @tparam T - The data type of the RoveCommPacket. Must be one of the
+     *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
+     *             int32_t, float, double, or char.
+     * @param unDataId - The data id to read.
+     * @return RoveCommLatestValue<T> - The packet, its receive time and sequence
+     *                                  number. bValid is false if no packet of this
+     *                                  data id and data type was received yet.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommLatestValue<T> RoveCommUDP::GetLatestValue(const uint16_t& unDataId) const
+    {
+        RoveCommLatestValue<T> stValue;
+        m_stLatestValues.Read<T>(unDataId, stValue);
+        return stValue;
+    }
+
+    /******************************************************************************
+     * @brief Get the most recent packet received for a data id into an existing
+     *        value. Polling into the same value reuses its packet's vector, so it
+     *        does not allocate once the vector has grown to the packet's size.
+     *
+     * @tparam T - The data type of the RoveCommPacket. Must be one of the
+     *             following: uint8_t, int8_t, uint16_t, int16_t, uint32_t,
+     *             int32_t, float, double, or char.
+     * @param unDataId - The data id to read.
+     * @param stValue - Filled with the packet, its receive time and its sequence
+     *                  number.
+     * @return true - A packet of this data id and data type was read.
+     * @return false - No packet of this data id was received yet, or the last one
+     *                 had a different data type.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    bool RoveCommUDP::GetLatestValue(const uint16_t& unDataId, RoveCommLatestValue<T>& stValue) const
+    {
+        return m_stLatestValues.Read<T>(unDataId, stValue);
+    }
+
+    /******************************************************************************
+     * @brief Get how many packets of a data id this node has received. Comparing
+     *        it with the sequence number of the last value read tells a poller
+     *        whether anything new arrived, without decoding the packet.
+     *
+     * @param unDataId - The data id to look up.
+     * @return uint64_t - The number of packets, 0 if none were received.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    uint64_t RoveCommUDP::GetLatestSequence(const uint16_t& unDataId) const
+    {
+        return m_stLatestValues.GetSequence(unDataId);
+    }
+
+    /******************************************************************************
+     * @brief Start keeping a fixed number of samples of a data id. The ring is
+     *        allocated here and filled by the receive thread, so memory use is
+     *        bounded by the capacities passed to this function.
+     *
+     * @param unDataId - The data id to keep.
+     * @param eDataType - The data type of its packets.
+     * @param unDataCount - The number of values kept per sample.
+     * @param siCapacity - The number of samples kept.
+     * @return true - The history was enabled.
+     * @return false - The data count or capacity was zero.
+     *
+     * @note Enabling a data id that already has a history starts a new, empty one.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::EnableHistory(const uint16_t& unDataId, manifest::DataTypes eDataType, uint16_t unDataCount, size_t siCapacity)
+    {
+        return m_stHistory.EnableHistory(unDataId, eDataType, unDataCount, siCapacity);
+    }
+
+    /******************************************************************************
+     * @brief Start keeping a fixed number of samples of a manifest entry, such as
+     *        manifest::Core::TELEMETRY.at("DRIVESPEEDS").
+     *
+     * @param stEntry - The manifest entry to keep.
+     * @param siCapacity - The number of samples kept.
+     * @return true - The history was enabled.
+     * @return false - The data count or capacity was zero.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::EnableHistory(const manifest::ManifestEntry& stEntry, size_t siCapacity)
+    {
+        return m_stHistory.EnableHistory(stEntry, siCapacity);
+    }
+
+    /******************************************************************************
+     * @brief Start keeping a fixed number of samples of every entry in a manifest
+     *        map, such as manifest::Core::TELEMETRY.
+     *
+     * @param mpEntries - The manifest entries to keep.
+     * @param siCapacity - The number of samples kept per data id.
+     * @return true - The history of every entry was enabled.
+     * @return false - At least one entry could not be enabled.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::EnableHistory(const std::map<std::string, manifest::ManifestEntry>& mpEntries, size_t siCapacity)
+    {
+        return m_stHistory.EnableHistory(mpEntries, siCapacity);
+    }
+
+    /******************************************************************************
+     * @brief Get the number of bytes allocated for this node's history rings.
+     *
+     * @return size_t - The memory used by samples.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommUDP::GetHistoryMemoryUsage() const
+    {
+        return m_stHistory.GetMemoryUsage();
+    }
+
+    /******************************************************************************
+     * @brief Get the last samples received for a data id, oldest first. The window
+     *        points into the history ring, so nothing is copied.
+     *
+     * @tparam T - The data type of the packets. Must be one of the following:
+     *             uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t, float,
+     *             double, or char.
+     * @param unDataId - The data id to query.
+     * @param siCount - The number of samples wanted.
+     * @return RoveCommHistoryWindow<T> - The samples, empty if history of this
+     *                                    type is not enabled for the data id.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommHistoryWindow<T> RoveCommUDP::GetLastSamples(const uint16_t& unDataId, size_t siCount) const
+    {
+        return m_stHistory.GetLast<T>(unDataId, siCount);
+    }
+
+    /******************************************************************************
+     * @brief Get the samples of a data id received at or after a point in time,
+     *        oldest first. The window points into the history ring, so nothing is
+     *        copied.
+     *
+     * @tparam T - The data type of the packets. Must be one of the following:
+     *             uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t, float,
+     *             double, or char.
+     * @param unDataId - The data id to query.
+     * @param tmSince - The earliest receive time wanted.
+     * @return RoveCommHistoryWindow<T> - The samples, empty if history of this
+     *                                    type is not enabled for the data id.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    RoveCommHistoryWindow<T> RoveCommUDP::GetSamplesSince(const uint16_t& unDataId, std::chrono::steady_clock::time_point tmSince) const
+    {
+        return m_stHistory.GetSince<T>(unDataId, tmSince);
+    }
+
+    /******************************************************************************
+     * @brief Process a UDP packet and invoke the appropriate callback functions.
+     *        This function is called from the ReceiveUDPPacketAndCallback function
+     *        and is used to invoke the appropriate callback functions based on the
+     *        data id of the received packet. View callbacks are invoked with a view
+     *        over the receive buffer. The payload is only copied into an owning
+     *        RoveCommPacket if a packet callback matches the data id.
+     *
+     * @tparam T - The type of data that the callback function will be invoked with.
+     *             This can be any of the types defined in the manifest.
+     * @param pData - The received bytes that are to be processed.
+     * @param siDataSize - The number of bytes received.
+     * @param saClientAddr - The address of the client that sent the packet.
+     *
+     * @note This function is not intended to be called directly. It is called from
+     *       the ReceiveUDPPacketAndCallback function.
+     *
+     * @author Eli Byrd (edbgkk@mst.edu)
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    void RoveCommUDP::ProcessPacket(const uint8_t* pData, size_t siDataSize, const sockaddr_in& saClientAddr)
+    {
+        // View the received data without copying it.
+        RoveCommPacketView<T> stView = ViewData<T>(pData, siDataSize);
+
+        // Check if the received packet is a subscribe or unsubscribe packet
+        if (stView.unDataId == manifest::System::SUBSCRIBE_DATA_ID)
+        {
+            // Newer nodes put their capabilities in the first element, legacy nodes send 0.
+            uint8_t unFlags = stView.eDataType == manifest::DataTypes::UINT8_T && !stView.empty() ? static_cast<uint8_t>(stView[0]) : 0;
+            AddSubscriber(inet_ntoa(saClientAddr.sin_addr), ntohs(saClientAddr.sin_port), unFlags & ROVECOMM_SUBSCRIBE_COALESCED, unFlags & ROVECOMM_SUBSCRIBE_FRAGMENTS);
+        }
+        else if (stView.unDataId == manifest::System::UNSUBSCRIBE_DATA_ID)
+        {
+            RemoveSubscriber(inet_ntoa(saClientAddr.sin_addr), ntohs(saClientAddr.sin_port));
+        }
+
+        // Pin the current callback snapshots. This never waits on a thread that is adding or removing callbacks.
+        typename RoveCommCallbackRegistry<UDPViewCallback<T>>::Snapshot stViewSnapshot = m_stViewCallbacks.Get<T>().Read();
+        typename RoveCommCallbackRegistry<UDPCallback<T>>::Snapshot stSnapshot         = m_stCallbacks.Get<T>().Read();
+
+        // Invoke the view callbacks registered for this data id.
+        const std::vector<std::function<void(const RoveCommPacketView<T>&, const sockaddr_in&)>>* pViewCallbacks = stViewSnapshot->Find(stView.unDataId);
+        if (pViewCallbacks != nullptr)
+        {
+            for (const std::function<void(const RoveCommPacketView<T>&, const sockaddr_in&)>& fnCallback : *pViewCallbacks)
+            {
+                fnCallback(stView, saClientAddr);
+            }
+        }
+
+        // Invoke the packet callbacks registered for this data id, unpacking the data once for all of them.
+        const std::vector<std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)>>* pCallbacks = stSnapshot->Find(stView.unDataId);
+        if (pCallbacks != nullptr && !pCallbacks->empty())
+        {
+            RoveCommPacket<T> stPacket = stView.ToPacket();
+            for (const std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)>& fnCallback : *pCallbacks)
+            {
+                fnCallback(stPacket, saClientAddr);
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Dispatch a received datagram to the appropriate callback functions.
+     *        Since data types are not known at compile time, this function calls
+     *        the appropriate ProcessPacket function based on the data type of the
+     *        received packet.
      *
+     * @param pData - The received datagram, at least a packet header long.
+     * @param siDataSize - The size of the received datagram in bytes.
+     * @param saClientAddr - The address of the client that sent the packet.
      *
      * @author Eli Byrd (edbgkk@mst.edu)
      * @date 2024-02-07
      ******************************************************************************/
-    RoveCommUDP::~RoveCommUDP()
+    void RoveCommUDP::DispatchUDPPacket(const uint8_t* pData, size_t siDataSize, const sockaddr_in& saClientAddr)
     {
-        CloseUDPSocket();
+        // Determine the data type from the received data
+        // manifest::DataTypes eDataType = manifest::Helpers::GetDataTypeFromId(unDataId);
+        manifest::DataTypes eDataType = static_cast<manifest::DataTypes>(pData[5]);
+
+        // Convert RoveCommData to appropriate RoveCommPacket based on data type
+        switch (eDataType)
+        {
+            case manifest::DataTypes::UINT8_T: ProcessPacket<uint8_t>(pData, siDataSize, saClientAddr); break;
+            case manifest::DataTypes::INT8_T: ProcessPacket<int8_t>(pData, siDataSize, saClientAddr); break;
+            case manifest::DataTypes::UINT16_T: ProcessPacket<uint16_t>(pData, siDataSize, saClientAddr); break;
+            case manifest::DataTypes::INT16_T: ProcessPacket<int16_t>(pData, siDataSize, saClientAddr); break;
+            case manifest::DataTypes::UINT32_T: ProcessPacket<uint32_t>(pData, siDataSize, saClientAddr); break;
+            case manifest::DataTypes::INT32_T: ProcessPacket<int32_t>(pData, siDataSize, saClientAddr); break;
+            case manifest::DataTypes::FLOAT_T: ProcessPacket<float>(pData, siDataSize, saClientAddr); break;
+            case manifest::DataTypes::DOUBLE_T: ProcessPacket<double>(pData, siDataSize, saClientAddr); break;
+            case manifest::DataTypes::CHAR: ProcessPacket<char>(pData, siDataSize, saClientAddr); break;
+        }
     }
 
     /******************************************************************************
-     * @brief Initialize the UDP socket and bind it to the specified port. This
-     *        method also starts the thread that will continuously receive UDP
-     *        packets and invoke the appropriate callback function.
+     * @brief Read up to unMaxPackets queued datagrams from the UDP socket into the
+     *        preallocated receive batch. On Linux this is a single recvmmsg call,
+     *        on Windows it falls back to one recvfrom call per datagram.
      *
-     * @param nPort - The port that the UDP socket is to be bound to. If set to 0,
-     *                then the operating system will automatically assign to an
-     *                available port.
-     * @return true - The UDP socket was successfully initialized and bound.
-     * @return false - An error occurred while initializing the UDP socket.
+     * @param unMaxPackets - The maximum number of datagrams to read. Must not be
+     *                       larger than the receive batch size.
+     * @return unsigned int - The number of datagrams read into the receive batch.
      *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    bool RoveCommUDP::InitUDPSocket(int nPort)
+    unsigned int RoveCommUDP::ReceiveUDPBatch(unsigned int unMaxPackets)
     {
+        unsigned int unReceived = 0;
+
 #if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
-        WSADATA wsaData;
-        if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+        while (unReceived < unMaxPackets)
         {
-            std::cerr << "WSAStartup failed." << std::endl;
-            return 1;
-        }
-#endif
+            socklen_t addrLen          = sizeof(sockaddr_in);
+            ssize_t siUDPBytesReceived = recvfrom(m_nUDPSocket,
+                                                  reinterpret_cast<char*>(&m_vReceiveBuffers[unReceived]),
+                                                  sizeof(RoveCommData),
+                                                  0,
+                                                  (struct sockaddr*) &m_vReceiveAddresses[unReceived],
+                                                  &addrLen);
+            m_unReceiveSyscalls++;
+            if (siUDPBytesReceived == -1)
+            {
+                break;
+            }
 
-        // Create a UDP socket
-        m_nUDPSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-        if (m_nUDPSocket == -1)
+            m_vReceiveSizes[unReceived] = siUDPBytesReceived;
+            unReceived++;
+        }
+#else
+        if (unMaxPackets == 1)
         {
-            perror("Failed to create UDP socket");
-            return false;
+            // A single datagram does not need the extra bookkeeping of recvmmsg.
+            socklen_t addrLen          = sizeof(sockaddr_in);
+            ssize_t siUDPBytesReceived = recvfrom(m_nUDPSocket,
+                                                  &m_vReceiveBuffers[0],
+                                                  sizeof(RoveCommData),
+                                                  MSG_DONTWAIT,
+                                                  (struct sockaddr*) &m_vReceiveAddresses[0],
+                                                  &addrLen);
+            m_unReceiveSyscalls++;
+            if (siUDPBytesReceived != -1)
+            {
+                m_vReceiveSizes[0] = siUDPBytesReceived;
+                unReceived         = 1;
+            }
         }
         else
         {
-#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
-            u_long mode = 1;    // 1 to enable non-blocking mode
-            if (ioctlsocket(m_nUDPSocket, FIONBIO, &mode) == SOCKET_ERROR)
+            // The kernel overwrites the address length on every call, so reset it before each batch.
+            for (unsigned int unIter = 0; unIter < unMaxPackets; ++unIter)
             {
-                // Handle and print error.
-                int err = WSAGetLastError();
-                fprintf(stderr, "Failed to set UDP socket to non-blocking mode. Error code: %d\n", err);
-                return false;
+                m_vReceiveHeaders[unIter].msg_hdr.msg_namelen = sizeof(sockaddr_in);
             }
-#else
-            if (fcntl(m_nUDPSocket, F_SETFL, fcntl(m_nUDPSocket, F_GETFL) | O_NONBLOCK) == -1)
+
+            int nReceived = recvmmsg(m_nUDPSocket, m_vReceiveHeaders.data(), unMaxPackets, MSG_DONTWAIT, nullptr);
+            m_unReceiveSyscalls++;
+            if (nReceived > 0)
             {
-                // Handle and print error.
-                perror("Failed to set UDP socket to non-blocking mode.");
-                return false;
+                for (int nIter = 0; nIter < nReceived; ++nIter)
+                {
+                    m_vReceiveSizes[nIter] = m_vReceiveHeaders[nIter].msg_len;
+                }
+                unReceived = nReceived;
             }
-#endif
-        }
-
-        // Configure the server address
-        sockaddr_in saServerAddr;
-        memset(&saServerAddr, 0, sizeof(saServerAddr));
-        saServerAddr.sin_family      = AF_INET;
-        saServerAddr.sin_addr.s_addr = htonl(INADDR_ANY);
-        saServerAddr.sin_port        = htons(nPort);
-
-        // Bind the socket
-        if (bind(m_nUDPSocket.load(), (struct sockaddr*) &saServerAddr, sizeof(saServerAddr)) == -1)
-        {
-            perror("Failed to bind UDP socket");
-            close(m_nUDPSocket);
-            return false;
         }
+#endif
 
-        // Start the thread
-        Start();
-
-        return true;
+        m_unPacketsReceived += unReceived;
+        return unReceived;
     }
 
     /******************************************************************************
-     * @brief Send a UDP packet to the specified IP address and port. Converts the
-     *        RoveCommPacket into bytes (RoveCommData) and sends it to the specified
-     *        IP address and port.
+     * @brief Receive a batch of UDP packets and invoke the appropriate callback
+     *        functions for each of them, in the order they were received. If
+     *        callbacks are dispatched asynchronously, the packets are queued for
+     *        the dispatch workers instead.
      *
-     * @tparam T - The type of data that is to be sent. This can be any of the types
-     *             defined in the manifest.
-     * @param stPacket - The RoveCommPacket that is to be sent.
-     * @param cIPAddress - The IP address of the client that the packet is to be sent to.
-     * @param nPort - The port that the packet is to be sent to.
-     * @return ssize_t - The number of bytes that were sent. If the return value is
-     *                   less than 0, then an error occurred.
+     * @param unMaxPackets - The maximum number of datagrams to read and dispatch.
+     * @return unsigned int - The number of datagrams that were dispatched. Zero if
+     *                        no datagram was waiting on the socket.
+     *
+     * @note This function is not intended to be called directly. It is called from
+     *       the ThreadedContinuousCode function. The socket is non-blocking, so this
+     *       returns immediately if no packet is waiting.
      *
      * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    template<typename T>
-    ssize_t RoveCommUDP::SendUDPPacket(const RoveCommPacket<T>& stPacket, const char* cIPAddress, int nPort)
+    unsigned int RoveCommUDP::ReceiveUDPPacketAndCallback(unsigned int unMaxPackets)
     {
-        // Pack the RoveCommPacket into a RoveCommData structure
-        RoveCommData stData = PackPacket(stPacket);
-        // Get size of data not including the data not filled. (the null/zero data in RoveCommData)
-        size_t siDataSize = ROVECOMM_PACKET_HEADER_SIZE + (sizeof(T) * stPacket.unDataCount);
-
-        // Setup the base UDP client address
-        struct sockaddr_in saUDPClientAddr;
-        memset(&saUDPClientAddr, 0, sizeof(saUDPClientAddr));
-        saUDPClientAddr.sin_family = AF_INET;
+        unsigned int unReceived = ReceiveUDPBatch(unMaxPackets);
 
-        // Send the packet to all subscribers
-        for (const SubscriberInfo& stSubscriber : vSubscribers)
+        for (unsigned int unIter = 0; unIter < unReceived; ++unIter)
         {
-            // Assemble client address.
-            saUDPClientAddr.sin_port = htons(stSubscriber.nPort);
-            inet_pton(AF_INET, stSubscriber.szIPAddress.c_str(), &saUDPClientAddr.sin_addr);
-            // Send data.
-            if (sendto(m_nUDPSocket, reinterpret_cast<char*>(&stData), siDataSize, 0, (struct sockaddr*) &saUDPClientAddr, sizeof(saUDPClientAddr)) == -1)
-            {
-                // Handle and print error message.
-                perror("Failed to send data to UDP client socket subscriber.");
-            }
-        }
+            const uint8_t* pData = m_vReceiveBuffers[unIter].unBytes;
+            size_t siDataSize    = m_vReceiveSizes[unIter];
 
-        // Send the packet to the specified IP address and port
-        if (std::strcmp(cIPAddress, "0.0.0.0") && nPort != 0)
-        {
-            saUDPClientAddr.sin_port = htons(nPort);
-            inet_pton(AF_INET, cIPAddress, &saUDPClientAddr.sin_addr);
+            // Pollers see the packet as soon as it is read, even if its callbacks are still queued.
+            std::chrono::steady_clock::time_point tmReceived = std::chrono::steady_clock::now();
+            if (siDataSize > 0 && pData[0] == ROVECOMM_COALESCED_VERSION)
+            {
+                // Walk the packets of a coalesced datagram. A malformed one ends the walk, since the next one cannot be found.
+                size_t siOffset = 1;
+                while (siOffset < siDataSize)
+                {
+                    size_t siPacketSize = GetPackedSize(pData + siOffset, siDataSize - siOffset);
+                    if (siPacketSize == 0)
+                    {
+                        break;
+                    }
 
-            return sendto(m_nUDPSocket, reinterpret_cast<char*>(&stData), siDataSize, 0, (struct sockaddr*) &saUDPClientAddr, sizeof(saUDPClientAddr));
+                    HandleUDPPacket(pData + siOffset, siPacketSize, m_vReceiveAddresses[unIter], tmReceived);
+                    siOffset += siPacketSize;
+                }
+            }
+            else if (siDataSize > 0 && pData[0] == ROVECOMM_FRAGMENT_VERSION)
+            {
+                // A fragment is handled once it completes its packet.
+                RoveCommBufferPool::Buffer stPacket;
+                if (m_stReassembler.Add(pData, siDataSize, m_vReceiveAddresses[unIter], tmReceived, stPacket))
+                {
+                    HandleUDPPacket(stPacket.data(), stPacket.size(), m_vReceiveAddresses[unIter], tmReceived);
+                }
+            }
+            else if (siDataSize >= ROVECOMM_PACKET_HEADER_SIZE)
+            {
+                // Ignore runt datagrams that cannot hold a RoveComm header.
+                HandleUDPPacket(pData, siDataSize, m_vReceiveAddresses[unIter], tmReceived);
+            }
         }
 
-        return -1;
+        return unReceived;
     }
 
     /******************************************************************************
-     * @brief Add a callback function to the list of UDP callbacks. The callback
-     *        function will be invoked when a packet with the specified data id is
-     *        received.
+     * @brief Record a single received packet for pollers and invoke its callbacks,
+     *        or queue it for the dispatch workers.
      *
-     * @tparam T - The type of data that the callback function will be invoked with.
-     *             This can be any of the types defined in the manifest.
-     * @param fnCallback - The callback function that is to be added to the list of
-     *                     UDP callbacks.
-     * @param unCondition - The data id that the callback function is to be invoked
-     *                      with. The callback function will only be invoked when a
-     *                      packet with this data id is received.
+     * @param pData - The packed packet, either a whole datagram or one packet of a
+     *                coalesced datagram.
+     * @param siDataSize - The packed size of the packet.
+     * @param saClientAddr - The address the packet was received from.
+     * @param tmReceived - The time the datagram was read.
      *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    template<typename T>
-    void RoveCommUDP::AddUDPCallback(std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)> fnCallback, const uint16_t& unCondition)
+    void RoveCommUDP::HandleUDPPacket(const uint8_t* pData, size_t siDataSize, const sockaddr_in& saClientAddr, std::chrono::steady_clock::time_point tmReceived)
     {
-        // Acquire a write lock to protect the callback vectors.
-        std::unique_lock<std::shared_mutex> lkCallbackLock(m_muCallbackMutex);
+        m_stLatestValues.Update(pData, siDataSize, tmReceived);
+        m_stHistory.Update(pData, siDataSize, tmReceived);
 
-        // Add the callback function to the vector of UDP callbacks for the specified data type
-        if constexpr (std::is_same_v<T, uint8_t>)
-        {
-            // Add the callback function to the vector of uint8_t callbacks
-            udp::vUInt8Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, int8_t>)
-        {
-            // Add the callback function to the vector of int8_t callbacks
-            udp::vInt8Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, uint16_t>)
-        {
-            // Add the callback function to the vector of uint16_t callbacks
-            udp::vUInt16Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, int16_t>)
-        {
-            // Add the callback function to the vector of int16_t callbacks
-            udp::vInt16Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, uint32_t>)
-        {
-            // Add the callback function to the vector of uint32_t callbacks
-            udp::vUInt32Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, int32_t>)
-        {
-            // Add the callback function to the vector of int32_t callbacks
-            udp::vInt32Callbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, float>)
-        {
-            // Add the callback function to the vector of float callbacks
-            udp::vFloatCallbacks.push_back(std::make_tuple(fnCallback, unCondition));
-        }
-        else if constexpr (std::is_same_v<T, double>)
+        if (m_pDispatcher != nullptr)
         {
-            // Add the callback function to the vector of double callbacks
-            udp::vDoubleCallbacks.push_back(std::make_tuple(fnCallback, unCondition));
+            m_pDispatcher->Push(pData, siDataSize, saClientAddr);
         }
-        else if constexpr (std::is_same_v<T, char>)
+        else
         {
-            // Add the callback function to the vector of char callbacks
-            udp::vCharCallbacks.push_back(std::make_tuple(fnCallback, unCondition));
+            DispatchUDPPacket(pData, siDataSize, saClientAddr);
         }
     }
 
     /******************************************************************************
-     * @brief Remove a callback function from the list of UDP callbacks. The callback
-     *        function will no longer be invoked when a packet with the specified
-     *        data id is received.
-     *
-     * @tparam T - The type of data that the callback function will be invoked with.
-     *             This can be any of the types defined in the manifest.
-     * @param fnCallback - The callback function that is to be removed from the list
-     *                     of UDP callbacks.
+     * @brief Allocate the receive buffers, addresses and message headers used by
+     *        ReceiveUDPBatch(). This is done once when the socket is initialized so
+     *        the receive loop never allocates.
      *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    template<typename T>
-    void RoveCommUDP::RemoveUDPCallback(std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)> fnCallback)
+    void RoveCommUDP::AllocateReceiveBatch()
     {
-        // Acquire a write lock to protect the callback vectors.
-        std::unique_lock<std::shared_mutex> lkCallbackLock(m_muCallbackMutex);
+        m_vReceiveBuffers.resize(m_unReceiveBatchSize);
+        m_vReceiveAddresses.resize(m_unReceiveBatchSize);
+        m_vReceiveSizes.resize(m_unReceiveBatchSize);
 
-        // Remove the callback function from the vector of UDP callbacks for the specified data type
-        if constexpr (std::is_same_v<T, uint8_t>)
-        {
-            // Remove the callback function from the vector of uint8_t callbacks
-            udp::vUInt8Callbacks.erase(std::remove_if(udp::vUInt8Callbacks.begin(),
-                                                      udp::vUInt8Callbacks.end(),
-                                                      [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                       udp::vUInt8Callbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, int8_t>)
-        {
-            // Remove the callback function from the vector of int8_t callbacks
-            udp::vInt8Callbacks.erase(std::remove_if(udp::vInt8Callbacks.begin(),
-                                                     udp::vInt8Callbacks.end(),
-                                                     [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                      udp::vInt8Callbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, uint16_t>)
-        {
-            // Remove the callback function from the vector of uint16_t callbacks
-            udp::vUInt16Callbacks.erase(std::remove_if(udp::vUInt16Callbacks.begin(),
-                                                       udp::vUInt16Callbacks.end(),
-                                                       [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                        udp::vUInt16Callbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, int16_t>)
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+        m_vReceiveHeaders.resize(m_unReceiveBatchSize);
+        m_vReceiveIOVecs.resize(m_unReceiveBatchSize);
+        for (unsigned int unIter = 0; unIter < m_unReceiveBatchSize; ++unIter)
         {
-            // Remove the callback function from the vector of int16_t callbacks
-            udp::vInt16Callbacks.erase(std::remove_if(udp::vInt16Callbacks.begin(),
-                                                      udp::vInt16Callbacks.end(),
-                                                      [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                       udp::vInt16Callbacks.end());
-        }
-        else if constexpr (std::is_same_v<T, uint32_t>)
-        {
-            // Remove the callback function from the vector of uint32_t callbacks
-            udp::vUInt32Callbacks.erase(std::remove_if(udp::vUInt32Callbacks.begin(),
-                                                       udp::vUInt32Callbacks.end(),
-                                                       [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                        udp::vUInt32Callbacks.end());
+            // Point each message header at its own buffer and address.
+            m_vReceiveIOVecs[unIter].iov_base = &m_vReceiveBuffers[unIter];
+            m_vReceiveIOVecs[unIter].iov_len  = sizeof(RoveCommData);
+
+            memset(&m_vReceiveHeaders[unIter], 0, sizeof(struct mmsghdr));
+            m_vReceiveHeaders[unIter].msg_hdr.msg_name    = &m_vReceiveAddresses[unIter];
+            m_vReceiveHeaders[unIter].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            m_vReceiveHeaders[unIter].msg_hdr.msg_iov     = &m_vReceiveIOVecs[unIter];
+            m_vReceiveHeaders[unIter].msg_hdr.msg_iovlen  = 1;
         }
-        else if constexpr (std::is_same_v<T, int32_t>)
+#endif
+    }
+
+    /******************************************************************************
+     * @brief Create the epoll instance and the wakeup eventfd used by the
+     *        event-driven receive mode. The UDP socket and the eventfd are both
+     *        registered so the receive thread can sleep until either data arrives
+     *        or CloseUDPSocket() asks it to stop.
+     *
+     * @return true - The event objects were created and registered.
+     * @return false - An error occurred while creating the event objects.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDP::InitReceiveEvents()
+    {
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        // Windows has no epoll/eventfd, WaitForUDPData() falls back to WSAPoll with a timeout.
+        return true;
+#else
+        // Create the epoll instance.
+        m_nEpollFD = epoll_create1(EPOLL_CLOEXEC);
+        if (m_nEpollFD == -1)
         {
-            // Remove the callback function from the vector of int32_t callbacks
-            udp::vInt32Callbacks.erase(std::remove_if(udp::vInt32Callbacks.begin(),
-                                                      udp::vInt32Callbacks.end(),
-                                                      [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                       udp::vInt32Callbacks.end());
+            perror("Failed to create UDP epoll instance");
+            return false;
         }
-        else if constexpr (std::is_same_v<T, float>)
+
+        // Create the eventfd used to wake the receive thread on shutdown.
+        m_nWakeupFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_nWakeupFD == -1)
         {
-            // Remove the callback function from the vector of float callbacks
-            udp::vFloatCallbacks.erase(std::remove_if(udp::vFloatCallbacks.begin(),
-                                                      udp::vFloatCallbacks.end(),
-                                                      [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                       udp::vFloatCallbacks.end());
+            perror("Failed to create UDP wakeup eventfd");
+            CloseReceiveEvents();
+            return false;
         }
-        else if constexpr (std::is_same_v<T, double>)
+
+        // Register the UDP socket and the wakeup eventfd.
+        struct epoll_event stEvent;
+        memset(&stEvent, 0, sizeof(stEvent));
+        stEvent.events  = EPOLLIN;
+        stEvent.data.fd = m_nUDPSocket;
+        if (epoll_ctl(m_nEpollFD, EPOLL_CTL_ADD, m_nUDPSocket, &stEvent) == -1)
         {
-            // Remove the callback function from the vector of double callbacks
-            udp::vDoubleCallbacks.erase(std::remove_if(udp::vDoubleCallbacks.begin(),
-                                                       udp::vDoubleCallbacks.end(),
-                                                       [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                        udp::vDoubleCallbacks.end());
+            perror("Failed to register UDP socket with epoll");
+            CloseReceiveEvents();
+            return false;
         }
-        else if constexpr (std::is_same_v<T, char>)
+
+        stEvent.data.fd = m_nWakeupFD;
+        if (epoll_ctl(m_nEpollFD, EPOLL_CTL_ADD, m_nWakeupFD, &stEvent) == -1)
         {
-            // Remove the callback function from the vector of char callbacks
-            udp::vCharCallbacks.erase(std::remove_if(udp::vCharCallbacks.begin(),
-                                                     udp::vCharCallbacks.end(),
-                                                     [&](const auto& tuple) { return std::get<0>(tuple).target_type() == fnCallback.target_type(); }),
-                                      udp::vCharCallbacks.end());
+            perror("Failed to register UDP wakeup eventfd with epoll");
+            CloseReceiveEvents();
+            return false;
         }
+
+        return true;
+#endif
     }
 
     /******************************************************************************
-     * @brief Process a UDP packet and invoke the appropriate callback function.
-     *        This function is called from the ReceiveUDPPacketAndCallback function
-     *        and is used to invoke the appropriate callback function based on the
-     *        data id of the received packet. The callback function is invoked with
-     *        the received packet and the client address.
-     *
-     * @tparam T - The type of data that the callback function will be invoked with.
-     *             This can be any of the types defined in the manifest.
-     * @param stData - The received RoveCommData that is to be processed.
-     * @param vCallbacks - The list of callback functions that are to be invoked when
-     *                    a packet with the specified data id is received.
-     * @param saClientAddr - The address of the client that sent the packet.
+     * @brief Block the receive thread until the UDP socket is readable, the node
+     *        is asked to stop, or ROVECOMM_EVENT_WAIT_TIMEOUT_MS elapses.
      *
-     * @note This function is not intended to be called directly. It is called from
-     *       the ReceiveUDPPacketAndCallback function.
+     * @return true - The UDP socket has data waiting to be read.
+     * @return false - The wait timed out or was interrupted by WakeReceiveThread().
      *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    template<typename T>
-    void RoveCommUDP::ProcessPacket(const RoveCommData& stData,
-                                    const std::vector<std::tuple<std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)>, uint32_t>>& vCallbacks,
-                                    const sockaddr_in& saClientAddr)
+    bool RoveCommUDP::WaitForUDPData()
     {
-        // Unpack the received data into a RoveCommPacket
-        RoveCommPacket<T> stPacket = UnpackData<T>(stData);
+#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
+        WSAPOLLFD stPollFD;
+        stPollFD.fd      = m_nUDPSocket;
+        stPollFD.events  = POLLRDNORM;
+        stPollFD.revents = 0;
 
-        // Create a SubscriberInfo struct to store the client address
-        SubscriberInfo stSubscriber;
-        stSubscriber.szIPAddress = inet_ntoa(saClientAddr.sin_addr);
-        stSubscriber.nPort       = ntohs(saClientAddr.sin_port);
+        m_unWaitSyscalls++;
+        return WSAPoll(&stPollFD, 1, rovecomm::ROVECOMM_EVENT_WAIT_TIMEOUT_MS) > 0;
+#else
+        struct epoll_event aEvents[2];
+        int nReady = epoll_wait(m_nEpollFD, aEvents, 2, rovecomm::ROVECOMM_EVENT_WAIT_TIMEOUT_MS);
+        m_unWaitSyscalls++;
 
-        // Check if the received packet is a subscribe or unsubscribe packet
-        if (stPacket.unDataId == manifest::System::SUBSCRIBE_DATA_ID)
-        {
-            AddSubscriber(stSubscriber.szIPAddress, stSubscriber.nPort);
-        }
-        else if (stPacket.unDataId == manifest::System::UNSUBSCRIBE_DATA_ID)
+        bool bReadable = false;
+        for (int nIter = 0; nIter < nReady; ++nIter)
         {
-            RemoveSubscriber(stSubscriber.szIPAddress, stSubscriber.nPort);
+            if (aEvents[nIter].data.fd == m_nWakeupFD)
+            {
+                // Consume the wakeup so the next wait blocks again.
+                uint64_t unWakeups;
+                if (read(m_nWakeupFD, &unWakeups, sizeof(unWakeups)) == -1 && errno != EAGAIN)
+                {
+                    perror("Failed to read UDP wakeup eventfd");
+                }
+            }
+            else
+            {
+                bReadable = true;
+            }
         }
 
-        // Acquire a read lock to protect the callback vectors.
-        std::shared_lock<std::shared_mutex> lkCallbackLock(m_muCallbackMutex);
+        return bReadable;
+#endif
+    }
 
-        // Invoke registered callbacks
-        for (const std::tuple<std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)>, uint32_t>& tpCallbackInfo : vCallbacks)
+    /******************************************************************************
+     * @brief Interrupt a receive thread that is sleeping in WaitForUDPData().
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDP::WakeReceiveThread()
+    {
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+        if (m_nWakeupFD != -1)
         {
-            const std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)>& fnCallback = std::get<0>(tpCallbackInfo);
-            const uint32_t& unCondition                                                         = std::get<1>(tpCallbackInfo);
-
-            if (unCondition == stPacket.unDataId)
+            uint64_t unWakeup = 1;
+            if (write(m_nWakeupFD, &unWakeup, sizeof(unWakeup)) == -1)
             {
-                fnCallback(stPacket, saClientAddr);
+                perror("Failed to write UDP wakeup eventfd");
             }
         }
+#endif
     }
 
     /******************************************************************************
-     * @brief Receive a UDP packet and invoke the appropriate callback function.
-     *        Since data types are not known at compile time, this function calls
-     *        the appropriate ProcessPacket function based on the data type of the
-     *        received packet.
-     *
-     * @note This function is not intended to be called directly. It is called from
-     *       the ThreadedContinuousCode function. If this is called directly, it
-     *       will block the thread until a packet is received.
+     * @brief Close the epoll instance and wakeup eventfd used by the event-driven
+     *        receive mode.
      *
-     * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    void RoveCommUDP::ReceiveUDPPacketAndCallback()
+    void RoveCommUDP::CloseReceiveEvents()
     {
-        RoveCommData stData;
-        sockaddr_in saClientAddr;
-        socklen_t addrLen = sizeof(saClientAddr);
-
-#if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
-        ssize_t siUDPBytesReceived = recvfrom(m_nUDPSocket, reinterpret_cast<char*>(&stData), sizeof(stData), 0, (struct sockaddr*) &saClientAddr, &addrLen);
-#else
-        ssize_t siUDPBytesReceived = recvfrom(m_nUDPSocket, &stData, sizeof(stData), MSG_DONTWAIT, (struct sockaddr*) &saClientAddr, &addrLen);
-#endif
-
-        if (siUDPBytesReceived != -1)
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+        if (m_nWakeupFD != -1)
         {
-            // Extract the data id from the received data
-            uint16_t unDataId = (static_cast<uint16_t>(stData.unBytes[1]) << 8) | static_cast<uint16_t>(stData.unBytes[2]);
-            // Determine the data type from the received data
-            // manifest::DataTypes eDataType = manifest::Helpers::GetDataTypeFromId(unDataId);
-            manifest::DataTypes eDataType = static_cast<manifest::DataTypes>(stData.unBytes[5]);
+            close(m_nWakeupFD);
+            m_nWakeupFD = -1;
+        }
 
-            // Convert RoveCommData to appropriate RoveCommPacket based on data type
-            switch (eDataType)
-            {
-                case manifest::DataTypes::UINT8_T: ProcessPacket<uint8_t>(stData, udp::vUInt8Callbacks, saClientAddr); break;
-                case manifest::DataTypes::INT8_T: ProcessPacket<int8_t>(stData, udp::vInt8Callbacks, saClientAddr); break;
-                case manifest::DataTypes::UINT16_T: ProcessPacket<uint16_t>(stData, udp::vUInt16Callbacks, saClientAddr); break;
-                case manifest::DataTypes::INT16_T: ProcessPacket<int16_t>(stData, udp::vInt16Callbacks, saClientAddr); break;
-                case manifest::DataTypes::UINT32_T: ProcessPacket<uint32_t>(stData, udp::vUInt32Callbacks, saClientAddr); break;
-                case manifest::DataTypes::INT32_T: ProcessPacket<int32_t>(stData, udp::vInt32Callbacks, saClientAddr); break;
-                case manifest::DataTypes::FLOAT_T: ProcessPacket<float>(stData, udp::vFloatCallbacks, saClientAddr); break;
-                case manifest::DataTypes::DOUBLE_T: ProcessPacket<double>(stData, udp::vDoubleCallbacks, saClientAddr); break;
-                case manifest::DataTypes::CHAR: ProcessPacket<char>(stData, udp::vCharCallbacks, saClientAddr); break;
-            }
+        if (m_nEpollFD != -1)
+        {
+            close(m_nEpollFD);
+            m_nEpollFD = -1;
         }
+#endif
     }
 
     /******************************************************************************
@@ -467,25 +2352,51 @@ namespace rovecomm
      *
      * @param szIPAddress - The IP address of the subscriber.
      * @param nPort - The port that the subscriber is listening on.
+     * @param bCoalesced - The subscriber can parse coalesced datagrams.
+     * @param bFragments - The subscriber can reassemble fragmented packets.
      *
      * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-08
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    void RoveCommUDP::AddSubscriber(const std::string& szIPAddress, const int& nPort)
+    void RoveCommUDP::AddSubscriber(const std::string& szIPAddress, const int& nPort, bool bCoalesced, bool bFragments)
     {
+        // Acquire a write lock to protect the subscriber vector.
+        std::unique_lock<std::shared_mutex> lkSubscriberLock(m_muSubscriberMutex);
+
+        // Check if the subscriber is already in the list, a full list still takes a change of its capabilities.
+        for (auto& subscriber : vSubscribers)
+        {
+            if (subscriber.szIPAddress == szIPAddress && subscriber.nPort == nPort)
+            {
+                subscriber.bCoalesced = bCoalesced;    // Subscriber already exists, only its capabilities may have changed
+                subscriber.bFragments = bFragments;
+                return;
+            }
+        }
+
         if (vSubscribers.size() < ROVECOMM_ETHERNET_UDP_MAX_SUBSCRIBERS)
         {
-            // Check if the subscriber is already in the list
-            for (const auto& subscriber : vSubscribers)
+            // Resolve the subscriber's address once so sends can use it directly.
+            SubscriberInfo stSubscriber;
+            stSubscriber.szIPAddress = szIPAddress;
+            stSubscriber.nPort       = nPort;
+            stSubscriber.bCoalesced  = bCoalesced;
+            stSubscriber.bFragments  = bFragments;
+            memset(&stSubscriber.saAddress, 0, sizeof(stSubscriber.saAddress));
+            stSubscriber.saAddress.sin_family = AF_INET;
+            stSubscriber.saAddress.sin_port   = htons(nPort);
+            if (inet_pton(AF_INET, szIPAddress.c_str(), &stSubscriber.saAddress.sin_addr) != 1)
             {
-                if (subscriber.szIPAddress == szIPAddress && subscriber.nPort == nPort)
-                {
-                    return;    // Subscriber already exists, no need to add again
-                }
+                std::cerr << "Invalid UDP subscriber address: " << szIPAddress << std::endl;
+                return;
             }
 
             // Add new subscriber
-            vSubscribers.push_back({szIPAddress, nPort});
+            vSubscribers.push_back(stSubscriber);
+
+            // The subscribers share one last sent packet in the send filter, which the new one never received.
+            m_stSendFilter.ResetDestination(nullptr);
         }
     }
 
@@ -502,6 +2413,9 @@ namespace rovecomm
      ******************************************************************************/
     void RoveCommUDP::RemoveSubscriber(const std::string& szIPAddress, const int& nPort)
     {
+        // Acquire a write lock to protect the subscriber vector.
+        std::unique_lock<std::shared_mutex> lkSubscriberLock(m_muSubscriberMutex);
+
         // Find and remove the subscriber
         vSubscribers.erase(
             std::remove_if(vSubscribers.begin(), vSubscribers.end(), [&](const SubscriberInfo& info) { return info.szIPAddress == szIPAddress && info.nPort == nPort; }),
@@ -517,44 +2431,87 @@ namespace rovecomm
      *       the AutonomyThread class. After the thread has been started.
      *
      * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
     void RoveCommUDP::ThreadedContinuousCode()
     {
-        ReceiveUDPPacketAndCallback();
+        if (m_eReceiveMode == eEventDriven)
+        {
+            // Sleep until data arrives, then drain every queued datagram before sleeping again. A short
+            // batch means the socket queue is empty, so go back to sleep instead of paying for an empty read.
+            if (WaitForUDPData())
+            {
+                while (ReceiveUDPPacketAndCallback(m_unReceiveBatchSize) == m_unReceiveBatchSize)
+                {
+                }
+            }
+            else
+            {
+                // Free the buffers of fragmented packets that stopped arriving while the socket was idle.
+                m_stReassembler.Expire();
+            }
+        }
+        else
+        {
+            // The legacy mode reads a single datagram per iteration.
+            ReceiveUDPPacketAndCallback(1);
+        }
     }
 
     /******************************************************************************
      * @brief This method holds the code that is ran in the thread pool started by
-     *        the ThreadedLinearCode() method. It currently does nothing and is not
-     *        needed in the current implementation of the RoveCommUDP class.
+     *        RunDetachedPool(). Each task is one dispatch worker, which runs the
+     *        callbacks for queued packets until the dispatch queues are closed
+     *        and drained. The first tasks serve the dedicated priority lanes.
      *
      * @note This function is not intended to be called directly. It is called from
      *       the AutonomyThread class. After the thread pool has been started.
      *
      * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
-    void RoveCommUDP::PooledLinearCode() {}
+    void RoveCommUDP::PooledLinearCode()
+    {
+        RoveCommDispatchQueue::Consumer fnDispatch = [this](const uint8_t* pData, size_t siDataSize, const sockaddr_in& saClientAddr)
+        { DispatchUDPPacket(pData, siDataSize, saClientAddr); };
+
+        m_pDispatcher->RunWorker(fnDispatch);
+    }
 
     /******************************************************************************
      * @brief Close the UDP socket. This method is called when the RoveCommUDP
      *        object is destroyed. Or when the user calls the CloseUDPSocket method.
      *
      * @author Eli Byrd (edbgkk@mst.edu)
-     * @date 2024-02-07
+     * @author agent (agent@local)
+     * @date 2026-10-17
      ******************************************************************************/
     void RoveCommUDP::CloseUDPSocket()
     {
         // Check if the socket is open
         if (m_nUDPSocket != -1)
         {
-            // Stop the thread
+            // Stop sending publishers, then send the last coalesced datagram, before the socket goes away.
+            m_stPublishers.Disable();
+            m_stCoalescer.Disable();
+
+            // Stop the thread, waking it if it is sleeping in the kernel.
             RequestStop();
+            WakeReceiveThread();
+
+            // Let the dispatch workers finish the queued packets and exit.
+            if (m_pDispatcher != nullptr)
+            {
+                m_pDispatcher->Close();
+            }
             Join();
 
             // Close the socket
+            CloseReceiveEvents();
             CLOSE_SOCKET(m_nUDPSocket);
+            m_nUDPSocket = -1;
 
 #if defined(__ROVECOMM_WINDOWS_MODE__) && __ROVECOMM_WINDOWS_MODE__ == 1
             WSACleanup();
@@ -564,39 +2521,112 @@ namespace rovecomm
 
     // Explicitly define template function types
     template ssize_t RoveCommUDP::SendUDPPacket<uint8_t>(const RoveCommPacket<uint8_t>&, const char*, int);
-    template void RoveCommUDP::AddUDPCallback<uint8_t>(std::function<void(const RoveCommPacket<uint8_t>&, const sockaddr_in&)>, const uint16_t&);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPCallback<uint8_t>(std::function<void(const RoveCommPacket<uint8_t>&, const sockaddr_in&)>, const uint16_t&);
     template void RoveCommUDP::RemoveUDPCallback<uint8_t>(std::function<void(const RoveCommPacket<uint8_t>&, const sockaddr_in&)>);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPViewCallback<uint8_t>(std::function<void(const RoveCommPacketView<uint8_t>&, const sockaddr_in&)>, const uint16_t&);
+    template void RoveCommUDP::RemoveUDPViewCallback<uint8_t>(std::function<void(const RoveCommPacketView<uint8_t>&, const sockaddr_in&)>);
+    template void RoveCommUDP::ProcessPacket<uint8_t>(const uint8_t*, size_t, const sockaddr_in&);
+    template RoveCommLatestValue<uint8_t> RoveCommUDP::GetLatestValue<uint8_t>(const uint16_t&) const;
+    template bool RoveCommUDP::GetLatestValue<uint8_t>(const uint16_t&, RoveCommLatestValue<uint8_t>&) const;
+    template RoveCommHistoryWindow<uint8_t> RoveCommUDP::GetLastSamples<uint8_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<uint8_t> RoveCommUDP::GetSamplesSince<uint8_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
     template ssize_t RoveCommUDP::SendUDPPacket<int8_t>(const RoveCommPacket<int8_t>&, const char*, int);
-    template void RoveCommUDP::AddUDPCallback<int8_t>(std::function<void(const RoveCommPacket<int8_t>&, const sockaddr_in&)>, const uint16_t&);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPCallback<int8_t>(std::function<void(const RoveCommPacket<int8_t>&, const sockaddr_in&)>, const uint16_t&);
     template void RoveCommUDP::RemoveUDPCallback<int8_t>(std::function<void(const RoveCommPacket<int8_t>&, const sockaddr_in&)>);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPViewCallback<int8_t>(std::function<void(const RoveCommPacketView<int8_t>&, const sockaddr_in&)>, const uint16_t&);
+    template void RoveCommUDP::RemoveUDPViewCallback<int8_t>(std::function<void(const RoveCommPacketView<int8_t>&, const sockaddr_in&)>);
+    template void RoveCommUDP::ProcessPacket<int8_t>(const uint8_t*, size_t, const sockaddr_in&);
+    template RoveCommLatestValue<int8_t> RoveCommUDP::GetLatestValue<int8_t>(const uint16_t&) const;
+    template bool RoveCommUDP::GetLatestValue<int8_t>(const uint16_t&, RoveCommLatestValue<int8_t>&) const;
+    template RoveCommHistoryWindow<int8_t> RoveCommUDP::GetLastSamples<int8_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<int8_t> RoveCommUDP::GetSamplesSince<int8_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
     template ssize_t RoveCommUDP::SendUDPPacket<uint16_t>(const RoveCommPacket<uint16_t>&, const char*, int);
-    template void RoveCommUDP::AddUDPCallback<uint16_t>(std::function<void(const RoveCommPacket<uint16_t>&, const sockaddr_in&)>, const uint16_t&);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPCallback<uint16_t>(std::function<void(const RoveCommPacket<uint16_t>&, const sockaddr_in&)>, const uint16_t&);
     template void RoveCommUDP::RemoveUDPCallback<uint16_t>(std::function<void(const RoveCommPacket<uint16_t>&, const sockaddr_in&)>);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPViewCallback<uint16_t>(std::function<void(const RoveCommPacketView<uint16_t>&, const sockaddr_in&)>, const uint16_t&);
+    template void RoveCommUDP::RemoveUDPViewCallback<uint16_t>(std::function<void(const RoveCommPacketView<uint16_t>&, const sockaddr_in&)>);
+    template void RoveCommUDP::ProcessPacket<uint16_t>(const uint8_t*, size_t, const sockaddr_in&);
+    template RoveCommLatestValue<uint16_t> RoveCommUDP::GetLatestValue<uint16_t>(const uint16_t&) const;
+    template bool RoveCommUDP::GetLatestValue<uint16_t>(const uint16_t&, RoveCommLatestValue<uint16_t>&) const;
+    template RoveCommHistoryWindow<uint16_t> RoveCommUDP::GetLastSamples<uint16_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<uint16_t> RoveCommUDP::GetSamplesSince<uint16_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
     template ssize_t RoveCommUDP::SendUDPPacket<int16_t>(const RoveCommPacket<int16_t>&, const char*, int);
-    template void RoveCommUDP::AddUDPCallback<int16_t>(std::function<void(const RoveCommPacket<int16_t>&, const sockaddr_in&)>, const uint16_t&);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPCallback<int16_t>(std::function<void(const RoveCommPacket<int16_t>&, const sockaddr_in&)>, const uint16_t&);
     template void RoveCommUDP::RemoveUDPCallback<int16_t>(std::function<void(const RoveCommPacket<int16_t>&, const sockaddr_in&)>);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPViewCallback<int16_t>(std::function<void(const RoveCommPacketView<int16_t>&, const sockaddr_in&)>, const uint16_t&);
+    template void RoveCommUDP::RemoveUDPViewCallback<int16_t>(std::function<void(const RoveCommPacketView<int16_t>&, const sockaddr_in&)>);
+    template void RoveCommUDP::ProcessPacket<int16_t>(const uint8_t*, size_t, const sockaddr_in&);
+    template RoveCommLatestValue<int16_t> RoveCommUDP::GetLatestValue<int16_t>(const uint16_t&) const;
+    template bool RoveCommUDP::GetLatestValue<int16_t>(const uint16_t&, RoveCommLatestValue<int16_t>&) const;
+    template RoveCommHistoryWindow<int16_t> RoveCommUDP::GetLastSamples<int16_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<int16_t> RoveCommUDP::GetSamplesSince<int16_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
     template ssize_t RoveCommUDP::SendUDPPacket<uint32_t>(const RoveCommPacket<uint32_t>&, const char*, int);
-    template void RoveCommUDP::AddUDPCallback<uint32_t>(std::function<void(const RoveCommPacket<uint32_t>&, const sockaddr_in&)>, const uint16_t&);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPCallback<uint32_t>(std::function<void(const RoveCommPacket<uint32_t>&, const sockaddr_in&)>, const uint16_t&);
     template void RoveCommUDP::RemoveUDPCallback<uint32_t>(std::function<void(const RoveCommPacket<uint32_t>&, const sockaddr_in&)>);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPViewCallback<uint32_t>(std::function<void(const RoveCommPacketView<uint32_t>&, const sockaddr_in&)>, const uint16_t&);
+    template void RoveCommUDP::RemoveUDPViewCallback<uint32_t>(std::function<void(const RoveCommPacketView<uint32_t>&, const sockaddr_in&)>);
+    template void RoveCommUDP::ProcessPacket<uint32_t>(const uint8_t*, size_t, const sockaddr_in&);
+    template RoveCommLatestValue<uint32_t> RoveCommUDP::GetLatestValue<uint32_t>(const uint16_t&) const;
+    template bool RoveCommUDP::GetLatestValue<uint32_t>(const uint16_t&, RoveCommLatestValue<uint32_t>&) const;
+    template RoveCommHistoryWindow<uint32_t> RoveCommUDP::GetLastSamples<uint32_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<uint32_t> RoveCommUDP::GetSamplesSince<uint32_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
     template ssize_t RoveCommUDP::SendUDPPacket<int32_t>(const RoveCommPacket<int32_t>&, const char*, int);
-    template void RoveCommUDP::AddUDPCallback<int32_t>(std::function<void(const RoveCommPacket<int32_t>&, const sockaddr_in&)>, const uint16_t&);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPCallback<int32_t>(std::function<void(const RoveCommPacket<int32_t>&, const sockaddr_in&)>, const uint16_t&);
     template void RoveCommUDP::RemoveUDPCallback<int32_t>(std::function<void(const RoveCommPacket<int32_t>&, const sockaddr_in&)>);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPViewCallback<int32_t>(std::function<void(const RoveCommPacketView<int32_t>&, const sockaddr_in&)>, const uint16_t&);
+    template void RoveCommUDP::RemoveUDPViewCallback<int32_t>(std::function<void(const RoveCommPacketView<int32_t>&, const sockaddr_in&)>);
+    template void RoveCommUDP::ProcessPacket<int32_t>(const uint8_t*, size_t, const sockaddr_in&);
+    template RoveCommLatestValue<int32_t> RoveCommUDP::GetLatestValue<int32_t>(const uint16_t&) const;
+    template bool RoveCommUDP::GetLatestValue<int32_t>(const uint16_t&, RoveCommLatestValue<int32_t>&) const;
+    template RoveCommHistoryWindow<int32_t> RoveCommUDP::GetLastSamples<int32_t>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<int32_t> RoveCommUDP::GetSamplesSince<int32_t>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
     template ssize_t RoveCommUDP::SendUDPPacket<float>(const RoveCommPacket<float>&, const char*, int);
-    template void RoveCommUDP::AddUDPCallback<float>(std::function<void(const RoveCommPacket<float>&, const sockaddr_in&)>, const uint16_t&);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPCallback<float>(std::function<void(const RoveCommPacket<float>&, const sockaddr_in&)>, const uint16_t&);
     template void RoveCommUDP::RemoveUDPCallback<float>(std::function<void(const RoveCommPacket<float>&, const sockaddr_in&)>);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPViewCallback<float>(std::function<void(const RoveCommPacketView<float>&, const sockaddr_in&)>, const uint16_t&);
+    template void RoveCommUDP::RemoveUDPViewCallback<float>(std::function<void(const RoveCommPacketView<float>&, const sockaddr_in&)>);
+    template void RoveCommUDP::ProcessPacket<float>(const uint8_t*, size_t, const sockaddr_in&);
+    template RoveCommLatestValue<float> RoveCommUDP::GetLatestValue<float>(const uint16_t&) const;
+    template bool RoveCommUDP::GetLatestValue<float>(const uint16_t&, RoveCommLatestValue<float>&) const;
+    template RoveCommHistoryWindow<float> RoveCommUDP::GetLastSamples<float>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<float> RoveCommUDP::GetSamplesSince<float>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
     template ssize_t RoveCommUDP::SendUDPPacket<double>(const RoveCommPacket<double>&, const char*, int);
-    template void RoveCommUDP::AddUDPCallback<double>(std::function<void(const RoveCommPacket<double>&, const sockaddr_in&)>, const uint16_t&);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPCallback<double>(std::function<void(const RoveCommPacket<double>&, const sockaddr_in&)>, const uint16_t&);
     template void RoveCommUDP::RemoveUDPCallback<double>(std::function<void(const RoveCommPacket<double>&, const sockaddr_in&)>);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPViewCallback<double>(std::function<void(const RoveCommPacketView<double>&, const sockaddr_in&)>, const uint16_t&);
+    template void RoveCommUDP::RemoveUDPViewCallback<double>(std::function<void(const RoveCommPacketView<double>&, const sockaddr_in&)>);
+    template void RoveCommUDP::ProcessPacket<double>(const uint8_t*, size_t, const sockaddr_in&);
+    template RoveCommLatestValue<double> RoveCommUDP::GetLatestValue<double>(const uint16_t&) const;
+    template bool RoveCommUDP::GetLatestValue<double>(const uint16_t&, RoveCommLatestValue<double>&) const;
+    template RoveCommHistoryWindow<double> RoveCommUDP::GetLastSamples<double>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<double> RoveCommUDP::GetSamplesSince<double>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
     template ssize_t RoveCommUDP::SendUDPPacket<char>(const RoveCommPacket<char>&, const char*, int);
-    template void RoveCommUDP::AddUDPCallback<char>(std::function<void(const RoveCommPacket<char>&, const sockaddr_in&)>, const uint16_t&);
+
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommUDP::AddPeriodicStream<uint8_t>(const uint16_t&, double, std::function<bool(RoveCommPacket<uint8_t>&)>, const char*, int);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommUDP::AddPeriodicStream<int8_t>(const uint16_t&, double, std::function<bool(RoveCommPacket<int8_t>&)>, const char*, int);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommUDP::AddPeriodicStream<uint16_t>(const uint16_t&, double, std::function<bool(RoveCommPacket<uint16_t>&)>, const char*, int);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommUDP::AddPeriodicStream<int16_t>(const uint16_t&, double, std::function<bool(RoveCommPacket<int16_t>&)>, const char*, int);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommUDP::AddPeriodicStream<uint32_t>(const uint16_t&, double, std::function<bool(RoveCommPacket<uint32_t>&)>, const char*, int);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommUDP::AddPeriodicStream<int32_t>(const uint16_t&, double, std::function<bool(RoveCommPacket<int32_t>&)>, const char*, int);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommUDP::AddPeriodicStream<float>(const uint16_t&, double, std::function<bool(RoveCommPacket<float>&)>, const char*, int);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommUDP::AddPeriodicStream<double>(const uint16_t&, double, std::function<bool(RoveCommPacket<double>&)>, const char*, int);
+    template std::shared_ptr<RoveCommPeriodicStream> RoveCommUDP::AddPeriodicStream<char>(const uint16_t&, double, std::function<bool(RoveCommPacket<char>&)>, const char*, int);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPCallback<char>(std::function<void(const RoveCommPacket<char>&, const sockaddr_in&)>, const uint16_t&);
     template void RoveCommUDP::RemoveUDPCallback<char>(std::function<void(const RoveCommPacket<char>&, const sockaddr_in&)>);
+    template RoveCommCallbackHandle RoveCommUDP::AddUDPViewCallback<char>(std::function<void(const RoveCommPacketView<char>&, const sockaddr_in&)>, const uint16_t&);
+    template void RoveCommUDP::RemoveUDPViewCallback<char>(std::function<void(const RoveCommPacketView<char>&, const sockaddr_in&)>);
+    template void RoveCommUDP::ProcessPacket<char>(const uint8_t*, size_t, const sockaddr_in&);
+    template RoveCommLatestValue<char> RoveCommUDP::GetLatestValue<char>(const uint16_t&) const;
+    template bool RoveCommUDP::GetLatestValue<char>(const uint16_t&, RoveCommLatestValue<char>&) const;
+    template RoveCommHistoryWindow<char> RoveCommUDP::GetLastSamples<char>(const uint16_t&, size_t) const;
+    template RoveCommHistoryWindow<char> RoveCommUDP::GetSamplesSince<char>(const uint16_t&, std::chrono::steady_clock::time_point) const;
 
 }    // namespace rovecomm
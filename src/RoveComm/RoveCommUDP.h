@@ -13,17 +13,30 @@
 #define ROVECOMM_UDP_H
 
 #include "ExternalIncludes.h"
+#include "RoveCommBufferPool.h"
+#include "RoveCommCallbackRegistry.h"
+#include "RoveCommCoalescer.h"
 #include "RoveCommConsts.h"
+#include "RoveCommFragment.h"
 #include "RoveCommGlobals.h"
+#include "RoveCommHistory.h"
+#include "RoveCommLatestValueCache.h"
 #include "RoveCommManifest.h"
 #include "RoveCommPacket.h"
+#include "RoveCommPriorityDispatcher.h"
+#include "RoveCommPublisher.h"
+#include "RoveCommSendFilter.h"
+#include "RoveCommUDPBatch.h"
 
 /// \cond
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <csignal>
 #include <cstring>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <shared_mutex>
 #include <unistd.h>
 #include <unordered_set>
@@ -50,22 +63,123 @@ namespace rovecomm
      ******************************************************************************/
     class RoveCommUDP : AutonomyThread<void>
     {
+        public:
+            // Define an enum for selecting how the receive thread waits for data.
+            enum UDPReceiveMode
+            {
+                eNonBlockingPoll,    // Legacy mode. One non-blocking read per iteration, capped at ROVECOMM_THREAD_MAX_IPS.
+                eEventDriven         // Sleep in the kernel until data arrives, then drain every queued datagram.
+            };
+
+            // Define a struct for reporting a snapshot of this node's counters.
+            struct UDPStatistics
+            {
+                public:
+                    uint64_t unPacketsReceived;    // Datagrams read from the socket.
+                    uint64_t unReceiveSyscalls;    // recvfrom/recvmmsg calls, including ones that found no data.
+                    uint64_t unWaitSyscalls;       // epoll_wait/WSAPoll calls made by the event-driven receive mode.
+                    double dSyscallsPerPacket;     // (unReceiveSyscalls + unWaitSyscalls) / unPacketsReceived.
+                    uint64_t unPacketsSent;        // Datagrams sent, counting every subscriber of a fan-out.
+                    uint64_t unSendSyscalls;       // sendto/sendmmsg calls.
+                    uint64_t unFragmentsSkipped;   // Fragmented packets not sent to a subscriber that cannot reassemble them.
+            };
+
+            // Define the callback types for each data type.
+            template<typename T>
+            using UDPCallback = std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)>;
+            template<typename T>
+            using UDPViewCallback = std::function<void(const RoveCommPacketView<T>&, const sockaddr_in&)>;
+
         private:
             // Private member variables
             std::atomic_int m_nUDPSocket;
             struct sockaddr_in m_saUDPServerAddr;
             std::vector<SubscriberInfo> vSubscribers;
-            std::shared_mutex m_muCallbackMutex;
+            std::shared_mutex m_muSubscriberMutex;
+            RoveCommCallbackTable<UDPCallback> m_stCallbacks;
+            RoveCommCallbackTable<UDPViewCallback> m_stViewCallbacks;
+            std::atomic<UDPReceiveMode> m_eReceiveMode;
+            int m_nEpollFD;
+            int m_nWakeupFD;
+            RoveCommBufferPool m_stSendBufferPool;
+
+            // Asynchronous callback dispatch. Disabled while m_unDispatchThreads is 0.
+            unsigned int m_unDispatchThreads;
+            RoveCommPriorityTable m_stPriorities;
+            std::array<bool, ePriorityCount> m_aDedicatedDispatchLanes;
+            std::unique_ptr<RoveCommPriorityDispatcher> m_pDispatcher;
+
+            // Latest packet of every data id, and the history of selected ones, for polling.
+            RoveCommLatestValueCache m_stLatestValues;
+            RoveCommHistoryStore m_stHistory;
+
+            // Change detection in front of every send.
+            RoveCommSendFilter m_stSendFilter;
+
+            // Rate limited publishers and periodic streams, sent from their own thread.
+            RoveCommPublisherScheduler m_stPublishers;
+
+            // Several packets per datagram for the subscribers that asked for it.
+            RoveCommCoalescer m_stCoalescer;
+
+            // Packets too large for one datagram, split on send and put back together on receive.
+            std::atomic<uint16_t> m_unNextMessageId;
+            RoveCommReassembler m_stReassembler;
+
+            // Preallocated receive batch.
+            unsigned int m_unReceiveBatchSize;
+            std::vector<RoveCommData> m_vReceiveBuffers;
+            std::vector<sockaddr_in> m_vReceiveAddresses;
+            std::vector<size_t> m_vReceiveSizes;
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+            std::vector<struct mmsghdr> m_vReceiveHeaders;
+            std::vector<struct iovec> m_vReceiveIOVecs;
+#endif
+
+            // Statistics counters.
+            std::atomic<uint64_t> m_unPacketsReceived;
+            std::atomic<uint64_t> m_unReceiveSyscalls;
+            std::atomic<uint64_t> m_unWaitSyscalls;
+            std::atomic<uint64_t> m_unPacketsSent;
+            std::atomic<uint64_t> m_unSendSyscalls;
+            std::atomic<uint64_t> m_unFragmentsSkipped;
 
             // Packet processing functions
             template<typename T>
-            void ProcessPacket(const RoveCommData& stData,
-                               const std::vector<std::tuple<std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)>, uint32_t>>& vCallbacks,
-                               const sockaddr_in& saClientAddr);
-            void ReceiveUDPPacketAndCallback();
+            void ProcessPacket(const uint8_t* pData, size_t siDataSize, const sockaddr_in& saClientAddr);
+            void DispatchUDPPacket(const uint8_t* pData, size_t siDataSize, const sockaddr_in& saClientAddr);
+            void HandleUDPPacket(const uint8_t* pData, size_t siDataSize, const sockaddr_in& saClientAddr, std::chrono::steady_clock::time_point tmReceived);
+            unsigned int ReceiveUDPBatch(unsigned int unMaxPackets);
+            unsigned int ReceiveUDPPacketAndCallback(unsigned int unMaxPackets);
+            void AllocateReceiveBatch();
+
+            // Event-driven receive functions
+            bool InitReceiveEvents();
+            bool WaitForUDPData();
+            void WakeReceiveThread();
+            void CloseReceiveEvents();
+
+            // Data transmission functions
+            ssize_t SendUDPData(const uint8_t* pData, size_t siDataSize, const sockaddr_in* pTargetAddr);
+#if !defined(__ROVECOMM_WINDOWS_MODE__) || __ROVECOMM_WINDOWS_MODE__ == 0
+            unsigned int SendUDPMessages(struct mmsghdr* pMessages, unsigned int unCount);
+#endif
+            int SendUDPBatchEntries(const RoveCommUDPBatch& stBatch, size_t& siExpected);
+            void CoalescePacket(const uint8_t* pData, size_t siDataSize);
+            void SendToCoalescedSubscribers(const uint8_t* pData, size_t siDataSize);
+            unsigned int SendUDPFragments(const uint8_t* pData,
+                                          size_t siDataSize,
+                                          bool bToSubscribers,
+                                          const sockaddr_in* pTargetAddr,
+                                          bool& bSubscribersSent,
+                                          bool& bTargetSent);
+            ssize_t SendSubscription(uint16_t unDataId, uint8_t unFlags, const char* cIPAddress, int nPort);
+
+            // Publisher functions
+            static bool ResolveTargetAddress(const char* cIPAddress, int nPort, sockaddr_in& saTargetAddr);
 
             // Subscriber management functions
-            void AddSubscriber(const std::string& szIPAddress, const int& nPort);
+            void AddSubscriber(const std::string& szIPAddress, const int& nPort, bool bCoalesced = false, bool bFragments = false);
             void RemoveSubscriber(const std::string& szIPAddress, const int& nPort);
 
             // AutonomyThread member functions
@@ -79,32 +193,113 @@ namespace rovecomm
             ~RoveCommUDP();
 
             // Initialization
+            // The receive mode, batch size and dispatch can only be changed while the socket is closed, they are refused once InitUDPSocket() succeeded.
+            bool SetReceiveMode(UDPReceiveMode eMode);
+            UDPReceiveMode GetReceiveMode() const;
+            bool SetReceiveBatchSize(unsigned int unBatchSize);
+            unsigned int GetReceiveBatchSize() const;
+            bool SetCallbackDispatch(unsigned int unWorkerThreads,
+                                     size_t siQueueCapacity         = ROVECOMM_DISPATCH_QUEUE_CAPACITY,
+                                     RoveCommOverflowPolicy ePolicy = eOverflowDropOldest);
+            unsigned int GetCallbackDispatchThreads() const;
+            void SetDedicatedDispatchThread(RoveCommPriority ePriority, bool bDedicated = true);
+            void SetDataIdPriority(uint16_t unDataId, RoveCommPriority ePriority);
+            void SetDataIdPriority(const std::map<std::string, manifest::ManifestEntry>& mpEntries, RoveCommPriority ePriority);
+            void SetManifestPriorities(const std::map<std::string, manifest::ManifestEntry>& mpCommands,
+                                       const std::map<std::string, manifest::ManifestEntry>& mpTelemetry,
+                                       const std::map<std::string, manifest::ManifestEntry>& mpErrors);
+            RoveCommPriority GetDataIdPriority(uint16_t unDataId) const;
             bool InitUDPSocket(int nPort);
 
             // Data transmission functions
             template<typename T>
             ssize_t SendUDPPacket(const RoveCommPacket<T>& stPacket, const char* cIPAddress, int nPort);
+            int SendUDPBatch(const RoveCommUDPBatch& stBatch);
+            std::shared_ptr<RoveCommPublisher> CreatePublisher(const uint16_t& unDataId, double dMaxRateHz, const char* cIPAddress = "0.0.0.0", int nPort = 0);
+            bool RemovePublisher(const std::shared_ptr<RoveCommPublisher>& pPublisher);
+            template<typename T>
+            std::shared_ptr<RoveCommPeriodicStream> AddPeriodicStream(const uint16_t& unDataId,
+                                                                      double dRateHz,
+                                                                      std::function<bool(RoveCommPacket<T>&)> fnProducer,
+                                                                      const char* cIPAddress = "0.0.0.0",
+                                                                      int nPort              = 0);
+            bool RemovePeriodicStream(const std::shared_ptr<RoveCommPeriodicStream>& pStream);
+            RoveCommSchedulerStatistics GetSchedulerStatistics() const;
+
+            // Send filter functions
+            void SetSendFilter(const uint16_t& unDataId, const RoveCommDeadband& stDeadband = RoveCommDeadband());
+            void SetSendFilter(const std::map<std::string, manifest::ManifestEntry>& mpEntries, const RoveCommDeadband& stDeadband = RoveCommDeadband());
+            bool ClearSendFilter(const uint16_t& unDataId);
+            RoveCommSendFilterStatistics GetSendFilterStatistics() const;
+            RoveCommSendFilterStatistics GetSendFilterStatistics(const uint16_t& unDataId) const;
+
+            // Coalescing functions
+            void SetCoalescing(bool bEnabled,
+                               size_t siMaxDatagramSize              = ROVECOMM_COALESCE_MAX_DATAGRAM_SIZE,
+                               std::chrono::microseconds tmMaxDelay = std::chrono::microseconds(ROVECOMM_COALESCE_MAX_DELAY_US));
+            void FlushCoalesced();
+            RoveCommCoalescerStatistics GetCoalescerStatistics() const;
+
+            // Fragmentation functions
+            void SetReassemblyLimits(std::chrono::milliseconds tmTimeout = std::chrono::milliseconds(ROVECOMM_REASSEMBLY_TIMEOUT_MS),
+                                     size_t siMaxPackets                 = ROVECOMM_REASSEMBLY_MAX_MESSAGES,
+                                     size_t siMaxBytes                   = ROVECOMM_REASSEMBLY_MAX_BYTES);
+            RoveCommReassemblyStatistics GetReassemblyStatistics() const;
+
+            // Subscription functions
+            ssize_t SubscribeTo(const char* cIPAddress, int nPort, bool bCoalesced = true, bool bFragments = true);
+            ssize_t UnsubscribeFrom(const char* cIPAddress, int nPort);
 
             // Callback management functions
             template<typename T>
-            void AddUDPCallback(std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)> fnCallback, const uint16_t& unCondition);
+            RoveCommCallbackHandle AddUDPCallback(std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)> fnCallback, const uint16_t& unCondition);
 
             template<typename T>
             void RemoveUDPCallback(std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)> fnCallback);
 
+            template<typename T>
+            RoveCommCallbackHandle AddUDPViewCallback(std::function<void(const RoveCommPacketView<T>&, const sockaddr_in&)> fnCallback, const uint16_t& unCondition);
+
+            template<typename T>
+            void RemoveUDPViewCallback(std::function<void(const RoveCommPacketView<T>&, const sockaddr_in&)> fnCallback);
+
+            // Latest value functions
+            template<typename T>
+            RoveCommLatestValue<T> GetLatestValue(const uint16_t& unDataId) const;
+
+            template<typename T>
+            bool GetLatestValue(const uint16_t& unDataId, RoveCommLatestValue<T>& stValue) const;
+
+            uint64_t GetLatestSequence(const uint16_t& unDataId) const;
+
+            // History functions
+            bool EnableHistory(const uint16_t& unDataId, manifest::DataTypes eDataType, uint16_t unDataCount, size_t siCapacity = ROVECOMM_HISTORY_DEFAULT_CAPACITY);
+            bool EnableHistory(const manifest::ManifestEntry& stEntry, size_t siCapacity = ROVECOMM_HISTORY_DEFAULT_CAPACITY);
+            bool EnableHistory(const std::map<std::string, manifest::ManifestEntry>& mpEntries, size_t siCapacity = ROVECOMM_HISTORY_DEFAULT_CAPACITY);
+            size_t GetHistoryMemoryUsage() const;
+
+            template<typename T>
+            RoveCommHistoryWindow<T> GetLastSamples(const uint16_t& unDataId, size_t siCount) const;
+
+            template<typename T>
+            RoveCommHistoryWindow<T> GetSamplesSince(const uint16_t& unDataId, std::chrono::steady_clock::time_point tmSince) const;
+
             // Deinitialization
             void CloseUDPSocket();
 
+            // Statistics
+            UDPStatistics GetStatistics() const;
+            RoveCommDispatchStatistics GetDispatchStatistics() const;
+            RoveCommDispatchStatistics GetDispatchStatistics(RoveCommPriority ePriority) const;
+
             // Selectively make inherited method public so we can get RoveCommNode FPS.
             using AutonomyThread::GetIPS;
 
             // NOTE: These functions are for testing purposes only and should not be used in production code!
             template<typename T>
-            void CallProcessPacket(const RoveCommData& stData,
-                                   const std::vector<std::tuple<std::function<void(const RoveCommPacket<T>&, const sockaddr_in&)>, uint32_t>>& vCallbacks,
-                                   const sockaddr_in& saClientAddr)
+            void CallProcessPacket(const RoveCommData& stData, const sockaddr_in& saClientAddr)
             {
-                ProcessPacket(stData, vCallbacks, saClientAddr);
+                ProcessPacket<T>(stData.unBytes, sizeof(stData.unBytes), saClientAddr);
             }
     };
 
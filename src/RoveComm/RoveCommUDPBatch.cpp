@@ -0,0 +1,214 @@
+/******************************************************************************
+ * @brief RoveComm UDP Batch Implementation.
+ *
+ * @file RoveCommUDPBatch.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RoveCommUDPBatch.h"
+
+/// \cond
+#include <iostream>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief Pack a RoveCommPacket and append it to the batch.
+     *
+     * @tparam T - The type of data that is to be sent. This can be any of the types
+     *             defined in the manifest.
+     * @param stPacket - The RoveCommPacket that is to be added.
+     * @param cIPAddress - The IP address to send the packet to in addition to the
+     *                     subscribers. Pass "0.0.0.0" to only send to subscribers.
+     * @param nPort - The port to send the packet to.
+     * @return true - The packet was added to the batch.
+     * @return false - The IP address could not be parsed or the packet could not be
+     *                 packed, the packet was not added.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    bool RoveCommUDPBatch::AddPacket(const RoveCommPacket<T>& stPacket, const char* cIPAddress, int nPort)
+    {
+        struct sockaddr_in saTargetAddr;
+        bool bHasTarget = std::strcmp(cIPAddress, "0.0.0.0") && nPort != 0;
+        if (bHasTarget)
+        {
+            memset(&saTargetAddr, 0, sizeof(saTargetAddr));
+            saTargetAddr.sin_family = AF_INET;
+            saTargetAddr.sin_port   = htons(nPort);
+            if (inet_pton(AF_INET, cIPAddress, &saTargetAddr.sin_addr) != 1)
+            {
+                std::cerr << "Invalid UDP destination address: " << cIPAddress << std::endl;
+                return false;
+            }
+        }
+
+        return AddPacketTo(stPacket, bHasTarget ? &saTargetAddr : nullptr);
+    }
+
+    /******************************************************************************
+     * @brief Pack a RoveCommPacket and append it to the batch, with a destination
+     *        that was already resolved.
+     *
+     * @tparam T - The type of data that is to be sent. This can be any of the types
+     *             defined in the manifest.
+     * @param stPacket - The RoveCommPacket that is to be added.
+     * @param pTargetAddr - The address to send the packet to in addition to the
+     *                      subscribers, or nullptr to only send to subscribers.
+     * @return true - The packet was added to the batch.
+     * @return false - The packet could not be packed, and was not added.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    template<typename T>
+    bool RoveCommUDPBatch::AddPacketTo(const RoveCommPacket<T>& stPacket, const sockaddr_in* pTargetAddr)
+    {
+        BatchEntry stEntry;
+        memset(&stEntry.saTargetAddr, 0, sizeof(stEntry.saTargetAddr));
+        stEntry.bHasTarget = pTargetAddr != nullptr;
+        if (stEntry.bHasTarget)
+        {
+            stEntry.saTargetAddr = *pTargetAddr;
+        }
+
+        // Pack the packet directly onto the end of the batch.
+        stEntry.siOffset = m_vBytes.size();
+        m_vBytes.resize(stEntry.siOffset + GetPackedSize(stPacket));
+        stEntry.siSize = PackPacket(stPacket, &m_vBytes[stEntry.siOffset], m_vBytes.size() - stEntry.siOffset);
+        if (stEntry.siSize == 0)
+        {
+            m_vBytes.resize(stEntry.siOffset);
+            return false;
+        }
+        m_vEntries.push_back(stEntry);
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Append an already packed packet to the batch.
+     *
+     * @param pData - The packed packet bytes.
+     * @param siDataSize - The number of bytes.
+     * @param pTargetAddr - The address to send the packet to in addition to the
+     *                      subscribers, or nullptr to only send to subscribers.
+     * @return true - The packet was added to the batch.
+     * @return false - The bytes are shorter than a packet header, and were not
+     *                 added.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    bool RoveCommUDPBatch::AddBytes(const uint8_t* pData, size_t siDataSize, const sockaddr_in* pTargetAddr)
+    {
+        if (siDataSize < ROVECOMM_PACKET_HEADER_SIZE)
+        {
+            return false;
+        }
+
+        BatchEntry stEntry;
+        memset(&stEntry.saTargetAddr, 0, sizeof(stEntry.saTargetAddr));
+        stEntry.bHasTarget = pTargetAddr != nullptr;
+        if (stEntry.bHasTarget)
+        {
+            stEntry.saTargetAddr = *pTargetAddr;
+        }
+        stEntry.siOffset = m_vBytes.size();
+        stEntry.siSize   = siDataSize;
+        m_vBytes.insert(m_vBytes.end(), pData, pData + siDataSize);
+        m_vEntries.push_back(stEntry);
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Remove every packet from the batch. The batch keeps its memory so it
+     *        can be refilled without allocating.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void RoveCommUDPBatch::Clear()
+    {
+        m_vBytes.clear();
+        m_vEntries.clear();
+    }
+
+    /******************************************************************************
+     * @brief Get the number of packets in the batch.
+     *
+     * @return size_t - The number of packets.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommUDPBatch::GetPacketCount() const
+    {
+        return m_vEntries.size();
+    }
+
+    /******************************************************************************
+     * @brief Get the packed bytes of one packet in the batch.
+     *
+     * @param siIndex - The index of the packet, in the order it was added.
+     * @return const uint8_t* - The packet's bytes, valid until the batch changes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    const uint8_t* RoveCommUDPBatch::GetPacketData(size_t siIndex) const
+    {
+        return &m_vBytes[m_vEntries[siIndex].siOffset];
+    }
+
+    /******************************************************************************
+     * @brief Get the packed size of one packet in the batch.
+     *
+     * @param siIndex - The index of the packet, in the order it was added.
+     * @return size_t - The number of bytes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    size_t RoveCommUDPBatch::GetPacketSize(size_t siIndex) const
+    {
+        return m_vEntries[siIndex].siSize;
+    }
+
+    // Explicitly define template function types
+    template bool RoveCommUDPBatch::AddPacket<uint8_t>(const RoveCommPacket<uint8_t>&, const char*, int);
+    template bool RoveCommUDPBatch::AddPacket<int8_t>(const RoveCommPacket<int8_t>&, const char*, int);
+    template bool RoveCommUDPBatch::AddPacket<uint16_t>(const RoveCommPacket<uint16_t>&, const char*, int);
+    template bool RoveCommUDPBatch::AddPacket<int16_t>(const RoveCommPacket<int16_t>&, const char*, int);
+    template bool RoveCommUDPBatch::AddPacket<uint32_t>(const RoveCommPacket<uint32_t>&, const char*, int);
+    template bool RoveCommUDPBatch::AddPacket<int32_t>(const RoveCommPacket<int32_t>&, const char*, int);
+    template bool RoveCommUDPBatch::AddPacket<float>(const RoveCommPacket<float>&, const char*, int);
+    template bool RoveCommUDPBatch::AddPacket<double>(const RoveCommPacket<double>&, const char*, int);
+    template bool RoveCommUDPBatch::AddPacket<char>(const RoveCommPacket<char>&, const char*, int);
+
+    template bool RoveCommUDPBatch::AddPacketTo<uint8_t>(const RoveCommPacket<uint8_t>&, const sockaddr_in*);
+    template bool RoveCommUDPBatch::AddPacketTo<int8_t>(const RoveCommPacket<int8_t>&, const sockaddr_in*);
+    template bool RoveCommUDPBatch::AddPacketTo<uint16_t>(const RoveCommPacket<uint16_t>&, const sockaddr_in*);
+    template bool RoveCommUDPBatch::AddPacketTo<int16_t>(const RoveCommPacket<int16_t>&, const sockaddr_in*);
+    template bool RoveCommUDPBatch::AddPacketTo<uint32_t>(const RoveCommPacket<uint32_t>&, const sockaddr_in*);
+    template bool RoveCommUDPBatch::AddPacketTo<int32_t>(const RoveCommPacket<int32_t>&, const sockaddr_in*);
+    template bool RoveCommUDPBatch::AddPacketTo<float>(const RoveCommPacket<float>&, const sockaddr_in*);
+    template bool RoveCommUDPBatch::AddPacketTo<double>(const RoveCommPacket<double>&, const sockaddr_in*);
+    template bool RoveCommUDPBatch::AddPacketTo<char>(const RoveCommPacket<char>&, const sockaddr_in*);
+}    // namespace rovecomm
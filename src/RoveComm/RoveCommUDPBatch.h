@@ -0,0 +1,77 @@
+/******************************************************************************
+ * @brief The RoveCommUDPBatch class collects packed packets so that a
+ *        RoveCommUDP node can send all of them with a single syscall.
+ *
+ * @file RoveCommUDPBatch.h
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ROVECOMM_UDP_BATCH_H
+#define ROVECOMM_UDP_BATCH_H
+
+#include "./RoveCommPacket.h"
+
+/// \cond
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RoveComm namespace contains all of the functionality for the
+ *        RoveComm library. This includes the packet structure and the
+ *        functions for packing and unpacking data.
+ *
+ * @author Eli Byrd (edbgkk@mst.edu)
+ * @date 2024-02-07
+ ******************************************************************************/
+namespace rovecomm
+{
+    /******************************************************************************
+     * @brief The RoveCommUDPBatch class collects several packed RoveCommPackets,
+     *        possibly of different data types and destinations, so that they can
+     *        be handed to RoveCommUDP::SendUDPBatch() and sent with a single
+     *        syscall. Every packet in the batch is also fanned out to the node's
+     *        subscribers, exactly like SendUDPPacket().
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    class RoveCommUDPBatch
+    {
+        private:
+            // Define a struct for locating a packet within the batch.
+            struct BatchEntry
+            {
+                public:
+                    size_t siOffset;
+                    size_t siSize;
+                    bool bHasTarget;
+                    sockaddr_in saTargetAddr;
+            };
+
+            // Private member variables
+            std::vector<uint8_t> m_vBytes;
+            std::vector<BatchEntry> m_vEntries;
+
+            friend class RoveCommUDP;
+
+        public:
+            // Batch management functions
+            template<typename T>
+            bool AddPacket(const RoveCommPacket<T>& stPacket, const char* cIPAddress = "0.0.0.0", int nPort = 0);
+            template<typename T>
+            bool AddPacketTo(const RoveCommPacket<T>& stPacket, const sockaddr_in* pTargetAddr);
+            bool AddBytes(const uint8_t* pData, size_t siDataSize, const sockaddr_in* pTargetAddr = nullptr);
+            void Clear();
+            size_t GetPacketCount() const;
+            const uint8_t* GetPacketData(size_t siIndex) const;
+            size_t GetPacketSize(size_t siIndex) const;
+    };
+}    // namespace rovecomm
+
+#endif    // ROVECOMM_UDP_BATCH_H
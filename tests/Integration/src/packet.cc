@@ -0,0 +1,241 @@
+/******************************************************************************
+ * @brief Benchmarks for packet packing and unpacking in RoveComm.
+ *
+ * @file packet.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../../src/RoveComm/RoveCommByteSwap.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <chrono>
+#include <functional>
+#include <gtest/gtest.h>
+#include <linux/perf_event.h>
+#include <numeric>
+#include <string>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Open a hardware cache-miss counter for the calling thread.
+ *
+ * @return int - The counter's file descriptor, or -1 if hardware counters are
+ *               not available (for example inside a container or VM).
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static int OpenCacheMissCounter()
+{
+    struct perf_event_attr stAttr;
+    memset(&stAttr, 0, sizeof(stAttr));
+    stAttr.type           = PERF_TYPE_HARDWARE;
+    stAttr.size           = sizeof(stAttr);
+    stAttr.config         = PERF_COUNT_HW_CACHE_MISSES;
+    stAttr.disabled       = 1;
+    stAttr.exclude_kernel = 1;
+    stAttr.exclude_hv     = 1;
+    return static_cast<int>(syscall(SYS_perf_event_open, &stAttr, 0, -1, -1, 0));
+}
+
+/******************************************************************************
+ * @brief Run a function repeatedly and measure its cost.
+ *
+ * @param nIterations - How many times to run fnWork.
+ * @param fnWork - The work to measure.
+ * @param dCacheMisses - Set to the cache misses per iteration, or -1 if hardware
+ *                       counters are not available.
+ * @return double - Nanoseconds per iteration.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static double MeasurePerIteration(int nIterations, const std::function<void()>& fnWork, double& dCacheMisses)
+{
+    int nCounterFD = OpenCacheMissCounter();
+    if (nCounterFD != -1)
+    {
+        ioctl(nCounterFD, PERF_EVENT_IOC_RESET, 0);
+        ioctl(nCounterFD, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    for (int nIter = 0; nIter < nIterations; ++nIter)
+    {
+        fnWork();
+    }
+    double dElapsedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tmStart).count();
+
+    dCacheMisses = -1.0;
+    if (nCounterFD != -1)
+    {
+        ioctl(nCounterFD, PERF_EVENT_IOC_DISABLE, 0);
+        uint64_t unMisses = 0;
+        if (read(nCounterFD, &unMisses, sizeof(unMisses)) == sizeof(unMisses))
+        {
+            dCacheMisses = static_cast<double>(unMisses) / nIterations;
+        }
+        close(nCounterFD);
+    }
+
+    return dElapsedNs / nIterations;
+}
+
+/******************************************************************************
+ * @brief Compare packing a small command into a full RoveCommData structure
+ *        against packing it into a right-sized stack buffer (the send path for
+ *        small packets) and a pooled buffer (the send path for large packets).
+ *        Cache misses are reported as -1 when hardware counters are unavailable.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPacketBenchmark, RightSizedPack)
+{
+    const int nIterations = 200000;
+
+    // Create a DRIVELEFTRIGHT-sized packet.
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = 1000;
+    stPacket.unDataCount = 2;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {0.5f, -0.5f};
+
+    // Every variant hands its bytes to a sink so the work is not optimized away.
+    volatile uint8_t unSink = 0;
+
+    double dLegacyMisses = 0.0;
+    double dLegacyNs     = MeasurePerIteration(
+        nIterations,
+        [&]()
+        {
+            rovecomm::RoveCommData stData = rovecomm::PackPacket(stPacket);
+            unSink                        = stData.unBytes[rovecomm::GetPackedSize(stPacket) - 1];
+        },
+        dLegacyMisses);
+
+    double dStackMisses = 0.0;
+    double dStackNs     = MeasurePerIteration(
+        nIterations,
+        [&]()
+        {
+            uint8_t aBuffer[rovecomm::ROVECOMM_PACKET_STACK_BUFFER_SIZE];
+            size_t siSize = rovecomm::PackPacket(stPacket, aBuffer, sizeof(aBuffer));
+            unSink        = aBuffer[siSize - 1];
+        },
+        dStackMisses);
+
+    rovecomm::RoveCommBufferPool stPool;
+    double dPooledMisses = 0.0;
+    double dPooledNs     = MeasurePerIteration(
+        nIterations,
+        [&]()
+        {
+            rovecomm::RoveCommBufferPool::Buffer stBuffer = stPool.Acquire(rovecomm::GetPackedSize(stPacket));
+            size_t siSize                                 = rovecomm::PackPacket(stPacket, stBuffer.data(), stBuffer.size());
+            unSink                                        = stBuffer.data()[siSize - 1];
+        },
+        dPooledMisses);
+    (void) unSink;
+
+    testutils::PrintBenchmarkResult("Pack DRIVELEFTRIGHT (RoveCommData)", {{"ns/pkt", dLegacyNs}, {"cache_misses/pkt", dLegacyMisses}});
+    testutils::PrintBenchmarkResult("Pack DRIVELEFTRIGHT (stack buffer)", {{"ns/pkt", dStackNs}, {"cache_misses/pkt", dStackMisses}});
+    testutils::PrintBenchmarkResult("Pack DRIVELEFTRIGHT (pooled buffer)", {{"ns/pkt", dPooledNs}, {"cache_misses/pkt", dPooledMisses}});
+
+    EXPECT_GT(dLegacyNs, 0.0);
+    EXPECT_GT(dStackNs, 0.0);
+    EXPECT_GT(dPooledNs, 0.0);
+}
+
+/******************************************************************************
+ * @brief Compare the byte-swap kernels on large payloads. Every kernel the CPU
+ *        supports packs and unpacks a 4096-element DOUBLE_T packet, and a
+ *        256-element CHAR packet is included as the copy-only baseline.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPacketBenchmark, ByteSwapKernels)
+{
+    const int nIterations = 20000;
+
+    rovecomm::RoveCommPacket<double> stDoublePacket;
+    stDoublePacket.unDataId    = 1100;
+    stDoublePacket.unDataCount = 4096;
+    stDoublePacket.eDataType   = manifest::DataTypes::DOUBLE_T;
+    stDoublePacket.vData.resize(stDoublePacket.unDataCount);
+    std::iota(stDoublePacket.vData.begin(), stDoublePacket.vData.end(), 0.25);
+
+    rovecomm::RoveCommPacket<char> stCharPacket;
+    stCharPacket.unDataId    = 3013;
+    stCharPacket.unDataCount = 256;
+    stCharPacket.eDataType   = manifest::DataTypes::CHAR;
+    stCharPacket.vData.assign(stCharPacket.unDataCount, 'r');
+
+    std::vector<uint8_t> vDoubleBytes(rovecomm::GetPackedSize(stDoublePacket));
+    std::vector<uint8_t> vCharBytes(rovecomm::GetPackedSize(stCharPacket));
+    volatile uint8_t unSink = 0;
+
+    const rovecomm::ByteSwapKernel eDefaultKernel = rovecomm::GetByteSwapKernel();
+    const rovecomm::ByteSwapKernel aKernels[]     = {rovecomm::ByteSwapKernel::eScalar,
+                                                     rovecomm::ByteSwapKernel::eSSSE3,
+                                                     rovecomm::ByteSwapKernel::eAVX2,
+                                                     rovecomm::ByteSwapKernel::eNEON};
+    for (rovecomm::ByteSwapKernel eKernel : aKernels)
+    {
+        if (!rovecomm::SetByteSwapKernel(eKernel))
+        {
+            continue;
+        }
+        std::string szKernel = rovecomm::GetByteSwapKernelName(eKernel);
+
+        double dPackMisses = 0.0;
+        double dPackNs     = MeasurePerIteration(
+            nIterations,
+            [&]()
+            {
+                rovecomm::PackPacket(stDoublePacket, vDoubleBytes.data(), vDoubleBytes.size());
+                unSink = vDoubleBytes.back();
+            },
+            dPackMisses);
+
+        double dUnpackMisses = 0.0;
+        double dUnpackNs     = MeasurePerIteration(
+            nIterations,
+            [&]()
+            {
+                rovecomm::RoveCommPacket<double> stUnpacked = rovecomm::UnpackData<double>(vDoubleBytes.data(), vDoubleBytes.size());
+                unSink                                      = static_cast<uint8_t>(stUnpacked.vData.back());
+            },
+            dUnpackMisses);
+
+        testutils::PrintBenchmarkResult("Pack 4096 DOUBLE_T (" + szKernel + ")", {{"ns/pkt", dPackNs}, {"cache_misses/pkt", dPackMisses}});
+        testutils::PrintBenchmarkResult("Unpack 4096 DOUBLE_T (" + szKernel + ")", {{"ns/pkt", dUnpackNs}, {"cache_misses/pkt", dUnpackMisses}});
+        EXPECT_GT(dPackNs, 0.0);
+        EXPECT_GT(dUnpackNs, 0.0);
+    }
+    rovecomm::SetByteSwapKernel(eDefaultKernel);
+
+    double dCharMisses = 0.0;
+    double dCharNs     = MeasurePerIteration(
+        nIterations,
+        [&]()
+        {
+            rovecomm::PackPacket(stCharPacket, vCharBytes.data(), vCharBytes.size());
+            unSink = vCharBytes.back();
+        },
+        dCharMisses);
+    (void) unSink;
+
+    testutils::PrintBenchmarkResult("Pack 256 CHAR (copy only)", {{"ns/pkt", dCharNs}, {"cache_misses/pkt", dCharMisses}});
+    EXPECT_GT(dCharNs, 0.0);
+}
@@ -0,0 +1,459 @@
+/******************************************************************************
+ * @brief Integration tests and loopback benchmarks for TCP functionality in
+ *        RoveComm.
+ *
+ * @file tcp.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Measure the loopback throughput of stream transfers into a buffer
+ *        sink for several chunk sizes, and from a file into a file sink.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCPBenchmark, StreamThroughput)
+{
+    const size_t siTransferSize = 64 * 1024 * 1024;
+    const int nTransfers        = 4;
+
+    rovecomm::RoveCommTCP pReceiverNode;
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12101));
+
+    std::vector<uint8_t> vSource(siTransferSize);
+    for (size_t siIter = 0; siIter < vSource.size(); ++siIter)
+    {
+        vSource[siIter] = static_cast<uint8_t>(siIter ^ (siIter >> 11));
+    }
+    std::vector<uint8_t> vSink(siTransferSize);
+    ASSERT_TRUE(pReceiverNode.SetTCPStreamBuffer(1310, vSink.data(), vSink.size()));
+
+    // Send the same buffer a few times per chunk size, over one connection each.
+    for (size_t siChunkSize : {64 * 1024, 256 * 1024, 1024 * 1024})
+    {
+        rovecomm::RoveCommTCPStream stStream;
+        stStream.SetFlowControl(siChunkSize, rovecomm::ROVECOMM_STREAM_WINDOW_CHUNKS);
+        ASSERT_TRUE(stStream.Connect("127.0.0.1", 12101));
+
+        int nProgressReports                          = 0;
+        std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+        for (int nIter = 0; nIter < nTransfers; ++nIter)
+        {
+            ASSERT_TRUE(stStream.SendBuffer(1310, vSource.data(), vSource.size(), [&](const rovecomm::RoveCommStreamStatus&) { nProgressReports++; }));
+        }
+        double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStart).count();
+
+        EXPECT_GT(nProgressReports, nTransfers);
+        EXPECT_TRUE(vSink == vSource);
+        testutils::PrintBenchmarkResult("TCP stream buffer (" + std::to_string(siChunkSize / 1024) + " KB chunks)",
+                                        {{"MB/s", nTransfers * siTransferSize / dSeconds / (1024.0 * 1024.0)},
+                                         {"ms/transfer", dSeconds * 1000.0 / nTransfers},
+                                         {"reports", static_cast<double>(nProgressReports)}});
+    }
+
+    // Send a file into a file sink, mapped on one end and spliced on the other.
+    std::string szSourcePath = "rovecomm_stream_benchmark_source.bin";
+    std::string szSinkPath   = "rovecomm_stream_benchmark_sink.bin";
+    {
+        std::ofstream fsSource(szSourcePath, std::ios::binary);
+        fsSource.write(reinterpret_cast<const char*>(vSource.data()), vSource.size());
+    }
+    ASSERT_TRUE(pReceiverNode.SetTCPStreamFile(1311, szSinkPath));
+
+    rovecomm::RoveCommTCPStream stStream;
+    ASSERT_TRUE(stStream.Connect("127.0.0.1", 12101));
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    for (int nIter = 0; nIter < nTransfers; ++nIter)
+    {
+        ASSERT_TRUE(stStream.SendFile(1311, szSourcePath.c_str()));
+    }
+    double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStart).count();
+    testutils::PrintBenchmarkResult("TCP stream file to file",
+                                    {{"MB/s", nTransfers * siTransferSize / dSeconds / (1024.0 * 1024.0)}, {"ms/transfer", dSeconds * 1000.0 / nTransfers}});
+
+    {
+        std::ifstream fsSink(szSinkPath, std::ios::binary | std::ios::ate);
+        EXPECT_EQ(static_cast<size_t>(fsSink.tellg()), siTransferSize);
+    }
+
+    rovecomm::RoveCommStreamStatistics stStatistics = pReceiverNode.GetTCPStreamStatistics();
+    EXPECT_EQ(stStatistics.unTransfersCompleted, 4u * nTransfers);
+    EXPECT_EQ(stStatistics.unTransfersFailed, 0u);
+
+    pReceiverNode.CloseTCPSocket();
+    std::remove(szSourcePath.c_str());
+    std::remove(szSinkPath.c_str());
+}
+
+/******************************************************************************
+ * @brief Measure loopback command rate and latency, from SendTCPPacket() to the
+ *        receiver's callback, with pooled connections and with a connection
+ *        opened for every packet.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCPBenchmark, PooledConnectionLatency)
+{
+    const int nCommands = 2000;
+
+    std::atomic<int> nReceived(0);
+    rovecomm::RoveCommTCP pReceiverNode;
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12102));
+    pReceiverNode.AddTCPCallback<float>([&](const rovecomm::RoveCommPacket<float>&) { nReceived++; }, 1321);
+
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = 1321;
+    stPacket.unDataCount = 2;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {0.5f, -0.5f};
+
+    for (bool bPooled : {true, false})
+    {
+        rovecomm::RoveCommTCP pSenderNode;
+        pSenderNode.SetTCPConnectionPooling(bPooled);
+
+        // Send one command at a time and wait for its callback before sending the next.
+        std::vector<double> vLatencies;
+        vLatencies.reserve(nCommands);
+        nReceived                                     = 0;
+        std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+        for (int nIter = 0; nIter < nCommands; ++nIter)
+        {
+            std::chrono::steady_clock::time_point tmSent = std::chrono::steady_clock::now();
+            ASSERT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12102), 0);
+            while (nReceived <= nIter)
+            {
+                std::this_thread::yield();
+            }
+            vLatencies.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tmSent).count());
+        }
+        double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStart).count();
+
+        rovecomm::RoveCommConnectionPoolStatistics stStatistics = pSenderNode.GetTCPConnectionPoolStatistics();
+        EXPECT_EQ(stStatistics.unConnects, bPooled ? 1u : 0u);
+        testutils::PrintBenchmarkResult(bPooled ? "TCP commands, pooled connection" : "TCP commands, connection per packet",
+                                        {{"commands/s", nCommands / dSeconds},
+                                         {"p50 us", testutils::Percentile(vLatencies, 50.0)},
+                                         {"p99 us", testutils::Percentile(vLatencies, 99.0)}});
+    }
+
+    pReceiverNode.CloseTCPSocket();
+}
+
+/******************************************************************************
+ * @brief Measure how loopback packet throughput into one node scales with 1,
+ *        10 and 100 senders connected at once, each sending as fast as it can
+ *        over its own long-lived connection.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCPBenchmark, ConcurrentSenderThroughput)
+{
+    const int nTotalPackets = 200000;
+
+    std::atomic<int> nReceived(0);
+    rovecomm::RoveCommTCP pReceiverNode;
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12103));
+    pReceiverNode.AddTCPCallback<float>([&](const rovecomm::RoveCommPacket<float>&) { nReceived++; }, 1323);
+
+    for (int nSenders : {1, 10, 100})
+    {
+        const int nPackets = nTotalPackets / nSenders;
+
+        // Open every connection before timing, so the benchmark measures the receive loop rather than accept.
+        std::vector<std::unique_ptr<rovecomm::RoveCommTCP>> vSenderNodes;
+        rovecomm::RoveCommPacket<float> stPacket;
+        stPacket.unDataId    = 1323;
+        stPacket.unDataCount = 4;
+        stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+        stPacket.vData       = {1.0f, 2.0f, 3.0f, 4.0f};
+        for (int nSender = 0; nSender < nSenders; ++nSender)
+        {
+            vSenderNodes.emplace_back(new rovecomm::RoveCommTCP());
+            ASSERT_GT(vSenderNodes.back()->SendTCPPacket(stPacket, "127.0.0.1", 12103), 0);
+        }
+        while (nReceived < nSenders)
+        {
+            std::this_thread::yield();
+        }
+        nReceived = 0;
+
+        std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+        std::vector<std::thread> vSenderThreads;
+        for (int nSender = 0; nSender < nSenders; ++nSender)
+        {
+            vSenderThreads.emplace_back(
+                [&, nSender]()
+                {
+                    for (int nIter = 0; nIter < nPackets; ++nIter)
+                    {
+                        vSenderNodes[nSender]->SendTCPPacket(stPacket, "127.0.0.1", 12103);
+                    }
+                });
+        }
+        for (std::thread& thSender : vSenderThreads)
+        {
+            thSender.join();
+        }
+
+        std::chrono::steady_clock::time_point tmDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (nReceived < nSenders * nPackets && std::chrono::steady_clock::now() < tmDeadline)
+        {
+            std::this_thread::yield();
+        }
+        double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStart).count();
+
+        EXPECT_EQ(nReceived, nSenders * nPackets);
+        EXPECT_EQ(pReceiverNode.GetTCPServerStatistics().siOpenConnections, static_cast<size_t>(nSenders));
+        testutils::PrintBenchmarkResult("TCP receive, " + std::to_string(nSenders) + " concurrent senders",
+                                        {{"packets/s", nReceived / dSeconds},
+                                         {"MB/s", nReceived * rovecomm::GetPackedSize(stPacket) / dSeconds / (1024.0 * 1024.0)}});
+
+        // Let the receiver see every sender close before the next round.
+        vSenderNodes.clear();
+        while (pReceiverNode.GetTCPServerStatistics().siOpenConnections != 0)
+        {
+            std::this_thread::yield();
+        }
+        nReceived = 0;
+    }
+
+    pReceiverNode.CloseTCPSocket();
+}
+
+/******************************************************************************
+ * @brief Measure how long a burst of packets holds up the sending thread when
+ *        SendTCPPacket() writes each one itself, against SendTCPPacketAsync()
+ *        queueing them for the send queue's thread to write in gathered batches.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCPBenchmark, AsyncSendBurst)
+{
+    const int nPackets = 100000;
+
+    std::atomic<int> nReceived(0);
+    rovecomm::RoveCommTCP pReceiverNode;
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12104));
+    pReceiverNode.AddTCPCallback<float>([&](const rovecomm::RoveCommPacket<float>&) { nReceived++; }, 1326);
+
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = 1326;
+    stPacket.unDataCount = 4;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {1.0f, 2.0f, 3.0f, 4.0f};
+
+    for (bool bAsync : {false, true})
+    {
+        // Connect before timing, so both patterns measure only the burst.
+        rovecomm::RoveCommTCP pSenderNode;
+        pSenderNode.SetTCPSendQueueLimits(rovecomm::ROVECOMM_TCP_SEND_HIGH_WATER_MARK, rovecomm::eBackpressureBlock, std::chrono::milliseconds(5000));
+        ASSERT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12104), 0);
+        ASSERT_GT(pSenderNode.SendTCPPacketFuture(stPacket, "127.0.0.1", 12104).get(), 0);
+        while (nReceived < 2)
+        {
+            std::this_thread::yield();
+        }
+        nReceived = 0;
+
+        // Time every call the sending thread makes, then the burst until the receiver has it all.
+        std::vector<double> vCallTimes;
+        vCallTimes.reserve(nPackets);
+        std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+        for (int nIter = 0; nIter < nPackets; ++nIter)
+        {
+            std::chrono::steady_clock::time_point tmCall = std::chrono::steady_clock::now();
+            if (bAsync)
+            {
+                ASSERT_TRUE(pSenderNode.SendTCPPacketAsync(stPacket, "127.0.0.1", 12104));
+            }
+            else
+            {
+                ASSERT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12104), 0);
+            }
+            vCallTimes.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tmCall).count());
+        }
+        double dCallerSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStart).count();
+        while (nReceived < nPackets)
+        {
+            std::this_thread::yield();
+        }
+        double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStart).count();
+
+        if (bAsync)
+        {
+            rovecomm::RoveCommSendQueueStatistics stStatistics = pSenderNode.GetTCPSendQueueStatistics();
+            EXPECT_EQ(stStatistics.unSent, nPackets + 1u);
+            EXPECT_EQ(stStatistics.unRejected, 0u);
+            testutils::PrintBenchmarkResult("TCP burst, queued sends",
+                                            {{"caller packets/s", nPackets / dCallerSeconds},
+                                             {"delivered packets/s", nPackets / dSeconds},
+                                             {"call p50 us", testutils::Percentile(vCallTimes, 50.0)},
+                                             {"call p99 us", testutils::Percentile(vCallTimes, 99.0)},
+                                             {"packets/write", static_cast<double>(stStatistics.unSent) / stStatistics.unFlushes},
+                                             {"max queued KiB", stStatistics.siMaxQueuedBytes / 1024.0},
+                                             {"mean flush us", static_cast<double>(stStatistics.unMeanFlushLatencyUs)},
+                                             {"max flush us", static_cast<double>(stStatistics.unMaxFlushLatencyUs)}});
+        }
+        else
+        {
+            testutils::PrintBenchmarkResult("TCP burst, blocking sends",
+                                            {{"caller packets/s", nPackets / dCallerSeconds},
+                                             {"delivered packets/s", nPackets / dSeconds},
+                                             {"call p50 us", testutils::Percentile(vCallTimes, 50.0)},
+                                             {"call p99 us", testutils::Percentile(vCallTimes, 99.0)}});
+        }
+    }
+
+    pReceiverNode.CloseTCPSocket();
+}
+
+/******************************************************************************
+ * @brief Measure the latency of a command written as two small packets, which
+ *        Nagle's algorithm holds back until the first is acknowledged, with and
+ *        without the data id marked latency-critical.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCPBenchmark, NoDelayLatency)
+{
+    const int nCommands = 200;
+
+    std::atomic<int> nReceived(0);
+    rovecomm::RoveCommTCP pReceiverNode;
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12105));
+    pReceiverNode.AddTCPCallback<float>([&](const rovecomm::RoveCommPacket<float>&) { nReceived++; }, 1328);
+
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = 1328;
+    stPacket.unDataCount = 2;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {0.5f, -0.5f};
+
+    for (bool bNoDelay : {false, true})
+    {
+        rovecomm::RoveCommTCP pSenderNode;
+        pSenderNode.SetTCPNoDelay(1328, bNoDelay);
+        ASSERT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12105), 0);
+        while (nReceived < 1)
+        {
+            std::this_thread::yield();
+        }
+        nReceived = 0;
+
+        // Send each command as two packets and wait for both before sending the next.
+        std::vector<double> vLatencies;
+        vLatencies.reserve(nCommands);
+        std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+        for (int nIter = 0; nIter < nCommands; ++nIter)
+        {
+            std::chrono::steady_clock::time_point tmSent = std::chrono::steady_clock::now();
+            ASSERT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12105), 0);
+            ASSERT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12105), 0);
+            while (nReceived < 2 * (nIter + 1))
+            {
+                std::this_thread::yield();
+            }
+            vLatencies.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tmSent).count());
+        }
+        double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStart).count();
+
+        testutils::PrintBenchmarkResult(bNoDelay ? "TCP two-packet commands, no delay" : "TCP two-packet commands, Nagle",
+                                        {{"commands/s", nCommands / dSeconds},
+                                         {"p50 us", testutils::Percentile(vLatencies, 50.0)},
+                                         {"p99 us", testutils::Percentile(vLatencies, 99.0)}});
+    }
+
+    pReceiverNode.CloseTCPSocket();
+}
+
+/******************************************************************************
+ * @brief Measure delivered throughput and burst latency of bursts of small
+ *        packets sent one segment each with no delay, against the same bursts
+ *        corked and flushed once at the end.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCPBenchmark, CorkedBurstThroughput)
+{
+    const int nBursts    = 1000;
+    const int nBurstSize  = 64;
+    const int nPackets   = nBursts * nBurstSize;
+
+    std::atomic<int> nReceived(0);
+    rovecomm::RoveCommTCP pReceiverNode;
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12106));
+    pReceiverNode.AddTCPCallback<float>([&](const rovecomm::RoveCommPacket<float>&) { nReceived++; }, 1329);
+
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = 1329;
+    stPacket.unDataCount = 4;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {1.0f, 2.0f, 3.0f, 4.0f};
+
+    for (bool bCorked : {false, true})
+    {
+        rovecomm::RoveCommTCP pSenderNode;
+        pSenderNode.SetTCPNoDelay(true);
+        ASSERT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12106), 0);
+        while (nReceived < 1)
+        {
+            std::this_thread::yield();
+        }
+        nReceived = 0;
+
+        // Send each burst, flush it, and wait for all of it before the next.
+        rovecomm::RoveCommTCPSendMode eMode = bCorked ? rovecomm::eSendBatched : rovecomm::eSendDefault;
+        std::vector<double> vLatencies;
+        vLatencies.reserve(nBursts);
+        std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+        for (int nBurst = 0; nBurst < nBursts; ++nBurst)
+        {
+            std::chrono::steady_clock::time_point tmSent = std::chrono::steady_clock::now();
+            for (int nIter = 0; nIter < nBurstSize; ++nIter)
+            {
+                ASSERT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12106, eMode), 0);
+            }
+            pSenderNode.FlushTCP("127.0.0.1", 12106);
+            while (nReceived < (nBurst + 1) * nBurstSize)
+            {
+                std::this_thread::yield();
+            }
+            vLatencies.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tmSent).count());
+        }
+        double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStart).count();
+
+        testutils::PrintBenchmarkResult(bCorked ? "TCP bursts, corked and flushed" : "TCP bursts, no delay",
+                                        {{"packets/s", nPackets / dSeconds},
+                                         {"burst p50 us", testutils::Percentile(vLatencies, 50.0)},
+                                         {"burst p99 us", testutils::Percentile(vLatencies, 99.0)}});
+    }
+
+    pReceiverNode.CloseTCPSocket();
+}
@@ -0,0 +1,1749 @@
+/******************************************************************************
+ * @brief Integration tests and loopback benchmarks for UDP functionality in
+ *        RoveComm.
+ *
+ * @file udp.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Get the current steady clock time in nanoseconds. Used to stamp
+ *        benchmark packets so the receiver can compute one-way latency.
+ *
+ * @return uint64_t - Nanoseconds since the steady clock epoch.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static uint64_t GetSteadyNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/******************************************************************************
+ * @brief Send a paced stream of timestamped packets from one UDP node to
+ *        another over loopback and report delivered packets/s and latency.
+ *
+ * @param eMode - The receive mode of the receiving node.
+ * @param nPort - The port to bind the receiving node to.
+ * @param nPackets - The number of packets to send.
+ * @param nRateHz - The offered send rate in packets per second.
+ * @param szName - The name to print alongside the results.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static void RunReceiveModeBenchmark(rovecomm::RoveCommUDP::UDPReceiveMode eMode, int nPort, int nPackets, int nRateHz, const std::string& szName)
+{
+    const uint16_t unDataId = 1200;
+
+    // Create the receiving and sending nodes.
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    pReceiverNode.SetReceiveMode(eMode);
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(nPort));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+
+    // The callback only ever runs on the receiver's thread, so the sample vector has a single writer.
+    std::vector<double> vLatenciesUS(nPackets, 0.0);
+    std::atomic<int> nReceived(0);
+    std::atomic<uint64_t> unLastReceiveNS(0);
+    std::function<void(const rovecomm::RoveCommPacket<uint32_t>&, const sockaddr_in&)> fnCallback =
+        [&](const rovecomm::RoveCommPacket<uint32_t>& stPacket, const sockaddr_in& saAddress)
+    {
+        (void) saAddress;
+        uint64_t unNow    = GetSteadyNanoseconds();
+        uint64_t unSentNS = (static_cast<uint64_t>(stPacket.vData[0]) << 32) | stPacket.vData[1];
+        int nIndex        = nReceived.load();
+        if (nIndex < static_cast<int>(vLatenciesUS.size()))
+        {
+            vLatenciesUS[nIndex] = (unNow - unSentNS) / 1000.0;
+        }
+        unLastReceiveNS = unNow;
+        nReceived++;
+    };
+    pReceiverNode.AddUDPCallback<uint32_t>(fnCallback, unDataId);
+
+    // Send the packets at the requested rate.
+    rovecomm::RoveCommPacket<uint32_t> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = 2;
+    stPacket.eDataType   = manifest::DataTypes::UINT32_T;
+    stPacket.vData.resize(2);
+
+    std::chrono::nanoseconds tmInterval(1000000000LL / nRateHz);
+    std::chrono::steady_clock::time_point tmNextSend = std::chrono::steady_clock::now();
+    uint64_t unFirstSendNS                           = GetSteadyNanoseconds();
+    for (int nIter = 0; nIter < nPackets; ++nIter)
+    {
+        while (std::chrono::steady_clock::now() < tmNextSend)
+        {
+        }
+        tmNextSend += tmInterval;
+
+        uint64_t unNow    = GetSteadyNanoseconds();
+        stPacket.vData[0] = static_cast<uint32_t>(unNow >> 32);
+        stPacket.vData[1] = static_cast<uint32_t>(unNow & 0xFFFFFFFF);
+        pSenderNode.SendUDPPacket<uint32_t>(stPacket, "127.0.0.1", nPort);
+    }
+
+    // Wait until everything arrived, or until nothing has arrived for a while.
+    std::chrono::steady_clock::time_point tmLastProgress = std::chrono::steady_clock::now();
+    int nLastReceived                                    = -1;
+    while (nReceived < nPackets && std::chrono::steady_clock::now() - tmLastProgress < std::chrono::milliseconds(500))
+    {
+        if (nReceived != nLastReceived)
+        {
+            nLastReceived  = nReceived;
+            tmLastProgress = std::chrono::steady_clock::now();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // Stop the receiver before reading the samples.
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+    pReceiverNode.RemoveUDPCallback<uint32_t>(fnCallback);
+
+    int nTotalReceived = std::min(nReceived.load(), nPackets);
+    vLatenciesUS.resize(nTotalReceived);
+    double dElapsedS = nTotalReceived > 0 ? (unLastReceiveNS - unFirstSendNS) / 1e9 : 1.0;
+
+    testutils::PrintBenchmarkResult(szName,
+                                    {{"received", nTotalReceived},
+                                     {"dropped", nPackets - nTotalReceived},
+                                     {"pkt/s", nTotalReceived / dElapsedS},
+                                     {"p50_us", testutils::Percentile(vLatenciesUS, 50)},
+                                     {"p99_us", testutils::Percentile(vLatenciesUS, 99)}});
+
+    EXPECT_GT(nTotalReceived, 0);
+}
+
+/******************************************************************************
+ * @brief Compare the legacy non-blocking polling receive loop against the
+ *        event-driven receive loop, both at a low command rate and under a
+ *        telemetry-style flood.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDPBenchmark, ReceiveModes)
+{
+    RunReceiveModeBenchmark(rovecomm::RoveCommUDP::eNonBlockingPoll, 11100, 50, 500, "UDP poll receive (500 pkt/s)");
+    RunReceiveModeBenchmark(rovecomm::RoveCommUDP::eEventDriven, 11101, 50, 500, "UDP event receive (500 pkt/s)");
+    RunReceiveModeBenchmark(rovecomm::RoveCommUDP::eNonBlockingPoll, 11102, 2000, 10000, "UDP poll receive (10k pkt/s)");
+    RunReceiveModeBenchmark(rovecomm::RoveCommUDP::eEventDriven, 11103, 2000, 10000, "UDP event receive (10k pkt/s)");
+}
+
+/******************************************************************************
+ * @brief Test that an event-driven node sleeping in the kernel with no traffic
+ *        still stops promptly when the socket is closed.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, EventDrivenClosePromptly)
+{
+    rovecomm::RoveCommUDP pRoveCommUDP_Node;
+    EXPECT_TRUE(pRoveCommUDP_Node.SetReceiveMode(rovecomm::RoveCommUDP::eEventDriven));
+    ASSERT_TRUE(pRoveCommUDP_Node.InitUDPSocket(11104));
+
+    // The receive thread is already waiting on the epoll instance, so the mode cannot change under it.
+    EXPECT_FALSE(pRoveCommUDP_Node.SetReceiveMode(rovecomm::RoveCommUDP::eNonBlockingPoll));
+    EXPECT_EQ(pRoveCommUDP_Node.GetReceiveMode(), rovecomm::RoveCommUDP::eEventDriven);
+
+    // Let the receive thread go to sleep in the kernel.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    pRoveCommUDP_Node.CloseUDPSocket();
+    std::chrono::milliseconds tmElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - tmStart);
+
+    // The wakeup eventfd should stop the thread well before the wait timeout expires.
+    EXPECT_LT(tmElapsed.count(), rovecomm::ROVECOMM_EVENT_WAIT_TIMEOUT_MS);
+}
+
+/******************************************************************************
+ * @brief Send bursts of telemetry-sized packets at an event-driven node and
+ *        report how many receive syscalls were needed per packet for a given
+ *        receive batch size.
+ *
+ * @param unBatchSize - The receive batch size of the receiving node.
+ * @param nPort - The port to bind the receiving node to.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static void RunReceiveBatchBenchmark(unsigned int unBatchSize, int nPort)
+{
+    const uint16_t unDataId = 1201;
+    const int nBursts       = 20;
+    const int nBurstSize    = 100;
+
+    // Create the receiving and sending nodes.
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    pReceiverNode.SetReceiveMode(rovecomm::RoveCommUDP::eEventDriven);
+    EXPECT_TRUE(pReceiverNode.SetReceiveBatchSize(unBatchSize));
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(nPort));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+
+    // The receive batch is allocated now, so it cannot grow under the receive thread.
+    EXPECT_FALSE(pReceiverNode.SetReceiveBatchSize(unBatchSize * 4));
+    EXPECT_EQ(pReceiverNode.GetReceiveBatchSize(), unBatchSize);
+
+    std::atomic<int> nReceived(0);
+    std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)> fnCallback = [&](const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)
+    {
+        nReceived++;
+    };
+    pReceiverNode.AddUDPCallback<float>(fnCallback, unDataId);
+
+    // Create a DRIVESPEEDS-sized packet.
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = 6;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    for (int nBurst = 0; nBurst < nBursts; ++nBurst)
+    {
+        for (int nIter = 0; nIter < nBurstSize; ++nIter)
+        {
+            pSenderNode.SendUDPPacket<float>(stPacket, "127.0.0.1", nPort);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    // Wait for every packet, or give up after a second.
+    while (nReceived < nBursts * nBurstSize && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(1))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    double dElapsedS = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStart).count();
+
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+    pReceiverNode.RemoveUDPCallback<float>(fnCallback);
+
+    rovecomm::RoveCommUDP::UDPStatistics stStatistics = pReceiverNode.GetStatistics();
+    testutils::PrintBenchmarkResult("UDP burst receive (batch " + std::to_string(unBatchSize) + ")",
+                                    {{"received", nReceived.load()},
+                                     {"pkt/s", nReceived / dElapsedS},
+                                     {"recv_calls", static_cast<double>(stStatistics.unReceiveSyscalls)},
+                                     {"wait_calls", static_cast<double>(stStatistics.unWaitSyscalls)},
+                                     {"syscalls/pkt", stStatistics.dSyscallsPerPacket}});
+
+    EXPECT_EQ(stStatistics.unPacketsReceived, static_cast<uint64_t>(nReceived.load()));
+    EXPECT_GT(nReceived.load(), 0);
+}
+
+/******************************************************************************
+ * @brief Compare single-datagram receives against batched recvmmsg receives
+ *        under bursty telemetry.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDPBenchmark, ReceiveBatchSize)
+{
+    RunReceiveBatchBenchmark(1, 11110);
+    RunReceiveBatchBenchmark(16, 11111);
+    RunReceiveBatchBenchmark(64, 11112);
+}
+
+/******************************************************************************
+ * @brief Subscribe several receiving nodes to one sending node, then measure the
+ *        cost of fanning telemetry out to all of them.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDPBenchmark, SubscriberFanOut)
+{
+    const uint16_t unDataId    = 1202;
+    const int nSenderPort      = 11120;
+    const int nSubscriberCount = 4;
+    const int nPackets         = 1000;
+
+    // Create the sending node and the subscribing nodes.
+    rovecomm::RoveCommUDP pSenderNode;
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(nSenderPort));
+    std::vector<std::unique_ptr<rovecomm::RoveCommUDP>> vSubscriberNodes;
+    for (int nIter = 0; nIter < nSubscriberCount; ++nIter)
+    {
+        vSubscriberNodes.emplace_back(std::make_unique<rovecomm::RoveCommUDP>());
+        ASSERT_TRUE(vSubscriberNodes.back()->InitUDPSocket(nSenderPort + 1 + nIter));
+    }
+
+    // Every subscriber owns its callbacks, so register the same counting callback on each of them.
+    std::atomic<int> nReceived(0);
+    std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)> fnCallback = [&](const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)
+    {
+        nReceived++;
+    };
+    for (const std::unique_ptr<rovecomm::RoveCommUDP>& pSubscriberNode : vSubscriberNodes)
+    {
+        pSubscriberNode->AddUDPCallback<float>(fnCallback, unDataId);
+    }
+
+    // Subscribe every node to the sender.
+    rovecomm::RoveCommPacket<uint8_t> stSubscribePacket;
+    stSubscribePacket.unDataId    = manifest::System::SUBSCRIBE_DATA_ID;
+    stSubscribePacket.unDataCount = 1;
+    stSubscribePacket.eDataType   = manifest::DataTypes::UINT8_T;
+    stSubscribePacket.vData       = {0};
+    for (const std::unique_ptr<rovecomm::RoveCommUDP>& pSubscriberNode : vSubscriberNodes)
+    {
+        pSubscriberNode->SendUDPPacket<uint8_t>(stSubscribePacket, "127.0.0.1", nSenderPort);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // Create a DRIVESPEEDS-sized packet.
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = 6;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+
+    // Send to subscribers only, in small bursts so the receive buffers do not overflow.
+    rovecomm::RoveCommUDP::UDPStatistics stBefore = pSenderNode.GetStatistics();
+    std::vector<double> vSendTimesUs;
+    for (int nIter = 0; nIter < nPackets; ++nIter)
+    {
+        std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+        pSenderNode.SendUDPPacket<float>(stPacket, "0.0.0.0", 0);
+        vSendTimesUs.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tmStart).count());
+        if (nIter % 50 == 49)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+    rovecomm::RoveCommUDP::UDPStatistics stAfter = pSenderNode.GetStatistics();
+
+    // Wait for every delivery, or give up after a second.
+    std::chrono::steady_clock::time_point tmWaitStart = std::chrono::steady_clock::now();
+    while (nReceived < nPackets * nSubscriberCount && std::chrono::steady_clock::now() - tmWaitStart < std::chrono::seconds(1))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    for (const std::unique_ptr<rovecomm::RoveCommUDP>& pSubscriberNode : vSubscriberNodes)
+    {
+        pSubscriberNode->CloseUDPSocket();
+    }
+    pSenderNode.CloseUDPSocket();
+
+    uint64_t unSendSyscalls = stAfter.unSendSyscalls - stBefore.unSendSyscalls;
+    uint64_t unPacketsSent  = stAfter.unPacketsSent - stBefore.unPacketsSent;
+    testutils::PrintBenchmarkResult("UDP subscriber fan-out (" + std::to_string(nSubscriberCount) + " subscribers)",
+                                    {{"received", nReceived.load()},
+                                     {"send_calls/pkt", static_cast<double>(unSendSyscalls) / nPackets},
+                                     {"p50_us", testutils::Percentile(vSendTimesUs, 50.0)},
+                                     {"p99_us", testutils::Percentile(vSendTimesUs, 99.0)}});
+
+    // Each packet should reach every subscriber with a single syscall.
+    EXPECT_EQ(unPacketsSent, static_cast<uint64_t>(nPackets * nSubscriberCount));
+    EXPECT_EQ(unSendSyscalls, static_cast<uint64_t>(nPackets));
+    EXPECT_GT(nReceived.load(), 0);
+}
+
+/******************************************************************************
+ * @brief Verify that a batch of packets of different types is delivered intact
+ *        with a single send syscall.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, SendBatch)
+{
+    const int nPort = 11130;
+
+    // Create the receiving and sending nodes.
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(nPort));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+
+    std::atomic<int> nFloatPackets(0);
+    std::atomic<int> nUInt16Packets(0);
+    std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)> fnFloatCallback =
+        [&](const rovecomm::RoveCommPacket<float>& stPacket, const sockaddr_in&)
+    {
+        if (stPacket.vData == std::vector<float>{1.5f, -2.5f})
+        {
+            nFloatPackets++;
+        }
+    };
+    std::function<void(const rovecomm::RoveCommPacket<uint16_t>&, const sockaddr_in&)> fnUInt16Callback =
+        [&](const rovecomm::RoveCommPacket<uint16_t>& stPacket, const sockaddr_in&)
+    {
+        if (stPacket.vData == std::vector<uint16_t>{1, 2, 3})
+        {
+            nUInt16Packets++;
+        }
+    };
+    pReceiverNode.AddUDPCallback<float>(fnFloatCallback, 1203);
+    pReceiverNode.AddUDPCallback<uint16_t>(fnUInt16Callback, 1204);
+
+    // Build a mixed batch.
+    rovecomm::RoveCommPacket<float> stFloatPacket;
+    stFloatPacket.unDataId    = 1203;
+    stFloatPacket.unDataCount = 2;
+    stFloatPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stFloatPacket.vData       = {1.5f, -2.5f};
+    rovecomm::RoveCommPacket<uint16_t> stUInt16Packet;
+    stUInt16Packet.unDataId    = 1204;
+    stUInt16Packet.unDataCount = 3;
+    stUInt16Packet.eDataType   = manifest::DataTypes::UINT16_T;
+    stUInt16Packet.vData       = {1, 2, 3};
+
+    rovecomm::RoveCommUDPBatch stBatch;
+    for (int nIter = 0; nIter < 5; ++nIter)
+    {
+        EXPECT_TRUE(stBatch.AddPacket<float>(stFloatPacket, "127.0.0.1", nPort));
+        EXPECT_TRUE(stBatch.AddPacket<uint16_t>(stUInt16Packet, "127.0.0.1", nPort));
+    }
+    EXPECT_FALSE(stBatch.AddPacket<float>(stFloatPacket, "not an address", nPort));
+    EXPECT_EQ(stBatch.GetPacketCount(), 10u);
+
+    rovecomm::RoveCommUDP::UDPStatistics stBefore = pSenderNode.GetStatistics();
+    EXPECT_EQ(pSenderNode.SendUDPBatch(stBatch), 10);
+    rovecomm::RoveCommUDP::UDPStatistics stAfter = pSenderNode.GetStatistics();
+    EXPECT_EQ(stAfter.unSendSyscalls - stBefore.unSendSyscalls, 1u);
+
+    // Wait for every packet, or give up after a second.
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    while ((nFloatPackets < 5 || nUInt16Packets < 5) && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(1))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+    pReceiverNode.RemoveUDPCallback<float>(fnFloatCallback);
+    pReceiverNode.RemoveUDPCallback<uint16_t>(fnUInt16Callback);
+
+    EXPECT_EQ(nFloatPackets.load(), 5);
+    EXPECT_EQ(nUInt16Packets.load(), 5);
+
+    // A cleared batch sends nothing.
+    stBatch.Clear();
+    EXPECT_EQ(stBatch.GetPacketCount(), 0u);
+}
+
+/******************************************************************************
+ * @brief Verify that view callbacks and packet callbacks registered for the same
+ *        data ID both see the received data.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, ViewCallbackInvoked)
+{
+    const int nPort = 11140;
+
+    // Create the receiving and sending nodes.
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(nPort));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+
+    std::atomic<int> nViewPackets(0);
+    std::atomic<int> nPacketPackets(0);
+    std::function<void(const rovecomm::RoveCommPacketView<int16_t>&, const sockaddr_in&)> fnViewCallback =
+        [&](const rovecomm::RoveCommPacketView<int16_t>& stView, const sockaddr_in&)
+    {
+        if (stView.size() == 3 && stView[0] == -300 && stView[2] == 300)
+        {
+            nViewPackets++;
+        }
+    };
+    std::function<void(const rovecomm::RoveCommPacket<int16_t>&, const sockaddr_in&)> fnPacketCallback =
+        [&](const rovecomm::RoveCommPacket<int16_t>& stPacket, const sockaddr_in&)
+    {
+        if (stPacket.vData == std::vector<int16_t>{-300, 0, 300})
+        {
+            nPacketPackets++;
+        }
+    };
+    pReceiverNode.AddUDPViewCallback<int16_t>(fnViewCallback, 1205);
+    pReceiverNode.AddUDPCallback<int16_t>(fnPacketCallback, 1205);
+
+    rovecomm::RoveCommPacket<int16_t> stPacket;
+    stPacket.unDataId    = 1205;
+    stPacket.unDataCount = 3;
+    stPacket.eDataType   = manifest::DataTypes::INT16_T;
+    stPacket.vData       = {-300, 0, 300};
+    pSenderNode.SendUDPPacket<int16_t>(stPacket, "127.0.0.1", nPort);
+
+    // Wait for the packet, or give up after a second.
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    while ((nViewPackets < 1 || nPacketPackets < 1) && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(1))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+    pReceiverNode.RemoveUDPViewCallback<int16_t>(fnViewCallback);
+    pReceiverNode.RemoveUDPCallback<int16_t>(fnPacketCallback);
+
+    EXPECT_EQ(nViewPackets.load(), 1);
+    EXPECT_EQ(nPacketPackets.load(), 1);
+}
+
+/******************************************************************************
+ * @brief Compare the per-packet cost of unpacking into an owning RoveCommPacket
+ *        against reading the same values through a RoveCommPacketView.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDPBenchmark, PacketViewDecode)
+{
+    const int nIterations = 200000;
+
+    // Create a DRIVESPEEDS-sized packet.
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = 1206;
+    stPacket.unDataCount = 6;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+    rovecomm::RoveCommData stData = rovecomm::PackPacket(stPacket);
+
+    // Read one element per packet, the common case for telemetry callbacks.
+    volatile float fSink = 0.0f;
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    for (int nIter = 0; nIter < nIterations; ++nIter)
+    {
+        rovecomm::RoveCommPacket<float> stUnpacked = rovecomm::UnpackData<float>(stData);
+        fSink                                      = stUnpacked.vData[0];
+    }
+    double dUnpackNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tmStart).count() / nIterations;
+
+    tmStart = std::chrono::steady_clock::now();
+    for (int nIter = 0; nIter < nIterations; ++nIter)
+    {
+        rovecomm::RoveCommPacketView<float> stView = rovecomm::ViewData<float>(stData);
+        fSink                                      = stView[0];
+    }
+    double dViewNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tmStart).count() / nIterations;
+    (void) fSink;
+
+    testutils::PrintBenchmarkResult("Packet decode (6 floats, read 1)", {{"unpack_ns", dUnpackNs}, {"view_ns", dViewNs}});
+    EXPECT_GT(dUnpackNs, 0.0);
+}
+
+/******************************************************************************
+ * @brief Measure how the cost of dispatching one packet grows with the number
+ *        of registered callbacks. Only one callback matches the packet's data
+ *        id, and the rest are registered for other data ids. The linear scan
+ *        over a vector of (callback, data id) tuples is how callbacks were
+ *        stored before the index and is kept here as the reference.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDPBenchmark, CallbackDispatchScaling)
+{
+    const int nIterations   = 100000;
+    const uint16_t unDataId = 1207;
+
+    // Create a single-float telemetry packet.
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId             = unDataId;
+    stPacket.unDataCount          = 1;
+    stPacket.eDataType            = manifest::DataTypes::FLOAT_T;
+    stPacket.vData                = {42.0f};
+    rovecomm::RoveCommData stData = rovecomm::PackPacket(stPacket);
+
+    struct sockaddr_in saClientAddr;
+    memset(&saClientAddr, 0, sizeof(saClientAddr));
+    saClientAddr.sin_family = AF_INET;
+
+    rovecomm::RoveCommUDP pNode;
+    for (int nCallbackCount : {1, 100, 1000})
+    {
+        // Register one matching callback and fill the rest with callbacks for other data ids.
+        std::atomic<int> nMatched(0);
+        std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)> fnMatching =
+            [&nMatched](const rovecomm::RoveCommPacket<float>&, const sockaddr_in&) { nMatched.fetch_add(1, std::memory_order_relaxed); };
+        std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)> fnOther = [](const rovecomm::RoveCommPacket<float>&, const sockaddr_in&) {};
+
+        std::vector<std::tuple<std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)>, unsigned int>> vLinearCallbacks;
+        for (int nIndex = 0; nIndex < nCallbackCount - 1; ++nIndex)
+        {
+            uint16_t unOtherId = static_cast<uint16_t>(2000 + nIndex);
+            pNode.AddUDPCallback<float>(fnOther, unOtherId);
+            vLinearCallbacks.push_back(std::make_tuple(fnOther, unOtherId));
+        }
+        pNode.AddUDPCallback<float>(fnMatching, unDataId);
+        vLinearCallbacks.push_back(std::make_tuple(fnMatching, unDataId));
+
+        // Dispatch through the index.
+        std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+        for (int nIter = 0; nIter < nIterations; ++nIter)
+        {
+            pNode.CallProcessPacket<float>(stData, saClientAddr);
+        }
+        double dIndexedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tmStart).count() / nIterations;
+        EXPECT_EQ(nMatched.load(), nIterations);
+
+        // Dispatch with the old linear scan.
+        tmStart = std::chrono::steady_clock::now();
+        for (int nIter = 0; nIter < nIterations; ++nIter)
+        {
+            rovecomm::RoveCommPacketView<float> stView = rovecomm::ViewData<float>(stData);
+            for (const auto& tpCallbackInfo : vLinearCallbacks)
+            {
+                if (std::get<1>(tpCallbackInfo) == stView.unDataId)
+                {
+                    std::get<0>(tpCallbackInfo)(stView.ToPacket(), saClientAddr);
+                }
+            }
+        }
+        double dLinearNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tmStart).count() / nIterations;
+        EXPECT_EQ(nMatched.load(), 2 * nIterations);
+
+        pNode.RemoveUDPCallback<float>(fnOther);
+        pNode.RemoveUDPCallback<float>(fnMatching);
+
+        testutils::PrintBenchmarkResult("Dispatch with " + std::to_string(nCallbackCount) + " callbacks",
+                                        {{"indexed_ns", dIndexedNs}, {"linear_scan_ns", dLinearNs}});
+        EXPECT_GT(dIndexedNs, 0.0);
+    }
+}
+
+/******************************************************************************
+ * @brief Stress the callback registry by adding and removing callbacks from
+ *        two threads while a third dispatches packets as fast as it can. A
+ *        callback that stays registered the whole time must see every
+ *        dispatch, and callbacks that are being removed must never run after
+ *        their removal returns.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, CallbackRegistryStress)
+{
+    const uint16_t unDataId = 1208;
+
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId             = unDataId;
+    stPacket.unDataCount          = 1;
+    stPacket.eDataType            = manifest::DataTypes::FLOAT_T;
+    stPacket.vData                = {1.0f};
+    rovecomm::RoveCommData stData = rovecomm::PackPacket(stPacket);
+
+    struct sockaddr_in saClientAddr;
+    memset(&saClientAddr, 0, sizeof(saClientAddr));
+    saClientAddr.sin_family = AF_INET;
+
+    rovecomm::RoveCommUDP pNode;
+    std::atomic<uint64_t> unStableCalls(0);
+    std::atomic<uint64_t> unChurnCalls(0);
+    std::atomic<bool> bChurnRemoved(true);
+    std::atomic<bool> bLateCall(false);
+    std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)> fnStable = [&](const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)
+    { unStableCalls.fetch_add(1, std::memory_order_relaxed); };
+    std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)> fnChurn = [&](const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)
+    {
+        unChurnCalls.fetch_add(1, std::memory_order_relaxed);
+        if (bChurnRemoved.load())
+        {
+            bLateCall = true;
+        }
+    };
+    pNode.AddUDPCallback<float>(fnStable, unDataId);
+
+    // Dispatch as fast as possible for a fixed time, with and without churn.
+    auto fnDispatch = [&](std::chrono::milliseconds tmDuration) -> uint64_t
+    {
+        uint64_t unDispatched                       = 0;
+        std::chrono::steady_clock::time_point tmEnd = std::chrono::steady_clock::now() + tmDuration;
+        while (std::chrono::steady_clock::now() < tmEnd)
+        {
+            for (int nIter = 0; nIter < 256; ++nIter)
+            {
+                pNode.CallProcessPacket<float>(stData, saClientAddr);
+            }
+            unDispatched += 256;
+        }
+        return unDispatched;
+    };
+
+    uint64_t unQuietDispatched = fnDispatch(std::chrono::milliseconds(300));
+    EXPECT_EQ(unStableCalls.load(), unQuietDispatched);
+
+    // One thread adds and removes the churn callback for the dispatched data id, the other for unrelated ids.
+    std::atomic<bool> bStop(false);
+    std::atomic<uint64_t> unUpdates(0);
+    std::thread thSameId(
+        [&]()
+        {
+            while (!bStop)
+            {
+                bChurnRemoved = false;
+                pNode.AddUDPCallback<float>(fnChurn, unDataId);
+                pNode.RemoveUDPCallback<float>(fnChurn);
+                bChurnRemoved = true;
+                unUpdates.fetch_add(2, std::memory_order_relaxed);
+            }
+        });
+    std::thread thOtherIds(
+        [&]()
+        {
+            std::function<void(const rovecomm::RoveCommPacketView<float>&, const sockaddr_in&)> fnOther = [](const rovecomm::RoveCommPacketView<float>&, const sockaddr_in&) {};
+            uint16_t unOtherId = 2000;
+            while (!bStop)
+            {
+                pNode.AddUDPViewCallback<float>(fnOther, unOtherId);
+                pNode.RemoveUDPViewCallback<float>(fnOther);
+                unOtherId = unOtherId == 2999 ? 2000 : unOtherId + 1;
+                unUpdates.fetch_add(2, std::memory_order_relaxed);
+            }
+        });
+
+    uint64_t unStableBefore    = unStableCalls.load();
+    uint64_t unChurnDispatched = fnDispatch(std::chrono::milliseconds(1000));
+    bStop                      = true;
+    thSameId.join();
+    thOtherIds.join();
+
+    EXPECT_EQ(unStableCalls.load() - unStableBefore, unChurnDispatched);
+    EXPECT_FALSE(bLateCall.load());
+    EXPECT_GT(unChurnCalls.load(), 0u);
+
+    // The stable callback stops running once it is removed.
+    pNode.RemoveUDPCallback<float>(fnStable);
+    uint64_t unStableAfter = unStableCalls.load();
+    pNode.CallProcessPacket<float>(stData, saClientAddr);
+    EXPECT_EQ(unStableCalls.load(), unStableAfter);
+
+    testutils::PrintBenchmarkResult("Dispatch under callback churn",
+                                    {{"quiet_dispatch/s", unQuietDispatched / 0.3}, {"churn_dispatch/s", static_cast<double>(unChurnDispatched)}, {"updates/s", static_cast<double>(unUpdates.load())}});
+}
+
+/******************************************************************************
+ * @brief Measure how long it takes to add and then remove one callback while
+ *        many others are registered, removing either by handle or by target
+ *        type. Removing by target type checks every registered callback.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDPBenchmark, CallbackUnsubscribeCost)
+{
+    const int nIterations   = 2000;
+    const uint16_t unDataId = 1209;
+
+    rovecomm::RoveCommUDP pNode;
+    std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)> fnOther = [](const rovecomm::RoveCommPacket<float>&, const sockaddr_in&) {};
+    for (int nIndex = 0; nIndex < 4000; ++nIndex)
+    {
+        pNode.AddUDPCallback<float>(fnOther, static_cast<uint16_t>(4000 + nIndex));
+    }
+
+    std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)> fnToggled = [](const rovecomm::RoveCommPacket<float>&, const sockaddr_in& saClientAddr)
+    { (void) saClientAddr; };
+
+    // Remove through the handle returned by AddUDPCallback.
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    for (int nIter = 0; nIter < nIterations; ++nIter)
+    {
+        rovecomm::RoveCommCallbackHandle stHandle = pNode.AddUDPCallback<float>(fnToggled, unDataId);
+        EXPECT_TRUE(stHandle.Unsubscribe());
+    }
+    double dHandleUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tmStart).count() / nIterations;
+
+    // Remove by matching the target type against every registered callback.
+    tmStart = std::chrono::steady_clock::now();
+    for (int nIter = 0; nIter < nIterations; ++nIter)
+    {
+        pNode.AddUDPCallback<float>(fnToggled, unDataId);
+        pNode.RemoveUDPCallback<float>(fnToggled);
+    }
+    double dTargetTypeUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tmStart).count() / nIterations;
+
+    pNode.RemoveUDPCallback<float>(fnOther);
+
+    testutils::PrintBenchmarkResult("Add and remove 1 of 4000 callbacks", {{"handle_us", dHandleUs}, {"target_type_us", dTargetTypeUs}});
+    EXPECT_GT(dHandleUs, 0.0);
+}
+
+/******************************************************************************
+ * @brief Test that a node with dispatch workers runs every callback off the
+ *        receive thread, drains the queue when it is closed, and reports it in
+ *        its dispatch counters.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, AsyncDispatchDeliversEveryPacket)
+{
+    const uint16_t unDataId = 1210;
+    const int nPackets      = 200;
+
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    EXPECT_TRUE(pReceiverNode.SetCallbackDispatch(4, 64, rovecomm::eOverflowBlock));
+    EXPECT_EQ(pReceiverNode.GetCallbackDispatchThreads(), 4u);
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(11113));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+
+    // The workers are running now, so the dispatch cannot be swapped out from under them.
+    EXPECT_FALSE(pReceiverNode.SetCallbackDispatch(0));
+    EXPECT_EQ(pReceiverNode.GetCallbackDispatchThreads(), 4u);
+
+    // Every callback is slow, so running them inline would fall far behind the sender.
+    std::atomic<int> nReceived(0);
+    std::atomic<int> nConcurrent(0);
+    std::atomic<int> nMaxConcurrent(0);
+    pReceiverNode.AddUDPCallback<uint8_t>(
+        [&](const rovecomm::RoveCommPacket<uint8_t>&, const sockaddr_in&)
+        {
+            int nRunning = ++nConcurrent;
+            int nMax     = nMaxConcurrent.load();
+            while (nRunning > nMax && !nMaxConcurrent.compare_exchange_weak(nMax, nRunning))
+            {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            nConcurrent--;
+            nReceived++;
+        },
+        unDataId);
+
+    rovecomm::RoveCommPacket<uint8_t> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = 1;
+    stPacket.eDataType   = manifest::DataTypes::UINT8_T;
+    stPacket.vData       = {1};
+    for (int nIter = 0; nIter < nPackets; ++nIter)
+    {
+        pSenderNode.SendUDPPacket<uint8_t>(stPacket, "127.0.0.1", 11113);
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    // Wait for every callback. Closing earlier would reject packets the receive thread is still waiting to queue.
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    while (nReceived < nPackets && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(2))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+
+    rovecomm::RoveCommDispatchStatistics stStatistics = pReceiverNode.GetDispatchStatistics();
+    EXPECT_EQ(nReceived, nPackets);
+    EXPECT_GT(nMaxConcurrent, 1);
+    EXPECT_EQ(stStatistics.unEnqueued, static_cast<uint64_t>(nPackets));
+    EXPECT_EQ(stStatistics.unDispatched, static_cast<uint64_t>(nPackets));
+    EXPECT_EQ(stStatistics.siDepth, 0u);
+    EXPECT_LE(stStatistics.siMaxDepth, 64u);
+}
+
+/******************************************************************************
+ * @brief Flood a node whose callback takes 100 us per packet and report how
+ *        many datagrams the receive thread read from the socket and how many
+ *        callbacks ran, with callbacks inline or on dispatch workers.
+ *
+ * @param unWorkers - The number of dispatch workers, 0 to run callbacks inline.
+ * @param nPort - The port to bind the receiving node to.
+ * @param szName - The name to print alongside the results.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static void RunSlowCallbackBenchmark(unsigned int unWorkers, int nPort, const std::string& szName)
+{
+    const uint16_t unDataId = 1211;
+    const int nBursts       = 20;
+    const int nBurstSize    = 200;
+
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    pReceiverNode.SetCallbackDispatch(unWorkers, rovecomm::ROVECOMM_DISPATCH_QUEUE_CAPACITY, rovecomm::eOverflowDropOldest);
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(nPort));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+
+    std::atomic<int> nCallbacks(0);
+    pReceiverNode.AddUDPCallback<float>(
+        [&](const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            nCallbacks++;
+        },
+        unDataId);
+
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = 6;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    for (int nBurst = 0; nBurst < nBursts; ++nBurst)
+    {
+        for (int nIter = 0; nIter < nBurstSize; ++nIter)
+        {
+            pSenderNode.SendUDPPacket<float>(stPacket, "127.0.0.1", nPort);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // Give the callbacks a moment to catch up before closing.
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+    double dElapsedS = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStart).count();
+
+    rovecomm::RoveCommUDP::UDPStatistics stStatistics         = pReceiverNode.GetStatistics();
+    rovecomm::RoveCommDispatchStatistics stDispatchStatistics = pReceiverNode.GetDispatchStatistics();
+    testutils::PrintBenchmarkResult(szName,
+                                    {{"sent", nBursts * nBurstSize},
+                                     {"socket_read", static_cast<double>(stStatistics.unPacketsReceived)},
+                                     {"callbacks", nCallbacks.load()},
+                                     {"callbacks/s", nCallbacks / dElapsedS},
+                                     {"queue_drops", static_cast<double>(stDispatchStatistics.unDroppedOldest + stDispatchStatistics.unDroppedNewest)},
+                                     {"max_depth", static_cast<double>(stDispatchStatistics.siMaxDepth)}});
+
+    EXPECT_GT(nCallbacks.load(), 0);
+}
+
+/******************************************************************************
+ * @brief Compare running a slow callback on the receive thread against running
+ *        it on a pool of dispatch workers.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDPBenchmark, SlowCallbackDispatch)
+{
+    RunSlowCallbackBenchmark(0, 11114, "Slow callback inline");
+    RunSlowCallbackBenchmark(4, 11115, "Slow callback on 4 workers");
+}
+
+/******************************************************************************
+ * @brief Flood a node with slow telemetry while sending it a command every
+ *        2 ms, and measure the command latency from send to callback. The node
+ *        uses the Core board's manifest split when bPriorities is set, and
+ *        every data id shares one lane otherwise.
+ *
+ * @param bPriorities - Whether to classify Core by its manifest split and give
+ *                      the command lane a dedicated thread.
+ * @param nPort - The port to bind the receiving node to.
+ * @param szName - The name to print alongside the results.
+ * @return std::vector<double> - The latency of every delivered command in us.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static std::vector<double> RunCommandLatencyUnderFlood(bool bPriorities, int nPort, const std::string& szName)
+{
+    const uint16_t unCommandId   = manifest::Core::COMMANDS.at("DRIVELEFTRIGHT").DATA_ID;
+    const uint16_t unTelemetryId = manifest::Core::TELEMETRY.at("IMUDATA").DATA_ID;
+    const int nCommands          = 100;
+    const int nTelemetryPerRound = 50;
+
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    pReceiverNode.SetCallbackDispatch(2, rovecomm::ROVECOMM_DISPATCH_QUEUE_CAPACITY, rovecomm::eOverflowDropOldest);
+    if (bPriorities)
+    {
+        pReceiverNode.SetManifestPriorities(manifest::Core::COMMANDS, manifest::Core::TELEMETRY, manifest::Core::ERROR);
+        pReceiverNode.SetDedicatedDispatchThread(rovecomm::ePriorityHigh);
+    }
+    if (!pReceiverNode.InitUDPSocket(nPort) || !pSenderNode.InitUDPSocket(0))
+    {
+        ADD_FAILURE() << "Failed to open the sockets for " << szName;
+        return {};
+    }
+
+    // Telemetry callbacks are slow enough that the two shared workers cannot keep up with the flood.
+    std::atomic<int> nTelemetry(0);
+    pReceiverNode.AddUDPCallback<float>(
+        [&](const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            nTelemetry++;
+        },
+        unTelemetryId);
+
+    // Each command carries its send time.
+    std::mutex muLatencies;
+    std::vector<double> vLatenciesUs;
+    pReceiverNode.AddUDPCallback<uint32_t>(
+        [&](const rovecomm::RoveCommPacket<uint32_t>& stPacket, const sockaddr_in&)
+        {
+            uint64_t unSent = (static_cast<uint64_t>(stPacket.vData[0]) << 32) | stPacket.vData[1];
+            std::lock_guard<std::mutex> lkLatencies(muLatencies);
+            vLatenciesUs.push_back((GetSteadyNanoseconds() - unSent) / 1000.0);
+        },
+        unCommandId);
+
+    rovecomm::RoveCommPacket<float> stTelemetry;
+    stTelemetry.unDataId    = unTelemetryId;
+    stTelemetry.unDataCount = 3;
+    stTelemetry.eDataType   = manifest::DataTypes::FLOAT_T;
+    stTelemetry.vData       = {1.0f, 2.0f, 3.0f};
+
+    rovecomm::RoveCommPacket<uint32_t> stCommand;
+    stCommand.unDataId    = unCommandId;
+    stCommand.unDataCount = 2;
+    stCommand.eDataType   = manifest::DataTypes::UINT32_T;
+
+    for (int nIter = 0; nIter < nCommands; ++nIter)
+    {
+        for (int nTelemetryIter = 0; nTelemetryIter < nTelemetryPerRound; ++nTelemetryIter)
+        {
+            pSenderNode.SendUDPPacket<float>(stTelemetry, "127.0.0.1", nPort);
+        }
+
+        uint64_t unNow  = GetSteadyNanoseconds();
+        stCommand.vData = {static_cast<uint32_t>(unNow >> 32), static_cast<uint32_t>(unNow)};
+        pSenderNode.SendUDPPacket<uint32_t>(stCommand, "127.0.0.1", nPort);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    // Without priorities the last commands are still behind a backlog of telemetry.
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(2))
+    {
+        {
+            std::lock_guard<std::mutex> lkLatencies(muLatencies);
+            if (vLatenciesUs.size() >= static_cast<size_t>(nCommands))
+            {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+
+    std::lock_guard<std::mutex> lkLatencies(muLatencies);
+    rovecomm::RoveCommDispatchStatistics stTelemetryStatistics = pReceiverNode.GetDispatchStatistics(bPriorities ? rovecomm::ePriorityLow : rovecomm::ePriorityNormal);
+    testutils::PrintBenchmarkResult(szName,
+                                    {{"commands", static_cast<double>(vLatenciesUs.size())},
+                                     {"telemetry_callbacks", nTelemetry.load()},
+                                     {"telemetry_drops", static_cast<double>(stTelemetryStatistics.unDroppedOldest + stTelemetryStatistics.unDroppedNewest)},
+                                     {"p50_us", testutils::Percentile(vLatenciesUs, 50.0)},
+                                     {"p99_us", testutils::Percentile(vLatenciesUs, 99.0)},
+                                     {"max_us", testutils::Percentile(vLatenciesUs, 100.0)}});
+
+    return vLatenciesUs;
+}
+
+/******************************************************************************
+ * @brief Test that commands classified from the manifest are dispatched ahead
+ *        of a telemetry flood, so their latency stays bounded while the shared
+ *        workers are saturated.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, PriorityDispatchBoundsCommandLatency)
+{
+    std::vector<double> vSharedLatenciesUs   = RunCommandLatencyUnderFlood(false, 11116, "Command latency, one lane");
+    std::vector<double> vPriorityLatenciesUs = RunCommandLatencyUnderFlood(true, 11117, "Command latency, priority lanes");
+
+    // Every command arrives, and none waits behind the telemetry backlog.
+    ASSERT_EQ(vPriorityLatenciesUs.size(), 100u);
+    EXPECT_LT(testutils::Percentile(vPriorityLatenciesUs, 99.0), 5000.0);
+    if (!vSharedLatenciesUs.empty())
+    {
+        EXPECT_LT(testutils::Percentile(vPriorityLatenciesUs, 50.0), testutils::Percentile(vSharedLatenciesUs, 50.0));
+    }
+}
+
+/******************************************************************************
+ * @brief Test that a node keeps the latest packet of each data id it receives,
+ *        so it can be polled without registering a callback.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, LatestValuePolling)
+{
+    const uint16_t unDataId = 1212;
+    const int nPackets      = 50;
+
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(11118));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+    EXPECT_FALSE(pReceiverNode.GetLatestValue<double>(unDataId).bValid);
+
+    rovecomm::RoveCommPacket<double> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = 2;
+    stPacket.eDataType   = manifest::DataTypes::DOUBLE_T;
+    for (int nIter = 1; nIter <= nPackets; ++nIter)
+    {
+        stPacket.vData = {static_cast<double>(nIter), -static_cast<double>(nIter)};
+        pSenderNode.SendUDPPacket<double>(stPacket, "127.0.0.1", 11118);
+    }
+
+    // Poll until the last packet shows up.
+    rovecomm::RoveCommLatestValue<double> stValue;
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    while (pReceiverNode.GetLatestSequence(unDataId) < nPackets && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(2))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(pReceiverNode.GetLatestValue<double>(unDataId, stValue));
+    EXPECT_EQ(stValue.unSequence, static_cast<uint64_t>(nPackets));
+    EXPECT_EQ(stValue.stPacket.vData, std::vector<double>({nPackets, -nPackets}));
+    EXPECT_LE(stValue.tmReceived, std::chrono::steady_clock::now());
+
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that a node fills the history of an enabled data id on receive,
+ *        and leaves data ids without history alone.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, HistoryFilledOnReceive)
+{
+    const manifest::ManifestEntry stDriveSpeeds = manifest::Core::TELEMETRY.at("DRIVESPEEDS");
+    const int nPackets                          = 60;
+
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    ASSERT_TRUE(pReceiverNode.EnableHistory(stDriveSpeeds, 32));
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(11119));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = stDriveSpeeds.DATA_ID;
+    stPacket.unDataCount = stDriveSpeeds.DATA_COUNT;
+    stPacket.eDataType   = stDriveSpeeds.DATA_TYPE;
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    for (int nIter = 1; nIter <= nPackets; ++nIter)
+    {
+        stPacket.vData = std::vector<float>(stDriveSpeeds.DATA_COUNT, static_cast<float>(nIter));
+        pSenderNode.SendUDPPacket<float>(stPacket, "127.0.0.1", 11119);
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+
+    while (pReceiverNode.GetLatestSequence(stDriveSpeeds.DATA_ID) < nPackets && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(2))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    rovecomm::RoveCommHistoryWindow<float> stWindow = pReceiverNode.GetLastSamples<float>(stDriveSpeeds.DATA_ID, 10);
+    ASSERT_EQ(stWindow.size(), 10u);
+    EXPECT_EQ(stWindow.GetValue(9, 0), static_cast<float>(nPackets));
+    EXPECT_EQ(stWindow.GetValue(0, 5), static_cast<float>(nPackets - 9));
+    EXPECT_GE(stWindow.GetTimestamp(0), tmStart);
+    EXPECT_TRUE(stWindow.IsIntact());
+
+    // Everything received after the start is still in the 32 sample ring.
+    EXPECT_EQ(pReceiverNode.GetSamplesSince<float>(stDriveSpeeds.DATA_ID, tmStart).size(), 32u);
+    EXPECT_TRUE(pReceiverNode.GetLastSamples<float>(manifest::Core::TELEMETRY.at("IMUDATA").DATA_ID, 10).empty());
+
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that a publisher fed from a tight loop puts at most its maximum
+ *        rate on the wire, and that the receiver ends up with the last value.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, PublisherLimitsSendRate)
+{
+    const manifest::ManifestEntry stDriveLeftRight = manifest::Core::COMMANDS.at("DRIVELEFTRIGHT");
+    const double dMaxRateHz                        = 100.0;
+
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(11120));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+    std::shared_ptr<rovecomm::RoveCommPublisher> pPublisher = pSenderNode.CreatePublisher(stDriveLeftRight.DATA_ID, dMaxRateHz, "127.0.0.1", 11120);
+    ASSERT_NE(pPublisher, nullptr);
+
+    // Publish as fast as a control loop would for 200 ms.
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = stDriveLeftRight.DATA_ID;
+    stPacket.unDataCount = stDriveLeftRight.DATA_COUNT;
+    stPacket.eDataType   = stDriveLeftRight.DATA_TYPE;
+    stPacket.vData       = {0.0f, 0.0f};
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    int nPublished                                = 0;
+    while (std::chrono::steady_clock::now() - tmStart < std::chrono::milliseconds(200))
+    {
+        ++nPublished;
+        stPacket.vData[0] = static_cast<float>(nPublished);
+        stPacket.vData[1] = -static_cast<float>(nPublished);
+        ASSERT_TRUE(pPublisher->Publish(stPacket));
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    std::chrono::duration<double> tmElapsed = std::chrono::steady_clock::now() - tmStart;
+
+    // Wait for the trailing packet of the last window.
+    rovecomm::RoveCommLatestValue<float> stValue;
+    while (std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(2))
+    {
+        if (pReceiverNode.GetLatestValue<float>(stDriveLeftRight.DATA_ID, stValue) && stValue.stPacket.vData[0] == static_cast<float>(nPublished))
+        {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(stValue.bValid);
+    EXPECT_EQ(stValue.stPacket.vData[0], static_cast<float>(nPublished));
+    EXPECT_EQ(stValue.stPacket.vData[1], -static_cast<float>(nPublished));
+
+    rovecomm::RoveCommPublisherStatistics stStatistics = pPublisher->GetStatistics();
+    EXPECT_EQ(stStatistics.unPublished, static_cast<uint64_t>(nPublished));
+    EXPECT_LE(stStatistics.unSent, static_cast<uint64_t>(tmElapsed.count() * dMaxRateHz) + 2);
+    EXPECT_EQ(stStatistics.unPublished, stStatistics.unSent + stStatistics.unCoalesced);
+    EXPECT_EQ(pReceiverNode.GetLatestSequence(stDriveLeftRight.DATA_ID), stStatistics.unSent);
+    std::cout << "[ PUBLISH  ] " << nPublished << " published, " << stStatistics.unSent << " sent, " << stStatistics.unCoalesced << " coalesced" << std::endl;
+
+    EXPECT_TRUE(pSenderNode.RemovePublisher(pPublisher));
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that periodic streams with related rates reach a receiver at
+ *        their rates, and that the scheduler sends them in shared batches.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, PeriodicStreamsShareBatches)
+{
+    const manifest::ManifestEntry stDriveSpeeds = manifest::Core::TELEMETRY.at("DRIVESPEEDS");
+    const manifest::ManifestEntry stIMUData     = manifest::Core::TELEMETRY.at("IMUDATA");
+
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(11121));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+
+    std::shared_ptr<rovecomm::RoveCommPeriodicStream> pSpeeds = pSenderNode.AddPeriodicStream<float>(
+        stDriveSpeeds.DATA_ID,
+        100.0,
+        [&stDriveSpeeds](rovecomm::RoveCommPacket<float>& stPacket)
+        {
+            stPacket.vData.assign(stDriveSpeeds.DATA_COUNT, 1.0f);
+            return true;
+        },
+        "127.0.0.1",
+        11121);
+    std::shared_ptr<rovecomm::RoveCommPeriodicStream> pIMU = pSenderNode.AddPeriodicStream<float>(
+        stIMUData.DATA_ID,
+        50.0,
+        [&stIMUData](rovecomm::RoveCommPacket<float>& stPacket)
+        {
+            stPacket.vData.assign(stIMUData.DATA_COUNT, 2.0f);
+            return true;
+        },
+        "127.0.0.1",
+        11121);
+    ASSERT_NE(pSpeeds, nullptr);
+    ASSERT_NE(pIMU, nullptr);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_TRUE(pSenderNode.RemovePeriodicStream(pSpeeds));
+    EXPECT_TRUE(pSenderNode.RemovePeriodicStream(pIMU));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    rovecomm::RoveCommPeriodicStatistics stSpeeds = pSpeeds->GetStatistics();
+    rovecomm::RoveCommPeriodicStatistics stIMU    = pIMU->GetStatistics();
+    EXPECT_GE(stSpeeds.unSent, 20u);
+    EXPECT_LE(stSpeeds.unSent, 31u);
+    EXPECT_GE(stIMU.unSent, 10u);
+    EXPECT_LE(stIMU.unSent, 16u);
+    EXPECT_EQ(pReceiverNode.GetLatestSequence(stDriveSpeeds.DATA_ID), stSpeeds.unSent);
+    EXPECT_EQ(pReceiverNode.GetLatestSequence(stIMUData.DATA_ID), stIMU.unSent);
+
+    // Every IMU sample rides along with a drive speeds sample.
+    rovecomm::RoveCommSchedulerStatistics stStatistics = pSenderNode.GetSchedulerStatistics();
+    EXPECT_EQ(stStatistics.unPacketsSent, stSpeeds.unSent + stIMU.unSent);
+    EXPECT_LE(stStatistics.unBatches, stSpeeds.unSent + stSpeeds.unMissed);
+    std::cout << "[ PERIODIC ] " << stStatistics.unPacketsSent << " packets in " << stStatistics.unBatches << " batches, " << stStatistics.unWakeups << " wakeups, "
+              << stStatistics.unLateWakeups << " late" << std::endl;
+
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that a send filter keeps unchanged telemetry off the wire, for
+ *        direct sends and for periodic streams, while changes and keepalives
+ *        still reach the receiver.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, SendFilterSuppressesUnchangedTelemetry)
+{
+    const manifest::ManifestEntry stDriveSpeeds = manifest::Core::TELEMETRY.at("DRIVESPEEDS");
+    const manifest::ManifestEntry stIMUData     = manifest::Core::TELEMETRY.at("IMUDATA");
+
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(11122));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+
+    rovecomm::RoveCommDeadband stDeadband;
+    stDeadband.dAbsolute   = 0.05;
+    stDeadband.tmKeepalive = std::chrono::milliseconds(100);
+    pSenderNode.SetSendFilter(stDriveSpeeds.DATA_ID, stDeadband);
+    pSenderNode.SetSendFilter(stIMUData.DATA_ID, stDeadband);
+
+    // Twenty identical sends and one real change put two packets on the wire.
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = stDriveSpeeds.DATA_ID;
+    stPacket.unDataCount = stDriveSpeeds.DATA_COUNT;
+    stPacket.eDataType   = stDriveSpeeds.DATA_TYPE;
+    stPacket.vData.assign(stDriveSpeeds.DATA_COUNT, 0.5f);
+    ssize_t nSent = 0;
+    for (int nIter = 0; nIter < 20; ++nIter)
+    {
+        nSent += pSenderNode.SendUDPPacket(stPacket, "127.0.0.1", 11122) > 0 ? 1 : 0;
+    }
+    stPacket.vData[0] = 0.6f;
+    nSent += pSenderNode.SendUDPPacket(stPacket, "127.0.0.1", 11122) > 0 ? 1 : 0;
+    EXPECT_EQ(nSent, 2);
+
+    // A constant stream at 100 Hz only sends its keepalives, roughly every tenth sample.
+    std::shared_ptr<rovecomm::RoveCommPeriodicStream> pIMU = pSenderNode.AddPeriodicStream<float>(
+        stIMUData.DATA_ID,
+        100.0,
+        [&stIMUData](rovecomm::RoveCommPacket<float>& stPacket)
+        {
+            stPacket.vData.assign(stIMUData.DATA_COUNT, 1.0f);
+            return true;
+        },
+        "127.0.0.1",
+        11122);
+    ASSERT_NE(pIMU, nullptr);
+    std::this_thread::sleep_for(std::chrono::milliseconds(350));
+    EXPECT_TRUE(pSenderNode.RemovePeriodicStream(pIMU));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    rovecomm::RoveCommSendFilterStatistics stIMU = pSenderNode.GetSendFilterStatistics(stIMUData.DATA_ID);
+    EXPECT_EQ(stIMU.unChecked, pIMU->GetStatistics().unSent);
+    EXPECT_GE(stIMU.unSent, 3u);
+    EXPECT_LE(stIMU.unSent, 5u);
+    EXPECT_EQ(stIMU.unKeepalives, stIMU.unSent - 1);
+    EXPECT_EQ(pReceiverNode.GetLatestSequence(stDriveSpeeds.DATA_ID), 2u);
+    EXPECT_EQ(pReceiverNode.GetLatestSequence(stIMUData.DATA_ID), stIMU.unSent);
+
+    rovecomm::RoveCommSendFilterStatistics stStatistics = pSenderNode.GetSendFilterStatistics();
+    EXPECT_EQ(stStatistics.unSuppressed, 19u + stIMU.unSuppressed);
+    std::cout << "[ FILTER   ] " << stStatistics.unSent << " sent, " << stStatistics.unSuppressed << " suppressed, " << stStatistics.unBytesSaved << " bytes saved" << std::endl;
+
+    EXPECT_TRUE(pSenderNode.ClearSendFilter(stDriveSpeeds.DATA_ID));
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that a value the subscribers already have is still sent to every
+ *        address that asks for it, and that each address is filtered on its own.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, SendFilterTracksEachDestination)
+{
+    const manifest::ManifestEntry stDriveSpeeds = manifest::Core::TELEMETRY.at("DRIVESPEEDS");
+
+    rovecomm::RoveCommUDP pSenderNode;
+    rovecomm::RoveCommUDP pSubscriberNode;
+    rovecomm::RoveCommUDP pFirstNode;
+    rovecomm::RoveCommUDP pSecondNode;
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(11125));
+    ASSERT_TRUE(pSubscriberNode.InitUDPSocket(11126));
+    ASSERT_TRUE(pFirstNode.InitUDPSocket(11127));
+    ASSERT_TRUE(pSecondNode.InitUDPSocket(11128));
+    EXPECT_GT(pSubscriberNode.SubscribeTo("127.0.0.1", 11125, false), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    rovecomm::RoveCommDeadband stDeadband;
+    stDeadband.tmKeepalive = std::chrono::milliseconds(0);
+    pSenderNode.SetSendFilter(stDriveSpeeds.DATA_ID, stDeadband);
+
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = stDriveSpeeds.DATA_ID;
+    stPacket.unDataCount = stDriveSpeeds.DATA_COUNT;
+    stPacket.eDataType   = stDriveSpeeds.DATA_TYPE;
+    stPacket.vData.assign(stDriveSpeeds.DATA_COUNT, 0.5f);
+
+    // The same value goes to the subscribers and then to two peers, once each.
+    pSenderNode.SendUDPPacket(stPacket, "0.0.0.0", 0);
+    EXPECT_GT(pSenderNode.SendUDPPacket(stPacket, "127.0.0.1", 11127), 0);
+    EXPECT_GT(pSenderNode.SendUDPPacket(stPacket, "127.0.0.1", 11128), 0);
+    EXPECT_EQ(pSenderNode.SendUDPPacket(stPacket, "127.0.0.1", 11127), 0);
+    EXPECT_EQ(pSenderNode.SendUDPPacket(stPacket, "127.0.0.1", 11128), 0);
+
+    // A change reaches the subscribers once, along with the first peer, and each peer once.
+    stPacket.vData[0] = 0.6f;
+    EXPECT_GT(pSenderNode.SendUDPPacket(stPacket, "127.0.0.1", 11127), 0);
+    EXPECT_GT(pSenderNode.SendUDPPacket(stPacket, "127.0.0.1", 11128), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(pSubscriberNode.GetLatestSequence(stDriveSpeeds.DATA_ID), 2u);
+    EXPECT_EQ(pFirstNode.GetLatestSequence(stDriveSpeeds.DATA_ID), 2u);
+    EXPECT_EQ(pSecondNode.GetLatestSequence(stDriveSpeeds.DATA_ID), 2u);
+
+    rovecomm::RoveCommSendFilterStatistics stStatistics = pSenderNode.GetSendFilterStatistics(stDriveSpeeds.DATA_ID);
+    EXPECT_EQ(stStatistics.unSent, 6u);
+    EXPECT_EQ(stStatistics.unSuppressed, 7u);
+    EXPECT_EQ(stStatistics.unChecked, 13u);
+
+    pSecondNode.CloseUDPSocket();
+    pFirstNode.CloseUDPSocket();
+    pSubscriberNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that a subscriber joining after the send filter has seen a value
+ *        still receives that value, even with the keepalive turned off.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, SendFilterServesLateSubscribers)
+{
+    const manifest::ManifestEntry stDriveSpeeds = manifest::Core::TELEMETRY.at("DRIVESPEEDS");
+
+    rovecomm::RoveCommUDP pSenderNode;
+    rovecomm::RoveCommUDP pEarlyNode;
+    rovecomm::RoveCommUDP pLateNode;
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(11152));
+    ASSERT_TRUE(pEarlyNode.InitUDPSocket(0));
+    ASSERT_TRUE(pLateNode.InitUDPSocket(0));
+    EXPECT_GT(pEarlyNode.SubscribeTo("127.0.0.1", 11152, false), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    rovecomm::RoveCommDeadband stDeadband;
+    stDeadband.tmKeepalive = std::chrono::milliseconds(0);
+    pSenderNode.SetSendFilter(stDriveSpeeds.DATA_ID, stDeadband);
+
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = stDriveSpeeds.DATA_ID;
+    stPacket.unDataCount = stDriveSpeeds.DATA_COUNT;
+    stPacket.eDataType   = stDriveSpeeds.DATA_TYPE;
+    stPacket.vData.assign(stDriveSpeeds.DATA_COUNT, 0.5f);
+    pSenderNode.SendUDPPacket(stPacket, "0.0.0.0", 0);
+    pSenderNode.SendUDPPacket(stPacket, "0.0.0.0", 0);
+
+    // The unchanged value goes out once more after the late subscriber joins, and is suppressed again after that.
+    EXPECT_GT(pLateNode.SubscribeTo("127.0.0.1", 11152, false), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    pSenderNode.SendUDPPacket(stPacket, "0.0.0.0", 0);
+    pSenderNode.SendUDPPacket(stPacket, "0.0.0.0", 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    rovecomm::RoveCommLatestValue<float> stLatest = pLateNode.GetLatestValue<float>(stDriveSpeeds.DATA_ID);
+    ASSERT_TRUE(stLatest.bValid);
+    EXPECT_EQ(stLatest.stPacket.vData[0], 0.5f);
+    EXPECT_EQ(pLateNode.GetLatestSequence(stDriveSpeeds.DATA_ID), 1u);
+    EXPECT_EQ(pEarlyNode.GetLatestSequence(stDriveSpeeds.DATA_ID), 2u);
+
+    rovecomm::RoveCommSendFilterStatistics stStatistics = pSenderNode.GetSendFilterStatistics(stDriveSpeeds.DATA_ID);
+    EXPECT_EQ(stStatistics.unSent, 2u);
+    EXPECT_EQ(stStatistics.unSuppressed, 2u);
+
+    pLateNode.CloseUDPSocket();
+    pEarlyNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that a node which subscribed with the coalescing capability gets
+ *        a burst of telemetry in a few shared datagrams and dispatches every
+ *        packet in them, while a legacy subscriber still gets one datagram per
+ *        packet.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, CoalescedSubscribersShareDatagrams)
+{
+    const manifest::ManifestEntry stDriveSpeeds = manifest::Core::TELEMETRY.at("DRIVESPEEDS");
+    const int nPackets                          = 60;
+
+    rovecomm::RoveCommUDP pSenderNode;
+    rovecomm::RoveCommUDP pCoalescedNode;
+    rovecomm::RoveCommUDP pLegacyNode;
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(11123));
+    ASSERT_TRUE(pCoalescedNode.InitUDPSocket(0));
+    ASSERT_TRUE(pLegacyNode.InitUDPSocket(0));
+
+    std::atomic<int> nCoalescedReceived(0);
+    std::atomic<int> nLegacyReceived(0);
+    std::atomic<bool> bInOrder(true);
+    std::atomic<int> nLastValue(-1);
+    pCoalescedNode.AddUDPCallback<float>(
+        [&](const rovecomm::RoveCommPacket<float>& stPacket, const sockaddr_in&)
+        {
+            // Packets of a coalesced datagram are dispatched in the order they were sent.
+            int nValue = static_cast<int>(stPacket.vData[0]);
+            bInOrder   = bInOrder && nValue == nLastValue + 1;
+            nLastValue = nValue;
+            nCoalescedReceived++;
+        },
+        stDriveSpeeds.DATA_ID);
+    pLegacyNode.AddUDPCallback<float>([&](const rovecomm::RoveCommPacket<float>&, const sockaddr_in&) { nLegacyReceived++; }, stDriveSpeeds.DATA_ID);
+
+    // One node advertises the capability, the other subscribes like a version 3 node.
+    EXPECT_GT(pCoalescedNode.SubscribeTo("127.0.0.1", 11123), 0);
+    EXPECT_GT(pLegacyNode.SubscribeTo("127.0.0.1", 11123, false), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    pSenderNode.SetCoalescing(true, rovecomm::ROVECOMM_COALESCE_MAX_DATAGRAM_SIZE, std::chrono::milliseconds(500));
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = stDriveSpeeds.DATA_ID;
+    stPacket.unDataCount = stDriveSpeeds.DATA_COUNT;
+    stPacket.eDataType   = stDriveSpeeds.DATA_TYPE;
+    for (int nIter = 0; nIter < nPackets; ++nIter)
+    {
+        stPacket.vData.assign(stDriveSpeeds.DATA_COUNT, static_cast<float>(nIter));
+        pSenderNode.SendUDPPacket(stPacket, "0.0.0.0", 0);
+    }
+    pSenderNode.FlushCoalesced();
+
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    while ((nCoalescedReceived < nPackets || nLegacyReceived < nPackets) && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(2))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(nCoalescedReceived, nPackets);
+    EXPECT_EQ(nLegacyReceived, nPackets);
+    EXPECT_TRUE(bInOrder);
+
+    // 49 packets of 30 bytes fit in a datagram of at most 1472 bytes, so 60 take two.
+    rovecomm::RoveCommCoalescerStatistics stStatistics = pSenderNode.GetCoalescerStatistics();
+    EXPECT_EQ(stStatistics.unPacketsCoalesced, static_cast<uint64_t>(nPackets));
+    EXPECT_EQ(stStatistics.unDatagramsSent, 2u);
+    EXPECT_EQ(pCoalescedNode.GetStatistics().unPacketsReceived, 2u);
+    EXPECT_EQ(pLegacyNode.GetStatistics().unPacketsReceived, static_cast<uint64_t>(nPackets));
+    std::cout << "[ COALESCE ] " << nPackets << " packets in " << stStatistics.unDatagramsSent << " datagrams" << std::endl;
+
+    // Turning coalescing off sends to the capable node one packet per datagram again.
+    pSenderNode.SetCoalescing(false);
+    pSenderNode.SendUDPPacket(stPacket, "0.0.0.0", 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(nCoalescedReceived, nPackets + 1);
+    EXPECT_EQ(pCoalescedNode.GetStatistics().unPacketsReceived, 3u);
+
+    pCoalescedNode.CloseUDPSocket();
+    pLegacyNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that a subscriber can change its capabilities while the
+ *        subscriber list is full, and that only new subscribers are refused.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, ResubscribeWithFullSubscriberList)
+{
+    const manifest::ManifestEntry stDriveSpeeds = manifest::Core::TELEMETRY.at("DRIVESPEEDS");
+    const int nPackets                          = 10;
+
+    rovecomm::RoveCommUDP pSenderNode;
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(11150));
+
+    // Fill the list with legacy subscribers, then try one more.
+    std::vector<std::unique_ptr<rovecomm::RoveCommUDP>> vSubscriberNodes;
+    for (int nIter = 0; nIter <= ROVECOMM_ETHERNET_UDP_MAX_SUBSCRIBERS; ++nIter)
+    {
+        vSubscriberNodes.emplace_back(std::make_unique<rovecomm::RoveCommUDP>());
+        ASSERT_TRUE(vSubscriberNodes.back()->InitUDPSocket(0));
+        EXPECT_GT(vSubscriberNodes.back()->SubscribeTo("127.0.0.1", 11150, false), 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // The first subscriber now advertises coalescing, which the full list still takes.
+    EXPECT_GT(vSubscriberNodes.front()->SubscribeTo("127.0.0.1", 11150), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    pSenderNode.SetCoalescing(true, rovecomm::ROVECOMM_COALESCE_MAX_DATAGRAM_SIZE, std::chrono::milliseconds(500));
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = stDriveSpeeds.DATA_ID;
+    stPacket.unDataCount = stDriveSpeeds.DATA_COUNT;
+    stPacket.eDataType   = stDriveSpeeds.DATA_TYPE;
+    for (int nIter = 0; nIter < nPackets; ++nIter)
+    {
+        stPacket.vData.assign(stDriveSpeeds.DATA_COUNT, static_cast<float>(nIter));
+        pSenderNode.SendUDPPacket(stPacket, "0.0.0.0", 0);
+    }
+    pSenderNode.FlushCoalesced();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(vSubscriberNodes.front()->GetStatistics().unPacketsReceived, 1u);
+    EXPECT_EQ(vSubscriberNodes[1]->GetStatistics().unPacketsReceived, static_cast<uint64_t>(nPackets));
+    EXPECT_EQ(vSubscriberNodes.back()->GetStatistics().unPacketsReceived, 0u);
+
+    for (std::unique_ptr<rovecomm::RoveCommUDP>& pSubscriberNode : vSubscriberNodes)
+    {
+        pSubscriberNode->CloseUDPSocket();
+    }
+    pSenderNode.CloseUDPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that packets of the largest size a packet can have are sent as
+ *        fragments back to back, and reach the callbacks and the latest value
+ *        cache in one piece.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, MaxSizePacketsAreFragmented)
+{
+    const uint16_t unDataId = 1220;
+    const uint16_t unCount  = ROVECOMM_PACKET_MAX_DATA_COUNT;
+    const int nLargePackets = 3;
+
+    rovecomm::RoveCommUDP pReceiverNode;
+    rovecomm::RoveCommUDP pSenderNode;
+    ASSERT_TRUE(pReceiverNode.InitUDPSocket(11124));
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(0));
+
+    std::atomic<int> nReceived(0);
+    std::atomic<bool> bIntact(true);
+    pReceiverNode.AddUDPCallback<double>(
+        [&](const rovecomm::RoveCommPacket<double>& stPacket, const sockaddr_in&)
+        {
+            bool bMatches = stPacket.unDataCount == unCount && stPacket.vData.size() == unCount;
+            for (size_t siIter = 0; bMatches && siIter < stPacket.vData.size(); ++siIter)
+            {
+                bMatches = stPacket.vData[siIter] == static_cast<double>(siIter) + stPacket.vData[0];
+            }
+            bIntact = bIntact && bMatches;
+            nReceived++;
+        },
+        unDataId);
+
+    // A 512 KB packet goes out as 359 fragments, and the packets are sent without pausing in between.
+    rovecomm::RoveCommPacket<double> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = unCount;
+    stPacket.eDataType   = manifest::DataTypes::DOUBLE_T;
+    size_t siPackedSize  = rovecomm::GetPackedSize(stPacket);
+    uint16_t unFragments = rovecomm::GetFragmentCount(siPackedSize);
+    for (int nPacket = 0; nPacket < nLargePackets; ++nPacket)
+    {
+        stPacket.vData.clear();
+        for (uint32_t unIter = 0; unIter < unCount; ++unIter)
+        {
+            stPacket.vData.push_back(static_cast<double>(nPacket * 100000 + unIter));
+        }
+        EXPECT_EQ(pSenderNode.SendUDPPacket(stPacket, "127.0.0.1", 11124), static_cast<ssize_t>(siPackedSize));
+    }
+
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    while (nReceived < nLargePackets && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(2))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(nReceived, nLargePackets);
+    EXPECT_TRUE(bIntact);
+
+    rovecomm::RoveCommLatestValue<double> stLatest = pReceiverNode.GetLatestValue<double>(unDataId);
+    ASSERT_TRUE(stLatest.bValid);
+    ASSERT_EQ(stLatest.stPacket.vData.size(), unCount);
+    EXPECT_EQ(stLatest.stPacket.vData[0], static_cast<double>((nLargePackets - 1) * 100000));
+
+    rovecomm::RoveCommReassemblyStatistics stStatistics = pReceiverNode.GetReassemblyStatistics();
+    EXPECT_EQ(stStatistics.unFragmentsReceived, nLargePackets * static_cast<uint64_t>(unFragments));
+    EXPECT_EQ(stStatistics.unPacketsCompleted, static_cast<uint64_t>(nLargePackets));
+    EXPECT_EQ(stStatistics.unPacketsTimedOut + stStatistics.unPacketsDropped + stStatistics.unLateFragments, 0u);
+    EXPECT_EQ(pReceiverNode.GetStatistics().unPacketsReceived, nLargePackets * static_cast<uint64_t>(unFragments));
+
+    pReceiverNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that the fragments of a large packet are only sent to subscribers
+ *        that advertised fragment support, and that skipped subscribers are
+ *        counted.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, FragmentsOnlyReachCapableSubscribers)
+{
+    const uint16_t unDataId = 1221;
+    const uint16_t unCount  = 20000;
+
+    rovecomm::RoveCommUDP pSenderNode;
+    rovecomm::RoveCommUDP pCapableNode;
+    rovecomm::RoveCommUDP pLegacyNode;
+    ASSERT_TRUE(pSenderNode.InitUDPSocket(11151));
+    ASSERT_TRUE(pCapableNode.InitUDPSocket(0));
+    ASSERT_TRUE(pLegacyNode.InitUDPSocket(0));
+
+    std::atomic<int> nCapableReceived(0);
+    pCapableNode.AddUDPCallback<float>([&](const rovecomm::RoveCommPacket<float>& stPacket, const sockaddr_in&)
+                                       { nCapableReceived += stPacket.vData.size() == unCount ? 1 : 0; },
+                                       unDataId);
+
+    EXPECT_GT(pCapableNode.SubscribeTo("127.0.0.1", 11151), 0);
+    EXPECT_GT(pLegacyNode.SubscribeTo("127.0.0.1", 11151, false, false), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = unCount;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData.assign(unCount, 1.0f);
+    pSenderNode.SendUDPPacket(stPacket, "0.0.0.0", 0);
+
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    while (nCapableReceived < 1 && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(2))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(nCapableReceived, 1);
+    EXPECT_EQ(pCapableNode.GetStatistics().unPacketsReceived, 55u);
+    EXPECT_EQ(pLegacyNode.GetStatistics().unPacketsReceived, 0u);
+    EXPECT_EQ(pSenderNode.GetStatistics().unFragmentsSkipped, 1u);
+
+    pCapableNode.CloseUDPSocket();
+    pLegacyNode.CloseUDPSocket();
+    pSenderNode.CloseUDPSocket();
+}
@@ -10,6 +10,12 @@
 
 #include "TestUtils.h"
 
+/// \cond
+#include <algorithm>
+#include <iomanip>
+
+/// \endcond
+
 /******************************************************************************
  * @brief The testutils namespace contains utility functions for running tests.
  *
@@ -78,4 +84,48 @@ namespace testutils
             FAIL() << "Test failed after " << nMaxRetries << " attempts";
         }
     }
+
+    /******************************************************************************
+     * @brief Compute a percentile of a set of benchmark samples using the
+     *        nearest-rank method.
+     *
+     * @param vSamples - The samples to compute the percentile of.
+     * @param dPercentile - The percentile to compute, from 0 to 100.
+     * @return double - The sample at the requested percentile, or 0 if there are
+     *                  no samples.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    double Percentile(std::vector<double> vSamples, double dPercentile)
+    {
+        if (vSamples.empty())
+        {
+            return 0.0;
+        }
+
+        std::sort(vSamples.begin(), vSamples.end());
+        size_t siRank = static_cast<size_t>((dPercentile / 100.0) * (vSamples.size() - 1) + 0.5);
+        return vSamples[std::min(siRank, vSamples.size() - 1)];
+    }
+
+    /******************************************************************************
+     * @brief Print a single benchmark result line so results from every benchmark
+     *        share the same layout in the test output.
+     *
+     * @param szName - The name of the benchmark case.
+     * @param vResults - The named values to print for the case.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-17
+     ******************************************************************************/
+    void PrintBenchmarkResult(const std::string& szName, const std::vector<std::pair<std::string, double>>& vResults)
+    {
+        std::cout << "[ BENCHMARK] " << std::left << std::setw(40) << szName;
+        for (const std::pair<std::string, double>& stResult : vResults)
+        {
+            std::cout << "  " << stResult.first << "=" << std::fixed << std::setprecision(2) << stResult.second << std::defaultfloat;
+        }
+        std::cout << std::endl;
+    }
 }    // namespace testutils
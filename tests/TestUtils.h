@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <thread>
+#include <vector>
 
 /******************************************************************************
  * @brief The testutils namespace contains utility functions for running tests.
@@ -28,6 +29,10 @@ namespace testutils
 {
     // Run a test with a timeout and retries.
     extern void RunTimedTest(const std::function<void()>& fnTestCode, int nMaxRetries, int nTimeoutMS);
+
+    // Benchmark helpers.
+    extern double Percentile(std::vector<double> vSamples, double dPercentile);
+    extern void PrintBenchmarkResult(const std::string& szName, const std::vector<std::pair<std::string, double>>& vResults);
 }    // namespace testutils
 
 #endif    // ROVECOMM_TESTUTILS_H
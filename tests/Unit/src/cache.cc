@@ -0,0 +1,177 @@
+/******************************************************************************
+ * @brief Unit test for the latest value cache in RoveComm.
+ *
+ * @file cache.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Pack a packet and store it in a latest value cache.
+ *
+ * @tparam T - The data type of the packet.
+ * @param stCache - The cache to update.
+ * @param unDataId - The data id of the packet.
+ * @param vData - The packet's elements.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+template<typename T>
+static void UpdateCache(rovecomm::RoveCommLatestValueCache& stCache, uint16_t unDataId, const std::vector<T>& vData)
+{
+    rovecomm::RoveCommPacket<T> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = vData.size();
+    stPacket.eDataType   = rovecomm::GetDataTypeOf<T>();
+    stPacket.vData       = vData;
+
+    std::vector<uint8_t> vBytes(rovecomm::GetPackedSize(stPacket));
+    rovecomm::PackPacket(stPacket, vBytes.data(), vBytes.size());
+    stCache.Update(vBytes.data(), vBytes.size());
+}
+
+/******************************************************************************
+ * @brief Test that the cache returns the last packet of each data id with its
+ *        sequence number, and nothing for data ids or types it has not seen.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommLatestValueCache, ReadLatest)
+{
+    rovecomm::RoveCommLatestValueCache stCache;
+    rovecomm::RoveCommLatestValue<float> stValue;
+    EXPECT_FALSE(stCache.Read<float>(3101, stValue));
+    EXPECT_FALSE(stValue.bValid);
+    EXPECT_EQ(stValue.unSequence, 0u);
+
+    std::chrono::steady_clock::time_point tmBefore = std::chrono::steady_clock::now();
+    UpdateCache<float>(stCache, 3101, {1.0f, 2.0f, 3.0f});
+    UpdateCache<float>(stCache, 3101, {4.0f, 5.0f, 6.0f});
+    UpdateCache<uint8_t>(stCache, 3100, {7});
+
+    ASSERT_TRUE(stCache.Read<float>(3101, stValue));
+    EXPECT_TRUE(stValue.bValid);
+    EXPECT_EQ(stValue.unSequence, 2u);
+    EXPECT_EQ(stValue.stPacket.unDataId, 3101);
+    EXPECT_EQ(stValue.stPacket.eDataType, manifest::DataTypes::FLOAT_T);
+    EXPECT_EQ(stValue.stPacket.vData, std::vector<float>({4.0f, 5.0f, 6.0f}));
+    EXPECT_GE(stValue.tmReceived, tmBefore);
+    EXPECT_LE(stValue.tmReceived, std::chrono::steady_clock::now());
+    EXPECT_EQ(stCache.GetSequence(3101), 2u);
+    EXPECT_EQ(stCache.GetSequence(3100), 1u);
+    EXPECT_EQ(stCache.GetSequence(3102), 0u);
+
+    // Reading with the wrong type does not reinterpret the bytes.
+    rovecomm::RoveCommLatestValue<double> stWrongType;
+    EXPECT_FALSE(stCache.Read<double>(3101, stWrongType));
+    EXPECT_FALSE(stWrongType.bValid);
+}
+
+/******************************************************************************
+ * @brief Test that a data id whose packets grow keeps its sequence number, and
+ *        that a shorter packet after a longer one is read at its own size.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommLatestValueCache, PacketSizeChanges)
+{
+    rovecomm::RoveCommLatestValueCache stCache;
+    rovecomm::RoveCommLatestValue<uint16_t> stValue;
+
+    UpdateCache<uint16_t>(stCache, 1300, {1});
+    std::vector<uint16_t> vLarge(500);
+    for (size_t siIter = 0; siIter < vLarge.size(); ++siIter)
+    {
+        vLarge[siIter] = static_cast<uint16_t>(siIter * 3);
+    }
+    UpdateCache<uint16_t>(stCache, 1300, vLarge);
+    ASSERT_TRUE(stCache.Read<uint16_t>(1300, stValue));
+    EXPECT_EQ(stValue.unSequence, 2u);
+    EXPECT_EQ(stValue.stPacket.vData, vLarge);
+
+    UpdateCache<uint16_t>(stCache, 1300, {9, 8});
+    ASSERT_TRUE(stCache.Read<uint16_t>(1300, stValue));
+    EXPECT_EQ(stValue.unSequence, 3u);
+    EXPECT_EQ(stValue.stPacket.vData, std::vector<uint16_t>({9, 8}));
+}
+
+/******************************************************************************
+ * @brief Test that readers racing a writer only ever see whole packets. Every
+ *        packet the writer stores holds its own sequence number in all of its
+ *        elements, so a torn read shows up as mixed elements.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommLatestValueCache, ReadersNeverSeeTornPackets)
+{
+    const int nWrites = 200000;
+    rovecomm::RoveCommLatestValueCache stCache;
+    UpdateCache<uint32_t>(stCache, 1301, std::vector<uint32_t>(16, 1));
+
+    std::atomic<bool> bDone(false);
+    std::atomic<int> nTorn(0);
+    std::atomic<int> nReads(0);
+    std::vector<std::thread> vReaders;
+    for (int nIter = 0; nIter < 3; ++nIter)
+    {
+        vReaders.emplace_back(
+            [&]()
+            {
+                rovecomm::RoveCommLatestValue<uint32_t> stValue;
+                uint64_t unLastSequence = 0;
+                while (!bDone)
+                {
+                    if (!stCache.Read<uint32_t>(1301, stValue))
+                    {
+                        nTorn++;
+                        continue;
+                    }
+                    for (uint32_t unElement : stValue.stPacket.vData)
+                    {
+                        if (unElement != stValue.unSequence)
+                        {
+                            nTorn++;
+                            break;
+                        }
+                    }
+                    if (stValue.unSequence < unLastSequence)
+                    {
+                        nTorn++;
+                    }
+                    unLastSequence = stValue.unSequence;
+                    nReads++;
+                }
+            });
+    }
+
+    for (uint32_t unIter = 2; unIter <= nWrites; ++unIter)
+    {
+        UpdateCache<uint32_t>(stCache, 1301, std::vector<uint32_t>(16, unIter));
+    }
+    bDone = true;
+    for (std::thread& thReader : vReaders)
+    {
+        thReader.join();
+    }
+
+    EXPECT_EQ(nTorn, 0);
+    EXPECT_GT(nReads, 0);
+    EXPECT_EQ(stCache.GetSequence(1301), static_cast<uint64_t>(nWrites));
+}
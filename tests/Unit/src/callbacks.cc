@@ -0,0 +1,183 @@
+/******************************************************************************
+ * @brief Unit test for callback registration and lookup in RoveComm.
+ *
+ * @file callbacks.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Test that the callback index only returns the callbacks registered
+ *        for the requested data id, in registration order, including data ids
+ *        at both ends of the 16-bit range.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommCallbackIndex, FindsOnlyMatchingDataId)
+{
+    rovecomm::RoveCommCallbackIndex<std::function<int()>> stIndex;
+    EXPECT_TRUE(stIndex.empty());
+    EXPECT_EQ(stIndex.Find(1000), nullptr);
+
+    stIndex.Add([]() { return 1; }, 1000);
+    stIndex.Add([]() { return 2; }, 1000);
+    stIndex.Add([]() { return 3; }, 1001);
+    stIndex.Add([]() { return 4; }, 0);
+    stIndex.Add([]() { return 5; }, 65535);
+    EXPECT_EQ(stIndex.size(), 5u);
+
+    const std::vector<std::function<int()>>* pCallbacks = stIndex.Find(1000);
+    ASSERT_NE(pCallbacks, nullptr);
+    ASSERT_EQ(pCallbacks->size(), 2u);
+    EXPECT_EQ((*pCallbacks)[0](), 1);
+    EXPECT_EQ((*pCallbacks)[1](), 2);
+
+    ASSERT_NE(stIndex.Find(1001), nullptr);
+    EXPECT_EQ(stIndex.Find(1001)->size(), 1u);
+    ASSERT_NE(stIndex.Find(0), nullptr);
+    EXPECT_EQ((*stIndex.Find(0))[0](), 4);
+    ASSERT_NE(stIndex.Find(65535), nullptr);
+    EXPECT_EQ((*stIndex.Find(65535))[0](), 5);
+
+    // A data id on an allocated page with nothing registered has no callbacks.
+    ASSERT_NE(stIndex.Find(1002), nullptr);
+    EXPECT_TRUE(stIndex.Find(1002)->empty());
+
+    stIndex.Clear();
+    EXPECT_TRUE(stIndex.empty());
+    EXPECT_EQ(stIndex.Find(1000), nullptr);
+}
+
+/******************************************************************************
+ * @brief Test that removing a callback removes it from every data id it was
+ *        registered for, and leaves other callbacks in place.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommCallbackIndex, RemoveIfAcrossDataIds)
+{
+    rovecomm::RoveCommCallbackIndex<std::function<int()>> stIndex;
+    for (uint16_t unDataId = 0; unDataId < 600; unDataId += 3)
+    {
+        stIndex.Add([]() { return 1; }, unDataId);
+        stIndex.Add([unDataId]() { return static_cast<int>(unDataId); }, unDataId);
+    }
+    EXPECT_EQ(stIndex.size(), 400u);
+
+    // Remove every callback that returns 1.
+    EXPECT_EQ(stIndex.RemoveIf([](const std::function<int()>& fnCallback) { return fnCallback() == 1; }), 200u);
+    EXPECT_EQ(stIndex.size(), 200u);
+
+    ASSERT_NE(stIndex.Find(300), nullptr);
+    ASSERT_EQ(stIndex.Find(300)->size(), 1u);
+    EXPECT_EQ((*stIndex.Find(300))[0](), 300);
+}
+
+/******************************************************************************
+ * @brief Test that a pinned registry snapshot does not change when callbacks
+ *        are added, that new readers see the change without waiting, and that
+ *        the writer does not free the old snapshot until it is released.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommCallbackRegistry, SnapshotsAreImmutable)
+{
+    rovecomm::RoveCommCallbackRegistry<std::function<int()>> stRegistry;
+    stRegistry.Add([]() { return 1; }, 1000);
+
+    std::atomic<bool> bWriterDone(false);
+    std::thread thWriter;
+    {
+        rovecomm::RoveCommCallbackRegistry<std::function<int()>>::Snapshot stBefore = stRegistry.Read();
+        ASSERT_EQ(stBefore->Find(1000)->size(), 1u);
+
+        // Modify the registry from another thread, since this thread is a reader.
+        thWriter = std::thread(
+            [&]()
+            {
+                stRegistry.Add([]() { return 2; }, 1000);
+                bWriterDone = true;
+            });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        // The pinned snapshot keeps its contents, while a new reader sees the change right away.
+        EXPECT_EQ(stBefore->Find(1000)->size(), 1u);
+        EXPECT_EQ(stRegistry.Read()->Find(1000)->size(), 2u);
+
+        // The writer is still waiting to free the snapshot this thread holds.
+        EXPECT_FALSE(bWriterDone);
+    }
+    thWriter.join();
+    EXPECT_TRUE(bWriterDone);
+
+    rovecomm::RoveCommCallbackRegistry<std::function<int()>>::Snapshot stAfter = stRegistry.Read();
+    ASSERT_EQ(stAfter->Find(1000)->size(), 2u);
+    EXPECT_EQ((*stAfter->Find(1000))[1](), 2);
+}
+
+/******************************************************************************
+ * @brief Test that a registry handle removes exactly one registration, that
+ *        releasing a scoped callback keeps it registered, and that a handle
+ *        outliving its registry is harmless.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommCallbackRegistry, HandlesRemoveOneRegistration)
+{
+    rovecomm::RoveCommCallbackHandle stOrphan;
+    {
+        rovecomm::RoveCommCallbackRegistry<std::function<int()>> stRegistry;
+        rovecomm::RoveCommCallbackHandle stFirst  = stRegistry.Add([]() { return 1; }, 1000);
+        rovecomm::RoveCommCallbackHandle stSecond = stRegistry.Add([]() { return 2; }, 1000);
+        stRegistry.Add([]() { return 3; }, 1001);
+        EXPECT_TRUE(stFirst.IsValid());
+
+        EXPECT_TRUE(stFirst.Unsubscribe());
+        EXPECT_FALSE(stFirst.IsValid());
+        ASSERT_EQ(stRegistry.Read()->Find(1000)->size(), 1u);
+        EXPECT_EQ((*stRegistry.Read()->Find(1000))[0](), 2);
+        EXPECT_EQ(stRegistry.size(), 2u);
+
+        // Releasing a scoped callback hands back the registration without removing it.
+        {
+            rovecomm::RoveCommScopedCallback stScoped(stSecond);
+            stOrphan = stScoped.Release();
+            EXPECT_FALSE(stScoped.IsValid());
+        }
+        EXPECT_EQ(stRegistry.size(), 2u);
+
+        // Moving a scoped callback moves ownership, so it is removed exactly once.
+        {
+            rovecomm::RoveCommScopedCallback stOuter;
+            {
+                rovecomm::RoveCommScopedCallback stInner(stRegistry.Add([]() { return 4; }, 1001));
+                stOuter = std::move(stInner);
+            }
+            EXPECT_EQ(stRegistry.size(), 3u);
+        }
+        EXPECT_EQ(stRegistry.size(), 2u);
+        EXPECT_TRUE(stOrphan.IsValid());
+    }
+
+    EXPECT_FALSE(stOrphan.IsValid());
+    EXPECT_FALSE(stOrphan.Unsubscribe());
+}
@@ -0,0 +1,163 @@
+/******************************************************************************
+ * @brief Unit test for packet coalescing in RoveComm.
+ *
+ * @file coalescer.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <algorithm>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Records the datagrams a coalescer sends.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+struct SentDatagrams
+{
+    public:
+        std::mutex muMutex;
+        std::vector<std::vector<uint8_t>> vDatagrams;
+
+        rovecomm::RoveCommCoalescer::SendFunction Recorder()
+        {
+            return [this](const uint8_t* pData, size_t siDataSize)
+            {
+                std::lock_guard<std::mutex> lkLock(muMutex);
+                vDatagrams.emplace_back(pData, pData + siDataSize);
+            };
+        }
+
+        size_t Count()
+        {
+            std::lock_guard<std::mutex> lkLock(muMutex);
+            return vDatagrams.size();
+        }
+};
+
+/******************************************************************************
+ * @brief Pack a float packet of the given size.
+ *
+ * @param unDataId - The data id of the packet.
+ * @param unDataCount - The number of float elements.
+ * @return std::vector<uint8_t> - The packed packet.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static std::vector<uint8_t> PackFloats(uint16_t unDataId, uint16_t unDataCount)
+{
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = unDataCount;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData.assign(unDataCount, 1.5f);
+
+    std::vector<uint8_t> vBytes(rovecomm::GetPackedSize(stPacket));
+    rovecomm::PackPacket(stPacket, vBytes.data(), vBytes.size());
+    return vBytes;
+}
+
+/******************************************************************************
+ * @brief Test that packets are sent together once the next one would not fit,
+ *        that each datagram is the marker byte followed by whole packets, and
+ *        that packets too large to share a datagram are refused.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommCoalescer, SizeFlush)
+{
+    SentDatagrams stSent;
+    rovecomm::RoveCommCoalescer stCoalescer(stSent.Recorder());
+
+    // Nothing is taken until coalescing is turned on and the node is open.
+    std::vector<uint8_t> vPacket = PackFloats(1217, 6);
+    ASSERT_EQ(vPacket.size(), 30u);
+    EXPECT_FALSE(stCoalescer.Append(vPacket.data(), vPacket.size()));
+    stCoalescer.Configure(true, 100, std::chrono::seconds(10));
+    EXPECT_FALSE(stCoalescer.Append(vPacket.data(), vPacket.size()));
+    stCoalescer.Enable();
+
+    // Three 30 byte packets fit in 100 bytes with the marker, the fourth starts a new datagram.
+    for (int nIter = 0; nIter < 4; ++nIter)
+    {
+        EXPECT_TRUE(stCoalescer.Append(vPacket.data(), vPacket.size()));
+    }
+    ASSERT_EQ(stSent.Count(), 1u);
+    ASSERT_EQ(stSent.vDatagrams[0].size(), 91u);
+    EXPECT_EQ(stSent.vDatagrams[0][0], ROVECOMM_COALESCED_VERSION);
+    size_t siOffset = 1;
+    while (siOffset < stSent.vDatagrams[0].size())
+    {
+        size_t siPacketSize = rovecomm::GetPackedSize(&stSent.vDatagrams[0][siOffset], stSent.vDatagrams[0].size() - siOffset);
+        ASSERT_EQ(siPacketSize, vPacket.size());
+        EXPECT_TRUE(std::equal(vPacket.begin(), vPacket.end(), stSent.vDatagrams[0].begin() + siOffset));
+        siOffset += siPacketSize;
+    }
+
+    // A packet that could never share a datagram is left to the caller.
+    std::vector<uint8_t> vLarge = PackFloats(1218, 24);
+    EXPECT_FALSE(stCoalescer.Append(vLarge.data(), vLarge.size()));
+
+    // Flush sends the pending packet, and an empty flush sends nothing.
+    stCoalescer.Flush();
+    stCoalescer.Flush();
+    ASSERT_EQ(stSent.Count(), 2u);
+    EXPECT_EQ(stSent.vDatagrams[1].size(), 31u);
+
+    rovecomm::RoveCommCoalescerStatistics stStatistics = stCoalescer.GetStatistics();
+    EXPECT_EQ(stStatistics.unPacketsCoalesced, 4u);
+    EXPECT_EQ(stStatistics.unDatagramsSent, 2u);
+    EXPECT_EQ(stStatistics.unSizeFlushes, 1u);
+    EXPECT_EQ(stStatistics.unTimeFlushes, 0u);
+}
+
+/******************************************************************************
+ * @brief Test that a datagram that never fills up is sent once its first
+ *        packet has waited for the maximum delay, and that disabling the
+ *        coalescer sends what is pending.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommCoalescer, TimeFlush)
+{
+    SentDatagrams stSent;
+    rovecomm::RoveCommCoalescer stCoalescer(stSent.Recorder());
+    stCoalescer.Enable();
+    stCoalescer.Configure(true, rovecomm::ROVECOMM_COALESCE_MAX_DATAGRAM_SIZE, std::chrono::milliseconds(20));
+
+    std::vector<uint8_t> vPacket = PackFloats(1217, 2);
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    EXPECT_TRUE(stCoalescer.Append(vPacket.data(), vPacket.size()));
+    EXPECT_TRUE(stCoalescer.Append(vPacket.data(), vPacket.size()));
+    while (stSent.Count() == 0 && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(1))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(stSent.Count(), 1u);
+    EXPECT_GE(std::chrono::steady_clock::now() - tmStart, std::chrono::milliseconds(20));
+    EXPECT_EQ(stSent.vDatagrams[0].size(), 1u + 2u * vPacket.size());
+    EXPECT_EQ(stCoalescer.GetStatistics().unTimeFlushes, 1u);
+
+    // Closing the node does not lose the pending packet.
+    EXPECT_TRUE(stCoalescer.Append(vPacket.data(), vPacket.size()));
+    stCoalescer.Disable();
+    EXPECT_EQ(stSent.Count(), 2u);
+    EXPECT_FALSE(stCoalescer.Append(vPacket.data(), vPacket.size()));
+}
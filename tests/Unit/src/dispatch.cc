@@ -0,0 +1,324 @@
+/******************************************************************************
+ * @brief Unit test for the asynchronous callback dispatch queue in RoveComm.
+ *
+ * @file dispatch.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Push a single byte packet into a dispatch queue.
+ *
+ * @param stQueue - The queue to push into.
+ * @param unValue - The byte to push.
+ * @return true - The packet was queued.
+ * @return false - The packet was dropped.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static bool PushByte(rovecomm::RoveCommDispatchQueue& stQueue, uint8_t unValue)
+{
+    struct sockaddr_in saAddress;
+    memset(&saAddress, 0, sizeof(saAddress));
+    return stQueue.Push(&unValue, 1, saAddress);
+}
+
+/******************************************************************************
+ * @brief Pop every queued packet and return the first byte of each.
+ *
+ * @param stQueue - The queue to drain.
+ * @return std::vector<uint8_t> - The bytes, in the order they were popped.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static std::vector<uint8_t> DrainBytes(rovecomm::RoveCommDispatchQueue& stQueue)
+{
+    std::vector<uint8_t> vBytes;
+    while (stQueue.TryPop([&](const uint8_t* pData, size_t siDataSize, const sockaddr_in&) { vBytes.push_back(siDataSize > 0 ? pData[0] : 0); }))
+    {
+    }
+    return vBytes;
+}
+
+/******************************************************************************
+ * @brief Test that each overflow policy drops the packets it should, and that
+ *        the depth and drop counters report it.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommDispatchQueue, OverflowPolicies)
+{
+    // The capacity is rounded up to a power of two.
+    rovecomm::RoveCommDispatchQueue stDropOldest(3, rovecomm::eOverflowDropOldest);
+    EXPECT_EQ(stDropOldest.GetCapacity(), 4u);
+    for (uint8_t unIter = 0; unIter < 6; ++unIter)
+    {
+        EXPECT_TRUE(PushByte(stDropOldest, unIter));
+    }
+    rovecomm::RoveCommDispatchStatistics stStatistics = stDropOldest.GetStatistics();
+    EXPECT_EQ(stStatistics.siDepth, 4u);
+    EXPECT_EQ(stStatistics.siMaxDepth, 4u);
+    EXPECT_EQ(stStatistics.unEnqueued, 6u);
+    EXPECT_EQ(stStatistics.unDroppedOldest, 2u);
+    EXPECT_EQ(DrainBytes(stDropOldest), std::vector<uint8_t>({2, 3, 4, 5}));
+    EXPECT_EQ(stDropOldest.GetStatistics().unDispatched, 4u);
+    EXPECT_EQ(stDropOldest.GetDepth(), 0u);
+
+    rovecomm::RoveCommDispatchQueue stDropNewest(4, rovecomm::eOverflowDropNewest);
+    for (uint8_t unIter = 0; unIter < 6; ++unIter)
+    {
+        EXPECT_EQ(PushByte(stDropNewest, unIter), unIter < 4);
+    }
+    EXPECT_EQ(stDropNewest.GetStatistics().unDroppedNewest, 2u);
+    EXPECT_EQ(DrainBytes(stDropNewest), std::vector<uint8_t>({0, 1, 2, 3}));
+}
+
+/******************************************************************************
+ * @brief Test that the blocking policy makes the producer wait for a consumer
+ *        instead of dropping, and that closing the queue releases a blocked
+ *        producer and lets the consumers drain what is left.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommDispatchQueue, BlockAndClose)
+{
+    rovecomm::RoveCommDispatchQueue stQueue(2, rovecomm::eOverflowBlock);
+    EXPECT_TRUE(PushByte(stQueue, 0));
+    EXPECT_TRUE(PushByte(stQueue, 1));
+
+    // The third push waits until a slot is freed.
+    std::atomic<bool> bPushed(false);
+    std::thread thProducer(
+        [&]()
+        {
+            PushByte(stQueue, 2);
+            bPushed = true;
+        });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(bPushed);
+
+    std::vector<uint8_t> vPopped;
+    auto fnConsumer = [&](const uint8_t* pData, size_t, const sockaddr_in&) { vPopped.push_back(pData[0]); };
+    EXPECT_TRUE(stQueue.Pop(fnConsumer));
+    thProducer.join();
+    EXPECT_TRUE(bPushed);
+    EXPECT_EQ(stQueue.GetStatistics().unBlockedWaits, 1u);
+
+    // A full queue releases a blocked producer when it is closed.
+    EXPECT_EQ(stQueue.GetDepth(), 2u);
+    std::thread thBlocked([&]() { EXPECT_FALSE(PushByte(stQueue, 3)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    stQueue.Close();
+    thBlocked.join();
+
+    // Queued packets are still consumed after closing, then Pop() reports the queue is finished.
+    EXPECT_TRUE(stQueue.Pop(fnConsumer));
+    EXPECT_TRUE(stQueue.Pop(fnConsumer));
+    EXPECT_FALSE(stQueue.Pop(fnConsumer));
+    EXPECT_EQ(vPopped, std::vector<uint8_t>({0, 1, 2}));
+    EXPECT_FALSE(PushByte(stQueue, 4));
+}
+
+/******************************************************************************
+ * @brief Test that several producers and consumers pass every packet through
+ *        the queue exactly once.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommDispatchQueue, ManyProducersAndConsumers)
+{
+    const int nProducers          = 3;
+    const int nPacketsPerProducer = 20000;
+    rovecomm::RoveCommDispatchQueue stQueue(64, rovecomm::eOverflowBlock);
+
+    // Each packet carries its producer and sequence number, and the consumers sum them.
+    std::atomic<uint64_t> unSum(0);
+    std::atomic<int> nConsumed(0);
+    std::vector<std::thread> vConsumers;
+    for (int nIter = 0; nIter < 3; ++nIter)
+    {
+        vConsumers.emplace_back(
+            [&]()
+            {
+                while (stQueue.Pop(
+                    [&](const uint8_t* pData, size_t siDataSize, const sockaddr_in&)
+                    {
+                        ASSERT_EQ(siDataSize, sizeof(uint32_t));
+                        uint32_t unValue;
+                        memcpy(&unValue, pData, sizeof(unValue));
+                        unSum += unValue;
+                        nConsumed++;
+                    }))
+                {
+                }
+            });
+    }
+
+    std::vector<std::thread> vProducers;
+    for (int nProducer = 0; nProducer < nProducers; ++nProducer)
+    {
+        vProducers.emplace_back(
+            [&, nProducer]()
+            {
+                struct sockaddr_in saAddress;
+                memset(&saAddress, 0, sizeof(saAddress));
+                for (uint32_t unIter = 0; unIter < nPacketsPerProducer; ++unIter)
+                {
+                    uint32_t unValue = nProducer * nPacketsPerProducer + unIter;
+                    EXPECT_TRUE(stQueue.Push(reinterpret_cast<const uint8_t*>(&unValue), sizeof(unValue), saAddress));
+                }
+            });
+    }
+    for (std::thread& thProducer : vProducers)
+    {
+        thProducer.join();
+    }
+    stQueue.Close();
+    for (std::thread& thConsumer : vConsumers)
+    {
+        thConsumer.join();
+    }
+
+    uint64_t unTotal = static_cast<uint64_t>(nProducers) * nPacketsPerProducer;
+    EXPECT_EQ(nConsumed, static_cast<int>(unTotal));
+    EXPECT_EQ(unSum, unTotal * (unTotal - 1) / 2);
+    EXPECT_EQ(stQueue.GetStatistics().unDispatched, unTotal);
+}
+
+/******************************************************************************
+ * @brief Push a header-only packet with the given data id into a dispatcher.
+ *
+ * @param stDispatcher - The dispatcher to push into.
+ * @param unDataId - The data id written into the packet header.
+ * @return true - The packet was queued.
+ * @return false - The packet was dropped.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static bool PushDataId(rovecomm::RoveCommPriorityDispatcher& stDispatcher, uint16_t unDataId)
+{
+    uint8_t aHeader[ROVECOMM_PACKET_HEADER_SIZE] = {ROVECOMM_VERSION, static_cast<uint8_t>(unDataId >> 8), static_cast<uint8_t>(unDataId), 0, 0, 0};
+    struct sockaddr_in saAddress;
+    memset(&saAddress, 0, sizeof(saAddress));
+    return stDispatcher.Push(aHeader, sizeof(aHeader), saAddress);
+}
+
+/******************************************************************************
+ * @brief Test that the manifest split assigns priorities, and that queued
+ *        packets are popped highest priority first and in arrival order within
+ *        a priority.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPriorityDispatcher, HighestPriorityFirst)
+{
+    const uint16_t unCommandId   = manifest::Core::COMMANDS.at("DRIVELEFTRIGHT").DATA_ID;
+    const uint16_t unTelemetryId = manifest::Core::TELEMETRY.at("DRIVESPEEDS").DATA_ID;
+    const uint16_t unUnknownId   = 1220;
+
+    rovecomm::RoveCommPriorityTable stPriorities;
+    stPriorities.SetManifestPriorities(manifest::Core::COMMANDS, manifest::Core::TELEMETRY, manifest::Core::ERROR);
+    EXPECT_EQ(stPriorities.GetPriority(unCommandId), rovecomm::ePriorityHigh);
+    EXPECT_EQ(stPriorities.GetPriority(unTelemetryId), rovecomm::ePriorityLow);
+    EXPECT_EQ(stPriorities.GetPriority(unUnknownId), rovecomm::ePriorityNormal);
+
+    rovecomm::RoveCommPriorityDispatcher stDispatcher(stPriorities, 16);
+    for (uint16_t unDataId : {unTelemetryId, unUnknownId, unTelemetryId, unCommandId, unUnknownId, unCommandId})
+    {
+        EXPECT_TRUE(PushDataId(stDispatcher, unDataId));
+    }
+    EXPECT_EQ(stDispatcher.GetStatistics().siDepth, 6u);
+    EXPECT_EQ(stDispatcher.GetStatistics(rovecomm::ePriorityHigh).siDepth, 2u);
+
+    std::vector<uint16_t> vPopped;
+    while (stDispatcher.TryPop([&](const uint8_t* pData, size_t, const sockaddr_in&) { vPopped.push_back((pData[1] << 8) | pData[2]); }))
+    {
+    }
+    EXPECT_EQ(vPopped, std::vector<uint16_t>({unCommandId, unCommandId, unUnknownId, unUnknownId, unTelemetryId, unTelemetryId}));
+    EXPECT_EQ(stDispatcher.GetStatistics().unDispatched, 6u);
+}
+
+/******************************************************************************
+ * @brief Test that a lane with a dedicated worker is served while the shared
+ *        worker is stuck in a slow callback, and that closing the dispatcher
+ *        stops both workers once the lanes are drained.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPriorityDispatcher, DedicatedWorker)
+{
+    const uint16_t unCommandId   = 3000;
+    const uint16_t unTelemetryId = 3100;
+
+    rovecomm::RoveCommPriorityTable stPriorities;
+    stPriorities.SetPriority(unCommandId, rovecomm::ePriorityHigh);
+    stPriorities.SetPriority(unTelemetryId, rovecomm::ePriorityLow);
+
+    rovecomm::RoveCommPriorityDispatcher stDispatcher(stPriorities, 16);
+    stDispatcher.SetDedicatedWorker(rovecomm::ePriorityHigh, true);
+    EXPECT_EQ(stDispatcher.GetDedicatedWorkers(), 1u);
+
+    // The telemetry callback blocks until the command has been handled.
+    std::atomic<bool> bCommandHandled(false);
+    std::atomic<int> nTelemetryHandled(0);
+    auto fnConsumer = [&](const uint8_t* pData, size_t, const sockaddr_in&)
+    {
+        uint16_t unDataId = (pData[1] << 8) | pData[2];
+        if (unDataId == unCommandId)
+        {
+            bCommandHandled = true;
+        }
+        else
+        {
+            std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+            while (!bCommandHandled && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(2))
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            nTelemetryHandled++;
+        }
+    };
+
+    // The first worker started is the dedicated one.
+    std::thread thDedicated([&]() { stDispatcher.RunWorker(fnConsumer); });
+    std::thread thShared([&]() { stDispatcher.RunWorker(fnConsumer); });
+
+    EXPECT_TRUE(PushDataId(stDispatcher, unTelemetryId));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_TRUE(PushDataId(stDispatcher, unCommandId));
+
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    while (nTelemetryHandled == 0 && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(2))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(bCommandHandled);
+    EXPECT_LT(std::chrono::steady_clock::now() - tmStart, std::chrono::seconds(1));
+
+    stDispatcher.Close();
+    thDedicated.join();
+    thShared.join();
+    EXPECT_EQ(stDispatcher.GetStatistics().unDispatched, 2u);
+}
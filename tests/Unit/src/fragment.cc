@@ -0,0 +1,181 @@
+/******************************************************************************
+ * @brief Unit test for packet fragmentation and reassembly in RoveComm.
+ *
+ * @file fragment.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <chrono>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Pack a double packet and split it into fragment datagrams the way a
+ *        node sends them.
+ *
+ * @param unMessageId - The message id of the fragments.
+ * @param unDataCount - The number of double elements.
+ * @param vPacked - Set to the packed packet.
+ * @return std::vector<std::vector<uint8_t>> - The fragment datagrams, in order.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static std::vector<std::vector<uint8_t>> Fragment(uint16_t unMessageId, uint16_t unDataCount, std::vector<uint8_t>& vPacked)
+{
+    rovecomm::RoveCommPacket<double> stPacket;
+    stPacket.unDataId    = 1219;
+    stPacket.unDataCount = unDataCount;
+    stPacket.eDataType   = manifest::DataTypes::DOUBLE_T;
+    for (uint16_t unIter = 0; unIter < unDataCount; ++unIter)
+    {
+        stPacket.vData.push_back(unIter * 0.5);
+    }
+    vPacked.resize(rovecomm::GetPackedSize(stPacket));
+    rovecomm::PackPacket(stPacket, vPacked.data(), vPacked.size());
+
+    rovecomm::RoveCommFragmentHeader stHeader;
+    stHeader.unMessageId = unMessageId;
+    stHeader.unCount     = rovecomm::GetFragmentCount(vPacked.size());
+    stHeader.unTotalSize = vPacked.size();
+
+    std::vector<std::vector<uint8_t>> vFragments;
+    for (stHeader.unIndex = 0; stHeader.unIndex < stHeader.unCount; ++stHeader.unIndex)
+    {
+        std::vector<uint8_t> vFragment(ROVECOMM_FRAGMENT_HEADER_SIZE + rovecomm::GetFragmentPayloadSize(stHeader));
+        rovecomm::PackFragmentHeader(stHeader, vFragment.data());
+        std::memcpy(&vFragment[ROVECOMM_FRAGMENT_HEADER_SIZE], &vPacked[rovecomm::GetFragmentOffset(stHeader)], vFragment.size() - ROVECOMM_FRAGMENT_HEADER_SIZE);
+        vFragments.push_back(vFragment);
+    }
+
+    return vFragments;
+}
+
+/******************************************************************************
+ * @brief Test that the largest possible packet is split into fragments that fit
+ *        a datagram, and is put back together byte for byte from fragments
+ *        arriving out of order and duplicated. Fragments arriving after the
+ *        packet completed are late.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommReassembler, OutOfOrder)
+{
+    std::vector<uint8_t> vPacked;
+    std::vector<std::vector<uint8_t>> vFragments = Fragment(7, ROVECOMM_PACKET_MAX_DATA_COUNT, vPacked);
+    ASSERT_EQ(vPacked.size(), 6u + 65535u * 8u);
+    ASSERT_EQ(vFragments.size(), 359u);
+    for (const std::vector<uint8_t>& vFragment : vFragments)
+    {
+        EXPECT_LE(vFragment.size(), static_cast<size_t>(rovecomm::ROVECOMM_FRAGMENT_MAX_DATAGRAM_SIZE));
+    }
+
+    sockaddr_in saAddress;
+    memset(&saAddress, 0, sizeof(saAddress));
+    std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+    rovecomm::RoveCommReassembler stReassembler;
+    rovecomm::RoveCommBufferPool::Buffer stPacket;
+
+    // Feed the fragments back to front, repeating one of them.
+    for (size_t siIter = vFragments.size() - 1; siIter > 0; --siIter)
+    {
+        EXPECT_FALSE(stReassembler.Add(vFragments[siIter].data(), vFragments[siIter].size(), saAddress, tmNow, stPacket));
+    }
+    EXPECT_FALSE(stReassembler.Add(vFragments[5].data(), vFragments[5].size(), saAddress, tmNow, stPacket));
+    EXPECT_EQ(stReassembler.GetStatistics().siBytesInUse, vPacked.size());
+    ASSERT_TRUE(stReassembler.Add(vFragments[0].data(), vFragments[0].size(), saAddress, tmNow, stPacket));
+    ASSERT_EQ(stPacket.size(), vPacked.size());
+    EXPECT_EQ(std::memcmp(stPacket.data(), vPacked.data(), vPacked.size()), 0);
+
+    rovecomm::RoveCommPacketView<double> stView = rovecomm::ViewData<double>(stPacket.data(), stPacket.size());
+    EXPECT_EQ(stView.size(), 65535u);
+    EXPECT_EQ(stView[65534], 65534 * 0.5);
+
+    // A retransmitted fragment of the finished packet does not start a new one.
+    EXPECT_FALSE(stReassembler.Add(vFragments[3].data(), vFragments[3].size(), saAddress, tmNow, stPacket));
+
+    rovecomm::RoveCommReassemblyStatistics stStatistics = stReassembler.GetStatistics();
+    EXPECT_EQ(stStatistics.unFragmentsReceived, 361u);
+    EXPECT_EQ(stStatistics.unPacketsCompleted, 1u);
+    EXPECT_EQ(stStatistics.unDuplicateFragments, 1u);
+    EXPECT_EQ(stStatistics.unLateFragments, 1u);
+    EXPECT_EQ(stStatistics.siBytesInUse, 0u);
+}
+
+/******************************************************************************
+ * @brief Test that incomplete packets time out, that the memory cap discards
+ *        the oldest packet for a new one and never admits a packet larger than
+ *        itself, and that fragments with a bad header are rejected.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommReassembler, Limits)
+{
+    std::vector<uint8_t> vSmall;
+    std::vector<uint8_t> vLarge;
+    std::vector<std::vector<uint8_t>> vFirst  = Fragment(1, 5000, vSmall);
+    std::vector<std::vector<uint8_t>> vSecond = Fragment(2, 5000, vSmall);
+    std::vector<std::vector<uint8_t>> vThird  = Fragment(3, 5000, vSmall);
+    std::vector<std::vector<uint8_t>> vFourth = Fragment(5, 5000, vSmall);
+    std::vector<std::vector<uint8_t>> vHuge   = Fragment(4, 20000, vLarge);
+
+    sockaddr_in saAddress;
+    memset(&saAddress, 0, sizeof(saAddress));
+    std::chrono::steady_clock::time_point tmBase;
+    rovecomm::RoveCommReassembler stReassembler;
+    rovecomm::RoveCommBufferPool::Buffer stPacket;
+    stReassembler.SetLimits(std::chrono::milliseconds(100), 4, 2 * vSmall.size() + 100);
+
+    // The first packet is not finished within the timeout.
+    EXPECT_FALSE(stReassembler.Add(vFirst[0].data(), vFirst[0].size(), saAddress, tmBase, stPacket));
+    EXPECT_FALSE(stReassembler.Add(vSecond[0].data(), vSecond[0].size(), saAddress, tmBase + std::chrono::milliseconds(50), stPacket));
+    EXPECT_FALSE(stReassembler.Add(vFirst[1].data(), vFirst[1].size(), saAddress, tmBase + std::chrono::milliseconds(100), stPacket));
+    EXPECT_EQ(stReassembler.GetStatistics().unPacketsTimedOut, 1u);
+    EXPECT_EQ(stReassembler.GetStatistics().unLateFragments, 1u);
+
+    // Two packets fit in the cap, so a third one discards the oldest.
+    EXPECT_FALSE(stReassembler.Add(vThird[0].data(), vThird[0].size(), saAddress, tmBase + std::chrono::milliseconds(60), stPacket));
+    EXPECT_EQ(stReassembler.GetStatistics().siBytesInUse, 2 * vSmall.size());
+    EXPECT_FALSE(stReassembler.Add(vFourth[0].data(), vFourth[0].size(), saAddress, tmBase + std::chrono::milliseconds(70), stPacket));
+    EXPECT_EQ(stReassembler.GetStatistics().unPacketsDropped, 1u);
+    EXPECT_FALSE(stReassembler.Add(vSecond[1].data(), vSecond[1].size(), saAddress, tmBase + std::chrono::milliseconds(70), stPacket));
+    EXPECT_EQ(stReassembler.GetStatistics().unLateFragments, 2u);
+    for (size_t siIter = 1; siIter < vThird.size(); ++siIter)
+    {
+        bool bComplete = stReassembler.Add(vThird[siIter].data(), vThird[siIter].size(), saAddress, tmBase + std::chrono::milliseconds(80), stPacket);
+        EXPECT_EQ(bComplete, siIter == vThird.size() - 1);
+    }
+
+    // A packet larger than the cap is never started, and its other fragments are late.
+    EXPECT_FALSE(stReassembler.Add(vHuge[0].data(), vHuge[0].size(), saAddress, tmBase + std::chrono::milliseconds(90), stPacket));
+    EXPECT_FALSE(stReassembler.Add(vHuge[1].data(), vHuge[1].size(), saAddress, tmBase + std::chrono::milliseconds(90), stPacket));
+
+    // Truncated fragments and fragments claiming an index past their count are malformed.
+    EXPECT_FALSE(stReassembler.Add(vSecond[1].data(), vSecond[1].size() - 1, saAddress, tmBase + std::chrono::milliseconds(90), stPacket));
+    std::vector<uint8_t> vBadIndex = vSecond[1];
+    vBadIndex[3]                   = 0xFF;
+    EXPECT_FALSE(stReassembler.Add(vBadIndex.data(), vBadIndex.size(), saAddress, tmBase + std::chrono::milliseconds(90), stPacket));
+
+    // The timeout also applies without new fragments arriving.
+    stReassembler.Expire(tmBase + std::chrono::seconds(1));
+
+    rovecomm::RoveCommReassemblyStatistics stStatistics = stReassembler.GetStatistics();
+    EXPECT_EQ(stStatistics.unPacketsCompleted, 1u);
+    EXPECT_EQ(stStatistics.unPacketsTimedOut, 2u);
+    EXPECT_EQ(stStatistics.unPacketsDropped, 2u);
+    EXPECT_EQ(stStatistics.unLateFragments, 3u);
+    EXPECT_EQ(stStatistics.unMalformedFragments, 2u);
+    EXPECT_EQ(stStatistics.siBytesInUse, 0u);
+}
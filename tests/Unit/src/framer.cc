@@ -0,0 +1,228 @@
+/******************************************************************************
+ * @brief Unit test for splitting a TCP byte stream into RoveComm packets.
+ *
+ * @file framer.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Pack a packet and append its bytes to a stream.
+ *
+ * @tparam T - The data type of the packet.
+ * @param unDataId - The data id of the packet.
+ * @param eDataType - The data type of the packet.
+ * @param unDataCount - The number of elements, filled with their index.
+ * @param vStream - The stream to append to.
+ * @return size_t - The packed size of the packet.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+template<typename T>
+static size_t AppendPacket(uint16_t unDataId, manifest::DataTypes eDataType, uint16_t unDataCount, std::vector<uint8_t>& vStream)
+{
+    rovecomm::RoveCommPacket<T> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = unDataCount;
+    stPacket.eDataType   = eDataType;
+    for (uint16_t unIter = 0; unIter < unDataCount; ++unIter)
+    {
+        stPacket.vData.push_back(static_cast<T>(unIter));
+    }
+
+    size_t siOffset = vStream.size();
+    vStream.resize(siOffset + rovecomm::GetPackedSize(stPacket));
+    return rovecomm::PackPacket(stPacket, vStream.data() + siOffset, vStream.size() - siOffset);
+}
+
+/******************************************************************************
+ * @brief Feed bytes into a framer in reads of at most a given size, the way a
+ *        connection delivers them, and collect every packet it returns.
+ *
+ * @param stFramer - The framer to feed.
+ * @param vStream - The bytes to feed.
+ * @param siReadSize - The largest number of bytes per read.
+ * @param vFrames - Every packet returned is appended to this.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static void Feed(rovecomm::RoveCommTCPFramer& stFramer, const std::vector<uint8_t>& vStream, size_t siReadSize, std::vector<std::vector<uint8_t>>& vFrames)
+{
+    size_t siOffset = 0;
+    while (siOffset < vStream.size() && stFramer.GetError() == rovecomm::eFrameNoError)
+    {
+        size_t siRead = std::min({siReadSize, stFramer.GetWriteCapacity(), vStream.size() - siOffset});
+        ASSERT_GT(siRead, 0u);
+        memcpy(stFramer.GetWriteBuffer(), vStream.data() + siOffset, siRead);
+        stFramer.Commit(siRead);
+        siOffset += siRead;
+
+        const uint8_t* pFrame;
+        size_t siFrameSize;
+        while (stFramer.NextFrame(pFrame, siFrameSize))
+        {
+            vFrames.emplace_back(pFrame, pFrame + siFrameSize);
+        }
+    }
+}
+
+/******************************************************************************
+ * @brief Test that every packet in one read is returned, each with the size
+ *        its header announces.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCPFramer, ManyPacketsPerRead)
+{
+    std::vector<uint8_t> vStream;
+    std::vector<size_t> vSizes;
+    vSizes.push_back(AppendPacket<uint8_t>(1400, manifest::DataTypes::UINT8_T, 5, vStream));
+    vSizes.push_back(AppendPacket<double>(1401, manifest::DataTypes::DOUBLE_T, 3, vStream));
+    vSizes.push_back(AppendPacket<int16_t>(1402, manifest::DataTypes::INT16_T, 0, vStream));
+    vSizes.push_back(AppendPacket<char>(1403, manifest::DataTypes::CHAR, 12, vStream));
+
+    rovecomm::RoveCommTCPFramer stFramer;
+    std::vector<std::vector<uint8_t>> vFrames;
+    Feed(stFramer, vStream, vStream.size(), vFrames);
+
+    ASSERT_EQ(vFrames.size(), vSizes.size());
+    size_t siOffset = 0;
+    for (size_t siIter = 0; siIter < vFrames.size(); ++siIter)
+    {
+        ASSERT_EQ(vFrames[siIter].size(), vSizes[siIter]);
+        EXPECT_TRUE(std::equal(vFrames[siIter].begin(), vFrames[siIter].end(), vStream.begin() + siOffset));
+        siOffset += vSizes[siIter];
+    }
+    EXPECT_EQ(stFramer.GetBufferedBytes(), 0u);
+    EXPECT_EQ(stFramer.GetError(), rovecomm::eFrameNoError);
+}
+
+/******************************************************************************
+ * @brief Test that packets split across reads at every possible point come out
+ *        whole and unchanged, with the partial packet carried between reads.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCPFramer, PartialReads)
+{
+    std::vector<uint8_t> vStream;
+    AppendPacket<uint32_t>(1404, manifest::DataTypes::UINT32_T, 7, vStream);
+    AppendPacket<float>(1405, manifest::DataTypes::FLOAT_T, 2, vStream);
+    AppendPacket<int8_t>(1406, manifest::DataTypes::INT8_T, 1, vStream);
+
+    rovecomm::RoveCommTCPFramer stReference;
+    std::vector<std::vector<uint8_t>> vExpected;
+    Feed(stReference, vStream, vStream.size(), vExpected);
+    ASSERT_EQ(vExpected.size(), 3u);
+
+    for (size_t siReadSize = 1; siReadSize <= vStream.size(); ++siReadSize)
+    {
+        rovecomm::RoveCommTCPFramer stFramer;
+        std::vector<std::vector<uint8_t>> vFrames;
+        Feed(stFramer, vStream, siReadSize, vFrames);
+        EXPECT_EQ(vFrames, vExpected) << "reads of " << siReadSize << " bytes";
+        EXPECT_EQ(stFramer.GetBufferedBytes(), 0u);
+    }
+}
+
+/******************************************************************************
+ * @brief Test that a packet larger than the buffer grows it, and that the
+ *        buffer shrinks back once the packet has been returned.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCPFramer, LargePacket)
+{
+    std::vector<uint8_t> vStream;
+    size_t siLargeSize = AppendPacket<double>(1407, manifest::DataTypes::DOUBLE_T, 65535, vStream);
+    AppendPacket<uint8_t>(1408, manifest::DataTypes::UINT8_T, 1, vStream);
+    ASSERT_EQ(siLargeSize, static_cast<size_t>(rovecomm::ROVECOMM_TCP_MAX_FRAME_SIZE));
+
+    rovecomm::RoveCommTCPFramer stFramer;
+    std::vector<std::vector<uint8_t>> vFrames;
+    Feed(stFramer, vStream, 4096, vFrames);
+
+    ASSERT_EQ(vFrames.size(), 2u);
+    EXPECT_EQ(vFrames[0].size(), siLargeSize);
+    EXPECT_TRUE(std::equal(vFrames[0].begin(), vFrames[0].end(), vStream.begin()));
+    EXPECT_EQ(stFramer.GetBufferSize(), static_cast<size_t>(rovecomm::ROVECOMM_TCP_FRAMER_BUFFER_SIZE));
+}
+
+/******************************************************************************
+ * @brief Test that a bad header is rejected as soon as it arrives, after the
+ *        packets before it have been returned, and that nothing after it is.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCPFramer, RejectsBadHeaders)
+{
+    // A wrong version byte.
+    {
+        std::vector<uint8_t> vStream;
+        AppendPacket<uint8_t>(1409, manifest::DataTypes::UINT8_T, 2, vStream);
+        size_t siGarbage = vStream.size();
+        AppendPacket<uint8_t>(1409, manifest::DataTypes::UINT8_T, 2, vStream);
+        vStream[siGarbage] = ROVECOMM_VERSION + 1;
+        AppendPacket<uint8_t>(1409, manifest::DataTypes::UINT8_T, 2, vStream);
+
+        rovecomm::RoveCommTCPFramer stFramer;
+        std::vector<std::vector<uint8_t>> vFrames;
+        Feed(stFramer, vStream, vStream.size(), vFrames);
+        EXPECT_EQ(vFrames.size(), 1u);
+        EXPECT_EQ(stFramer.GetError(), rovecomm::eFrameBadVersion);
+
+        // Once rejected, the stream stays rejected until it is reset.
+        const uint8_t* pFrame;
+        size_t siFrameSize;
+        EXPECT_FALSE(stFramer.NextFrame(pFrame, siFrameSize));
+        stFramer.Reset();
+        EXPECT_EQ(stFramer.GetError(), rovecomm::eFrameNoError);
+        EXPECT_EQ(stFramer.GetBufferedBytes(), 0u);
+    }
+
+    // A data type that is not in the manifest.
+    {
+        std::vector<uint8_t> vStream;
+        AppendPacket<uint8_t>(1410, manifest::DataTypes::UINT8_T, 2, vStream);
+        vStream[5] = 0xEE;
+
+        rovecomm::RoveCommTCPFramer stFramer;
+        std::vector<std::vector<uint8_t>> vFrames;
+        Feed(stFramer, vStream, 1, vFrames);
+        EXPECT_TRUE(vFrames.empty());
+        EXPECT_EQ(stFramer.GetError(), rovecomm::eFrameUnknownDataType);
+    }
+
+    // A packet over the maximum is rejected from its header, without waiting for its data.
+    {
+        std::vector<uint8_t> vStream;
+        AppendPacket<uint32_t>(1411, manifest::DataTypes::UINT32_T, 100, vStream);
+        vStream.resize(ROVECOMM_PACKET_HEADER_SIZE);
+
+        rovecomm::RoveCommTCPFramer stFramer(256);
+        std::vector<std::vector<uint8_t>> vFrames;
+        Feed(stFramer, vStream, vStream.size(), vFrames);
+        EXPECT_TRUE(vFrames.empty());
+        EXPECT_EQ(stFramer.GetError(), rovecomm::eFrameOversized);
+        EXPECT_EQ(stFramer.GetBufferSize(), static_cast<size_t>(rovecomm::ROVECOMM_TCP_FRAMER_BUFFER_SIZE));
+    }
+}
@@ -0,0 +1,161 @@
+/******************************************************************************
+ * @brief Unit test for the per data id history rings in RoveComm.
+ *
+ * @file history.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <chrono>
+#include <gtest/gtest.h>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Pack a float packet and append it to a history store.
+ *
+ * @param stStore - The store to update.
+ * @param unDataId - The data id of the packet.
+ * @param vData - The packet's elements.
+ * @param tmReceived - The receive time to record.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static void UpdateHistory(rovecomm::RoveCommHistoryStore& stStore, uint16_t unDataId, const std::vector<float>& vData, std::chrono::steady_clock::time_point tmReceived)
+{
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = vData.size();
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = vData;
+
+    std::vector<uint8_t> vBytes(rovecomm::GetPackedSize(stPacket));
+    rovecomm::PackPacket(stPacket, vBytes.data(), vBytes.size());
+    stStore.Update(vBytes.data(), vBytes.size(), tmReceived);
+}
+
+/******************************************************************************
+ * @brief Test that the last N samples come back oldest first as one contiguous
+ *        span, before and after the ring wraps around.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommHistory, LastSamples)
+{
+    const manifest::ManifestEntry stDriveSpeeds = manifest::Core::TELEMETRY.at("DRIVESPEEDS");
+    const uint16_t unDataId                     = stDriveSpeeds.DATA_ID;
+    std::chrono::steady_clock::time_point tmBase;
+
+    rovecomm::RoveCommHistoryStore stStore;
+    ASSERT_TRUE(stStore.EnableHistory(stDriveSpeeds, 8));
+    EXPECT_EQ(stStore.GetCapacity(unDataId), 8u);
+    EXPECT_EQ(stStore.GetCapacity(3101), 0u);
+    EXPECT_TRUE(stStore.GetLast<float>(unDataId, 4).empty());
+
+    // 13 samples through a ring of 8 wraps it once.
+    for (int nIter = 1; nIter <= 13; ++nIter)
+    {
+        float fValue = static_cast<float>(nIter);
+        UpdateHistory(stStore, unDataId, {fValue, fValue, fValue, fValue, fValue, -fValue}, tmBase + std::chrono::milliseconds(nIter));
+    }
+
+    rovecomm::RoveCommHistoryWindow<float> stWindow = stStore.GetLast<float>(unDataId, 5);
+    ASSERT_EQ(stWindow.size(), 5u);
+    EXPECT_EQ(stWindow.unDataCount, 6);
+    EXPECT_EQ(stWindow.unFirstSequence, 9u);
+    for (size_t siIter = 0; siIter < stWindow.size(); ++siIter)
+    {
+        float fExpected = static_cast<float>(9 + siIter);
+        EXPECT_EQ(stWindow.GetTimestamp(siIter), tmBase + std::chrono::milliseconds(9 + siIter));
+        EXPECT_EQ(stWindow.GetValue(siIter, 0), fExpected);
+        EXPECT_EQ(stWindow.GetValue(siIter, 5), -fExpected);
+    }
+    EXPECT_TRUE(stWindow.IsIntact());
+
+    // Asking for more than the capacity returns the whole ring, still contiguous.
+    rovecomm::RoveCommHistoryWindow<float> stAll = stStore.GetLast<float>(unDataId, 100);
+    ASSERT_EQ(stAll.size(), 8u);
+    EXPECT_EQ(stAll.GetValue(0, 0), 6.0f);
+    EXPECT_EQ(stAll.GetValue(7, 0), 13.0f);
+    EXPECT_TRUE(stAll.IsIntact());
+
+    // A window of the whole ring is intact until the next sample, after which the writer may be overwriting its first sample.
+    UpdateHistory(stStore, unDataId, {14, 14, 14, 14, 14, -14}, tmBase + std::chrono::milliseconds(14));
+    EXPECT_FALSE(stAll.IsIntact());
+    EXPECT_TRUE(stWindow.IsIntact());
+
+    // The wrong type gets nothing.
+    EXPECT_TRUE(stStore.GetLast<double>(unDataId, 4).empty());
+}
+
+/******************************************************************************
+ * @brief Test that samples since a point in time start at the first sample at
+ *        or after it.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommHistory, SamplesSince)
+{
+    const uint16_t unDataId = 1310;
+    std::chrono::steady_clock::time_point tmBase;
+
+    rovecomm::RoveCommHistoryStore stStore;
+    ASSERT_TRUE(stStore.EnableHistory(unDataId, manifest::DataTypes::FLOAT_T, 1, 16));
+    for (int nIter = 0; nIter < 20; ++nIter)
+    {
+        UpdateHistory(stStore, unDataId, {static_cast<float>(nIter)}, tmBase + std::chrono::milliseconds(10 * nIter));
+    }
+
+    rovecomm::RoveCommHistoryWindow<float> stWindow = stStore.GetSince<float>(unDataId, tmBase + std::chrono::milliseconds(155));
+    ASSERT_EQ(stWindow.size(), 4u);
+    EXPECT_EQ(stWindow.GetValue(0, 0), 16.0f);
+    EXPECT_EQ(stWindow.GetValue(3, 0), 19.0f);
+    EXPECT_EQ(stWindow.unFirstSequence, 17u);
+
+    // Samples older than the ring are gone, every retained sample is a valid window, and a time in the future returns nothing.
+    rovecomm::RoveCommHistoryWindow<float> stAll = stStore.GetSince<float>(unDataId, tmBase);
+    EXPECT_EQ(stAll.size(), 16u);
+    EXPECT_TRUE(stAll.IsIntact());
+    EXPECT_TRUE(stStore.GetSince<float>(unDataId, tmBase + std::chrono::seconds(1)).empty());
+}
+
+/******************************************************************************
+ * @brief Test that packets with a different count are padded or truncated, and
+ *        that the memory used is fixed by the configured capacities.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommHistory, BoundedMemory)
+{
+    rovecomm::RoveCommHistoryStore stStore;
+    EXPECT_FALSE(stStore.EnableHistory(1311, manifest::DataTypes::FLOAT_T, 2, 0));
+    EXPECT_EQ(stStore.GetMemoryUsage(), 0u);
+
+    ASSERT_TRUE(stStore.EnableHistory(1311, manifest::DataTypes::FLOAT_T, 2, 4));
+    size_t siExpected = 2 * (4 + 1) * (2 * sizeof(float) + sizeof(std::chrono::steady_clock::time_point));
+    EXPECT_EQ(stStore.GetMemoryUsage(), siExpected);
+
+    std::chrono::steady_clock::time_point tmBase;
+    for (int nIter = 0; nIter < 1000; ++nIter)
+    {
+        UpdateHistory(stStore, 1311, {1.0f, 2.0f, 3.0f}, tmBase);
+        UpdateHistory(stStore, 1311, {4.0f}, tmBase);
+    }
+    EXPECT_EQ(stStore.GetMemoryUsage(), siExpected);
+
+    rovecomm::RoveCommHistoryWindow<float> stWindow = stStore.GetLast<float>(1311, 2);
+    ASSERT_EQ(stWindow.size(), 2u);
+    EXPECT_EQ(std::vector<float>({stWindow.GetValue(0, 0), stWindow.GetValue(0, 1), stWindow.GetValue(1, 0), stWindow.GetValue(1, 1)}),
+              std::vector<float>({1.0f, 2.0f, 4.0f, 0.0f}));
+}
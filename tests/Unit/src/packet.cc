@@ -0,0 +1,357 @@
+/******************************************************************************
+ * @brief Unit test for packet packing, unpacking and viewing in RoveComm.
+ *
+ * @file packet.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../../src/RoveComm/RoveCommByteSwap.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <cstring>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Test that a RoveCommPacketView reads the same values that UnpackData
+ *        produces, by index and by iteration.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPacket, ViewMatchesUnpack)
+{
+    // Create RoveCommPacket
+    rovecomm::RoveCommPacket<double> stPacket;
+    stPacket.unDataId    = 1300;
+    stPacket.unDataCount = 4;
+    stPacket.eDataType   = manifest::DataTypes::DOUBLE_T;
+    stPacket.vData       = {-1.25, 0.0, 3.5e10, 42.0};
+
+    // Pack the packet and view it.
+    rovecomm::RoveCommData stData               = rovecomm::PackPacket(stPacket);
+    rovecomm::RoveCommPacketView<double> stView = rovecomm::ViewData<double>(stData);
+
+    EXPECT_EQ(stView.unDataId, 1300);
+    EXPECT_EQ(stView.unDataCount, 4);
+    EXPECT_EQ(stView.eDataType, manifest::DataTypes::DOUBLE_T);
+    ASSERT_EQ(stView.size(), 4u);
+    EXPECT_FALSE(stView.empty());
+
+    // Index access.
+    for (size_t siIter = 0; siIter < stView.size(); ++siIter)
+    {
+        EXPECT_EQ(stView[siIter], stPacket.vData[siIter]);
+    }
+
+    // Iteration.
+    std::vector<double> vIterated(stView.begin(), stView.end());
+    EXPECT_EQ(vIterated, stPacket.vData);
+    EXPECT_EQ(std::accumulate(stView.begin(), stView.end(), 0.0), std::accumulate(stPacket.vData.begin(), stPacket.vData.end(), 0.0));
+
+    // Owning conversion.
+    rovecomm::RoveCommPacket<double> stCopy   = stView.ToPacket();
+    rovecomm::RoveCommPacket<double> stUnpack = rovecomm::UnpackData<double>(stData);
+    EXPECT_EQ(stCopy.unDataId, stUnpack.unDataId);
+    EXPECT_EQ(stCopy.unDataCount, stUnpack.unDataCount);
+    EXPECT_EQ(stCopy.eDataType, stUnpack.eDataType);
+    EXPECT_EQ(stCopy.vData, stUnpack.vData);
+}
+
+/******************************************************************************
+ * @brief Test that a RoveCommPacketView never reads past the end of the buffer
+ *        when the header claims more data than fits.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPacket, ViewClampsDataCount)
+{
+    // Create a header that claims the maximum data count of 32-bit values.
+    rovecomm::RoveCommData stData;
+    memset(&stData, 0, sizeof(stData));
+    stData.unBytes[0] = ROVECOMM_VERSION;
+    stData.unBytes[1] = 0x05;
+    stData.unBytes[2] = 0x14;
+    stData.unBytes[3] = 0xFF;
+    stData.unBytes[4] = 0xFF;
+    stData.unBytes[5] = static_cast<uint8_t>(manifest::DataTypes::UINT32_T);
+
+    rovecomm::RoveCommPacketView<uint32_t> stView = rovecomm::ViewData<uint32_t>(stData);
+    EXPECT_EQ(stView.unDataId, 1300);
+    EXPECT_EQ(stView.size(), (sizeof(stData.unBytes) - ROVECOMM_PACKET_HEADER_SIZE) / sizeof(uint32_t));
+}
+
+/******************************************************************************
+ * @brief Test packing into a caller-supplied buffer sized to the packet.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPacket, PackIntoBuffer)
+{
+    // Create a DRIVELEFTRIGHT-sized packet.
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = 1000;
+    stPacket.unDataCount = 2;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {0.5f, -0.5f};
+
+    ASSERT_EQ(rovecomm::GetPackedSize(stPacket), 14u);
+
+    // A buffer that is one byte too small is rejected.
+    uint8_t aBuffer[14];
+    EXPECT_EQ(rovecomm::PackPacket(stPacket, aBuffer, sizeof(aBuffer) - 1), 0u);
+
+    // An exactly sized buffer matches the legacy RoveCommData encoding.
+    ASSERT_EQ(rovecomm::PackPacket(stPacket, aBuffer, sizeof(aBuffer)), 14u);
+    rovecomm::RoveCommData stData = rovecomm::PackPacket(stPacket);
+    EXPECT_EQ(memcmp(aBuffer, stData.unBytes, sizeof(aBuffer)), 0);
+
+    // Round trip through the bounded unpack.
+    rovecomm::RoveCommPacket<float> stUnpacked = rovecomm::UnpackData<float>(aBuffer, sizeof(aBuffer));
+    EXPECT_EQ(stUnpacked.unDataId, 1000);
+    EXPECT_EQ(stUnpacked.vData, stPacket.vData);
+
+    // A packet with less data than its data count cannot be packed, and the legacy encoding of it is no packet at all.
+    stPacket.unDataCount = 3;
+    uint8_t aLargeBuffer[32];
+    EXPECT_EQ(rovecomm::PackPacket(stPacket, aLargeBuffer, sizeof(aLargeBuffer)), 0u);
+    stData = rovecomm::PackPacket(stPacket);
+    EXPECT_EQ(stData.unBytes[0], 0u);
+    EXPECT_EQ(rovecomm::GetPackedSize(stData.unBytes, sizeof(stData.unBytes)), 0u);
+
+    // Neither is a packet too large for RoveCommData.
+    stPacket.unDataCount = ROVECOMM_PACKET_MAX_DATA_COUNT;
+    stPacket.vData.assign(ROVECOMM_PACKET_MAX_DATA_COUNT, 1.0f);
+    stData = rovecomm::PackPacket(stPacket);
+    EXPECT_EQ(rovecomm::GetPackedSize(stData.unBytes, sizeof(stData.unBytes)), 0u);
+}
+
+/******************************************************************************
+ * @brief Test that bounded unpacking and viewing never read past the number of
+ *        bytes that were actually received.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPacket, UnpackClampsToReceivedSize)
+{
+    rovecomm::RoveCommPacket<uint16_t> stPacket;
+    stPacket.unDataId    = 1301;
+    stPacket.unDataCount = 4;
+    stPacket.eDataType   = manifest::DataTypes::UINT16_T;
+    stPacket.vData       = {1, 2, 3, 4};
+
+    uint8_t aBuffer[14];
+    ASSERT_EQ(rovecomm::PackPacket(stPacket, aBuffer, sizeof(aBuffer)), 14u);
+
+    // Pretend only the header and two and a half elements arrived.
+    rovecomm::RoveCommPacket<uint16_t> stUnpacked = rovecomm::UnpackData<uint16_t>(aBuffer, 11);
+    EXPECT_EQ(stUnpacked.unDataCount, 2);
+    EXPECT_EQ(stUnpacked.vData, (std::vector<uint16_t>{1, 2}));
+    EXPECT_EQ(rovecomm::ViewData<uint16_t>(aBuffer, 11).size(), 2u);
+
+    // Less than a header is an empty packet.
+    EXPECT_EQ(rovecomm::UnpackData<uint16_t>(aBuffer, 3).unDataCount, 0);
+    EXPECT_TRUE(rovecomm::ViewData<uint16_t>(aBuffer, 3).empty());
+}
+
+/******************************************************************************
+ * @brief Test that the packed size read from a header accounts for the data
+ *        type, and that headers which do not fit in the remaining bytes are
+ *        rejected, as needed to walk a coalesced datagram.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPacket, PackedSizeFromHeader)
+{
+    rovecomm::RoveCommPacket<double> stPacket;
+    stPacket.unDataId    = 1302;
+    stPacket.unDataCount = 3;
+    stPacket.eDataType   = manifest::DataTypes::DOUBLE_T;
+    stPacket.vData       = {1.0, 2.0, 3.0};
+
+    uint8_t aBuffer[40];
+    ASSERT_EQ(rovecomm::PackPacket(stPacket, aBuffer, sizeof(aBuffer)), 30u);
+    EXPECT_EQ(rovecomm::GetPackedSize(aBuffer, sizeof(aBuffer)), 30u);
+    EXPECT_EQ(rovecomm::GetPackedSize(aBuffer, 30), 30u);
+
+    // A packet cut short, a partial header, an unknown data type or another version has no size.
+    EXPECT_EQ(rovecomm::GetPackedSize(aBuffer, 29), 0u);
+    EXPECT_EQ(rovecomm::GetPackedSize(aBuffer, 5), 0u);
+    aBuffer[5] = 0x7F;
+    EXPECT_EQ(rovecomm::GetPackedSize(aBuffer, sizeof(aBuffer)), 0u);
+    aBuffer[5] = manifest::DataTypes::DOUBLE_T;
+    aBuffer[0] = 0;
+    EXPECT_EQ(rovecomm::GetPackedSize(aBuffer, sizeof(aBuffer)), 0u);
+}
+
+/******************************************************************************
+ * @brief Test that the buffer pool reuses returned buffers.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommBufferPool, ReusesBuffers)
+{
+    rovecomm::RoveCommBufferPool stPool(2);
+    EXPECT_EQ(stPool.GetFreeBufferCount(), 0u);
+
+    const uint8_t* pFirstData = nullptr;
+    {
+        rovecomm::RoveCommBufferPool::Buffer stBuffer = stPool.Acquire(64);
+        EXPECT_EQ(stBuffer.size(), 64u);
+        pFirstData = stBuffer.data();
+    }
+    EXPECT_EQ(stPool.GetFreeBufferCount(), 1u);
+
+    // A smaller request reuses the same storage.
+    {
+        rovecomm::RoveCommBufferPool::Buffer stBuffer = stPool.Acquire(14);
+        EXPECT_EQ(stBuffer.size(), 14u);
+        EXPECT_EQ(stBuffer.data(), pFirstData);
+        EXPECT_EQ(stPool.GetFreeBufferCount(), 0u);
+    }
+
+    // The pool never keeps more than its limit.
+    {
+        rovecomm::RoveCommBufferPool::Buffer stFirst  = stPool.Acquire(8);
+        rovecomm::RoveCommBufferPool::Buffer stSecond = stPool.Acquire(8);
+        rovecomm::RoveCommBufferPool::Buffer stThird  = stPool.Acquire(8);
+    }
+    EXPECT_EQ(stPool.GetFreeBufferCount(), 2u);
+}
+
+/******************************************************************************
+ * @brief Pack a packet with the element-by-element conversion the library used
+ *        before the vectorized kernels, then check that PackPacket produces the
+ *        same bytes and that UnpackData restores the original values.
+ *
+ * @tparam T - The type of data in the packet.
+ * @param eDataType - The manifest data type matching T.
+ * @param unDataCount - The number of elements to pack.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+template<typename T>
+static void ExpectBitExactRoundTrip(manifest::DataTypes eDataType, uint16_t unDataCount)
+{
+    // Fill the packet with a byte pattern that differs in every byte of every element.
+    rovecomm::RoveCommPacket<T> stPacket;
+    stPacket.unDataId    = 1234;
+    stPacket.unDataCount = unDataCount;
+    stPacket.eDataType   = eDataType;
+    stPacket.vData.resize(unDataCount);
+    uint8_t* pPattern = reinterpret_cast<uint8_t*>(stPacket.vData.data());
+    for (size_t siByte = 0; siByte < unDataCount * sizeof(T); ++siByte)
+    {
+        pPattern[siByte] = static_cast<uint8_t>(siByte * 7 + 3);
+    }
+
+    // Build the reference encoding.
+    std::vector<uint8_t> vExpected(ROVECOMM_PACKET_HEADER_SIZE + unDataCount * sizeof(T));
+    for (uint16_t unIndex = 0; unIndex < unDataCount; ++unIndex)
+    {
+        uint8_t* pOut = &vExpected[ROVECOMM_PACKET_HEADER_SIZE + unIndex * sizeof(T)];
+        if constexpr (sizeof(T) == sizeof(uint8_t))
+        {
+            memcpy(pOut, &stPacket.vData[unIndex], sizeof(T));
+        }
+        else if constexpr (sizeof(T) == sizeof(uint16_t))
+        {
+            uint16_t unValue;
+            memcpy(&unValue, &stPacket.vData[unIndex], sizeof(T));
+            unValue = htons(unValue);
+            memcpy(pOut, &unValue, sizeof(T));
+        }
+        else if constexpr (sizeof(T) == sizeof(uint32_t))
+        {
+            uint32_t unValue;
+            memcpy(&unValue, &stPacket.vData[unIndex], sizeof(T));
+            unValue = htonl(unValue);
+            memcpy(pOut, &unValue, sizeof(T));
+        }
+        else
+        {
+            uint64_t unValue;
+            memcpy(&unValue, &stPacket.vData[unIndex], sizeof(T));
+            unValue = htonll(unValue);
+            memcpy(pOut, &unValue, sizeof(T));
+        }
+    }
+
+    // Compare the payload. The header is covered by the other packet tests.
+    std::vector<uint8_t> vPacked(vExpected.size());
+    ASSERT_EQ(rovecomm::PackPacket(stPacket, vPacked.data(), vPacked.size()), vPacked.size());
+    EXPECT_EQ(0, memcmp(vPacked.data() + ROVECOMM_PACKET_HEADER_SIZE, vExpected.data() + ROVECOMM_PACKET_HEADER_SIZE, unDataCount * sizeof(T)))
+        << "type size " << sizeof(T) << ", count " << unDataCount;
+
+    // Unpacking must restore the exact bytes, including NaN payloads for floats.
+    rovecomm::RoveCommPacket<T> stUnpacked = rovecomm::UnpackData<T>(vPacked.data(), vPacked.size());
+    ASSERT_EQ(stUnpacked.unDataCount, unDataCount);
+    EXPECT_EQ(0, memcmp(stUnpacked.vData.data(), stPacket.vData.data(), unDataCount * sizeof(T))) << "type size " << sizeof(T) << ", count " << unDataCount;
+
+    // The view converts through the same kernels.
+    rovecomm::RoveCommPacket<T> stFromView = rovecomm::ViewData<T>(vPacked.data(), vPacked.size()).ToPacket();
+    EXPECT_EQ(0, memcmp(stFromView.vData.data(), stPacket.vData.data(), unDataCount * sizeof(T))) << "type size " << sizeof(T) << ", count " << unDataCount;
+}
+
+/******************************************************************************
+ * @brief Test that every byte-swap kernel the CPU supports packs and unpacks
+ *        every manifest data type bit-exactly, including lengths that leave a
+ *        partial vector at the end.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPacket, ByteSwapKernelsAreBitExact)
+{
+    const rovecomm::ByteSwapKernel eDefaultKernel = rovecomm::GetByteSwapKernel();
+    const rovecomm::ByteSwapKernel aKernels[]     = {rovecomm::ByteSwapKernel::eScalar,
+                                                     rovecomm::ByteSwapKernel::eSSSE3,
+                                                     rovecomm::ByteSwapKernel::eAVX2,
+                                                     rovecomm::ByteSwapKernel::eNEON};
+    const uint16_t aCounts[]                      = {0, 1, 3, 7, 8, 15, 16, 17, 33, 257};
+
+    for (rovecomm::ByteSwapKernel eKernel : aKernels)
+    {
+        if (!rovecomm::IsByteSwapKernelSupported(eKernel))
+        {
+            EXPECT_FALSE(rovecomm::SetByteSwapKernel(eKernel));
+            continue;
+        }
+
+        ASSERT_TRUE(rovecomm::SetByteSwapKernel(eKernel));
+        EXPECT_EQ(rovecomm::GetByteSwapKernel(), eKernel);
+        SCOPED_TRACE(rovecomm::GetByteSwapKernelName(eKernel));
+
+        for (uint16_t unCount : aCounts)
+        {
+            ExpectBitExactRoundTrip<int8_t>(manifest::DataTypes::INT8_T, unCount);
+            ExpectBitExactRoundTrip<uint8_t>(manifest::DataTypes::UINT8_T, unCount);
+            ExpectBitExactRoundTrip<int16_t>(manifest::DataTypes::INT16_T, unCount);
+            ExpectBitExactRoundTrip<uint16_t>(manifest::DataTypes::UINT16_T, unCount);
+            ExpectBitExactRoundTrip<int32_t>(manifest::DataTypes::INT32_T, unCount);
+            ExpectBitExactRoundTrip<uint32_t>(manifest::DataTypes::UINT32_T, unCount);
+            ExpectBitExactRoundTrip<float>(manifest::DataTypes::FLOAT_T, unCount);
+            ExpectBitExactRoundTrip<double>(manifest::DataTypes::DOUBLE_T, unCount);
+            ExpectBitExactRoundTrip<char>(manifest::DataTypes::CHAR, unCount);
+        }
+    }
+
+    // The scalar kernel is always available.
+    EXPECT_TRUE(rovecomm::IsByteSwapKernelSupported(rovecomm::ByteSwapKernel::eScalar));
+
+    rovecomm::SetByteSwapKernel(eDefaultKernel);
+}
@@ -0,0 +1,308 @@
+/******************************************************************************
+ * @brief Unit test for the rate limited publishers in RoveComm.
+ *
+ * @file publisher.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Records every packet a scheduler sends, and the batch it was sent in,
+ *        in place of a node.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+struct SentPackets
+{
+    public:
+        std::mutex muSentMutex;
+        std::vector<float> vValues;
+        std::vector<uint16_t> vDataIds;
+        std::vector<size_t> vBatches;
+        std::vector<std::chrono::steady_clock::time_point> vTimes;
+        size_t siBatchCount = 0;
+
+        rovecomm::RoveCommPublisherScheduler::SendFunction GetSendFunction()
+        {
+            return [this](const rovecomm::RoveCommUDPBatch& stBatch)
+            {
+                std::lock_guard<std::mutex> lkSentLock(muSentMutex);
+                for (size_t siIter = 0; siIter < stBatch.GetPacketCount(); ++siIter)
+                {
+                    rovecomm::RoveCommPacketView<float> stView = rovecomm::ViewData<float>(stBatch.GetPacketData(siIter), stBatch.GetPacketSize(siIter));
+                    vValues.push_back(stView[0]);
+                    vDataIds.push_back(stView.unDataId);
+                    vBatches.push_back(siBatchCount);
+                    vTimes.push_back(std::chrono::steady_clock::now());
+                }
+                ++siBatchCount;
+                return true;
+            };
+        }
+
+        size_t GetCount()
+        {
+            std::lock_guard<std::mutex> lkSentLock(muSentMutex);
+            return vValues.size();
+        }
+};
+
+/******************************************************************************
+ * @brief Publish a single float to a publisher.
+ *
+ * @param stPublisher - The publisher.
+ * @param fValue - The value to publish.
+ * @return true - The packet was published.
+ * @return false - The packet was rejected.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+static bool PublishFloat(rovecomm::RoveCommPublisher& stPublisher, float fValue)
+{
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = stPublisher.GetDataId();
+    stPacket.unDataCount = 1;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {fValue};
+    return stPublisher.Publish(stPacket);
+}
+
+/******************************************************************************
+ * @brief Test that the first packet goes out at once, and that a burst within
+ *        the following window is coalesced into its last packet.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPublisher, LatestWins)
+{
+    SentPackets stSent;
+    rovecomm::RoveCommPublisherScheduler stScheduler(stSent.GetSendFunction());
+    std::shared_ptr<rovecomm::RoveCommPublisher> pPublisher = stScheduler.AddPublisher(3000, 10.0);
+    ASSERT_NE(pPublisher, nullptr);
+    stScheduler.Enable();
+
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    ASSERT_TRUE(PublishFloat(*pPublisher, 0.0f));
+    while (stSent.GetCount() < 1 && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(1))
+    {
+        std::this_thread::yield();
+    }
+    for (int nIter = 1; nIter <= 100; ++nIter)
+    {
+        ASSERT_TRUE(PublishFloat(*pPublisher, static_cast<float>(nIter)));
+    }
+    while (stSent.GetCount() < 2 && std::chrono::steady_clock::now() - tmStart < std::chrono::seconds(1))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    stScheduler.Disable();
+
+    ASSERT_EQ(stSent.vValues, std::vector<float>({0.0f, 100.0f}));
+    EXPECT_GE(stSent.vTimes[1] - stSent.vTimes[0], std::chrono::milliseconds(99));
+
+    rovecomm::RoveCommPublisherStatistics stStatistics = pPublisher->GetStatistics();
+    EXPECT_EQ(stStatistics.unPublished, 101u);
+    EXPECT_EQ(stStatistics.unSent, 2u);
+    EXPECT_EQ(stStatistics.unCoalesced, 99u);
+    EXPECT_EQ(stStatistics.unSendFailures, 0u);
+    EXPECT_FALSE(pPublisher->IsPending());
+}
+
+/******************************************************************************
+ * @brief Test that a publisher fed faster than its rate never sends faster than
+ *        it, and that the last packet published is the last one sent.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPublisher, RateBounded)
+{
+    SentPackets stSent;
+    rovecomm::RoveCommPublisherScheduler stScheduler(stSent.GetSendFunction());
+    stScheduler.Enable();
+    std::shared_ptr<rovecomm::RoveCommPublisher> pPublisher = stScheduler.AddPublisher(3001, 50.0);
+    ASSERT_NE(pPublisher, nullptr);
+
+    // Publish at roughly 5 kHz for 300 ms.
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    float fLast                                   = 0.0f;
+    while (std::chrono::steady_clock::now() - tmStart < std::chrono::milliseconds(300))
+    {
+        fLast += 1.0f;
+        PublishFloat(*pPublisher, fLast);
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    stScheduler.Disable();
+
+    ASSERT_FALSE(stSent.vValues.empty());
+    EXPECT_EQ(stSent.vValues.back(), fLast);
+    EXPECT_LE(stSent.vValues.size(), 18u);
+    for (size_t siIter = 1; siIter < stSent.vTimes.size(); ++siIter)
+    {
+        EXPECT_GE(stSent.vTimes[siIter] - stSent.vTimes[siIter - 1], std::chrono::milliseconds(19));
+    }
+
+    rovecomm::RoveCommPublisherStatistics stStatistics = pPublisher->GetStatistics();
+    EXPECT_EQ(stStatistics.unSent, stSent.vValues.size());
+    EXPECT_EQ(stStatistics.unPublished, stStatistics.unSent + stStatistics.unCoalesced);
+}
+
+/******************************************************************************
+ * @brief Test that publishers reject packets of other data ids and need a
+ *        positive rate, and that removed publishers are no longer sent.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPublisher, Management)
+{
+    SentPackets stSent;
+    rovecomm::RoveCommPublisherScheduler stScheduler(stSent.GetSendFunction());
+    EXPECT_EQ(stScheduler.AddPublisher(3002, 0.0), nullptr);
+    EXPECT_EQ(stScheduler.AddPublisher(3002, -5.0), nullptr);
+
+    std::shared_ptr<rovecomm::RoveCommPublisher> pPublisher = stScheduler.AddPublisher(3002, 1000.0);
+    ASSERT_NE(pPublisher, nullptr);
+    EXPECT_EQ(pPublisher->GetInterval(), std::chrono::milliseconds(1));
+    EXPECT_EQ(stScheduler.GetPublisherCount(), 1u);
+
+    rovecomm::RoveCommPacket<float> stPacket;
+    stPacket.unDataId    = 3003;
+    stPacket.unDataCount = 1;
+    stPacket.eDataType   = manifest::DataTypes::FLOAT_T;
+    stPacket.vData       = {1.0f};
+    EXPECT_FALSE(pPublisher->Publish(stPacket));
+    EXPECT_FALSE(pPublisher->IsPending());
+
+    // Nothing is sent before the scheduler is enabled, and nothing after the publisher is removed.
+    EXPECT_TRUE(PublishFloat(*pPublisher, 1.0f));
+    EXPECT_TRUE(pPublisher->IsPending());
+    EXPECT_TRUE(stScheduler.RemovePublisher(pPublisher));
+    EXPECT_FALSE(stScheduler.RemovePublisher(pPublisher));
+    stScheduler.Enable();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(stSent.GetCount(), 0u);
+    EXPECT_EQ(stScheduler.GetPublisherCount(), 0u);
+}
+
+/******************************************************************************
+ * @brief Test that periodic streams are sampled at their rate, that a stream at
+ *        half the rate of another is always sent in the same batch as it, and
+ *        that skipped periods are counted.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommPublisher, PeriodicStreams)
+{
+    SentPackets stSent;
+    rovecomm::RoveCommPublisherScheduler stScheduler(stSent.GetSendFunction());
+    EXPECT_EQ(stScheduler.AddPeriodicStream<float>(3100, 0.0, [](rovecomm::RoveCommPacket<float>&) { return true; }), nullptr);
+
+    float fFast = 0.0f;
+    float fSlow = 0.0f;
+    int nCalls  = 0;
+    std::shared_ptr<rovecomm::RoveCommPeriodicStream> pFast =
+        stScheduler.AddPeriodicStream<float>(3100, 100.0, [&fFast](rovecomm::RoveCommPacket<float>& stPacket) { stPacket.vData.assign(1, ++fFast); return true; });
+    std::shared_ptr<rovecomm::RoveCommPeriodicStream> pSlow =
+        stScheduler.AddPeriodicStream<float>(3101, 50.0, [&fSlow](rovecomm::RoveCommPacket<float>& stPacket) { stPacket.vData.assign(1, ++fSlow); return true; });
+    std::shared_ptr<rovecomm::RoveCommPeriodicStream> pSkipping =
+        stScheduler.AddPeriodicStream<float>(3102,
+                                             50.0,
+                                             [&nCalls](rovecomm::RoveCommPacket<float>& stPacket)
+                                             {
+                                                 stPacket.vData.assign(1, 0.0f);
+                                                 return ++nCalls % 2 == 0;
+                                             });
+    ASSERT_NE(pFast, nullptr);
+    ASSERT_NE(pSlow, nullptr);
+    ASSERT_NE(pSkipping, nullptr);
+    EXPECT_EQ(pFast->GetPeriodTicks(), 10u);
+    EXPECT_EQ(pSlow->GetPeriodTicks(), 20u);
+    EXPECT_EQ(stScheduler.GetPeriodicStreamCount(), 3u);
+
+    stScheduler.Enable();
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    stScheduler.Disable();
+
+    // Roughly 30 fast and 15 slow samples, allowing for a slow test machine.
+    rovecomm::RoveCommPeriodicStatistics stFast = pFast->GetStatistics();
+    rovecomm::RoveCommPeriodicStatistics stSlow = pSlow->GetStatistics();
+    EXPECT_GE(stFast.unSent + stFast.unMissed, 25u);
+    EXPECT_LE(stFast.unSent, 31u);
+    EXPECT_GE(stSlow.unSent + stSlow.unMissed, 12u);
+    EXPECT_LE(stSlow.unSent, 16u);
+
+    // Every slow sample shares its batch with a fast one.
+    for (size_t siIter = 0; siIter < stSent.vDataIds.size(); ++siIter)
+    {
+        if (stSent.vDataIds[siIter] != 3101)
+        {
+            continue;
+        }
+
+        bool bShared = false;
+        for (size_t siOther = 0; siOther < stSent.vDataIds.size(); ++siOther)
+        {
+            bShared |= stSent.vDataIds[siOther] == 3100 && stSent.vBatches[siOther] == stSent.vBatches[siIter];
+        }
+        EXPECT_TRUE(bShared);
+    }
+
+    rovecomm::RoveCommPeriodicStatistics stSkipping = pSkipping->GetStatistics();
+    EXPECT_EQ(stSkipping.unSampled, stSkipping.unSent + stSkipping.unSkipped);
+    EXPECT_GE(stSkipping.unSkipped, stSkipping.unSent);
+
+    rovecomm::RoveCommSchedulerStatistics stStatistics = stScheduler.GetStatistics();
+    EXPECT_EQ(stStatistics.unBatches, stSent.siBatchCount);
+    EXPECT_EQ(stStatistics.unPacketsSent, stSent.vValues.size());
+    EXPECT_LT(stStatistics.unBatches, stFast.unSent + stSlow.unSent + stSkipping.unSent);
+
+    // A producer that leaves more elements than a packet can carry is skipped instead of sent truncated.
+    std::shared_ptr<rovecomm::RoveCommPeriodicStream> pOversized =
+        stScheduler.AddPeriodicStream<uint8_t>(3103,
+                                               100.0,
+                                               [](rovecomm::RoveCommPacket<uint8_t>& stPacket)
+                                               {
+                                                   stPacket.vData.assign(ROVECOMM_PACKET_MAX_DATA_COUNT + 1, 0);
+                                                   return true;
+                                               });
+    ASSERT_NE(pOversized, nullptr);
+    stScheduler.Enable();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    stScheduler.Disable();
+
+    rovecomm::RoveCommPeriodicStatistics stOversized = pOversized->GetStatistics();
+    EXPECT_GT(stOversized.unSampled, 0u);
+    EXPECT_EQ(stOversized.unSent, 0u);
+    EXPECT_EQ(stOversized.unSkipped, stOversized.unSampled);
+    for (uint16_t unDataId : stSent.vDataIds)
+    {
+        EXPECT_NE(unDataId, 3103);
+    }
+    EXPECT_TRUE(stScheduler.RemovePeriodicStream(pOversized));
+
+    // A removed stream is not sampled again.
+    EXPECT_TRUE(stScheduler.RemovePeriodicStream(pSlow));
+    EXPECT_FALSE(stScheduler.RemovePeriodicStream(pSlow));
+    EXPECT_EQ(stScheduler.GetPeriodicStreamCount(), 2u);
+}
@@ -0,0 +1,228 @@
+/******************************************************************************
+ * @brief Unit test for the change detection send filter in RoveComm.
+ *
+ * @file sendfilter.cc
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../src/RoveComm/RoveComm.h"
+#include "../../TestUtils.h"
+
+/// \cond
+#include <chrono>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Pack a packet and ask a send filter whether it would be sent to a
+ *        destination, recording it as sent there if it would.
+ *
+ * @tparam T - The data type of the elements in the packet.
+ * @param stFilter - The filter to check with.
+ * @param unDataId - The data id of the packet.
+ * @param vData - The packet's elements.
+ * @param tmNow - The time of the send.
+ * @param pDestination - The explicit address the packet is for, or nullptr for
+ *                       the subscribers.
+ * @param bSendSucceeds - Whether the send of a packet let through succeeds.
+ * @return true - The filter lets the packet through.
+ * @return false - The filter suppresses the packet.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+template<typename T>
+static bool CheckPacket(rovecomm::RoveCommSendFilter& stFilter,
+                        uint16_t unDataId,
+                        const std::vector<T>& vData,
+                        std::chrono::steady_clock::time_point tmNow,
+                        const sockaddr_in* pDestination = nullptr,
+                        bool bSendSucceeds              = true)
+{
+    rovecomm::RoveCommPacket<T> stPacket;
+    stPacket.unDataId    = unDataId;
+    stPacket.unDataCount = vData.size();
+    stPacket.eDataType   = rovecomm::GetDataTypeOf<T>();
+    stPacket.vData       = vData;
+
+    std::vector<uint8_t> vBytes(rovecomm::GetPackedSize(stPacket));
+    rovecomm::PackPacket(stPacket, vBytes.data(), vBytes.size());
+    bool bSend = stFilter.Check(vBytes.data(), vBytes.size(), pDestination, tmNow);
+    if (bSend && bSendSucceeds)
+    {
+        stFilter.Commit(vBytes.data(), vBytes.size(), pDestination, tmNow);
+    }
+    return bSend;
+}
+
+/******************************************************************************
+ * @brief Test that without a deadband only identical packets are suppressed,
+ *        that a keepalive goes out once the last send is old enough, and that
+ *        the saved bytes are counted.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommSendFilter, ExactMatch)
+{
+    std::chrono::steady_clock::time_point tmBase;
+    rovecomm::RoveCommSendFilter stFilter;
+    rovecomm::RoveCommDeadband stDeadband;
+    stDeadband.tmKeepalive = std::chrono::milliseconds(500);
+    stFilter.SetFilter(1213, stDeadband);
+    EXPECT_TRUE(stFilter.IsFiltered(1213));
+    EXPECT_FALSE(stFilter.IsFiltered(1214));
+
+    std::vector<uint8_t> vState = {1, 2, 3, 4};
+    EXPECT_TRUE(CheckPacket<uint8_t>(stFilter, 1213, vState, tmBase));
+    EXPECT_FALSE(CheckPacket<uint8_t>(stFilter, 1213, vState, tmBase + std::chrono::milliseconds(100)));
+    EXPECT_FALSE(CheckPacket<uint8_t>(stFilter, 1213, vState, tmBase + std::chrono::milliseconds(499)));
+    EXPECT_TRUE(CheckPacket<uint8_t>(stFilter, 1213, vState, tmBase + std::chrono::milliseconds(500)));
+    EXPECT_FALSE(CheckPacket<uint8_t>(stFilter, 1213, vState, tmBase + std::chrono::milliseconds(600)));
+
+    // Any byte, or the data count, changing is sent right away.
+    vState[3] = 5;
+    EXPECT_TRUE(CheckPacket<uint8_t>(stFilter, 1213, vState, tmBase + std::chrono::milliseconds(601)));
+    vState.push_back(0);
+    EXPECT_TRUE(CheckPacket<uint8_t>(stFilter, 1213, vState, tmBase + std::chrono::milliseconds(602)));
+
+    // Data ids without a filter always go through.
+    EXPECT_TRUE(CheckPacket<uint8_t>(stFilter, 1214, vState, tmBase));
+    EXPECT_TRUE(CheckPacket<uint8_t>(stFilter, 1214, vState, tmBase));
+
+    rovecomm::RoveCommSendFilterStatistics stStatistics = stFilter.GetStatistics(1213);
+    EXPECT_EQ(stStatistics.unChecked, 7u);
+    EXPECT_EQ(stStatistics.unSent, 4u);
+    EXPECT_EQ(stStatistics.unKeepalives, 1u);
+    EXPECT_EQ(stStatistics.unSuppressed, 3u);
+    EXPECT_EQ(stStatistics.unBytesSaved, 3u * 10u);
+    EXPECT_EQ(stStatistics.unBytesSent, 3u * 10u + 11u);
+    EXPECT_EQ(stFilter.GetStatistics().unSuppressed, 3u);
+
+    // Once cleared, the data id is sent every time again.
+    EXPECT_TRUE(stFilter.ClearFilter(1213));
+    EXPECT_FALSE(stFilter.ClearFilter(1213));
+    EXPECT_TRUE(CheckPacket<uint8_t>(stFilter, 1213, vState, tmBase + std::chrono::milliseconds(603)));
+    EXPECT_EQ(stFilter.GetStatistics(1213).unChecked, 7u);
+}
+
+/******************************************************************************
+ * @brief Test that float elements within an absolute deadband of the last sent
+ *        value are suppressed, and that a slow drift is still sent once it adds
+ *        up to more than the deadband.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommSendFilter, AbsoluteDeadband)
+{
+    std::chrono::steady_clock::time_point tmBase;
+    rovecomm::RoveCommSendFilter stFilter;
+    rovecomm::RoveCommDeadband stDeadband;
+    stDeadband.dAbsolute   = 0.1;
+    stDeadband.tmKeepalive = std::chrono::milliseconds(0);
+    stFilter.SetFilter(1215, stDeadband);
+
+    // A 12 V battery creeping up by 0.03 V per reading is only sent every fourth reading.
+    std::vector<bool> vSent;
+    for (int nIter = 0; nIter <= 8; ++nIter)
+    {
+        vSent.push_back(CheckPacket<float>(stFilter, 1215, {12.0f + 0.03f * nIter, 0.0f}, tmBase + std::chrono::seconds(nIter)));
+    }
+    EXPECT_EQ(vSent, std::vector<bool>({true, false, false, false, true, false, false, false, true}));
+
+    // Any one element leaving the deadband is enough, in either direction.
+    EXPECT_TRUE(CheckPacket<float>(stFilter, 1215, {12.24f, -0.2f}, tmBase));
+    EXPECT_FALSE(CheckPacket<float>(stFilter, 1215, {12.24f, -0.15f}, tmBase));
+
+    // No keepalive was configured, so nothing is forced after a long silence.
+    EXPECT_FALSE(CheckPacket<float>(stFilter, 1215, {12.24f, -0.2f}, tmBase + std::chrono::hours(1)));
+    EXPECT_EQ(stFilter.GetStatistics(1215).unKeepalives, 0u);
+}
+
+/******************************************************************************
+ * @brief Test that a relative deadband scales with the last sent value, and
+ *        that NaN always counts as a change.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommSendFilter, RelativeDeadband)
+{
+    std::chrono::steady_clock::time_point tmBase;
+    rovecomm::RoveCommSendFilter stFilter;
+    rovecomm::RoveCommDeadband stDeadband;
+    stDeadband.dRelative   = 0.01;
+    stDeadband.tmKeepalive = std::chrono::milliseconds(0);
+    stFilter.SetFilter(1216, stDeadband);
+
+    EXPECT_TRUE(CheckPacket<double>(stFilter, 1216, {1000.0}, tmBase));
+    EXPECT_FALSE(CheckPacket<double>(stFilter, 1216, {1009.0}, tmBase));
+    EXPECT_TRUE(CheckPacket<double>(stFilter, 1216, {1011.0}, tmBase));
+    EXPECT_TRUE(CheckPacket<double>(stFilter, 1216, {std::numeric_limits<double>::quiet_NaN()}, tmBase));
+    EXPECT_TRUE(CheckPacket<double>(stFilter, 1216, {1011.0}, tmBase));
+
+    // Integer payloads ignore the deadband and are compared exactly.
+    EXPECT_TRUE(CheckPacket<int32_t>(stFilter, 1216, {1000}, tmBase));
+    EXPECT_TRUE(CheckPacket<int32_t>(stFilter, 1216, {1001}, tmBase));
+    EXPECT_FALSE(CheckPacket<int32_t>(stFilter, 1216, {1001}, tmBase));
+}
+
+/******************************************************************************
+ * @brief Test that the subscribers and every explicit address are filtered on
+ *        their own, and that a packet whose send failed does not hold back the
+ *        same value on the next try.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommSendFilter, PerDestination)
+{
+    std::chrono::steady_clock::time_point tmBase;
+    rovecomm::RoveCommSendFilter stFilter;
+    rovecomm::RoveCommDeadband stDeadband;
+    stDeadband.tmKeepalive = std::chrono::milliseconds(0);
+    stFilter.SetFilter(1217, stDeadband);
+
+    sockaddr_in saFirst;
+    memset(&saFirst, 0, sizeof(saFirst));
+    saFirst.sin_family      = AF_INET;
+    saFirst.sin_port        = htons(11123);
+    saFirst.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sockaddr_in saSecond    = saFirst;
+    saSecond.sin_port       = htons(11124);
+
+    // The subscribers already having a value does not keep it from either address, or them from each other.
+    std::vector<uint16_t> vState = {7, 8};
+    EXPECT_TRUE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase));
+    EXPECT_TRUE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase, &saFirst));
+    EXPECT_TRUE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase, &saSecond));
+    EXPECT_FALSE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase));
+    EXPECT_FALSE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase, &saFirst));
+    EXPECT_FALSE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase, &saSecond));
+
+    // A change sent to one address is still news to the other.
+    vState[0] = 9;
+    EXPECT_TRUE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase, &saFirst));
+    EXPECT_TRUE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase, &saSecond));
+
+    // Until a send succeeds, the value keeps being let through.
+    vState[1] = 10;
+    EXPECT_TRUE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase, nullptr, false));
+    EXPECT_TRUE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase, nullptr, false));
+    EXPECT_TRUE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase));
+    EXPECT_FALSE(CheckPacket<uint16_t>(stFilter, 1217, vState, tmBase));
+
+    rovecomm::RoveCommSendFilterStatistics stStatistics = stFilter.GetStatistics(1217);
+    EXPECT_EQ(stStatistics.unChecked, 12u);
+    EXPECT_EQ(stStatistics.unSent, 6u);
+    EXPECT_EQ(stStatistics.unSuppressed, 4u);
+    EXPECT_EQ(stStatistics.unKeepalives, 0u);
+}
@@ -12,9 +12,20 @@
 #include "../../TestUtils.h"
 
 /// \cond
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <future>
 #include <gtest/gtest.h>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 /// \endcond
 
@@ -178,7 +189,7 @@ TEST(RoveCommTCP, CallbackInvoked)
             rovecomm::RoveCommData stData = rovecomm::PackPacket(stPacket);
 
             // Process the received packet (simulate callback invocation)
-            pRoveCommTCP_Node.CallProcessPacket(stData, rovecomm::tcp::vInt32Callbacks);
+            pRoveCommTCP_Node.CallProcessPacket<int32_t>(stData);
 
             // Check if the callback was invoked
             EXPECT_TRUE(bCallbackInvoked);
@@ -189,3 +200,658 @@ TEST(RoveCommTCP, CallbackInvoked)
         3,         // 3 total attempts
         30000);    // 30 second timeout (30,000 ms)
 }
+
+/******************************************************************************
+ * @brief Test that stream transfers over one connection are written into
+ *        buffer and file sinks, report their progress, and are refused when
+ *        they have no sink or do not fit it.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCP, StreamTransfers)
+{
+    rovecomm::RoveCommTCP pReceiverNode;
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12003));
+
+    // Three and a half chunks of a recognizable pattern.
+    std::vector<uint8_t> vSource(3 * 4096 + 2048);
+    for (size_t siIter = 0; siIter < vSource.size(); ++siIter)
+    {
+        vSource[siIter] = static_cast<uint8_t>(siIter * 7 + siIter / 251);
+    }
+
+    std::vector<uint8_t> vSink(vSource.size());
+    std::atomic<int> nReceiverProgress(0);
+    std::atomic<int> nReceiverComplete(0);
+    ASSERT_TRUE(pReceiverNode.SetTCPStreamBuffer(1300,
+                                                 vSink.data(),
+                                                 vSink.size(),
+                                                 [&](const rovecomm::RoveCommStreamStatus& stStatus)
+                                                 {
+                                                     if (stStatus.eState == rovecomm::eStreamInProgress)
+                                                     {
+                                                         nReceiverProgress++;
+                                                     }
+                                                     else if (stStatus.eState == rovecomm::eStreamComplete)
+                                                     {
+                                                         nReceiverComplete++;
+                                                     }
+                                                 }));
+    std::string szPath = "rovecomm_stream_test.bin";
+    ASSERT_TRUE(pReceiverNode.SetTCPStreamFile(1301, szPath));
+
+    rovecomm::RoveCommTCPStream stStream;
+    stStream.SetFlowControl(4096, 2);
+    ASSERT_TRUE(stStream.Connect("127.0.0.1", 12003));
+
+    // The sender hears of chunks as they are acknowledged, then of the whole transfer.
+    std::vector<uint64_t> vProgress;
+    bool bComplete = false;
+    EXPECT_TRUE(stStream.SendBuffer(1300,
+                                    vSource.data(),
+                                    vSource.size(),
+                                    [&](const rovecomm::RoveCommStreamStatus& stStatus)
+                                    {
+                                        if (stStatus.eState == rovecomm::eStreamInProgress)
+                                        {
+                                            vProgress.push_back(stStatus.unBytesDone);
+                                        }
+                                        bComplete = stStatus.eState == rovecomm::eStreamComplete && stStatus.unBytesDone == vSource.size();
+                                    }));
+    EXPECT_TRUE(bComplete);
+    ASSERT_FALSE(vProgress.empty());
+    for (size_t siIter = 0; siIter < vProgress.size(); ++siIter)
+    {
+        EXPECT_EQ(vProgress[siIter] % 4096, 0u);
+        EXPECT_TRUE(siIter == 0 || vProgress[siIter] > vProgress[siIter - 1]);
+    }
+    EXPECT_LT(vProgress.back(), vSource.size());
+    EXPECT_EQ(vSink, vSource);
+    EXPECT_EQ(nReceiverProgress, 3);
+    EXPECT_EQ(nReceiverComplete, 1);
+
+    // A file goes over the same connection into the file sink.
+    std::string szSourcePath = "rovecomm_stream_source.bin";
+    {
+        std::ofstream fsSource(szSourcePath, std::ios::binary);
+        fsSource.write(reinterpret_cast<const char*>(vSource.data()), vSource.size());
+    }
+    EXPECT_TRUE(stStream.SendFile(1301, szSourcePath.c_str()));
+    {
+        std::ifstream fsSink(szPath, std::ios::binary);
+        std::vector<uint8_t> vFile((std::istreambuf_iterator<char>(fsSink)), std::istreambuf_iterator<char>());
+        EXPECT_EQ(vFile, vSource);
+    }
+
+    // An empty transfer completes at once.
+    EXPECT_TRUE(stStream.SendBuffer(1300, nullptr, 0));
+    EXPECT_TRUE(stStream.IsConnected());
+
+    // A transfer larger than its buffer is refused, and the connection is closed.
+    std::vector<uint8_t> vTooLarge(vSink.size() + 1);
+    EXPECT_FALSE(stStream.SendBuffer(1300, vTooLarge.data(), vTooLarge.size()));
+    EXPECT_FALSE(stStream.IsConnected());
+
+    // So is a transfer with no sink.
+    ASSERT_TRUE(stStream.Connect("127.0.0.1", 12003));
+    EXPECT_FALSE(stStream.SendBuffer(1302, vSource.data(), vSource.size()));
+
+    rovecomm::RoveCommStreamStatistics stStatistics = pReceiverNode.GetTCPStreamStatistics();
+    EXPECT_EQ(stStatistics.unConnectionsAccepted, 2u);
+    EXPECT_EQ(stStatistics.unTransfersCompleted, 3u);
+    EXPECT_EQ(stStatistics.unTransfersRejected, 2u);
+    EXPECT_EQ(stStatistics.unBytesReceived, 2 * vSource.size());
+
+    pReceiverNode.CloseTCPSocket();
+    std::remove(szPath.c_str());
+    std::remove(szSourcePath.c_str());
+}
+
+/******************************************************************************
+ * @brief Test that a stream sender which stops partway through a header or a
+ *        transfer, or disconnects mid-payload, has its transfer failed, its
+ *        connection closed and its sink freed for the next transfer, and that
+ *        a busy sink cannot be replaced.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCP, StreamStalls)
+{
+    rovecomm::RoveCommTCP pReceiverNode;
+    pReceiverNode.SetTCPStreamTimeouts(std::chrono::milliseconds(200));
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12011));
+
+    std::vector<uint8_t> vSink(8192);
+    std::atomic<int> nFailed(0);
+    std::atomic<uint64_t> unFailedAt(0);
+    rovecomm::RoveCommStreamCallback fnCallback = [&](const rovecomm::RoveCommStreamStatus& stStatus)
+    {
+        if (stStatus.eState == rovecomm::eStreamFailed)
+        {
+            unFailedAt = stStatus.unBytesDone;
+            nFailed++;
+        }
+    };
+    ASSERT_TRUE(pReceiverNode.SetTCPStreamBuffer(1303, vSink.data(), vSink.size(), fnCallback));
+
+    // Open a raw stream connection and send the first bytes of a transfer of the whole sink.
+    auto fnStartTransfer = [&](size_t siHeaderBytes, size_t siPayloadBytes)
+    {
+        int nSocket = socket(AF_INET, SOCK_STREAM, 0);
+        struct sockaddr_in saAddress;
+        memset(&saAddress, 0, sizeof(saAddress));
+        saAddress.sin_family = AF_INET;
+        saAddress.sin_port   = htons(12011);
+        inet_pton(AF_INET, "127.0.0.1", &saAddress.sin_addr);
+        EXPECT_EQ(connect(nSocket, (struct sockaddr*) &saAddress, sizeof(saAddress)), 0);
+        struct timeval tvTimeout = {2, 0};
+        setsockopt(nSocket, SOL_SOCKET, SO_RCVTIMEO, &tvTimeout, sizeof(tvTimeout));
+
+        rovecomm::RoveCommStreamHeader stHeader;
+        stHeader.unDataId     = 1303;
+        stHeader.unTransferId = 1;
+        stHeader.unTotalSize  = vSink.size();
+        stHeader.unChunkSize  = 4096;
+        uint8_t aHeader[ROVECOMM_STREAM_HEADER_SIZE];
+        rovecomm::PackStreamHeader(stHeader, aHeader);
+        EXPECT_EQ(send(nSocket, aHeader, siHeaderBytes, MSG_NOSIGNAL), static_cast<ssize_t>(siHeaderBytes));
+        if (siHeaderBytes == ROVECOMM_STREAM_HEADER_SIZE)
+        {
+            uint64_t unAck = 1;
+            EXPECT_EQ(recv(nSocket, &unAck, sizeof(unAck), MSG_WAITALL), static_cast<ssize_t>(sizeof(unAck)));
+            EXPECT_EQ(unAck, 0u);
+
+            std::vector<uint8_t> vPayload(siPayloadBytes, 0x5A);
+            EXPECT_EQ(send(nSocket, vPayload.data(), vPayload.size(), MSG_NOSIGNAL), static_cast<ssize_t>(vPayload.size()));
+        }
+        return nSocket;
+    };
+    auto fnWaitForFailures = [&](int nFailures)
+    {
+        std::chrono::steady_clock::time_point tmDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (nFailed < nFailures && std::chrono::steady_clock::now() < tmDeadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return nFailed == nFailures;
+    };
+
+    // A sender that stops mid-payload is closed once the stall timeout passes.
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    int nSocket                                   = fnStartTransfer(ROVECOMM_STREAM_HEADER_SIZE, 1000);
+
+    // The sink cannot be replaced while the transfer into it is in progress.
+    std::vector<uint8_t> vOtherSink(vSink.size());
+    EXPECT_FALSE(pReceiverNode.SetTCPStreamBuffer(1303, vOtherSink.data(), vOtherSink.size(), fnCallback));
+    EXPECT_FALSE(pReceiverNode.SetTCPStreamFile(1303, "rovecomm_stream_stall.bin", fnCallback));
+
+    uint8_t unByte;
+    EXPECT_EQ(recv(nSocket, &unByte, 1, 0), 0);
+    EXPECT_GE(std::chrono::steady_clock::now() - tmStart, std::chrono::milliseconds(200));
+    close(nSocket);
+    EXPECT_TRUE(fnWaitForFailures(1));
+    EXPECT_EQ(unFailedAt, 1000u);
+    EXPECT_TRUE(pReceiverNode.SetTCPStreamBuffer(1303, vSink.data(), vSink.size(), fnCallback));
+
+    // A sender that disconnects mid-payload fails at once.
+    nSocket = fnStartTransfer(ROVECOMM_STREAM_HEADER_SIZE, 3000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    close(nSocket);
+    EXPECT_TRUE(fnWaitForFailures(2));
+    EXPECT_EQ(unFailedAt, 3000u);
+
+    // A sender that never finishes its header is closed as well, with no transfer to fail.
+    nSocket = fnStartTransfer(5, 0);
+    EXPECT_EQ(recv(nSocket, &unByte, 1, 0), 0);
+    close(nSocket);
+    EXPECT_EQ(nFailed, 2);
+
+    // The sink was freed every time, so a complete transfer still goes through.
+    std::vector<uint8_t> vSource(vSink.size(), 0xA5);
+    rovecomm::RoveCommTCPStream stStream;
+    ASSERT_TRUE(stStream.Connect("127.0.0.1", 12011));
+    EXPECT_TRUE(stStream.SendBuffer(1303, vSource.data(), vSource.size()));
+    EXPECT_EQ(vSink, vSource);
+
+    rovecomm::RoveCommStreamStatistics stStatistics = pReceiverNode.GetTCPStreamStatistics();
+    EXPECT_EQ(stStatistics.unConnectionsTimedOut, 2u);
+    EXPECT_EQ(stStatistics.unTransfersFailed, 2u);
+    EXPECT_EQ(stStatistics.unTransfersCompleted, 1u);
+
+    pReceiverNode.CloseTCPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that SendTCPPacket() reuses one connection per destination,
+ *        replaces a connection the receiver has closed, and backs off from a
+ *        destination it cannot connect to.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCP, PooledConnections)
+{
+    std::atomic<int> nReceived(0);
+    std::atomic<size_t> siLargestCount(0);
+    std::function<void(const rovecomm::RoveCommPacket<uint32_t>&)> fnCallback = [&](const rovecomm::RoveCommPacket<uint32_t>& stPacket)
+    {
+        EXPECT_EQ(stPacket.vData.back(), stPacket.unDataCount - 1u);
+        siLargestCount = std::max<size_t>(siLargestCount, stPacket.unDataCount);
+        nReceived++;
+    };
+    auto fnWaitForPackets = [&](int nPackets)
+    {
+        std::chrono::steady_clock::time_point tmDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (nReceived < nPackets && std::chrono::steady_clock::now() < tmDeadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return nReceived == nPackets;
+    };
+
+    rovecomm::RoveCommTCP pReceiverNode;
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12004));
+    pReceiverNode.AddTCPCallback<uint32_t>(fnCallback, 1320);
+
+    // The node only sends, so it never opens a listening socket.
+    rovecomm::RoveCommTCP pSenderNode;
+    pSenderNode.SetTCPReconnectBackoff(std::chrono::milliseconds(1000), std::chrono::milliseconds(1000));
+
+    // Three packets share one connection, including one too large for the receiver's initial buffer.
+    rovecomm::RoveCommPacket<uint32_t> stPacket;
+    stPacket.unDataId  = 1320;
+    stPacket.eDataType = manifest::DataTypes::UINT32_T;
+    for (uint16_t unDataCount : {3, 20000, 1})
+    {
+        stPacket.unDataCount = unDataCount;
+        stPacket.vData.resize(unDataCount);
+        for (uint32_t unIter = 0; unIter < unDataCount; ++unIter)
+        {
+            stPacket.vData[unIter] = unIter;
+        }
+        EXPECT_EQ(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12004), static_cast<ssize_t>(rovecomm::GetPackedSize(stPacket)));
+    }
+    EXPECT_TRUE(fnWaitForPackets(3));
+    EXPECT_EQ(siLargestCount, 20000u);
+
+    rovecomm::RoveCommConnectionPoolStatistics stStatistics = pSenderNode.GetTCPConnectionPoolStatistics();
+    EXPECT_EQ(stStatistics.unConnects, 1u);
+    EXPECT_EQ(stStatistics.unReuses, 2u);
+    EXPECT_EQ(stStatistics.siOpenConnections, 1u);
+
+    // A restarted receiver closed the pooled connection, so the next send opens a new one.
+    pReceiverNode.CloseTCPSocket();
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12004));
+    EXPECT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12004), 0);
+    EXPECT_TRUE(fnWaitForPackets(4));
+
+    stStatistics = pSenderNode.GetTCPConnectionPoolStatistics();
+    EXPECT_EQ(stStatistics.unConnects, 2u);
+    EXPECT_EQ(stStatistics.unStaleConnections, 1u);
+    EXPECT_EQ(stStatistics.unConnectFailures, 0u);
+
+    // A destination that refuses the connection is not tried again until the backoff has passed.
+    EXPECT_EQ(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12005), -1);
+    EXPECT_EQ(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12005), -1);
+
+    stStatistics = pSenderNode.GetTCPConnectionPoolStatistics();
+    EXPECT_EQ(stStatistics.unConnectFailures, 1u);
+    EXPECT_EQ(stStatistics.unBackoffRejects, 1u);
+    EXPECT_EQ(stStatistics.siOpenConnections, 1u);
+
+    // Without pooling every packet still arrives, each over its own connection.
+    pSenderNode.SetTCPConnectionPooling(false);
+    EXPECT_EQ(pSenderNode.GetTCPConnectionPoolStatistics().siOpenConnections, 0u);
+    EXPECT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12004), 0);
+    EXPECT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12004), 0);
+    EXPECT_TRUE(fnWaitForPackets(6));
+    EXPECT_EQ(pSenderNode.GetTCPConnectionPoolStatistics().unConnects, 2u);
+
+    pReceiverNode.CloseTCPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that a node serves many client connections at once, keeps each
+ *        open for all of its packets, and forgets each when its sender closes it.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCP, ConcurrentClients)
+{
+    const int nSenders = 20;
+    const int nPackets = 10;
+
+    std::array<std::atomic<int>, nSenders> aReceived{};
+    rovecomm::RoveCommTCP pReceiverNode;
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12006));
+    pReceiverNode.AddTCPCallback<int16_t>(
+        [&](const rovecomm::RoveCommPacket<int16_t>& stPacket)
+        {
+            ASSERT_LT(stPacket.vData[0], nSenders);
+            aReceived[stPacket.vData[0]]++;
+        },
+        1322);
+    auto fnWaitForStatistics = [&](std::function<bool(const rovecomm::RoveCommTCPServerStatistics&)> fnDone)
+    {
+        std::chrono::steady_clock::time_point tmDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (!fnDone(pReceiverNode.GetTCPServerStatistics()) && std::chrono::steady_clock::now() < tmDeadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return fnDone(pReceiverNode.GetTCPServerStatistics());
+    };
+
+    // Every sender connects at once and keeps its connection open.
+    {
+        std::vector<std::unique_ptr<rovecomm::RoveCommTCP>> vSenderNodes;
+        std::vector<std::thread> vSenderThreads;
+        for (int nSender = 0; nSender < nSenders; ++nSender)
+        {
+            vSenderNodes.emplace_back(new rovecomm::RoveCommTCP());
+            vSenderThreads.emplace_back(
+                [&, nSender]()
+                {
+                    rovecomm::RoveCommPacket<int16_t> stPacket;
+                    stPacket.unDataId    = 1322;
+                    stPacket.unDataCount = 2;
+                    stPacket.eDataType   = manifest::DataTypes::INT16_T;
+                    stPacket.vData       = {static_cast<int16_t>(nSender), 0};
+                    for (int nIter = 0; nIter < nPackets; ++nIter)
+                    {
+                        EXPECT_GT(vSenderNodes[nSender]->SendTCPPacket(stPacket, "127.0.0.1", 12006), 0);
+                    }
+                });
+        }
+        for (std::thread& thSender : vSenderThreads)
+        {
+            thSender.join();
+        }
+
+        EXPECT_TRUE(fnWaitForStatistics([&](const rovecomm::RoveCommTCPServerStatistics& stStatistics)
+                                        { return stStatistics.unPacketsReceived == static_cast<uint64_t>(nSenders * nPackets); }));
+        for (int nSender = 0; nSender < nSenders; ++nSender)
+        {
+            EXPECT_EQ(aReceived[nSender], nPackets);
+        }
+
+        rovecomm::RoveCommTCPServerStatistics stStatistics = pReceiverNode.GetTCPServerStatistics();
+        EXPECT_EQ(stStatistics.unConnectionsAccepted, static_cast<uint64_t>(nSenders));
+        EXPECT_EQ(stStatistics.siOpenConnections, static_cast<size_t>(nSenders));
+        EXPECT_EQ(stStatistics.unConnectionsClosed, 0u);
+    }
+
+    // Destroying the senders closes their connections.
+    EXPECT_TRUE(fnWaitForStatistics([&](const rovecomm::RoveCommTCPServerStatistics& stStatistics) { return stStatistics.siOpenConnections == 0; }));
+    EXPECT_EQ(pReceiverNode.GetTCPServerStatistics().unConnectionsClosed, static_cast<uint64_t>(nSenders));
+
+    pReceiverNode.CloseTCPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that a node closes a client that sends a malformed or oversized
+ *        packet header, without disturbing its other clients.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCP, RejectsBadFrames)
+{
+    std::atomic<int> nReceived(0);
+    rovecomm::RoveCommTCP pReceiverNode;
+    pReceiverNode.SetTCPMaxFrameSize(1024);
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12007));
+    pReceiverNode.AddTCPCallback<uint8_t>([&](const rovecomm::RoveCommPacket<uint8_t>&) { nReceived++; }, 1324);
+
+    // Open a raw connection, send bytes over it, and wait for the node to close it.
+    auto fnSendAndWaitForClose = [](const std::vector<uint8_t>& vBytes)
+    {
+        int nSocket = socket(AF_INET, SOCK_STREAM, 0);
+        struct sockaddr_in saAddress;
+        memset(&saAddress, 0, sizeof(saAddress));
+        saAddress.sin_family = AF_INET;
+        saAddress.sin_port   = htons(12007);
+        inet_pton(AF_INET, "127.0.0.1", &saAddress.sin_addr);
+        EXPECT_EQ(connect(nSocket, (struct sockaddr*) &saAddress, sizeof(saAddress)), 0);
+        EXPECT_EQ(send(nSocket, vBytes.data(), vBytes.size(), MSG_NOSIGNAL), static_cast<ssize_t>(vBytes.size()));
+
+        struct timeval tvTimeout = {2, 0};
+        setsockopt(nSocket, SOL_SOCKET, SO_RCVTIMEO, &tvTimeout, sizeof(tvTimeout));
+        uint8_t unByte;
+        ssize_t siReceived = recv(nSocket, &unByte, 1, 0);
+        close(nSocket);
+        return siReceived == 0;
+    };
+
+    // A sender that keeps its connection open throughout.
+    rovecomm::RoveCommTCP pSenderNode;
+    rovecomm::RoveCommPacket<uint8_t> stPacket;
+    stPacket.unDataId    = 1324;
+    stPacket.unDataCount = 4;
+    stPacket.eDataType   = manifest::DataTypes::UINT8_T;
+    stPacket.vData       = {1, 2, 3, 4};
+    EXPECT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12007), 0);
+
+    // A valid packet followed by a header with the wrong version: the packet is handled, then the client is closed.
+    std::vector<uint8_t> vBytes(rovecomm::GetPackedSize(stPacket));
+    rovecomm::PackPacket(stPacket, vBytes.data(), vBytes.size());
+    vBytes.insert(vBytes.end(), {0x7F, 0x05, 0x14, 0x00, 0x01, 0x00});
+    EXPECT_TRUE(fnSendAndWaitForClose(vBytes));
+
+    // A header announcing more than the node accepts is closed before any of its data is sent.
+    EXPECT_TRUE(fnSendAndWaitForClose({ROVECOMM_VERSION, 0x05, 0x14, 0x10, 0x00, static_cast<uint8_t>(manifest::DataTypes::UINT8_T)}));
+
+    EXPECT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12007), 0);
+    std::chrono::steady_clock::time_point tmDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (nReceived < 3 && std::chrono::steady_clock::now() < tmDeadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(nReceived, 3);
+
+    rovecomm::RoveCommTCPServerStatistics stStatistics = pReceiverNode.GetTCPServerStatistics();
+    EXPECT_EQ(stStatistics.unMalformedFrames, 1u);
+    EXPECT_EQ(stStatistics.unOversizedFrames, 1u);
+    EXPECT_EQ(stStatistics.unConnectionsClosed, 2u);
+    EXPECT_EQ(stStatistics.siOpenConnections, 1u);
+    EXPECT_EQ(pSenderNode.GetTCPConnectionPoolStatistics().unConnects, 1u);
+
+    pReceiverNode.CloseTCPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that queued sends return at once and report how they ended, that
+ *        a destination over its high-water mark refuses or holds new sends, and
+ *        that packets a stalled destination never takes time out.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCP, AsyncSends)
+{
+    std::atomic<int> nReceived(0);
+    rovecomm::RoveCommTCP pReceiverNode;
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12008));
+    pReceiverNode.AddTCPCallback<uint8_t>([&](const rovecomm::RoveCommPacket<uint8_t>&) { nReceived++; }, 1325);
+
+    rovecomm::RoveCommTCP pSenderNode;
+    pSenderNode.SetTCPReconnectBackoff(std::chrono::milliseconds(1000), std::chrono::milliseconds(1000));
+
+    rovecomm::RoveCommPacket<uint8_t> stPacket;
+    stPacket.unDataId    = 1325;
+    stPacket.unDataCount = 1000;
+    stPacket.eDataType   = manifest::DataTypes::UINT8_T;
+    stPacket.vData.assign(1000, 7);
+    ssize_t siPacketSize = static_cast<ssize_t>(rovecomm::GetPackedSize(stPacket));
+
+    // Every queued packet arrives, and its callback is told it was written in full.
+    std::atomic<int> nWritten(0);
+    for (int nIter = 0; nIter < 50; ++nIter)
+    {
+        EXPECT_TRUE(pSenderNode.SendTCPPacketAsync(stPacket, "127.0.0.1", 12008, [&](ssize_t siResult) { nWritten += siResult == siPacketSize; }));
+    }
+    std::future<ssize_t> stFuture = pSenderNode.SendTCPPacketFuture(stPacket, "127.0.0.1", 12008);
+    ASSERT_EQ(stFuture.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+    EXPECT_EQ(stFuture.get(), siPacketSize);
+
+    std::chrono::steady_clock::time_point tmDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (nReceived < 51 && std::chrono::steady_clock::now() < tmDeadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(nReceived, 51);
+    EXPECT_EQ(nWritten, 50);
+
+    rovecomm::RoveCommSendQueueStatistics stStatistics = pSenderNode.GetTCPSendQueueStatistics();
+    EXPECT_EQ(stStatistics.unQueued, 51u);
+    EXPECT_EQ(stStatistics.unSent, 51u);
+    EXPECT_EQ(stStatistics.unConnects, 1u);
+    EXPECT_EQ(stStatistics.siQueuedBytes, 0u);
+    EXPECT_GE(stStatistics.siMaxQueuedBytes, static_cast<size_t>(siPacketSize));
+
+    // Nothing listens on this port, so its packets wait out the reconnect backoff in the write buffer.
+    pSenderNode.SetTCPSendQueueLimits(2 * siPacketSize, rovecomm::eBackpressureReject, std::chrono::milliseconds(200));
+    std::atomic<int> nFailed(0);
+    auto fnCountFailure = [&](ssize_t siResult) { nFailed += siResult == -1; };
+    EXPECT_TRUE(pSenderNode.SendTCPPacketAsync(stPacket, "127.0.0.1", 12009, fnCountFailure));
+    EXPECT_TRUE(pSenderNode.SendTCPPacketAsync(stPacket, "127.0.0.1", 12009, fnCountFailure));
+    EXPECT_FALSE(pSenderNode.SendTCPPacketAsync(stPacket, "127.0.0.1", 12009, fnCountFailure));
+    EXPECT_EQ(nFailed, 1);
+    EXPECT_EQ(pSenderNode.GetTCPSendQueueStatistics().unRejected, 1u);
+
+    // A blocking send waits for room, which is made when the stalled packets ahead of it time out.
+    pSenderNode.SetTCPSendQueueLimits(2 * siPacketSize, rovecomm::eBackpressureBlock, std::chrono::milliseconds(200));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+    EXPECT_TRUE(pSenderNode.SendTCPPacketAsync(stPacket, "127.0.0.1", 12009, fnCountFailure));
+    EXPECT_GE(std::chrono::steady_clock::now() - tmStart, std::chrono::milliseconds(100));
+    EXPECT_EQ(nFailed, 3);
+    EXPECT_EQ(pSenderNode.GetTCPSendQueueStatistics().unBlockedWaits, 1u);
+
+    // The packet it queued times out in turn, since the backoff outlasts the send timeout.
+    tmDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (nFailed < 4 && std::chrono::steady_clock::now() < tmDeadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(nFailed, 4);
+
+    stStatistics = pSenderNode.GetTCPSendQueueStatistics();
+    EXPECT_EQ(stStatistics.unTimedOut, 3u);
+    EXPECT_EQ(stStatistics.unRejected, 1u);
+    EXPECT_EQ(stStatistics.unConnectFailures, 1u);
+    EXPECT_EQ(stStatistics.siQueuedBytes, 0u);
+
+    // The receiver is still reachable once the stalled destination has failed.
+    EXPECT_EQ(pSenderNode.SendTCPPacketFuture(stPacket, "127.0.0.1", 12008).get(), siPacketSize);
+
+    pReceiverNode.CloseTCPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that batched sends are held in the corked connection until they
+ *        are flushed, and that latency-critical data ids are recorded.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCP, SendModes)
+{
+    std::atomic<int> nReceived(0);
+    rovecomm::RoveCommTCP pReceiverNode;
+    ASSERT_TRUE(pReceiverNode.InitTCPSocket("127.0.0.1", 12010));
+    pReceiverNode.AddTCPCallback<int16_t>([&](const rovecomm::RoveCommPacket<int16_t>&) { nReceived++; }, 1327);
+    auto fnWaitForPackets = [&](int nPackets)
+    {
+        std::chrono::steady_clock::time_point tmDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (nReceived < nPackets && std::chrono::steady_clock::now() < tmDeadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return nReceived == nPackets;
+    };
+
+    rovecomm::RoveCommTCP pSenderNode;
+    EXPECT_FALSE(pSenderNode.GetTCPNoDelay(1327));
+    pSenderNode.SetTCPNoDelay(1327, true);
+    EXPECT_TRUE(pSenderNode.GetTCPNoDelay(1327));
+    EXPECT_FALSE(pSenderNode.FlushTCP("127.0.0.1", 12010));
+
+    rovecomm::RoveCommPacket<int16_t> stPacket;
+    stPacket.unDataId    = 1327;
+    stPacket.unDataCount = 2;
+    stPacket.eDataType   = manifest::DataTypes::INT16_T;
+    stPacket.vData       = {-1, 1};
+    EXPECT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12010), 0);
+    EXPECT_TRUE(fnWaitForPackets(1));
+
+    // A batch smaller than a segment stays in the corked connection until it is flushed.
+    for (int nIter = 0; nIter < 20; ++nIter)
+    {
+        EXPECT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12010, rovecomm::eSendBatched), 0);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(nReceived, 1);
+    EXPECT_TRUE(pSenderNode.FlushTCP("127.0.0.1", 12010));
+    EXPECT_TRUE(fnWaitForPackets(21));
+
+    // A send that is not batched pushes the batch ahead of it.
+    EXPECT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12010, rovecomm::eSendBatched), 0);
+    EXPECT_GT(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12010, rovecomm::eSendNoDelay), 0);
+    EXPECT_TRUE(fnWaitForPackets(23));
+
+    rovecomm::RoveCommConnectionPoolStatistics stStatistics = pSenderNode.GetTCPConnectionPoolStatistics();
+    EXPECT_EQ(stStatistics.unBatchedSends, 21u);
+    EXPECT_EQ(stStatistics.unFlushes, 2u);
+    EXPECT_EQ(stStatistics.unConnects, 1u);
+
+    pReceiverNode.CloseTCPSocket();
+}
+
+/******************************************************************************
+ * @brief Test that flushing and closing the pooled connections does not
+ *        deadlock against a sender that keeps failing to connect to a refused
+ *        port.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommTCP, CloseAllDuringFailedConnects)
+{
+    rovecomm::RoveCommTCP pSenderNode;
+    pSenderNode.SetTCPReconnectBackoff(std::chrono::milliseconds(0), std::chrono::milliseconds(0));
+
+    rovecomm::RoveCommPacket<uint8_t> stPacket;
+    stPacket.unDataId    = 1330;
+    stPacket.unDataCount = 1;
+    stPacket.eDataType   = manifest::DataTypes::UINT8_T;
+    stPacket.vData       = {1};
+
+    // Every send reaches connect() and fails, taking the backoff path.
+    std::atomic<bool> bStop(false);
+    std::atomic<int> nSends(0);
+    std::thread thSender(
+        [&]()
+        {
+            while (!bStop)
+            {
+                EXPECT_EQ(pSenderNode.SendTCPPacket(stPacket, "127.0.0.1", 12005), -1);
+                nSends++;
+            }
+        });
+
+    std::chrono::steady_clock::time_point tmDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+    while (std::chrono::steady_clock::now() < tmDeadline)
+    {
+        pSenderNode.FlushTCP();
+        pSenderNode.SetTCPConnectionPooling(false);
+        pSenderNode.SetTCPConnectionPooling(true);
+    }
+    bStop = true;
+    thSender.join();
+
+    EXPECT_GT(nSends, 0);
+    EXPECT_GT(pSenderNode.GetTCPConnectionPoolStatistics().unConnectFailures, 0u);
+}
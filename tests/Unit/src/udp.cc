@@ -18,6 +18,7 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <thread>
+#include <vector>
 
 /// \endcond
 
@@ -202,7 +203,7 @@ TEST(RoveCommUDP, CallbackInvoked)
             inet_pton(AF_INET, "127.0.0.1", &saUDPClientAddr.sin_addr);
 
             // Process the received packet (simulate callback invocation)
-            pRoveCommUDP_Node.CallProcessPacket<int32_t>(stData, rovecomm::udp::vInt32Callbacks, saUDPClientAddr);
+            pRoveCommUDP_Node.CallProcessPacket<int32_t>(stData, saUDPClientAddr);
 
             // Check if the callback was invoked
             EXPECT_TRUE(bCallbackInvoked);
@@ -213,3 +214,87 @@ TEST(RoveCommUDP, CallbackInvoked)
         3,         // 3 total attempts
         30000);    // 30 second timeout (30,000 ms)
 }
+
+/******************************************************************************
+ * @brief Test that callbacks belong to the node they were added to. Two nodes
+ *        register callbacks for the same data id, and each dispatch only
+ *        reaches the callback of the node that received the packet.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, CallbacksArePerNode)
+{
+    rovecomm::RoveCommUDP pRoverNode;
+    rovecomm::RoveCommUDP pBaseStationNode;
+
+    int nRoverCalls       = 0;
+    int nBaseStationCalls = 0;
+    pRoverNode.AddUDPCallback<uint16_t>([&](const rovecomm::RoveCommPacket<uint16_t>&, const sockaddr_in&) { nRoverCalls++; }, 1101);
+    pBaseStationNode.AddUDPCallback<uint16_t>([&](const rovecomm::RoveCommPacket<uint16_t>&, const sockaddr_in&) { nBaseStationCalls++; }, 1101);
+
+    rovecomm::RoveCommPacket<uint16_t> stPacket;
+    stPacket.unDataId             = 1101;
+    stPacket.unDataCount          = 1;
+    stPacket.eDataType            = manifest::DataTypes::UINT16_T;
+    stPacket.vData                = {7};
+    rovecomm::RoveCommData stData = rovecomm::PackPacket(stPacket);
+
+    struct sockaddr_in saUDPClientAddr;
+    memset(&saUDPClientAddr, 0, sizeof(saUDPClientAddr));
+    saUDPClientAddr.sin_family = AF_INET;
+
+    pRoverNode.CallProcessPacket<uint16_t>(stData, saUDPClientAddr);
+    EXPECT_EQ(nRoverCalls, 1);
+    EXPECT_EQ(nBaseStationCalls, 0);
+
+    pBaseStationNode.CallProcessPacket<uint16_t>(stData, saUDPClientAddr);
+    pBaseStationNode.CallProcessPacket<uint16_t>(stData, saUDPClientAddr);
+    EXPECT_EQ(nRoverCalls, 1);
+    EXPECT_EQ(nBaseStationCalls, 2);
+}
+
+/******************************************************************************
+ * @brief Test that the handle returned when adding a callback removes only
+ *        that registration. Both callbacks wrap the same lambda type, so
+ *        removing by target type would remove both.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-17
+ ******************************************************************************/
+TEST(RoveCommUDP, HandleRemovesOnlyItsCallback)
+{
+    rovecomm::RoveCommUDP pNode;
+
+    std::vector<int> vCalls(3, 0);
+    auto fnMakeCallback = [&](int nIndex) { return [&vCalls, nIndex](const rovecomm::RoveCommPacket<uint16_t>&, const sockaddr_in&) { vCalls[nIndex]++; }; };
+    rovecomm::RoveCommCallbackHandle stFirst = pNode.AddUDPCallback<uint16_t>(fnMakeCallback(0), 1102);
+    pNode.AddUDPCallback<uint16_t>(fnMakeCallback(1), 1102);
+
+    rovecomm::RoveCommPacket<uint16_t> stPacket;
+    stPacket.unDataId             = 1102;
+    stPacket.unDataCount          = 1;
+    stPacket.eDataType            = manifest::DataTypes::UINT16_T;
+    stPacket.vData                = {7};
+    rovecomm::RoveCommData stData = rovecomm::PackPacket(stPacket);
+
+    struct sockaddr_in saUDPClientAddr;
+    memset(&saUDPClientAddr, 0, sizeof(saUDPClientAddr));
+    saUDPClientAddr.sin_family = AF_INET;
+
+    {
+        // A scoped callback only runs while it is in scope.
+        rovecomm::RoveCommScopedCallback stScoped(pNode.AddUDPCallback<uint16_t>(fnMakeCallback(2), 1102));
+        pNode.CallProcessPacket<uint16_t>(stData, saUDPClientAddr);
+        EXPECT_EQ(vCalls, std::vector<int>({1, 1, 1}));
+    }
+    pNode.CallProcessPacket<uint16_t>(stData, saUDPClientAddr);
+    EXPECT_EQ(vCalls, std::vector<int>({2, 2, 1}));
+
+    // Unsubscribing the first handle leaves the second callback registered.
+    EXPECT_EQ(stFirst.GetDataId(), 1102);
+    EXPECT_TRUE(stFirst.Unsubscribe());
+    EXPECT_FALSE(stFirst.Unsubscribe());
+    pNode.CallProcessPacket<uint16_t>(stData, saUDPClientAddr);
+    EXPECT_EQ(vCalls, std::vector<int>({2, 3, 1}));
+}